@@ -0,0 +1,144 @@
+//
+//  CSImageLoadBenchmark.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/File.h>
+#include <ChilliSource/Core/Image.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Core/State.h>
+
+#include <vector>
+
+namespace
+{
+    const u32 k_imageSize = 1024;
+    const std::string k_imageDirectory = "CSImageLoadBenchmark/";
+#ifdef CS_BENCHMARK_LZ4
+    const std::string k_imageFilePath = k_imageDirectory + "ImageLZ4.csimage";
+#else
+    const std::string k_imageFilePath = k_imageDirectory + "ImageZlib.csimage";
+#endif
+    
+    //------------------------------------------------------------------------------
+    /// A benchmark which measures the cost of loading a compressed 1024x1024
+    /// RGBA8888 csimage through the csimage provider, which streams the compressed
+    /// data from file into the image buffer. An image is written to the cache on
+    /// start up, then loaded and released every frame. By default the image is
+    /// zlib compressed; when built with CS_BENCHMARK_LZ4 it is LZ4 compressed.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class CSImageLoadBenchmarkState final : public CSCore::State
+    {
+    private:
+        //------------------------------------------------------------------------------
+        /// Writes the image. It contains smooth gradients, flat areas and some
+        /// noise, so it compresses roughly as well as typical UI art.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        void OnInit() override
+        {
+            std::vector<u8> imageData(k_imageSize * k_imageSize * 4);
+            
+            u32 seed = 12345;
+            for (u32 y = 0; y < k_imageSize; ++y)
+            {
+                for (u32 x = 0; x < k_imageSize; ++x)
+                {
+                    seed = seed * 1664525 + 1013904223;
+                    
+                    u8* pixel = imageData.data() + (y * k_imageSize + x) * 4;
+                    const bool isFlat = ((x / 128 + y / 128) % 2 == 0);
+                    pixel[0] = isFlat ? 200 : u8(x / 4);
+                    pixel[1] = isFlat ? 80 : u8(y / 4);
+                    pixel[2] = isFlat ? 40 : u8((seed >> 24) & 0x0F);
+                    pixel[3] = isFlat ? 255 : u8(255 - x / 8);
+                }
+            }
+            
+            CSCore::CSImageWriter::Options options;
+            options.m_generateMipMaps = false;
+#ifdef CS_BENCHMARK_LZ4
+            options.m_compression = CSCore::CSImageWriter::Compression::k_lz4;
+#else
+            options.m_compression = CSCore::CSImageWriter::Compression::k_zlib;
+#endif
+            
+            CSCore::Application::Get()->GetFileSystem()->CreateDirectoryPath(CSCore::StorageLocation::k_cache, k_imageDirectory);
+            if (CSCore::CSImageWriter::WriteFile(CSCore::StorageLocation::k_cache, k_imageFilePath, imageData.data(), k_imageSize, k_imageSize, options) == false)
+            {
+                CS_LOG_FATAL("Could not write benchmark image: " + k_imageFilePath);
+            }
+        }
+        //------------------------------------------------------------------------------
+        /// Loads and then releases the image.
+        ///
+        /// @author Ian Copland
+        ///
+        /// @param The delta time.
+        //------------------------------------------------------------------------------
+        void OnUpdate(f32 in_deltaTime) override
+        {
+            CSCore::ResourcePool* resourcePool = CSCore::Application::Get()->GetResourcePool();
+            
+            CSCore::ImageCSPtr image = resourcePool->LoadResource<CSCore::Image>(CSCore::StorageLocation::k_cache, k_imageFilePath);
+            if (image == nullptr || image->GetLoadState() != CSCore::Resource::LoadState::k_loaded)
+            {
+                CS_LOG_FATAL("Could not load benchmark image: " + k_imageFilePath);
+            }
+            
+            const CSCore::Image* rawImage = image.get();
+            image.reset();
+            resourcePool->Release(rawImage);
+        }
+    };
+    //------------------------------------------------------------------------------
+    /// The benchmark application.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class CSImageLoadBenchmarkApp final : public CSCore::Application
+    {
+    private:
+        void CreateSystems() override {}
+        void OnInit() override {}
+        void PushInitialState() override
+        {
+            GetStateManager()->Push(std::make_shared<CSImageLoadBenchmarkState>());
+        }
+        void OnDestroy() override {}
+    };
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+CSCore::Application* CreateApplication()
+{
+    return new CSImageLoadBenchmarkApp();
+}
@@ -0,0 +1,138 @@
+//
+//  EntityChurnBenchmark.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Entity.h>
+#include <ChilliSource/Core/Scene.h>
+#include <ChilliSource/Core/State.h>
+
+#include <algorithm>
+#include <vector>
+
+#ifndef CS_BENCHMARK_NUMENTITIES
+#define CS_BENCHMARK_NUMENTITIES 10000
+#endif
+
+namespace
+{
+    const u32 k_numEntities = CS_BENCHMARK_NUMENTITIES;
+    
+    //------------------------------------------------------------------------------
+    /// A benchmark which measures the cost of entity churn in a scene. Every frame
+    /// the given number of entities are created and added to the scene, then each
+    /// is looked up by its handle and removed, in a shuffled order. As removal
+    /// from the scene is constant time, the cost per entity should not grow with
+    /// the number of entities. The entity count defaults to 10000 and can be set
+    /// by defining CS_BENCHMARK_NUMENTITIES.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class EntityChurnBenchmarkState final : public CSCore::State
+    {
+    private:
+        //------------------------------------------------------------------------------
+        /// Builds the removal order.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        void OnInit() override
+        {
+            m_removalOrder.resize(k_numEntities);
+            for (u32 i = 0; i < k_numEntities; ++i)
+            {
+                m_removalOrder[i] = i;
+            }
+            
+            u32 seed = 12345;
+            for (u32 i = k_numEntities - 1; i > 0; --i)
+            {
+                seed = seed * 1664525 + 1013904223;
+                std::swap(m_removalOrder[i], m_removalOrder[(seed >> 8) % (i + 1)]);
+            }
+            
+            m_handles.resize(k_numEntities);
+        }
+        //------------------------------------------------------------------------------
+        /// Adds and then removes all of the entities. This is called after the scene
+        /// has been updated, so removals are not deferred.
+        ///
+        /// @author Ian Copland
+        ///
+        /// @param The delta time.
+        //------------------------------------------------------------------------------
+        void OnUpdate(f32 in_deltaTime) override
+        {
+            CSCore::Scene* scene = GetScene();
+            
+            for (u32 i = 0; i < k_numEntities; ++i)
+            {
+                CSCore::EntitySPtr entity = CSCore::MakeSharedPooled(CSCore::Entity::Create());
+                scene->Add(entity);
+                m_handles[i] = scene->GetEntityHandle(entity.get());
+            }
+            
+            for (u32 index : m_removalOrder)
+            {
+                CSCore::Entity* entity = scene->GetEntity(m_handles[index]);
+                CS_ASSERT(entity != nullptr, "Entity handle could not be resolved.");
+                entity->RemoveFromParent();
+            }
+            
+            if (scene->GetEntities().empty() == false)
+            {
+                CS_LOG_FATAL("Entities were not removed from the scene.");
+            }
+        }
+        
+        std::vector<u32> m_removalOrder;
+        std::vector<CSCore::EntityHandle> m_handles;
+    };
+    //------------------------------------------------------------------------------
+    /// The benchmark application.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class EntityChurnBenchmarkApp final : public CSCore::Application
+    {
+    private:
+        void CreateSystems() override {}
+        void OnInit() override {}
+        void PushInitialState() override
+        {
+            GetStateManager()->Push(std::make_shared<EntityChurnBenchmarkState>());
+        }
+        void OnDestroy() override {}
+    };
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+CSCore::Application* CreateApplication()
+{
+    return new EntityChurnBenchmarkApp();
+}
@@ -0,0 +1,143 @@
+//
+//  ImageFormatConverterBenchmark.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Image.h>
+#include <ChilliSource/Core/State.h>
+
+#include <cstring>
+#include <memory>
+
+namespace
+{
+    const u32 k_imageSize = 2048;
+    const u32 k_imageDataSize = k_imageSize * k_imageSize * 4;
+    
+    //------------------------------------------------------------------------------
+    /// The scalar RGBA8888 to RGB565 conversion that the image format converter
+    /// used before it gained SIMD and multithreaded kernels. This is used as the
+    /// baseline, and to check the results of the converter.
+    ///
+    /// @author Ian Copland
+    ///
+    /// @param The input RGBA8888 image data.
+    /// @param The size of the input image data.
+    /// @param [Out] The output RGB565 image data.
+    //------------------------------------------------------------------------------
+    void RGBA8888ToRGB565Scalar(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData)
+    {
+        const u32 area = in_imageDataSize / 4;
+        const u32* pixel32 = reinterpret_cast<const u32*>(in_imageData);
+        u16* pixel16 = reinterpret_cast<u16*>(out_imageData);
+        
+        for (u32 i = 0; i < area; ++i, ++pixel32, ++pixel16)
+        {
+            *pixel16 = ((((*pixel32 >> 0) & 0xFF) >> 3) << 11) | ((((*pixel32 >> 8) & 0xFF) >> 2) << 5) | ((((*pixel32 >> 16) & 0xFF) >> 3) << 0);
+        }
+    }
+    //------------------------------------------------------------------------------
+    /// A benchmark which measures the cost of converting a 2048x2048 RGBA8888 image
+    /// to RGB565 once per frame. By default this uses the image format converter,
+    /// which uses SIMD kernels and splits the image across the worker threads.
+    /// When built with CS_BENCHMARK_SCALAR, the scalar baseline is used instead.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class ImageFormatConverterBenchmarkState final : public CSCore::State
+    {
+    private:
+        //------------------------------------------------------------------------------
+        /// Creates the source image and checks that the converter matches the
+        /// scalar baseline.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        void OnInit() override
+        {
+            m_imageData = std::unique_ptr<u8[]>(new u8[k_imageDataSize]);
+            m_convertedData = std::unique_ptr<u8[]>(new u8[k_imageDataSize / 2]);
+            
+            u32 seed = 12345;
+            for (u32 i = 0; i < k_imageDataSize; ++i)
+            {
+                seed = seed * 1664525 + 1013904223;
+                m_imageData[i] = u8(seed >> 24);
+            }
+            
+            std::unique_ptr<u8[]> expectedData(new u8[k_imageDataSize / 2]);
+            RGBA8888ToRGB565Scalar(m_imageData.get(), k_imageDataSize, expectedData.get());
+            CSCore::ImageFormatConverter::RGBA8888ToRGB565(m_imageData.get(), k_imageDataSize, m_convertedData.get());
+            
+            if (memcmp(expectedData.get(), m_convertedData.get(), k_imageDataSize / 2) != 0)
+            {
+                CS_LOG_FATAL("The image format converter output does not match the scalar baseline.");
+            }
+        }
+        //------------------------------------------------------------------------------
+        /// Converts the image.
+        ///
+        /// @author Ian Copland
+        ///
+        /// @param The delta time.
+        //------------------------------------------------------------------------------
+        void OnUpdate(f32 in_deltaTime) override
+        {
+#ifdef CS_BENCHMARK_SCALAR
+            RGBA8888ToRGB565Scalar(m_imageData.get(), k_imageDataSize, m_convertedData.get());
+#else
+            CSCore::ImageFormatConverter::RGBA8888ToRGB565(m_imageData.get(), k_imageDataSize, m_convertedData.get());
+#endif
+        }
+        
+        std::unique_ptr<u8[]> m_imageData;
+        std::unique_ptr<u8[]> m_convertedData;
+    };
+    //------------------------------------------------------------------------------
+    /// The benchmark application.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class ImageFormatConverterBenchmarkApp final : public CSCore::Application
+    {
+    private:
+        void CreateSystems() override {}
+        void OnInit() override {}
+        void PushInitialState() override
+        {
+            GetStateManager()->Push(std::make_shared<ImageFormatConverterBenchmarkState>());
+        }
+        void OnDestroy() override {}
+    };
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+CSCore::Application* CreateApplication()
+{
+    return new ImageFormatConverterBenchmarkApp();
+}
@@ -0,0 +1,185 @@
+//
+//  MenuBenchmark.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/File.h>
+#include <ChilliSource/Core/Image.h>
+#include <ChilliSource/Core/Math.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Core/State.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Rendering/Texture.h>
+#include <ChilliSource/UI/Base.h>
+#include <ChilliSource/UI/Drawable.h>
+
+#include <vector>
+
+namespace
+{
+    const u32 k_numButtons = 8;
+    const u32 k_numDecorations = 4;
+    const u32 k_iconSize = 48;
+    const u32 k_patchSize = 64;
+    const std::string k_imageDirectory = "MenuBenchmark/";
+    
+    //------------------------------------------------------------------------------
+    /// Writes a small solid image with a one texel darker border to the cache, so
+    /// that each texture in the menu is a separate file as it would be in a real
+    /// project.
+    ///
+    /// @author Ian Copland
+    ///
+    /// @param The file name.
+    /// @param The image size.
+    /// @param The colour of the image.
+    ///
+    /// @return The texture loaded from the written file.
+    //------------------------------------------------------------------------------
+    CSRendering::TextureCSPtr CreateTexture(const std::string& in_fileName, u32 in_size, const CSCore::Colour& in_colour)
+    {
+        CSCore::ByteColour colour = CSCore::ColourUtils::ColourToByteColour(in_colour);
+        
+        std::vector<u8> imageData(in_size * in_size * 4);
+        for (u32 y = 0; y < in_size; ++y)
+        {
+            for (u32 x = 0; x < in_size; ++x)
+            {
+                const bool isBorder = (x == 0 || y == 0 || x == in_size - 1 || y == in_size - 1);
+                u8* pixel = imageData.data() + (y * in_size + x) * 4;
+                pixel[0] = isBorder ? colour.r / 2 : colour.r;
+                pixel[1] = isBorder ? colour.g / 2 : colour.g;
+                pixel[2] = isBorder ? colour.b / 2 : colour.b;
+                pixel[3] = colour.a;
+            }
+        }
+        
+        CSCore::CSImageWriter::Options options;
+        options.m_generateMipMaps = false;
+        options.m_compression = CSCore::CSImageWriter::Compression::k_none;
+        
+        const std::string filePath = k_imageDirectory + in_fileName + ".csimage";
+        CSCore::Application::Get()->GetFileSystem()->CreateDirectoryPath(CSCore::StorageLocation::k_cache, k_imageDirectory);
+        if (CSCore::CSImageWriter::WriteFile(CSCore::StorageLocation::k_cache, filePath, imageData.data(), in_size, in_size, options) == false)
+        {
+            CS_LOG_FATAL("Could not write benchmark image: " + filePath);
+        }
+        
+        return CSCore::Application::Get()->GetResourcePool()->LoadResource<CSRendering::Texture>(CSCore::StorageLocation::k_cache, filePath);
+    }
+    //------------------------------------------------------------------------------
+    /// A benchmark which measures the cost of drawing a typical menu. The menu is
+    /// a nine-patch panel with a title banner, a column of nine-patch buttons each
+    /// with its own icon, and a few decorations. Every image is a separate texture
+    /// so the number of draw calls reflects how well the UI batches.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class MenuBenchmarkState final : public CSCore::State
+    {
+    private:
+        //------------------------------------------------------------------------------
+        /// Creates the menu.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        void OnInit() override
+        {
+            CSUI::WidgetFactory* widgetFactory = CSCore::Application::Get()->GetWidgetFactory();
+            const CSCore::Vector4 insets(0.25f, 0.25f, 0.25f, 0.25f);
+            
+            CSUI::WidgetSPtr panel = widgetFactory->CreateImage();
+            panel->SetRelativeSize(CSCore::Vector2(0.6f, 0.9f));
+            panel->GetComponent<CSUI::DrawableComponent>()->ApplyDrawableDef(CSUI::DrawableDefCSPtr(new CSUI::NinePatchDrawableDef(CreateTexture("Panel", k_patchSize, CSCore::Colour::k_grey), insets)));
+            GetUICanvas()->AddWidget(panel);
+            
+            CSUI::WidgetSPtr banner = widgetFactory->CreateImage();
+            banner->SetRelativeSize(CSCore::Vector2(0.8f, 0.1f));
+            banner->SetRelativePosition(CSCore::Vector2(0.0f, 0.42f));
+            banner->GetComponent<CSUI::DrawableComponent>()->ApplyDrawableDef(CSUI::DrawableDefCSPtr(new CSUI::NinePatchDrawableDef(CreateTexture("Banner", k_patchSize, CSCore::Colour::k_orange), insets)));
+            panel->AddWidget(banner);
+            
+            CSRendering::TextureCSPtr buttonTexture = CreateTexture("Button", k_patchSize, CSCore::Colour::k_blue);
+            for (u32 i = 0; i < k_numButtons; ++i)
+            {
+                const f32 y = 0.3f - f32(i) * 0.085f;
+                
+                CSUI::WidgetSPtr button = widgetFactory->CreateImage();
+                button->SetRelativeSize(CSCore::Vector2(0.8f, 0.075f));
+                button->SetRelativePosition(CSCore::Vector2(0.0f, y));
+                button->GetComponent<CSUI::DrawableComponent>()->ApplyDrawableDef(CSUI::DrawableDefCSPtr(new CSUI::NinePatchDrawableDef(buttonTexture, insets)));
+                panel->AddWidget(button);
+                
+                const CSCore::Colour iconColour(f32(i) / f32(k_numButtons), 1.0f - f32(i) / f32(k_numButtons), 0.5f, 1.0f);
+                
+                CSUI::WidgetSPtr icon = widgetFactory->CreateImage();
+                icon->SetRelativeSize(CSCore::Vector2(0.15f, 0.8f));
+                icon->SetRelativePosition(CSCore::Vector2(-0.38f, 0.0f));
+                icon->GetComponent<CSUI::DrawableComponent>()->ApplyDrawableDef(CSUI::DrawableDefCSPtr(new CSUI::StandardDrawableDef(CreateTexture("Icon" + CSCore::ToString(i), k_iconSize, iconColour))));
+                button->AddWidget(icon);
+            }
+            
+            for (u32 i = 0; i < k_numDecorations; ++i)
+            {
+                CSUI::WidgetSPtr decoration = widgetFactory->CreateImage();
+                decoration->SetRelativeSize(CSCore::Vector2(0.1f, 0.05f));
+                decoration->SetRelativePosition(CSCore::Vector2(-0.45f + f32(i) * 0.3f, -0.45f));
+                decoration->GetComponent<CSUI::DrawableComponent>()->ApplyDrawableDef(CSUI::DrawableDefCSPtr(new CSUI::StandardDrawableDef(CreateTexture("Decoration" + CSCore::ToString(i), k_iconSize, CSCore::Colour::k_yellow))));
+                panel->AddWidget(decoration);
+            }
+        }
+    };
+    //------------------------------------------------------------------------------
+    /// The benchmark application. When built with CS_BENCHMARK_DYNAMICATLAS the
+    /// dynamic texture atlas is enabled before any textures are loaded.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class MenuBenchmarkApp final : public CSCore::Application
+    {
+    private:
+        void CreateSystems() override {}
+        void OnInit() override
+        {
+#ifdef CS_BENCHMARK_DYNAMICATLAS
+            GetSystem<CSRendering::DynamicTextureAtlas>()->SetEnabled(true);
+#endif
+        }
+        void PushInitialState() override
+        {
+            GetStateManager()->Push(std::make_shared<MenuBenchmarkState>());
+        }
+        void OnDestroy() override {}
+    };
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+CSCore::Application* CreateApplication()
+{
+    return new MenuBenchmarkApp();
+}
@@ -0,0 +1,115 @@
+//
+//  SceneBenchmark.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Entity.h>
+#include <ChilliSource/Core/Scene.h>
+#include <ChilliSource/Core/State.h>
+
+#include <vector>
+
+namespace
+{
+    const u32 k_numRootEntities = 100;
+    const u32 k_numChildrenPerEntity = 10;
+    
+    //------------------------------------------------------------------------------
+    /// A benchmark which measures the cost of updating the transforms of a
+    /// scene. A hierarchy of entities is created, each of which is rotated
+    /// every frame.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class SceneBenchmarkState final : public CSCore::State
+    {
+    private:
+        //------------------------------------------------------------------------------
+        /// Creates the entity hierarchy.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        void OnInit() override
+        {
+            for (u32 i = 0; i < k_numRootEntities; ++i)
+            {
+                CSCore::EntitySPtr root = CSCore::Entity::Create();
+                root->GetTransform().SetPosition(f32(i), 0.0f, 0.0f);
+                m_entities.push_back(root);
+                
+                for (u32 j = 0; j < k_numChildrenPerEntity; ++j)
+                {
+                    CSCore::EntitySPtr child = CSCore::Entity::Create();
+                    child->GetTransform().SetPosition(0.0f, f32(j + 1), 0.0f);
+                    root->AddEntity(child);
+                    m_entities.push_back(child);
+                }
+                
+                GetScene()->Add(root);
+            }
+        }
+        //------------------------------------------------------------------------------
+        /// Rotates every entity in the scene.
+        ///
+        /// @author Ian Copland
+        ///
+        /// @param The delta time.
+        //------------------------------------------------------------------------------
+        void OnUpdate(f32 in_deltaTime) override
+        {
+            for (const auto& entity : m_entities)
+            {
+                entity->GetTransform().RotateYBy(in_deltaTime);
+            }
+        }
+        
+        std::vector<CSCore::EntitySPtr> m_entities;
+    };
+    //------------------------------------------------------------------------------
+    /// The benchmark application.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class SceneBenchmarkApp final : public CSCore::Application
+    {
+    private:
+        void CreateSystems() override {}
+        void OnInit() override {}
+        void PushInitialState() override
+        {
+            GetStateManager()->Push(std::make_shared<SceneBenchmarkState>());
+        }
+        void OnDestroy() override {}
+    };
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+CSCore::Application* CreateApplication()
+{
+    return new SceneBenchmarkApp();
+}
@@ -0,0 +1,168 @@
+//
+//  WidgetPoolBenchmark.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/File.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Core/State.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/UI/Base.h>
+#include <ChilliSource/UI/Text.h>
+
+#include <vector>
+
+namespace
+{
+    const u32 k_numRows = 1000;
+    const std::string k_templateFilePath = "WidgetPoolBenchmark/Row.csui";
+    
+    //------------------------------------------------------------------------------
+    /// The row template used by the benchmark: a button with an icon, a title
+    /// and a subtitle, which is typical of the rows of a scrolling list.
+    //------------------------------------------------------------------------------
+    const std::string k_rowTemplate =
+        "{"
+        "  \"Type\": \"HighlightButton\","
+        "  \"Name\": \"Row\","
+        "  \"RelSize\": \"1.0 0.05\","
+        "  \"Children\": ["
+        "    { \"Type\": \"Image\", \"Name\": \"Icon\", \"RelSize\": \"0.1 0.8\", \"RelPosition\": \"-0.4 0.0\","
+        "      \"Drawable\": { \"Type\": \"Standard\", \"TextureLocation\": \"ChilliSource\", \"TexturePath\": \"Textures/Blank.csimage\" } },"
+        "    { \"Type\": \"Label\", \"Name\": \"Title\", \"RelSize\": \"0.6 0.5\", \"RelPosition\": \"0.1 0.2\" },"
+        "    { \"Type\": \"Label\", \"Name\": \"Subtitle\", \"RelSize\": \"0.6 0.4\", \"RelPosition\": \"0.1 -0.25\" }"
+        "  ]"
+        "}";
+    
+    //------------------------------------------------------------------------------
+    /// A benchmark which measures the cost of rebuilding a scrolling list of rows
+    /// every frame. By default rows are acquired from and released to a widget
+    /// pool; when built with CS_BENCHMARK_FACTORY each row is instead created
+    /// with the widget factory and destroyed when it is removed from the list.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class WidgetPoolBenchmarkState final : public CSCore::State
+    {
+    private:
+        //------------------------------------------------------------------------------
+        /// Writes and loads the row template, and creates the list and the pool.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        void OnInit() override
+        {
+            CSCore::FileSystem* fileSystem = CSCore::Application::Get()->GetFileSystem();
+            fileSystem->CreateDirectoryPath(CSCore::StorageLocation::k_cache, "WidgetPoolBenchmark");
+            if (fileSystem->WriteFile(CSCore::StorageLocation::k_cache, k_templateFilePath, k_rowTemplate) == false)
+            {
+                CS_LOG_FATAL("Could not write benchmark template: " + k_templateFilePath);
+            }
+            
+            m_rowTemplate = CSCore::Application::Get()->GetResourcePool()->LoadResource<CSUI::WidgetTemplate>(CSCore::StorageLocation::k_cache, k_templateFilePath);
+            if (m_rowTemplate == nullptr || m_rowTemplate->GetLoadState() != CSCore::Resource::LoadState::k_loaded)
+            {
+                CS_LOG_FATAL("Could not load benchmark template: " + k_templateFilePath);
+            }
+            
+            m_list = CSCore::Application::Get()->GetWidgetFactory()->CreateWidget();
+            GetUICanvas()->AddWidget(m_list);
+            
+#ifndef CS_BENCHMARK_FACTORY
+            m_pool.reset(new CSUI::WidgetPool(m_rowTemplate, k_numRows));
+            m_pool->Reserve(k_numRows);
+#endif
+            m_rows.reserve(k_numRows);
+        }
+        //------------------------------------------------------------------------------
+        /// Replaces every row in the list with a new one, as happens when a list is
+        /// rebound to new data.
+        ///
+        /// @author Ian Copland
+        ///
+        /// @param The time since the last update.
+        //------------------------------------------------------------------------------
+        void OnUpdate(f32 in_deltaTime) override
+        {
+            CSUI::WidgetFactory* widgetFactory = CSCore::Application::Get()->GetWidgetFactory();
+            
+            for (const auto& row : m_rows)
+            {
+#ifdef CS_BENCHMARK_FACTORY
+                row->RemoveFromParent();
+#else
+                m_pool->Release(row);
+#endif
+            }
+            m_rows.clear();
+            
+            for (u32 i = 0; i < k_numRows; ++i)
+            {
+#ifdef CS_BENCHMARK_FACTORY
+                CSUI::WidgetSPtr row = widgetFactory->Create(m_rowTemplate);
+#else
+                CSUI::WidgetSPtr row = m_pool->Acquire();
+#endif
+                row->SetRelativePosition(CSCore::Vector2(0.0f, 0.5f - f32(i) * 0.05f));
+                row->GetWidget("Title")->GetComponent<CSUI::TextComponent>()->SetText("Row " + CSCore::ToString(m_frame * k_numRows + i));
+                m_list->AddWidget(row);
+                m_rows.push_back(row);
+            }
+            
+            ++m_frame;
+        }
+        
+        CSUI::WidgetTemplateCSPtr m_rowTemplate;
+        CSUI::WidgetSPtr m_list;
+        std::unique_ptr<CSUI::WidgetPool> m_pool;
+        std::vector<CSUI::WidgetSPtr> m_rows;
+        u32 m_frame = 0;
+    };
+    //------------------------------------------------------------------------------
+    /// The benchmark application.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class WidgetPoolBenchmarkApp final : public CSCore::Application
+    {
+    private:
+        void CreateSystems() override {}
+        void OnInit() override {}
+        void PushInitialState() override
+        {
+            GetStateManager()->Push(std::make_shared<WidgetPoolBenchmarkState>());
+        }
+        void OnDestroy() override {}
+    };
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+CSCore::Application* CreateApplication()
+{
+    return new WidgetPoolBenchmarkApp();
+}
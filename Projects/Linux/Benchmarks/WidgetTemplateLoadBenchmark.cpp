@@ -0,0 +1,186 @@
+//
+//  WidgetTemplateLoadBenchmark.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Json/JsonUtils.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Core/State.h>
+#include <ChilliSource/Core/Time/PerformanceTimer.h>
+#include <ChilliSource/UI/Base.h>
+#include <ChilliSource/UI/Base/WidgetParserUtils.h>
+
+#include <json/json.h>
+
+#include <iomanip>
+#include <iostream>
+
+namespace
+{
+    const std::string k_templateDirectory = "WidgetTemplateLoadBenchmark/";
+#ifdef CS_BENCHMARK_JSON
+    const std::string k_templateFilePath = k_templateDirectory + "Menu.csui";
+#else
+    const std::string k_templateFilePath = k_templateDirectory + "MenuCompiled.csui";
+#endif
+    
+    //------------------------------------------------------------------------------
+    /// A benchmark which measures the cost of opening a menu from a widget
+    /// template each frame. By default the compiled form of the template is
+    /// used; when built with CS_BENCHMARK_JSON the json form is used instead.
+    ///
+    /// Opening is split into the same three steps performed by the widget
+    /// template provider and the widget factory, and the mean time of each
+    /// is reported when the benchmark ends. The first open, which also loads
+    /// the textures and font used by the menu, is excluded.
+    ///
+    /// The steps are:
+    ///
+    /// * Load - Reading the file and, for json, parsing the document.
+    /// * Parse - Building the widget description. This is where property
+    ///   values are parsed from strings, and where the drawable and layout
+    ///   defs are built from json values.
+    /// * Create - Creating the widgets from the description and adding them
+    ///   to the canvas.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class WidgetTemplateLoadBenchmarkState final : public CSCore::State
+    {
+    private:
+        //------------------------------------------------------------------------------
+        /// Creates the template resource which is rebuilt each frame.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        void OnInit() override
+        {
+            m_widgetTemplate = CSCore::Application::Get()->GetResourcePool()->CreateResource<CSUI::WidgetTemplate>("WidgetTemplateLoadBenchmark");
+        }
+        //------------------------------------------------------------------------------
+        /// Closes the previous menu and opens a new one.
+        ///
+        /// @author Ian Copland
+        ///
+        /// @param The time since the last update.
+        //------------------------------------------------------------------------------
+        void OnUpdate(f32 in_deltaTime) override
+        {
+            if (m_menu != nullptr)
+            {
+                m_menu->RemoveFromParent();
+                m_menu.reset();
+            }
+            
+            CSCore::PerformanceTimer loadTimer;
+            CSCore::PerformanceTimer parseTimer;
+            CSCore::PerformanceTimer createTimer;
+            
+            loadTimer.Start();
+#ifdef CS_BENCHMARK_JSON
+            Json::Value root;
+            if (CSCore::JsonUtils::ReadJson(CSCore::StorageLocation::k_package, k_templateFilePath, root) == false)
+            {
+                CS_LOG_FATAL("Could not read benchmark template: " + k_templateFilePath);
+            }
+#else
+            CSUI::CompiledWidgetFileUPtr compiledFile = CSUI::CompiledWidgetFile::Load(CSCore::StorageLocation::k_package, k_templateFilePath);
+            if (compiledFile == nullptr)
+            {
+                CS_LOG_FATAL("Could not read benchmark template: " + k_templateFilePath);
+            }
+            CSUI::CompiledWidgetFile::Value root = compiledFile->GetRoot();
+#endif
+            loadTimer.Stop();
+            
+            parseTimer.Start();
+            CSUI::WidgetDesc desc = CSUI::WidgetParserUtils::ParseWidget(root, CSCore::StorageLocation::k_package, k_templateDirectory);
+            parseTimer.Stop();
+            
+            createTimer.Start();
+            m_widgetTemplate->Build(desc);
+            m_menu = CSCore::Application::Get()->GetWidgetFactory()->Create(m_widgetTemplate);
+            GetUICanvas()->AddWidget(m_menu);
+            createTimer.Stop();
+            
+            if (m_isFirstOpen == true)
+            {
+                m_isFirstOpen = false;
+                return;
+            }
+            
+            m_loadTimeMS += loadTimer.GetTimeTakenMS();
+            m_parseTimeMS += parseTimer.GetTimeTakenMS();
+            m_createTimeMS += createTimer.GetTimeTakenMS();
+            ++m_numOpened;
+        }
+        //------------------------------------------------------------------------------
+        /// Outputs the mean time taken by each step.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        void OnDestroy() override
+        {
+            const f64 numOpened = f64(std::max(m_numOpened, 1u));
+            std::cout << std::fixed << std::setprecision(3);
+            std::cout << std::left << std::setw(28) << "Load per open:" << m_loadTimeMS / numOpened << "ms" << std::endl;
+            std::cout << std::left << std::setw(28) << "Parse per open:" << m_parseTimeMS / numOpened << "ms" << std::endl;
+            std::cout << std::left << std::setw(28) << "Create per open:" << m_createTimeMS / numOpened << "ms" << std::endl;
+        }
+        
+        CSUI::WidgetTemplateSPtr m_widgetTemplate;
+        CSUI::WidgetSPtr m_menu;
+        f64 m_loadTimeMS = 0.0;
+        f64 m_parseTimeMS = 0.0;
+        f64 m_createTimeMS = 0.0;
+        u32 m_numOpened = 0;
+        bool m_isFirstOpen = true;
+    };
+    //------------------------------------------------------------------------------
+    /// The benchmark application.
+    ///
+    /// @author Ian Copland
+    //------------------------------------------------------------------------------
+    class WidgetTemplateLoadBenchmarkApp final : public CSCore::Application
+    {
+    private:
+        void CreateSystems() override {}
+        void OnInit() override {}
+        void PushInitialState() override
+        {
+            GetStateManager()->Push(std::make_shared<WidgetTemplateLoadBenchmarkState>());
+        }
+        void OnDestroy() override {}
+    };
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+CSCore::Application* CreateApplication()
+{
+    return new WidgetTemplateLoadBenchmarkApp();
+}
@@ -0,0 +1,85 @@
+#-------------------------------------------------------------------
+# Config.mk
+# Chilli Source
+#
+# Created by Ian Copland on 19/10/2015
+# Copyright 2015 Tag Games. All rights reserved.
+#-------------------------------------------------------------------
+#-------------------------------------------------------------------
+# SHARED_SOURCE_PATH
+#
+# The logging, string utils, libpng and zlib sources are shared with
+# the PNGAlphaPremultiplier tool rather than duplicated.
+#-------------------------------------------------------------------
+SHARED_SOURCE_PATH = ../../PNGAlphaPremultiplier/Native/Source
+#-------------------------------------------------------------------
+# ENGINE_SOURCE_PATH
+#
+# The csimage encoder, and the LZ4 and CRC32 code it relies on, are
+# built from the engine source so that files written by the tool
+# always match those written by the engine.
+#-------------------------------------------------------------------
+ENGINE_SOURCE_PATH = ../../../../Source
+#-------------------------------------------------------------------
+# PROJECT_NAME
+#
+# The name of the project. This will be used as the output
+# exectable name.
+#-------------------------------------------------------------------
+PROJECT_NAME = CSImageMipBuilder
+#-------------------------------------------------------------------
+# PROJECT_INCLUDE_PATHS
+#
+# A list of all the include paths used. This should be in the format
+# -I<relativepath>
+#-------------------------------------------------------------------
+PROJECT_INCLUDE_PATHS = -ISource/ -I$(SHARED_SOURCE_PATH)/ -I$(SHARED_SOURCE_PATH)/LibPng/ -I$(SHARED_SOURCE_PATH)/ZLib/ -I$(ENGINE_SOURCE_PATH)/
+#-------------------------------------------------------------------
+# PROJECT_C_SOURCE_FILES
+#
+# A list of all the c sources to be built in the project.
+#-------------------------------------------------------------------
+PROJECT_C_SOURCE_FILES = $(SHARED_SOURCE_PATH)/LibPng/png.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngerror.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngget.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngmem.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngpread.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngread.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngrio.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngrtran.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngrutil.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngset.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngtrans.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngwio.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngwrite.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngwtran.c \
+	$(SHARED_SOURCE_PATH)/LibPng/pngwutil.c \
+	$(SHARED_SOURCE_PATH)/ZLib/adler32.c \
+	$(SHARED_SOURCE_PATH)/ZLib/compress.c \
+	$(SHARED_SOURCE_PATH)/ZLib/crc32.c \
+	$(SHARED_SOURCE_PATH)/ZLib/deflate.c \
+	$(SHARED_SOURCE_PATH)/ZLib/gzclose.c \
+	$(SHARED_SOURCE_PATH)/ZLib/gzlib.c \
+	$(SHARED_SOURCE_PATH)/ZLib/gzread.c \
+	$(SHARED_SOURCE_PATH)/ZLib/gzwrite.c \
+	$(SHARED_SOURCE_PATH)/ZLib/infback.c \
+	$(SHARED_SOURCE_PATH)/ZLib/inffast.c \
+	$(SHARED_SOURCE_PATH)/ZLib/inflate.c \
+	$(SHARED_SOURCE_PATH)/ZLib/inftrees.c \
+	$(SHARED_SOURCE_PATH)/ZLib/trees.c \
+	$(SHARED_SOURCE_PATH)/ZLib/uncompr.c \
+	$(SHARED_SOURCE_PATH)/ZLib/zutil.c
+#-------------------------------------------------------------------
+# PROJECT_CPP_SOURCE_FILES
+#
+# A list of all the c++ sources to be built in the project.
+#-------------------------------------------------------------------
+PROJECT_CPP_SOURCE_FILES = Source/Main.cpp \
+	Source/CSImageWriter.cpp \
+	Source/MipChainGenerator.cpp \
+	Source/PNGReader.cpp \
+	$(SHARED_SOURCE_PATH)/Logging.cpp \
+	$(SHARED_SOURCE_PATH)/StringUtils.cpp \
+	$(ENGINE_SOURCE_PATH)/ChilliSource/Core/Base/LZ4.cpp \
+	$(ENGINE_SOURCE_PATH)/ChilliSource/Core/Cryptographic/HashCRC32.cpp \
+	$(ENGINE_SOURCE_PATH)/ChilliSource/Core/Image/CSImageEncoder.cpp
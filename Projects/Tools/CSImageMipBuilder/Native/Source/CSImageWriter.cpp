@@ -0,0 +1,149 @@
+//
+//  CSImageWriter.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include "CSImageWriter.h"
+
+#include "Logging.h"
+
+#include <cstdio>
+
+namespace CSImageWriter
+{
+	namespace
+	{
+		//-------------------------------------------------
+		/// Appends a little endian 16-bit value.
+		///
+		/// @author Ian Copland
+		///
+		/// @param The value.
+		/// @param [Out] The output buffer.
+		//-------------------------------------------------
+		void AppendU16(uint32_t in_value, std::vector<uint8_t>& out_data)
+		{
+			out_data.push_back(uint8_t(in_value & 0xff));
+			out_data.push_back(uint8_t((in_value >> 8) & 0xff));
+		}
+		//-------------------------------------------------
+		/// Converts RGBA8888 data to the given format, using
+		/// the same bit layouts as the engine's
+		/// ImageFormatConverter.
+		///
+		/// @author Ian Copland
+		///
+		/// @param The RGBA8888 image data.
+		/// @param The output format.
+		///
+		/// @return The converted image data.
+		//-------------------------------------------------
+		std::vector<uint8_t> Convert(const std::vector<uint8_t>& in_imageData, CSCore::ImageFormat in_format)
+		{
+			std::vector<uint8_t> output;
+			for (uint32_t i = 0; i + 4 <= in_imageData.size(); i += 4)
+			{
+				const uint32_t r = in_imageData[i + 0];
+				const uint32_t g = in_imageData[i + 1];
+				const uint32_t b = in_imageData[i + 2];
+				const uint32_t a = in_imageData[i + 3];
+				switch (in_format)
+				{
+					case CSCore::ImageFormat::k_Lum8:
+						output.push_back(uint8_t(r));
+						break;
+					case CSCore::ImageFormat::k_LumA88:
+						output.push_back(uint8_t(r));
+						output.push_back(uint8_t(a));
+						break;
+					case CSCore::ImageFormat::k_RGB565:
+						AppendU16((r >> 3) << 11 | (g >> 2) << 5 | (b >> 3), output);
+						break;
+					case CSCore::ImageFormat::k_RGBA4444:
+						AppendU16((r >> 4) << 12 | (g >> 4) << 8 | (b >> 4) << 4 | (a >> 4), output);
+						break;
+					case CSCore::ImageFormat::k_RGB888:
+						output.push_back(uint8_t(r));
+						output.push_back(uint8_t(g));
+						output.push_back(uint8_t(b));
+						break;
+					default:
+						output.insert(output.end(), in_imageData.begin() + i, in_imageData.begin() + i + 4);
+						break;
+				}
+			}
+			return output;
+		}
+	}
+	//-------------------------------------------------
+	//-------------------------------------------------
+	bool Write(const std::string& in_filePath, const std::vector<MipChainGenerator::Level>& in_levels, CSCore::ImageFormat in_format, CSCore::CSImageEncoder::Compression in_compression)
+	{
+		if (CSCore::CSImageEncoder::IsFormatSupported(in_format) == false)
+		{
+			Logging::LogError("Unsupported output format.");
+			return false;
+		}
+
+		std::vector<std::vector<uint8_t>> convertedLevels(in_levels.size());
+		std::vector<CSCore::CSImageEncoder::Level> levels(in_levels.size());
+		for (uint32_t i = 0; i < in_levels.size(); ++i)
+		{
+			convertedLevels[i] = Convert(in_levels[i].m_imageData, in_format);
+
+			levels[i].m_width = in_levels[i].m_width;
+			levels[i].m_height = in_levels[i].m_height;
+			levels[i].m_data = convertedLevels[i].data();
+			levels[i].m_dataSize = uint32_t(convertedLevels[i].size());
+		}
+
+		std::vector<uint8_t> fileData;
+		if (CSCore::CSImageEncoder::Encode(levels, in_format, in_compression, fileData) == false)
+		{
+			Logging::LogError("Failed to compress the mip levels.");
+			return false;
+		}
+
+		FILE* file = fopen(in_filePath.c_str(), "wb");
+		if (file == nullptr)
+		{
+			Logging::LogError("File '" + in_filePath + "' could not be opened for writing.");
+			return false;
+		}
+
+		fwrite(fileData.data(), 1, fileData.size(), file);
+
+		const bool success = (ferror(file) == 0);
+		fclose(file);
+
+		if (success == false)
+		{
+			Logging::LogError("Failed to write to '" + in_filePath + "'.");
+		}
+		return success;
+	}
+}
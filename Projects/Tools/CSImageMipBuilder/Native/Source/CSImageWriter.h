@@ -0,0 +1,68 @@
+//
+//  CSImageWriter.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CSIMAGEMIPBUILDER_CSIMAGEWRITER_H_
+#define _CSIMAGEMIPBUILDER_CSIMAGEWRITER_H_
+
+#include "MipChainGenerator.h"
+
+#include <ChilliSource/Core/Image/CSImageEncoder.h>
+
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------
+/// Writes version 4 csimage files, which contain a complete
+/// mip chain. The file is laid out and compressed by the
+/// engine's CSImageEncoder, so it is always read correctly
+/// by CSImageProvider.
+///
+/// @author Ian Copland
+//------------------------------------------------------------
+namespace CSImageWriter
+{
+	//-------------------------------------------------
+	/// Converts each level to the given format and
+	/// writes them to a csimage file.
+	///
+	/// @author Ian Copland
+	///
+	/// @param The output file path.
+	/// @param The RGBA8888 levels, base level first.
+	/// @param The output format. Depth formats are not
+	/// supported.
+	/// @param The compression type.
+	///
+	/// @return Whether or not the file was written
+	/// successfully.
+	//-------------------------------------------------
+	bool Write(const std::string& in_filePath, const std::vector<MipChainGenerator::Level>& in_levels, CSCore::ImageFormat in_format, CSCore::CSImageEncoder::Compression in_compression);
+}
+
+#endif
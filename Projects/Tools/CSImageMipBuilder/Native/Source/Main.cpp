@@ -0,0 +1,281 @@
+//
+//  Main.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include "CSImageWriter.h"
+#include "Logging.h"
+#include "MipChainGenerator.h"
+#include "PNGReader.h"
+#include "StringUtils.h"
+
+//-------------------------------------------------
+/// Displays the help messages.
+///
+/// @author Ian Copland
+//-------------------------------------------------
+void DisplayHelp()
+{
+	Logging::SetLoggingLevel(Logging::LoggingLevel::k_verbose);
+	Logging::LogVerbose("Usage: --input <filename> --output <filename> [--convert <type>] [--compression <type>] [--filter <type>] [--linear] [--disablepremultipliedalpha] [" + Logging::k_paramLoggingLevel + " <level>] [--help]");
+	Logging::LogVerbose("Parameters");
+	Logging::LogVerbose(" --input(-i): The input png filename.");
+	Logging::LogVerbose(" --output(-o): The output csimage filename.");
+	Logging::LogVerbose(" --convert(-ct): [Optional] The type to convert to. The default is RGBA8888.");
+	Logging::LogVerbose(" --compression(-cn): [Optional] The compression type. The default is zlib compression.");
+	Logging::LogVerbose(" --filter(-f): [Optional] The filter used to generate each mip level. The default is Kaiser.");
+	Logging::LogVerbose(" --linear(-l): [Optional] If set the colour is filtered as is, rather than being treated as sRGB. This should be used for non-colour data such as normal maps.");
+	Logging::LogVerbose(" --disablepremultipliedalpha(-dpa): [Optional] If set the output image will not have its alpha premultiplied.");
+	Logging::LogVerbose(" " + Logging::k_paramLoggingLevel + "(" + Logging::k_paramLoggingLevelShort + "): The logging level.");
+	Logging::LogVerbose(" --help(-h): Display this help message.");
+	Logging::LogVerbose("Conversion Types:");
+	Logging::LogVerbose(" L8");
+	Logging::LogVerbose(" LA88");
+	Logging::LogVerbose(" RGB565");
+	Logging::LogVerbose(" RGBA4444");
+	Logging::LogVerbose(" RGB888");
+	Logging::LogVerbose(" RGBA8888");
+	Logging::LogVerbose("Compression Types:");
+	Logging::LogVerbose(" None");
+	Logging::LogVerbose(" Default");
+	Logging::LogVerbose(" LZ4");
+	Logging::LogVerbose("Filter Types:");
+	Logging::LogVerbose(" Box");
+	Logging::LogVerbose(" Kaiser");
+	Logging::LogVerbose("Logging Levels:");
+	Logging::LogVerbose(" " + Logging::k_loggingLevelNone + ": No logging.");
+	Logging::LogVerbose(" " + Logging::k_loggingLevelFatal + ": Only log fatal errors.");
+	Logging::LogVerbose(" " + Logging::k_loggingLevelError + ": Only log errors.");
+	Logging::LogVerbose(" " + Logging::k_loggingLevelWarning + ": Log errors and warnings.");
+	Logging::LogVerbose(" " + Logging::k_loggingLevelVerbose + ": Log all messages.");
+}
+//-------------------------------------------------
+/// @author Ian Copland
+///
+/// @param The conversion type string.
+///
+/// @return The format.
+//-------------------------------------------------
+CSCore::ImageFormat ParseFormat(const std::string& in_format)
+{
+	std::string format = StringUtils::ToUpperCase(in_format);
+	if (format == "L8")
+		return CSCore::ImageFormat::k_Lum8;
+	if (format == "LA88")
+		return CSCore::ImageFormat::k_LumA88;
+	if (format == "RGB565")
+		return CSCore::ImageFormat::k_RGB565;
+	if (format == "RGBA4444")
+		return CSCore::ImageFormat::k_RGBA4444;
+	if (format == "RGB888")
+		return CSCore::ImageFormat::k_RGB888;
+	if (format == "RGBA8888")
+		return CSCore::ImageFormat::k_RGBA8888;
+
+	Logging::LogFatal("Invalid conversion type: " + in_format);
+	return CSCore::ImageFormat::k_RGBA8888;
+}
+//-------------------------------------------------
+/// @author Ian Copland
+///
+/// @param The compression type string.
+///
+/// @return The compression type.
+//-------------------------------------------------
+CSCore::CSImageEncoder::Compression ParseCompression(const std::string& in_compression)
+{
+	std::string compression = StringUtils::ToLowerCase(in_compression);
+	if (compression == "default")
+		return CSCore::CSImageEncoder::Compression::k_zlib;
+	if (compression == "lz4")
+		return CSCore::CSImageEncoder::Compression::k_lz4;
+	if (compression == "none")
+		return CSCore::CSImageEncoder::Compression::k_none;
+
+	Logging::LogFatal("Invalid compression type: " + in_compression);
+	return CSCore::CSImageEncoder::Compression::k_zlib;
+}
+//-------------------------------------------------
+/// @author Ian Copland
+///
+/// @param The filter type string.
+///
+/// @return The filter.
+//-------------------------------------------------
+MipChainGenerator::Filter ParseFilter(const std::string& in_filter)
+{
+	std::string filter = StringUtils::ToLowerCase(in_filter);
+	if (filter == "box")
+		return MipChainGenerator::Filter::k_box;
+	if (filter == "kaiser")
+		return MipChainGenerator::Filter::k_kaiser;
+
+	Logging::LogFatal("Invalid filter type: " + in_filter);
+	return MipChainGenerator::Filter::k_kaiser;
+}
+//-------------------------------------------------
+/// The entry point into the application.
+///
+/// @author Ian Copland
+//-------------------------------------------------
+int main(int in_argCount, char* in_arguments[])
+{
+	//initialise the logger
+	Logging::Start(in_argCount, in_arguments);
+
+	//if no params have been passed, display the help message.
+	if (in_argCount < 2)
+	{
+		DisplayHelp();
+		return 0;
+	}
+
+	//collect parameters
+	std::string inputFilename;
+	std::string outputFilename;
+	CSCore::ImageFormat format = CSCore::ImageFormat::k_RGBA8888;
+	CSCore::CSImageEncoder::Compression compression = CSCore::CSImageEncoder::Compression::k_zlib;
+	MipChainGenerator::Options options;
+	for (int i = 1; i < in_argCount; ++i)
+	{
+		std::string argument(in_arguments[i]);
+		
+		//input param
+		if (argument == "-i" || argument == "--input")
+		{
+			if (i + 1 < in_argCount)
+				inputFilename = in_arguments[i + 1];
+			else
+				Logging::LogFatal("No input filename provided!");
+			i++;
+		}
+		
+		//output param
+		else if (argument == "-o" || argument == "--output")
+		{
+			if (i + 1 < in_argCount)
+				outputFilename = in_arguments[i + 1];
+			else
+				Logging::LogFatal("No output filename provided!");
+			i++;
+		}
+
+		//conversion param
+		else if (argument == "-ct" || argument == "--convert")
+		{
+			if (i + 1 < in_argCount)
+				format = ParseFormat(in_arguments[i + 1]);
+			else
+				Logging::LogFatal("No conversion type provided!");
+			i++;
+		}
+
+		//compression param
+		else if (argument == "-cn" || argument == "--compression")
+		{
+			if (i + 1 < in_argCount)
+				compression = ParseCompression(in_arguments[i + 1]);
+			else
+				Logging::LogFatal("No compression type provided!");
+			i++;
+		}
+
+		//filter param
+		else if (argument == "-f" || argument == "--filter")
+		{
+			if (i + 1 < in_argCount)
+				options.m_filter = ParseFilter(in_arguments[i + 1]);
+			else
+				Logging::LogFatal("No filter type provided!");
+			i++;
+		}
+
+		//linear param
+		else if (argument == "-l" || argument == "--linear")
+		{
+			options.m_gammaCorrect = false;
+		}
+
+		//premultiplied alpha param
+		else if (argument == "-dpa" || argument == "--disablepremultipliedalpha")
+		{
+			options.m_premultiplyAlpha = false;
+		}
+
+		//help
+		else if (argument == "-h" || argument == "--help")
+		{
+			DisplayHelp();
+			return 0;
+		}
+
+		//skip logging level
+		else if (argument == Logging::k_paramLoggingLevelShort || argument == Logging::k_paramLoggingLevel)
+		{
+			i++;
+		}
+
+		//failure
+		else 
+		{
+			Logging::LogFatal("Invalid argument found: " + argument);
+		}
+	}
+	
+	//check that the required params have been provided.
+	if (inputFilename == "")
+		Logging::LogFatal("No input provided!");
+	if (outputFilename == "")
+		Logging::LogFatal("No output provided!");
+		
+	//ensure input paths are in the correct format
+	inputFilename = StringUtils::StandardisePath(inputFilename);
+	outputFilename = StringUtils::StandardisePath(outputFilename);
+
+	//check the params are valid
+	if (StringUtils::EndsWith(StringUtils::ToLowerCase(inputFilename), ".png") == false)
+		Logging::LogFatal("Input is not a png.");
+	if (StringUtils::EndsWith(StringUtils::ToLowerCase(outputFilename), ".csimage") == false)
+		Logging::LogFatal("Output is not a csimage.");
+
+	//read, generate the mip chain and write
+	uint32_t width = 0;
+	uint32_t height = 0;
+	std::vector<uint8_t> imageData;
+	if (PNGReader::Read(inputFilename, width, height, imageData) == false)
+		Logging::LogFatal("Failed to read input: " + inputFilename);
+
+	std::vector<MipChainGenerator::Level> levels = MipChainGenerator::Generate(imageData.data(), width, height, options);
+	Logging::LogVerbose("Generated " + std::to_string(levels.size()) + " mip levels from a " + std::to_string(width) + "x" + std::to_string(height) + " image.");
+
+	if (CSImageWriter::Write(outputFilename, levels, format, compression) == false)
+		Logging::LogFatal("Failed to write output: " + outputFilename);
+	
+	//output any errors or warnings reported and exit happily
+	Logging::Finish();
+	return 0;
+}
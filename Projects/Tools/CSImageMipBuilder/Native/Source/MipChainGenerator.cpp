@@ -0,0 +1,374 @@
+//
+//  MipChainGenerator.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include "MipChainGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace MipChainGenerator
+{
+	namespace
+	{
+		const double k_pi = 3.14159265358979323846;
+		const double k_kaiserRadius = 3.0;
+		const double k_kaiserAlpha = 4.0;
+
+		//-------------------------------------------------
+		/// An image stored as linear, alpha weighted RGBA
+		/// floats.
+		///
+		/// @author Ian Copland
+		//-------------------------------------------------
+		struct FloatImage final
+		{
+			uint32_t m_width = 0;
+			uint32_t m_height = 0;
+			std::vector<float> m_pixels;
+		};
+		//-------------------------------------------------
+		/// A single source sample contributing to an
+		/// output pixel.
+		///
+		/// @author Ian Copland
+		//-------------------------------------------------
+		struct Tap final
+		{
+			uint32_t m_index;
+			float m_weight;
+		};
+		//-------------------------------------------------
+		/// @author Ian Copland
+		///
+		/// @param The sRGB value in the range 0 - 1.
+		///
+		/// @return The linear value.
+		//-------------------------------------------------
+		double SRGBToLinear(double in_value)
+		{
+			return (in_value <= 0.04045) ? in_value / 12.92 : std::pow((in_value + 0.055) / 1.055, 2.4);
+		}
+		//-------------------------------------------------
+		/// @author Ian Copland
+		///
+		/// @param The linear value in the range 0 - 1.
+		///
+		/// @return The sRGB value.
+		//-------------------------------------------------
+		double LinearToSRGB(double in_value)
+		{
+			return (in_value <= 0.0031308) ? in_value * 12.92 : 1.055 * std::pow(in_value, 1.0 / 2.4) - 0.055;
+		}
+		//-------------------------------------------------
+		/// The zeroth order modified Bessel function of the
+		/// first kind, used by the Kaiser window.
+		///
+		/// @author Ian Copland
+		///
+		/// @param The value.
+		///
+		/// @return The result.
+		//-------------------------------------------------
+		double BesselI0(double in_value)
+		{
+			double sum = 1.0;
+			double term = 1.0;
+			const double halfValueSquared = in_value * in_value * 0.25;
+			for (uint32_t k = 1; k < 32; ++k)
+			{
+				term *= halfValueSquared / double(k * k);
+				sum += term;
+				if (term < sum * 1e-12)
+				{
+					break;
+				}
+			}
+			return sum;
+		}
+		//-------------------------------------------------
+		/// @author Ian Copland
+		///
+		/// @param The filter.
+		/// @param The distance from the centre of the
+		/// output pixel, in output pixels.
+		///
+		/// @return The weight of a sample at the distance.
+		//-------------------------------------------------
+		double EvaluateFilter(Filter in_filter, double in_distance)
+		{
+			const double distance = std::abs(in_distance);
+			if (in_filter == Filter::k_box)
+			{
+				return (distance <= 0.5) ? 1.0 : 0.0;
+			}
+
+			if (distance >= k_kaiserRadius)
+			{
+				return 0.0;
+			}
+
+			const double sinc = (distance < 1e-9) ? 1.0 : std::sin(k_pi * distance) / (k_pi * distance);
+			const double windowPosition = distance / k_kaiserRadius;
+			const double window = BesselI0(k_kaiserAlpha * std::sqrt(1.0 - windowPosition * windowPosition)) / BesselI0(k_kaiserAlpha);
+			return sinc * window;
+		}
+		//-------------------------------------------------
+		/// Calculates the source samples and normalised
+		/// weights for each output pixel along one axis.
+		/// Samples outside of the image are clamped to the
+		/// edge.
+		///
+		/// @author Ian Copland
+		///
+		/// @param The filter.
+		/// @param The source size.
+		/// @param The output size.
+		///
+		/// @return The taps for each output pixel.
+		//-------------------------------------------------
+		std::vector<std::vector<Tap>> CalculateTaps(Filter in_filter, uint32_t in_sourceSize, uint32_t in_outputSize)
+		{
+			const double scale = double(in_sourceSize) / double(in_outputSize);
+			const double radius = ((in_filter == Filter::k_box) ? 0.5 : k_kaiserRadius) * scale;
+
+			std::vector<std::vector<Tap>> taps(in_outputSize);
+			for (uint32_t i = 0; i < in_outputSize; ++i)
+			{
+				const double centre = (double(i) + 0.5) * scale;
+				const int32_t first = int32_t(std::floor(centre - radius));
+				const int32_t last = int32_t(std::ceil(centre + radius));
+
+				double totalWeight = 0.0;
+				for (int32_t j = first; j <= last; ++j)
+				{
+					const double weight = EvaluateFilter(in_filter, (double(j) + 0.5 - centre) / scale);
+					if (weight != 0.0)
+					{
+						const uint32_t index = uint32_t(std::min(std::max(j, 0), int32_t(in_sourceSize) - 1));
+						taps[i].push_back(Tap{index, float(weight)});
+						totalWeight += weight;
+					}
+				}
+
+				for (auto& tap : taps[i])
+				{
+					tap.m_weight = float(tap.m_weight / totalWeight);
+				}
+			}
+			return taps;
+		}
+		//-------------------------------------------------
+		/// Halves the size of the given image using the
+		/// given filter. The filter is separable so rows
+		/// and columns are filtered in two passes.
+		///
+		/// @author Ian Copland
+		///
+		/// @param The source image.
+		/// @param The filter.
+		///
+		/// @return The downscaled image.
+		//-------------------------------------------------
+		FloatImage Downscale(const FloatImage& in_image, Filter in_filter)
+		{
+			const uint32_t outputWidth = std::max(in_image.m_width / 2, 1u);
+			const uint32_t outputHeight = std::max(in_image.m_height / 2, 1u);
+
+			const auto horizontalTaps = CalculateTaps(in_filter, in_image.m_width, outputWidth);
+			std::vector<float> horizontal(outputWidth * in_image.m_height * 4, 0.0f);
+			for (uint32_t y = 0; y < in_image.m_height; ++y)
+			{
+				const float* sourceRow = in_image.m_pixels.data() + y * in_image.m_width * 4;
+				float* outputRow = horizontal.data() + y * outputWidth * 4;
+				for (uint32_t x = 0; x < outputWidth; ++x)
+				{
+					for (const auto& tap : horizontalTaps[x])
+					{
+						for (uint32_t channel = 0; channel < 4; ++channel)
+						{
+							outputRow[x * 4 + channel] += sourceRow[tap.m_index * 4 + channel] * tap.m_weight;
+						}
+					}
+				}
+			}
+
+			FloatImage output;
+			output.m_width = outputWidth;
+			output.m_height = outputHeight;
+			output.m_pixels.assign(outputWidth * outputHeight * 4, 0.0f);
+
+			const auto verticalTaps = CalculateTaps(in_filter, in_image.m_height, outputHeight);
+			for (uint32_t y = 0; y < outputHeight; ++y)
+			{
+				float* outputRow = output.m_pixels.data() + y * outputWidth * 4;
+				for (const auto& tap : verticalTaps[y])
+				{
+					const float* sourceRow = horizontal.data() + tap.m_index * outputWidth * 4;
+					for (uint32_t i = 0; i < outputWidth * 4; ++i)
+					{
+						outputRow[i] += sourceRow[i] * tap.m_weight;
+					}
+				}
+			}
+
+			//the Kaiser filter has negative lobes, so the result can overshoot.
+			for (uint32_t i = 0; i < outputWidth * outputHeight; ++i)
+			{
+				float* pixel = output.m_pixels.data() + i * 4;
+				pixel[3] = std::min(std::max(pixel[3], 0.0f), 1.0f);
+				for (uint32_t channel = 0; channel < 3; ++channel)
+				{
+					pixel[channel] = std::min(std::max(pixel[channel], 0.0f), pixel[3]);
+				}
+			}
+
+			return output;
+		}
+		//-------------------------------------------------
+		/// @author Ian Copland
+		///
+		/// @param The RGBA8888 image data.
+		/// @param The width.
+		/// @param The height.
+		/// @param Whether or not the colour is in sRGB.
+		///
+		/// @return The image as linear, alpha weighted
+		/// floats.
+		//-------------------------------------------------
+		FloatImage ToFloatImage(const uint8_t* in_imageData, uint32_t in_width, uint32_t in_height, bool in_gammaCorrect)
+		{
+			float toLinear[256];
+			for (uint32_t i = 0; i < 256; ++i)
+			{
+				toLinear[i] = (in_gammaCorrect == true) ? float(SRGBToLinear(double(i) / 255.0)) : float(i) / 255.0f;
+			}
+
+			FloatImage image;
+			image.m_width = in_width;
+			image.m_height = in_height;
+			image.m_pixels.resize(in_width * in_height * 4);
+			for (uint32_t i = 0; i < in_width * in_height; ++i)
+			{
+				const float alpha = float(in_imageData[i * 4 + 3]) / 255.0f;
+				for (uint32_t channel = 0; channel < 3; ++channel)
+				{
+					image.m_pixels[i * 4 + channel] = toLinear[in_imageData[i * 4 + channel]] * alpha;
+				}
+				image.m_pixels[i * 4 + 3] = alpha;
+			}
+			return image;
+		}
+		//-------------------------------------------------
+		/// @author Ian Copland
+		///
+		/// @param The image as linear, alpha weighted
+		/// floats.
+		/// @param The options.
+		///
+		/// @return The output level.
+		//-------------------------------------------------
+		Level ToLevel(const FloatImage& in_image, const Options& in_options)
+		{
+			Level level;
+			level.m_width = in_image.m_width;
+			level.m_height = in_image.m_height;
+			level.m_imageData.resize(in_image.m_width * in_image.m_height * 4);
+			for (uint32_t i = 0; i < in_image.m_width * in_image.m_height; ++i)
+			{
+				const float* pixel = in_image.m_pixels.data() + i * 4;
+				const double alpha = pixel[3];
+				for (uint32_t channel = 0; channel < 3; ++channel)
+				{
+					double value = (alpha > 0.0) ? std::min(double(pixel[channel]) / alpha, 1.0) : 0.0;
+					if (in_options.m_gammaCorrect == true)
+					{
+						value = LinearToSRGB(value);
+					}
+					if (in_options.m_premultiplyAlpha == true)
+					{
+						value *= alpha;
+					}
+					level.m_imageData[i * 4 + channel] = uint8_t(value * 255.0 + 0.5);
+				}
+				level.m_imageData[i * 4 + 3] = uint8_t(alpha * 255.0 + 0.5);
+			}
+			return level;
+		}
+		//-------------------------------------------------
+		/// The base level is output directly from the
+		/// source data so that it is not altered by the
+		/// float conversion. Alpha is premultiplied in
+		/// gamma space, matching PNGToCSImage.
+		///
+		/// @author Ian Copland
+		///
+		/// @param The RGBA8888 image data.
+		/// @param The width.
+		/// @param The height.
+		/// @param The options.
+		///
+		/// @return The output level.
+		//-------------------------------------------------
+		Level ToBaseLevel(const uint8_t* in_imageData, uint32_t in_width, uint32_t in_height, const Options& in_options)
+		{
+			Level level;
+			level.m_width = in_width;
+			level.m_height = in_height;
+			level.m_imageData.assign(in_imageData, in_imageData + in_width * in_height * 4);
+			if (in_options.m_premultiplyAlpha == true)
+			{
+				for (uint32_t i = 0; i < in_width * in_height; ++i)
+				{
+					const uint32_t alpha = level.m_imageData[i * 4 + 3];
+					for (uint32_t channel = 0; channel < 3; ++channel)
+					{
+						level.m_imageData[i * 4 + channel] = uint8_t((level.m_imageData[i * 4 + channel] * alpha + 127) / 255);
+					}
+				}
+			}
+			return level;
+		}
+	}
+	//-------------------------------------------------
+	//-------------------------------------------------
+	std::vector<Level> Generate(const uint8_t* in_imageData, uint32_t in_width, uint32_t in_height, const Options& in_options)
+	{
+		std::vector<Level> levels;
+		levels.push_back(ToBaseLevel(in_imageData, in_width, in_height, in_options));
+
+		FloatImage image = ToFloatImage(in_imageData, in_width, in_height, in_options.m_gammaCorrect);
+		while (image.m_width > 1 || image.m_height > 1)
+		{
+			image = Downscale(image, in_options.m_filter);
+			levels.push_back(ToLevel(image, in_options));
+		}
+
+		return levels;
+	}
+}
@@ -0,0 +1,99 @@
+//
+//  MipChainGenerator.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CSIMAGEMIPBUILDER_MIPCHAINGENERATOR_H_
+#define _CSIMAGEMIPBUILDER_MIPCHAINGENERATOR_H_
+
+#include <cstdint>
+#include <vector>
+
+//------------------------------------------------------------
+/// Generates complete mip chains from RGBA8888 images.
+///
+/// Filtering is performed in floating point on colour which
+/// has been weighted by alpha, so that fully transparent
+/// pixels don't bleed into their neighbours. Each level is
+/// generated from the previous level without requantising
+/// in between.
+///
+/// @author Ian Copland
+//------------------------------------------------------------
+namespace MipChainGenerator
+{
+	//-------------------------------------------------
+	/// The filters which can be used to downscale each
+	/// level.
+	///
+	/// @author Ian Copland
+	//-------------------------------------------------
+	enum class Filter
+	{
+		k_box,
+		k_kaiser
+	};
+	//-------------------------------------------------
+	/// The options used when generating a mip chain.
+	///
+	/// @author Ian Copland
+	//-------------------------------------------------
+	struct Options final
+	{
+		Filter m_filter = Filter::k_kaiser;
+		bool m_gammaCorrect = true;
+		bool m_premultiplyAlpha = true;
+	};
+	//-------------------------------------------------
+	/// A single level of a mip chain.
+	///
+	/// @author Ian Copland
+	//-------------------------------------------------
+	struct Level final
+	{
+		uint32_t m_width = 0;
+		uint32_t m_height = 0;
+		std::vector<uint8_t> m_imageData;
+	};
+	//-------------------------------------------------
+	/// Generates a complete mip chain from the given
+	/// image, down to a 1x1 level.
+	///
+	/// @author Ian Copland
+	///
+	/// @param The RGBA8888 image data. This should not
+	/// have premultiplied alpha.
+	/// @param The image width.
+	/// @param The image height.
+	/// @param The options.
+	///
+	/// @return The RGBA8888 levels, base level first.
+	//-------------------------------------------------
+	std::vector<Level> Generate(const uint8_t* in_imageData, uint32_t in_width, uint32_t in_height, const Options& in_options);
+}
+
+#endif
@@ -0,0 +1,132 @@
+//
+//  PNGReader.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include "PNGReader.h"
+
+#include "Logging.h"
+
+#include "LibPng/png.h"
+
+#include <cstdio>
+
+namespace PNGReader
+{
+	//-------------------------------------------------
+	/// libpng reports errors by jumping back to the
+	/// setjmp point, so nothing with a destructor may be
+	/// created after it.
+	//-------------------------------------------------
+	bool Read(const std::string& in_filePath, uint32_t& out_width, uint32_t& out_height, std::vector<uint8_t>& out_imageData)
+	{
+		FILE* file = fopen(in_filePath.c_str(), "rb");
+		if (file == nullptr)
+		{
+			Logging::LogError("File '" + in_filePath + "' could not be opened for reading.");
+			return false;
+		}
+
+		png_byte signature[8];
+		if (fread(signature, 1, 8, file) != 8 || png_sig_cmp(signature, 0, 8) != 0)
+		{
+			Logging::LogError("File '" + in_filePath + "' is not recognised as a png file.");
+			fclose(file);
+			return false;
+		}
+
+		png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+		png_infop info = (png != nullptr) ? png_create_info_struct(png) : nullptr;
+		if (png == nullptr || info == nullptr)
+		{
+			Logging::LogError("Failed to initialise libpng.");
+			png_destroy_read_struct(&png, &info, nullptr);
+			fclose(file);
+			return false;
+		}
+
+		std::vector<png_bytep> rows;
+		if (setjmp(png_jmpbuf(png)))
+		{
+			Logging::LogError("Failed to read png file '" + in_filePath + "'.");
+			png_destroy_read_struct(&png, &info, nullptr);
+			fclose(file);
+			return false;
+		}
+
+		png_init_io(png, file);
+		png_set_sig_bytes(png, 8);
+		png_read_info(png, info);
+
+		out_width = png_get_image_width(png, info);
+		out_height = png_get_image_height(png, info);
+		png_byte colourType = png_get_color_type(png, info);
+		png_byte bitDepth = png_get_bit_depth(png, info);
+
+		//expand everything to 8-bit RGBA.
+		if (colourType == PNG_COLOR_TYPE_PALETTE)
+		{
+			png_set_palette_to_rgb(png);
+		}
+		if (colourType == PNG_COLOR_TYPE_GRAY && bitDepth < 8)
+		{
+			png_set_expand_gray_1_2_4_to_8(png);
+		}
+		if (png_get_valid(png, info, PNG_INFO_tRNS) != 0)
+		{
+			png_set_tRNS_to_alpha(png);
+		}
+		if (bitDepth == 16)
+		{
+			png_set_strip_16(png);
+		}
+		if (colourType == PNG_COLOR_TYPE_GRAY || colourType == PNG_COLOR_TYPE_GRAY_ALPHA)
+		{
+			png_set_gray_to_rgb(png);
+		}
+		if ((colourType & PNG_COLOR_MASK_ALPHA) == 0 && png_get_valid(png, info, PNG_INFO_tRNS) == 0)
+		{
+			png_set_filler(png, 0xff, PNG_FILLER_AFTER);
+		}
+		png_set_interlace_handling(png);
+		png_read_update_info(png, info);
+
+		out_imageData.resize(out_width * out_height * 4);
+		rows.resize(out_height);
+		for (uint32_t y = 0; y < out_height; ++y)
+		{
+			rows[y] = out_imageData.data() + y * out_width * 4;
+		}
+
+		png_read_image(png, rows.data());
+		png_read_end(png, nullptr);
+
+		png_destroy_read_struct(&png, &info, nullptr);
+		fclose(file);
+		return true;
+	}
+}
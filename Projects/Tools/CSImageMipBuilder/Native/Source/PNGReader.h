@@ -0,0 +1,61 @@
+//
+//  PNGReader.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CSIMAGEMIPBUILDER_PNGREADER_H_
+#define _CSIMAGEMIPBUILDER_PNGREADER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------
+/// Reads png files using libpng.
+///
+/// @author Ian Copland
+//------------------------------------------------------------
+namespace PNGReader
+{
+	//-------------------------------------------------
+	/// Reads the given png file, converting it to 8-bit
+	/// RGBA regardless of the format it is stored in.
+	///
+	/// @author Ian Copland
+	///
+	/// @param The input file path.
+	/// @param [Out] The width of the image.
+	/// @param [Out] The height of the image.
+	/// @param [Out] The RGBA8888 image data.
+	///
+	/// @return Whether or not the file was read
+	/// successfully.
+	//-------------------------------------------------
+	bool Read(const std::string& in_filePath, uint32_t& out_width, uint32_t& out_height, std::vector<uint8_t>& out_imageData);
+}
+
+#endif
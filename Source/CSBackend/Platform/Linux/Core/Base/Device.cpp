@@ -0,0 +1,194 @@
+//
+//  Device.cpp
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#include <CSBackend/Platform/Linux/Core/Base/Device.h>
+
+#include <ChilliSource/Core/String/StringUtils.h>
+
+#include <cstdlib>
+
+#include <sys/utsname.h>
+#include <unistd.h>
+
+namespace CSBackend
+{
+    namespace Linux
+    {
+        namespace
+        {
+            const std::string k_defaultLocale = "en_US";
+            const std::string k_defaultLanguage = "en";
+
+            //----------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The kernel release string.
+            //----------------------------------------------
+            std::string GetOSVersion()
+            {
+                utsname systemName;
+                if (uname(&systemName) == 0)
+                {
+                    return systemName.release;
+                }
+
+                return "";
+            }
+            //----------------------------------------------
+            /// Reads the locale from the LANG environment
+            /// variable, stripping the encoding and
+            /// modifier. For example, "en_GB.UTF-8"
+            /// becomes "en_GB".
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The current locale.
+            //----------------------------------------------
+            std::string GetLocale()
+            {
+                const char* lang = std::getenv("LANG");
+                if (lang == nullptr)
+                {
+                    return k_defaultLocale;
+                }
+
+                std::string locale(lang);
+                locale = locale.substr(0, locale.find_first_of(".@"));
+
+                if (locale.empty() == true || locale == "C" || locale == "POSIX")
+                {
+                    return k_defaultLocale;
+                }
+
+                return locale;
+            }
+            //----------------------------------------------------
+            /// Returns the language portion of a locale code.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The locale code.
+            ///
+            /// @return The language code.
+            //----------------------------------------------------
+            std::string ParseLanguageFromLocale(const std::string& in_locale)
+            {
+                std::vector<std::string> strLocaleBrokenUp = CSCore::StringUtils::Split(in_locale, "_", 0);
+
+                if (strLocaleBrokenUp.size() > 0)
+                {
+                    return strLocaleBrokenUp[0];
+                }
+                else
+                {
+                    return k_defaultLanguage;
+                }
+            }
+            //----------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The number of online cores.
+            //----------------------------------------------
+            u32 GetNumberOfCPUCores()
+            {
+                long numCores = sysconf(_SC_NPROCESSORS_ONLN);
+                return (numCores > 0) ? u32(numCores) : 1;
+            }
+        }
+
+        CS_DEFINE_NAMEDTYPE(Device);
+        //----------------------------------------------------
+        //----------------------------------------------------
+        Device::Device()
+            : m_model("Linux"), m_modelType("PC"), m_manufacturer("Unknown"), m_udid("FAKE ID")
+        {
+            m_locale = CSBackend::Linux::GetLocale();
+            m_language = CSBackend::Linux::ParseLanguageFromLocale(m_locale);
+            m_osVersion = CSBackend::Linux::GetOSVersion();
+            m_numCPUCores = CSBackend::Linux::GetNumberOfCPUCores();
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        bool Device::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return (CSCore::Device::InterfaceID == in_interfaceId || Device::InterfaceID == in_interfaceId);
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        const std::string& Device::GetModel() const
+        {
+            return m_model;
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        const std::string& Device::GetModelType() const
+        {
+            return m_modelType;
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        const std::string& Device::GetManufacturer() const
+        {
+            return m_manufacturer;
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        const std::string& Device::GetLocale() const
+        {
+            return m_locale;
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        const std::string& Device::GetLanguage() const
+        {
+            return m_language;
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        const std::string& Device::GetOSVersion() const
+        {
+            return m_osVersion;
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        const std::string& Device::GetUDID() const
+        {
+            return m_udid;
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        u32 Device::GetNumberOfCPUCores() const
+        {
+            return m_numCPUCores;
+        }
+    }
+}
+
+#endif
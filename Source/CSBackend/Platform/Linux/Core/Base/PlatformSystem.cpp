@@ -0,0 +1,89 @@
+//
+//  PlatformSystem.cpp
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#include <CSBackend/Platform/Linux/Core/Base/PlatformSystem.h>
+
+#include <CSBackend/Platform/Linux/Headless/Base/HeadlessDriver.h>
+#include <CSBackend/Rendering/Null/Shader/ShaderProvider.h>
+#include <ChilliSource/Core/Base/Application.h>
+
+#include <ctime>
+
+namespace CSBackend
+{
+    namespace Linux
+    {
+        CS_DEFINE_NAMEDTYPE(PlatformSystem);
+        //--------------------------------------------------
+        //--------------------------------------------------
+        bool PlatformSystem::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return (CSCore::PlatformSystem::InterfaceID == in_interfaceId || PlatformSystem::InterfaceID == in_interfaceId);
+        }
+        //-------------------------------------------------
+        //-------------------------------------------------
+        void PlatformSystem::CreateDefaultSystems(CSCore::Application* in_application)
+        {
+            in_application->CreateSystem<CSBackend::Null::ShaderProvider>();
+        }
+        //-------------------------------------------------
+        //-------------------------------------------------
+        void PlatformSystem::SetPreferredFPS(u32 in_fps)
+        {
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        void PlatformSystem::SetVSyncEnabled(bool in_enabled)
+        {
+        }
+        //--------------------------------------------
+        //--------------------------------------------
+        void PlatformSystem::Quit()
+        {
+            HeadlessDriver::Get()->Quit();
+        }
+        //-------------------------------------------------
+        //-------------------------------------------------
+        std::string PlatformSystem::GetAppVersion() const
+        {
+            return "";
+        }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        TimeIntervalMs PlatformSystem::GetSystemTimeMS() const
+        {
+            timespec currentTime;
+            clock_gettime(CLOCK_MONOTONIC, &currentTime);
+            return TimeIntervalMs(currentTime.tv_sec) * 1000 + TimeIntervalMs(currentTime.tv_nsec) / 1000000;
+        }
+    }
+}
+
+#endif
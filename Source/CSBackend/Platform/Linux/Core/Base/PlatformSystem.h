@@ -0,0 +1,124 @@
+//
+//  PlatformSystem.h
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#ifndef _CSBACKEND_PLATFORM_LINUX_CORE_BASE_PLATFORMSYSTEM_H_
+#define _CSBACKEND_PLATFORM_LINUX_CORE_BASE_PLATFORMSYSTEM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Platform/Linux/ForwardDeclarations.h>
+#include <ChilliSource/Core/Base/PlatformSystem.h>
+
+namespace CSBackend
+{
+    namespace Linux
+    {
+        //-------------------------------------------------------------
+        /// The headless Linux backend for the platform system. This
+        /// creates the Linux specific default systems.
+        ///
+        /// @author Ian Copland
+        //-------------------------------------------------------------
+        class PlatformSystem final : public CSCore::PlatformSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(PlatformSystem);
+            //--------------------------------------------------
+            /// Queries whether or not this system implements the
+            /// interface with the given Id.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The interface Id.
+            /// @param Whether system is of given type.
+            //--------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //-------------------------------------------------
+            /// Adds default systems to the applications system
+            /// list.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param the system list
+            //-------------------------------------------------
+            void CreateDefaultSystems(CSCore::Application* in_application) override;
+            //-------------------------------------------------
+            /// The headless driver always uses a fixed time
+            /// step so this has no effect.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The maximum frames per second.
+            //-------------------------------------------------
+            void SetPreferredFPS(u32 in_fps) override;
+            //---------------------------------------------------
+            /// There is no display to sync to so this has no
+            /// effect.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Enable/Disable
+            //---------------------------------------------------
+            void SetVSyncEnabled(bool in_enabled) override;
+            //-------------------------------------------------
+            /// Stops the headless driver at the end of the
+            /// current frame, causing the application to
+            /// terminate.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------
+            void Quit() override;
+            //-------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The version of the application
+            //-------------------------------------------------
+            std::string GetAppVersion() const override;
+            //------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return the current time in milliseconds
+            //-------------------------------------------------
+            TimeIntervalMs GetSystemTimeMS() const override;
+        private:
+            friend CSCore::PlatformSystemUPtr CSCore::PlatformSystem::Create();
+            //--------------------------------------------------
+            /// Private constructor to enforce use of create
+            /// method.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------
+            PlatformSystem() = default;
+        };
+    }
+}
+
+#endif
+
+#endif
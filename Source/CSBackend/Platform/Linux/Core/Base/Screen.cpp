@@ -0,0 +1,115 @@
+//
+//  Screen.cpp
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#include <CSBackend/Platform/Linux/Core/Base/Screen.h>
+
+#include <CSBackend/Platform/Linux/Headless/Base/HeadlessDriver.h>
+
+namespace CSBackend
+{
+    namespace Linux
+    {
+        CS_DEFINE_NAMEDTYPE(Screen);
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        Screen::Screen()
+        {
+            CSCore::Integer2 size = HeadlessDriver::Get()->GetResolution();
+            m_resolution.x = (f32)size.x;
+            m_resolution.y = (f32)size.y;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        bool Screen::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return (CSCore::Screen::InterfaceID == in_interfaceId || Screen::InterfaceID == in_interfaceId);
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        const CSCore::Vector2& Screen::GetResolution() const
+        {
+            return m_resolution;
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        f32 Screen::GetDensityScale() const
+        {
+            return 1.0f;
+        }
+        //----------------------------------------------------------
+        //-----------------------------------------------------------
+        f32 Screen::GetInverseDensityScale() const
+        {
+            return 1.0f;
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        CSCore::IConnectableEvent<Screen::ResolutionChangedDelegate>& Screen::GetResolutionChangedEvent()
+        {
+            return m_resolutionChangedEvent;
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        CSCore::IConnectableEvent<Screen::DisplayModeChangedDelegate>& Screen::GetDisplayModeChangedEvent()
+        {
+            return m_displayModeChangedEvent;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Screen::SetResolution(const CSCore::Integer2& in_size)
+        {
+            HeadlessDriver::Get()->SetResolution(in_size);
+
+            CSCore::Integer2 size = HeadlessDriver::Get()->GetResolution();
+            m_resolution.x = (f32)size.x;
+            m_resolution.y = (f32)size.y;
+
+            m_resolutionChangedEvent.NotifyConnections(m_resolution);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Screen::SetDisplayMode(DisplayMode in_mode)
+        {
+            if (m_displayMode != in_mode)
+            {
+                m_displayMode = in_mode;
+                m_displayModeChangedEvent.NotifyConnections(m_displayMode);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        std::vector<CSCore::Integer2> Screen::GetSupportedResolutions() const
+        {
+            return std::vector<CSCore::Integer2> { HeadlessDriver::Get()->GetResolution() };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,140 @@
+//
+//  Screen.h
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#ifndef _CSBACKEND_PLATFORM_LINUX_CORE_BASE_SCREEN_H_
+#define _CSBACKEND_PLATFORM_LINUX_CORE_BASE_SCREEN_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/Screen.h>
+#include <ChilliSource/Core/Event/Event.h>
+#include <CSBackend/Platform/Linux/ForwardDeclarations.h>
+
+namespace CSBackend
+{
+    namespace Linux
+    {
+        //----------------------------------------------------------------
+        /// The headless Linux backend for the screen. There is no real
+        /// display, so this describes a virtual screen with the size
+        /// given to the headless driver and a density scale of 1.
+        ///
+        /// @author Ian Copland
+        //----------------------------------------------------------------
+        class Screen final : public CSCore::Screen
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(Screen);
+            //-------------------------------------------------------
+            /// Queries whether or not this system implements the
+            /// interface with the given Id.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The interface Id.
+            /// @param Whether system is of given type.
+            //-------------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //-----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The size of the virtual screen.
+            //-----------------------------------------------------------
+            const CSCore::Vector2& GetResolution() const override;
+            //-----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The density scale factor of the screen. This is
+            /// always 1.
+            //-----------------------------------------------------------
+            f32 GetDensityScale() const override;
+            //-----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The inverse of density scale factor of the screen
+            //-----------------------------------------------------------
+            f32 GetInverseDensityScale() const override;
+            //-----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return An event that is called when the screen resolution
+            /// changes.
+            //-----------------------------------------------------------
+            CSCore::IConnectableEvent<ResolutionChangedDelegate>& GetResolutionChangedEvent() override;
+            //-----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return An event that is called when the screen display
+            /// mode changes.
+            //-----------------------------------------------------------
+            CSCore::IConnectableEvent<DisplayModeChangedDelegate>& GetDisplayModeChangedEvent() override;
+            //----------------------------------------------------------
+            /// Changes the size of the virtual screen.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Screen size in pixels
+            //----------------------------------------------------------
+            void SetResolution(const CSCore::Integer2& in_size) override;
+            //----------------------------------------------------------
+            /// Sets the display mode. As there is no real display this
+            /// only notifies listeners of the change.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The display mode.
+            //----------------------------------------------------------
+            void SetDisplayMode(DisplayMode in_mode) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return A list containing only the current resolution.
+            //----------------------------------------------------------
+            std::vector<CSCore::Integer2> GetSupportedResolutions() const override;
+        private:
+            friend CSCore::ScreenUPtr CSCore::Screen::Create();
+            //-------------------------------------------------------
+            /// Private constructor to force the use of the Create()
+            /// factory method.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------
+            Screen();
+
+            CSCore::Vector2 m_resolution;
+            DisplayMode m_displayMode = DisplayMode::k_windowed;
+            CSCore::Event<ResolutionChangedDelegate> m_resolutionChangedEvent;
+            CSCore::Event<DisplayModeChangedDelegate> m_displayModeChangedEvent;
+        };
+    }
+}
+
+#endif
+
+#endif
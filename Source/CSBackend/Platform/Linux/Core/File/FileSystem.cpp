@@ -0,0 +1,615 @@
+//
+//  FileSystem.cpp
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#include <CSBackend/Platform/Linux/Core/File/FileSystem.h>
+
+#include <ChilliSource/Core/Base/Utils.h>
+#include <ChilliSource/Core/File/FileStream.h>
+#include <ChilliSource/Core/String/StringUtils.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace CSBackend
+{
+    namespace Linux
+    {
+        namespace
+        {
+            const std::string k_saveDataPath = "SaveData/";
+            const std::string k_cachePath = "Cache/";
+            const std::string k_dlcPath = "DLC/";
+
+            //--------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The file path.
+            ///
+            /// @return Whether or not the given file path exists.
+            //--------------------------------------------------------------
+            bool DoesFileExist(const std::string& in_filePath)
+            {
+                struct stat fileInfo;
+                return (stat(in_filePath.c_str(), &fileInfo) == 0 && S_ISREG(fileInfo.st_mode));
+            }
+            //--------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The directory path.
+            ///
+            /// @return Whether or not the given directory path exists.
+            //--------------------------------------------------------------
+            bool DoesDirectoryExist(const std::string& in_directoryPath)
+            {
+                struct stat fileInfo;
+                return (stat(in_directoryPath.c_str(), &fileInfo) == 0 && S_ISDIR(fileInfo.st_mode));
+            }
+            //--------------------------------------------------------------
+            /// Creates the given directory, and any of its parents which
+            /// do not yet exist.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The directory path.
+            ///
+            /// @return Whether or not the directory exists once complete.
+            //--------------------------------------------------------------
+            bool CreateDirectoryHierarchy(const std::string& in_directoryPath)
+            {
+                std::string directoryPath = CSCore::StringUtils::StandardiseDirectoryPath(in_directoryPath);
+
+                std::string::size_type position = (directoryPath.empty() == false && directoryPath[0] == '/') ? 1 : 0;
+                while ((position = directoryPath.find('/', position)) != std::string::npos)
+                {
+                    std::string subPath = directoryPath.substr(0, position);
+                    if (mkdir(subPath.c_str(), 0755) != 0 && errno != EEXIST)
+                    {
+                        return false;
+                    }
+
+                    ++position;
+                }
+
+                return DoesDirectoryExist(directoryPath);
+            }
+            //--------------------------------------------------------------
+            /// Deletes the given directory and all of its contents.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The directory path.
+            ///
+            /// @return Whether or not the directory was deleted.
+            //--------------------------------------------------------------
+            bool DeleteDirectory(const std::string& in_directoryPath)
+            {
+                DIR* directory = opendir(in_directoryPath.c_str());
+                if (directory == nullptr)
+                {
+                    return false;
+                }
+
+                bool success = true;
+                while (dirent* entry = readdir(directory))
+                {
+                    std::string name = entry->d_name;
+                    if (name == "." || name == "..")
+                    {
+                        continue;
+                    }
+
+                    std::string path = in_directoryPath + name;
+                    if (DoesDirectoryExist(path) == true)
+                    {
+                        success = DeleteDirectory(CSCore::StringUtils::StandardiseDirectoryPath(path));
+                    }
+                    else
+                    {
+                        success = (unlink(path.c_str()) == 0);
+                    }
+
+                    if (success == false)
+                    {
+                        break;
+                    }
+                }
+
+                closedir(directory);
+
+                return (success == true && rmdir(in_directoryPath.c_str()) == 0);
+            }
+            //--------------------------------------------------------------
+            /// Lists all files and sub-directories inside the given directory.
+            /// All paths will be relative to the given directory.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The directory.
+            /// @param Whether or not to recurse into sub directories.
+            /// @param [Out] The sub directories.
+            /// @param [Out] The files.
+            /// @param [Optional] The relative directory path. This is used
+            /// in recursion and shouldn't be set outside of this function.
+            /// @return Whether or not this succeeded.
+            //--------------------------------------------------------------
+            bool ListDirectoryContents(const std::string& in_directoryPath, bool in_recursive, std::vector<std::string>& out_directoryPaths, std::vector<std::string>& out_filePaths,
+                const std::string& in_relativeDirectoryPath = "")
+            {
+                DIR* directory = opendir(in_directoryPath.c_str());
+                if (directory == nullptr)
+                {
+                    return false;
+                }
+
+                bool success = true;
+                while (dirent* entry = readdir(directory))
+                {
+                    std::string name = entry->d_name;
+                    if (name == "." || name == "..")
+                    {
+                        continue;
+                    }
+
+                    std::string absolutePath = in_directoryPath + name;
+                    if (DoesDirectoryExist(absolutePath) == true)
+                    {
+                        std::string relativeDirectoryPath = CSCore::StringUtils::StandardiseDirectoryPath(in_relativeDirectoryPath + name);
+                        out_directoryPaths.push_back(relativeDirectoryPath);
+
+                        if (in_recursive == true)
+                        {
+                            std::string absoluteDirectoryPath = CSCore::StringUtils::StandardiseDirectoryPath(absolutePath);
+                            if (ListDirectoryContents(absoluteDirectoryPath, true, out_directoryPaths, out_filePaths, relativeDirectoryPath) == false)
+                            {
+                                success = false;
+                                break;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        out_filePaths.push_back(CSCore::StringUtils::StandardiseFilePath(in_relativeDirectoryPath + name));
+                    }
+                }
+
+                closedir(directory);
+
+                return success;
+            }
+            //--------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The directory containing the running executable.
+            //--------------------------------------------------------------
+            std::string GetExecutableDirectory()
+            {
+                std::vector<char> buffer(4096);
+                ssize_t length = readlink("/proc/self/exe", buffer.data(), buffer.size() - 1);
+                if (length <= 0)
+                {
+                    return "./";
+                }
+
+                std::string path(buffer.data(), length);
+                std::string::size_type pos = path.find_last_of("/");
+                return CSCore::StringUtils::StandardiseDirectoryPath(path.substr(0, pos));
+            }
+        }
+        CS_DEFINE_NAMEDTYPE(FileSystem);
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        FileSystem::FileSystem()
+        {
+            std::string workingDir = GetExecutableDirectory();
+
+            m_packagePath = workingDir + "assets/";
+            m_documentsPath = workingDir + "Documents/";
+
+            CreateDirectoryPath(CSCore::StorageLocation::k_saveData, "");
+            CreateDirectoryPath(CSCore::StorageLocation::k_cache, "");
+            CreateDirectoryPath(CSCore::StorageLocation::k_DLC, "");
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        bool FileSystem::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return (CSCore::FileSystem::InterfaceID == in_interfaceId || FileSystem::InterfaceID == in_interfaceId);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        CSCore::FileStreamUPtr FileSystem::CreateFileStream(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath, CSCore::FileMode in_fileMode) const
+        {
+            CSCore::FileStreamUPtr fileStream = CSCore::FileStreamUPtr(new CSCore::FileStream());
+
+            if (IsWriteMode(in_fileMode) == true)
+            {
+                CS_ASSERT(IsStorageLocationWritable(in_storageLocation), "File System: Trying to write to read only storage location.");
+
+                std::string filePath = GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath;
+                fileStream->Open(filePath, in_fileMode);
+            }
+            else
+            {
+                std::string filePath = GetAbsolutePathToFile(in_storageLocation, in_filePath);
+                fileStream->Open(filePath, in_fileMode);
+            }
+
+            return fileStream;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::CreateDirectoryPath(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
+        {
+            CS_ASSERT(IsStorageLocationWritable(in_storageLocation), "File System: Trying to write to read only storage location.");
+
+            std::string directoryPath = GetAbsolutePathToStorageLocation(in_storageLocation) + in_directoryPath;
+            if (CreateDirectoryHierarchy(directoryPath) == false)
+            {
+                CS_LOG_ERROR("File System: Failed to create directory '" + in_directoryPath + "'");
+                return false;
+            }
+
+            return true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::CopyFile(CSCore::StorageLocation in_sourceStorageLocation, const std::string& in_sourceFilePath,
+            CSCore::StorageLocation in_destinationStorageLocation, const std::string& in_destinationFilePath) const
+        {
+            CS_ASSERT(IsStorageLocationWritable(in_destinationStorageLocation), "File System: Trying to write to read only storage location.");
+
+            std::string sourceFilePath = GetAbsolutePathToFile(in_sourceStorageLocation, in_sourceFilePath);
+            if (sourceFilePath.empty() == true)
+            {
+                CS_LOG_ERROR("File System: Trying to copy file '" + in_sourceFilePath + "' but it does not exist.");
+                return false;
+            }
+
+            //get the path to the file
+            std::string destinationFileName, destinationDirectoryPath;
+            CSCore::StringUtils::SplitFilename(in_destinationFilePath, destinationFileName, destinationDirectoryPath);
+
+            //create the output directory
+            CreateDirectoryPath(in_destinationStorageLocation, destinationDirectoryPath);
+
+            //try and copy the file
+            std::ifstream source(sourceFilePath, std::ios::binary);
+            std::ofstream destination(GetAbsolutePathToStorageLocation(in_destinationStorageLocation) + in_destinationFilePath, std::ios::binary | std::ios::trunc);
+            if (source.good() == false || destination.good() == false)
+            {
+                CS_LOG_ERROR("File System: Failed to copy file '" + in_sourceFilePath + "'");
+                return false;
+            }
+
+            destination << source.rdbuf();
+
+            if (destination.good() == false)
+            {
+                CS_LOG_ERROR("File System: Failed to copy file '" + in_sourceFilePath + "'");
+                return false;
+            }
+
+            return true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::CopyDirectory(CSCore::StorageLocation in_sourceStorageLocation, const std::string& in_sourceDirectoryPath,
+            CSCore::StorageLocation in_destinationStorageLocation, const std::string& in_destinationDirectoryPath) const
+        {
+            CS_ASSERT(IsStorageLocationWritable(in_destinationStorageLocation), "File System: Trying to write to read only storage location.");
+
+            if (DoesDirectoryExist(in_sourceStorageLocation, in_sourceDirectoryPath) == false)
+            {
+                CS_LOG_ERROR("File System: Trying to copy directory '" + in_sourceDirectoryPath + "' but it doesn't exist.");
+                return false;
+            }
+
+            std::vector<std::string> filePaths = GetFilePaths(in_sourceStorageLocation, in_sourceDirectoryPath, true);
+
+            //if the source directory is empty, just create the equivelent directory in the destination
+            if (filePaths.size() == 0)
+            {
+                CreateDirectoryPath(in_destinationStorageLocation, in_destinationDirectoryPath);
+            }
+            else
+            {
+                std::string sourceDirectoryPath = CSCore::StringUtils::StandardiseDirectoryPath(in_sourceDirectoryPath);
+                std::string destinationDirectoryPath = CSCore::StringUtils::StandardiseDirectoryPath(in_destinationDirectoryPath);
+                for (const std::string& filePath : filePaths)
+                {
+                    if (CopyFile(in_sourceStorageLocation, sourceDirectoryPath + filePath, in_destinationStorageLocation, destinationDirectoryPath + filePath) == false)
+                    {
+                        CS_LOG_ERROR("File System: Failed to copy directory '" + in_sourceDirectoryPath + "'");
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::DeleteFile(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const
+        {
+            CS_ASSERT(IsStorageLocationWritable(in_storageLocation), "File System: Trying to delete from a read only storage location.");
+
+            std::string filePath = GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath;
+            if (unlink(filePath.c_str()) != 0)
+            {
+                CS_LOG_ERROR("File System: Failed to delete file '" + in_filePath + "'");
+                return false;
+            }
+
+            return true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::DeleteDirectory(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
+        {
+            CS_ASSERT(IsStorageLocationWritable(in_storageLocation), "File System: Trying to delete from a read only storage location.");
+
+            std::string directoryPath = GetAbsolutePathToDirectory(in_storageLocation, in_directoryPath);
+            if (directoryPath != "")
+            {
+                if (CSBackend::Linux::DeleteDirectory(CSCore::StringUtils::StandardiseDirectoryPath(directoryPath)) == false)
+                {
+                    CS_LOG_ERROR("File System: Failed to delete directory '" + in_directoryPath + "'");
+                    return false;
+                }
+                return true;
+            }
+
+            return false;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        std::vector<std::string> FileSystem::GetFilePaths(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath, bool in_recursive) const
+        {
+            std::vector<std::string> possibleDirectories = GetPossibleAbsoluteDirectoryPaths(in_storageLocation, in_directoryPath);
+
+            std::vector<std::string> output;
+            std::vector<std::string> filePaths;
+            std::vector<std::string> directoryPaths;
+            for (const std::string& possibleDirectory : possibleDirectories)
+            {
+                filePaths.clear();
+                directoryPaths.clear();
+
+                ListDirectoryContents(CSCore::StringUtils::StandardiseDirectoryPath(possibleDirectory), in_recursive, directoryPaths, filePaths);
+                output.insert(output.end(), filePaths.begin(), filePaths.end());
+            }
+
+            std::sort(output.begin(), output.end());
+            std::vector<std::string>::iterator it = std::unique(output.begin(), output.end());
+            output.resize(it - output.begin());
+            return output;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        std::vector<std::string> FileSystem::GetDirectoryPaths(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath, bool in_recursive) const
+        {
+            std::vector<std::string> possibleDirectories = GetPossibleAbsoluteDirectoryPaths(in_storageLocation, in_directoryPath);
+
+            std::vector<std::string> output;
+            std::vector<std::string> filePaths;
+            std::vector<std::string> directoryPaths;
+            for (const std::string& possibleDirectory : possibleDirectories)
+            {
+                filePaths.clear();
+                directoryPaths.clear();
+
+                ListDirectoryContents(CSCore::StringUtils::StandardiseDirectoryPath(possibleDirectory), in_recursive, directoryPaths, filePaths);
+                output.insert(output.end(), directoryPaths.begin(), directoryPaths.end());
+            }
+
+            std::sort(output.begin(), output.end());
+            std::vector<std::string>::iterator it = std::unique(output.begin(), output.end());
+            output.resize(it - output.begin());
+            return output;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::DoesFileExist(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const
+        {
+            switch (in_storageLocation)
+            {
+                case CSCore::StorageLocation::k_DLC:
+                {
+                    if (DoesItemExistInDLCCache(in_filePath, false) == true)
+                    {
+                        return true;
+                    }
+
+                    return DoesFileExist(CSCore::StorageLocation::k_package, GetPackageDLCPath() + in_filePath);
+                }
+                default:
+                {
+                    std::string path = CSCore::StringUtils::StandardiseFilePath(GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath);
+                    return CSBackend::Linux::DoesFileExist(path);
+                }
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::DoesDirectoryExist(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
+        {
+            switch (in_storageLocation)
+            {
+                case CSCore::StorageLocation::k_DLC:
+                {
+                    if (DoesItemExistInDLCCache(in_directoryPath, true) == true)
+                    {
+                        return true;
+                    }
+
+                    return DoesDirectoryExist(CSCore::StorageLocation::k_package, GetPackageDLCPath() + in_directoryPath);
+                }
+                default:
+                {
+                    std::string path = CSCore::StringUtils::StandardiseDirectoryPath(GetAbsolutePathToStorageLocation(in_storageLocation) + in_directoryPath);
+                    return CSBackend::Linux::DoesDirectoryExist(path);
+                }
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::DoesFileExistInCachedDLC(const std::string& in_filePath) const
+        {
+            return DoesItemExistInDLCCache(in_filePath, false);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::DoesFileExistInPackageDLC(const std::string& in_filePath) const
+        {
+            return DoesFileExist(CSCore::StorageLocation::k_package, GetPackageDLCPath() + in_filePath);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        std::string FileSystem::GetAbsolutePathToStorageLocation(CSCore::StorageLocation in_storageLocation) const
+        {
+            switch (in_storageLocation)
+            {
+                case CSCore::StorageLocation::k_package:
+                    return m_packagePath + "AppResources/";
+                case CSCore::StorageLocation::k_chilliSource:
+                    return m_packagePath + "CSResources/";
+                case CSCore::StorageLocation::k_saveData:
+                    return m_documentsPath + k_saveDataPath;
+                case CSCore::StorageLocation::k_cache:
+                    return m_documentsPath + k_cachePath;
+                case CSCore::StorageLocation::k_DLC:
+                    return m_documentsPath + k_dlcPath;
+                case CSCore::StorageLocation::k_root:
+                    return "";
+                default:
+                    CS_LOG_ERROR("Storage Location not available on this platform!");
+                    return "";
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        std::string FileSystem::GetAbsolutePathToFile(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const
+        {
+            if (DoesFileExist(in_storageLocation, in_filePath) == true)
+            {
+                switch (in_storageLocation)
+                {
+                    case CSCore::StorageLocation::k_DLC:
+                    {
+                        std::string filePath = CSCore::StringUtils::StandardiseFilePath(GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_DLC) + in_filePath);
+                        if (CSBackend::Linux::DoesFileExist(filePath) == true)
+                        {
+                            return filePath;
+                        }
+
+                        return GetAbsolutePathToFile(CSCore::StorageLocation::k_package, GetPackageDLCPath() + in_filePath);
+                    }
+                    default:
+                    {
+                        return GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath;
+                    }
+                }
+            }
+
+            return "";
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        std::string FileSystem::GetAbsolutePathToDirectory(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
+        {
+            if (DoesDirectoryExist(in_storageLocation, in_directoryPath) == true)
+            {
+                switch (in_storageLocation)
+                {
+                    case CSCore::StorageLocation::k_DLC:
+                    {
+                        std::string directoryPath = CSCore::StringUtils::StandardiseDirectoryPath(GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_DLC) + in_directoryPath);
+                        if (CSBackend::Linux::DoesDirectoryExist(directoryPath) == true)
+                        {
+                            return directoryPath;
+                        }
+
+                        return GetAbsolutePathToDirectory(CSCore::StorageLocation::k_package, GetPackageDLCPath() + in_directoryPath);
+                    }
+                    default:
+                    {
+                        return GetAbsolutePathToStorageLocation(in_storageLocation) + in_directoryPath;
+                    }
+                }
+            }
+
+            return "";
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::DoesItemExistInDLCCache(const std::string& in_path, bool in_isDirectory) const
+        {
+            std::string path = GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_DLC) + in_path;
+            if (in_isDirectory == true)
+            {
+                return CSBackend::Linux::DoesDirectoryExist(CSCore::StringUtils::StandardiseDirectoryPath(path));
+            }
+            else
+            {
+                return CSBackend::Linux::DoesFileExist(CSCore::StringUtils::StandardiseFilePath(path));
+            }
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        std::vector<std::string> FileSystem::GetPossibleAbsoluteDirectoryPaths(CSCore::StorageLocation in_storageLocation, const std::string& in_path) const
+        {
+            std::vector<std::string> output;
+
+            switch (in_storageLocation)
+            {
+                case CSCore::StorageLocation::k_DLC:
+                {
+                    output.push_back(GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_package) + GetPackageDLCPath() + in_path);
+                    output.push_back(GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_DLC) + in_path);
+                    break;
+                }
+                default:
+                {
+                    output.push_back(GetAbsolutePathToStorageLocation(in_storageLocation) + in_path);
+                    break;
+                }
+            }
+
+            return output;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,262 @@
+//
+//  HeadlessDriver.cpp
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#include <CSBackend/Platform/Linux/Headless/Base/HeadlessDriver.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Time/PerformanceTimer.h>
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace CSBackend
+{
+    namespace Linux
+    {
+        namespace
+        {
+            //------------------------------------------------------------------------------
+            /// Returns the given percentile of a sorted list of values using the nearest
+            /// rank method.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The sorted values. Must not be empty.
+            /// @param The percentile in the range (0, 100].
+            ///
+            /// @return The value at the given percentile.
+            //------------------------------------------------------------------------------
+            f64 GetPercentile(const std::vector<f64>& in_sortedValues, f64 in_percentile)
+            {
+                CS_ASSERT(in_sortedValues.empty() == false, "Cannot get the percentile of an empty list.");
+
+                u32 rank = u32(std::ceil((in_percentile / 100.0) * f64(in_sortedValues.size())));
+                rank = std::max(rank, 1u);
+                rank = std::min(rank, u32(in_sortedValues.size()));
+
+                return in_sortedValues[rank - 1];
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        HeadlessDriver::FrameTimeReport HeadlessDriver::CalculateReport(std::vector<f64> in_frameTimesMS)
+        {
+            FrameTimeReport report;
+            if (in_frameTimesMS.empty() == true)
+            {
+                return report;
+            }
+
+            std::sort(in_frameTimesMS.begin(), in_frameTimesMS.end());
+
+            report.m_numFrames = u32(in_frameTimesMS.size());
+            for (f64 frameTime : in_frameTimesMS)
+            {
+                report.m_totalMS += frameTime;
+            }
+            report.m_minMS = in_frameTimesMS.front();
+            report.m_maxMS = in_frameTimesMS.back();
+            report.m_meanMS = report.m_totalMS / f64(report.m_numFrames);
+            report.m_p50MS = GetPercentile(in_frameTimesMS, 50.0);
+            report.m_p90MS = GetPercentile(in_frameTimesMS, 90.0);
+            report.m_p95MS = GetPercentile(in_frameTimesMS, 95.0);
+            report.m_p99MS = GetPercentile(in_frameTimesMS, 99.0);
+
+            return report;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        s32 HeadlessDriver::Run(const Options& in_options)
+        {
+            CS_ASSERT(m_isRunning == false, "The headless driver is already running.");
+            CS_ASSERT(in_options.m_frameDeltaTime > 0.0f, "The frame delta time must be greater than zero.");
+
+            m_options = in_options;
+            m_resolution = in_options.m_resolution;
+            m_report = FrameTimeReport();
+            m_renderStats = CSBackend::Null::RenderSystem::Stats();
+
+            std::vector<f64> frameTimesMS;
+            frameTimesMS.reserve(m_options.m_numFrames);
+
+            CSCore::Application* app = CreateApplication();
+            app->Init();
+            app->Resume();
+            app->Foreground();
+
+            CSBackend::Null::RenderSystem* renderSystem = app->GetSystem<CSBackend::Null::RenderSystem>();
+            CS_ASSERT(renderSystem != nullptr, "The headless driver requires the null render system.");
+
+            m_isRunning = true;
+
+            const u32 totalFrames = m_options.m_numWarmUpFrames + m_options.m_numFrames;
+            TimeIntervalSecs runningTime = 0.0;
+            CSCore::PerformanceTimer frameTimer;
+
+            for (u32 frame = 0; frame < totalFrames && m_isRunning == true; ++frame)
+            {
+                if (frame == m_options.m_numWarmUpFrames)
+                {
+                    renderSystem->ResetStats();
+                }
+
+                frameTimer.Start();
+
+                app->Update(m_options.m_frameDeltaTime, runningTime);
+                app->Render();
+
+                frameTimer.Stop();
+
+                if (frame >= m_options.m_numWarmUpFrames)
+                {
+                    frameTimesMS.push_back(frameTimer.GetTimeTakenMS());
+                }
+
+                runningTime += TimeIntervalSecs(m_options.m_frameDeltaTime);
+            }
+
+            m_isRunning = false;
+
+            if (frameTimesMS.empty() == false)
+            {
+                m_renderStats = renderSystem->GetStats();
+            }
+
+            app->Background();
+            app->Suspend();
+            app->Destroy();
+            delete app;
+
+            m_report = CalculateReport(std::move(frameTimesMS));
+            OutputReport();
+
+            return (m_report.m_numFrames > 0) ? 0 : 1;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const CSCore::Integer2& HeadlessDriver::GetResolution() const
+        {
+            return m_resolution;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void HeadlessDriver::SetResolution(const CSCore::Integer2& in_resolution)
+        {
+            m_resolution = CSCore::Integer2::Max(in_resolution, CSCore::Integer2::k_one);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const HeadlessDriver::FrameTimeReport& HeadlessDriver::GetReport() const
+        {
+            return m_report;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const CSBackend::Null::RenderSystem::Stats& HeadlessDriver::GetRenderStats() const
+        {
+            return m_renderStats;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void HeadlessDriver::Quit()
+        {
+            m_isRunning = false;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void HeadlessDriver::OutputReport() const
+        {
+            std::cout << std::fixed << std::setprecision(3);
+            std::cout << "Frames: " << m_report.m_numFrames << " (+" << m_options.m_numWarmUpFrames << " warm up)" << std::endl;
+            std::cout << "Total:  " << m_report.m_totalMS << "ms" << std::endl;
+            std::cout << "Min:    " << m_report.m_minMS << "ms" << std::endl;
+            std::cout << "Mean:   " << m_report.m_meanMS << "ms" << std::endl;
+            std::cout << "P50:    " << m_report.m_p50MS << "ms" << std::endl;
+            std::cout << "P90:    " << m_report.m_p90MS << "ms" << std::endl;
+            std::cout << "P95:    " << m_report.m_p95MS << "ms" << std::endl;
+            std::cout << "P99:    " << m_report.m_p99MS << "ms" << std::endl;
+            std::cout << "Max:    " << m_report.m_maxMS << "ms" << std::endl;
+
+            const f64 numFrames = f64(std::max(m_report.m_numFrames, 1u));
+            std::cout << std::left << std::setw(28) << "Draw calls per frame:" << f64(m_renderStats.m_numDrawCalls) / numFrames << std::endl;
+            std::cout << std::left << std::setw(28) << "Vertices per frame:" << f64(m_renderStats.m_numVerticesSubmitted) / numFrames << std::endl;
+            std::cout << std::left << std::setw(28) << "Indices per frame:" << f64(m_renderStats.m_numIndicesSubmitted) / numFrames << std::endl;
+            std::cout << std::left << std::setw(28) << "State changes per frame:" << f64(m_renderStats.m_numStateChanges) / numFrames << std::endl;
+            std::cout << std::left << std::setw(28) << "Material changes per frame:" << f64(m_renderStats.m_numMaterialChanges) / numFrames << std::endl;
+            std::cout << std::left << std::setw(28) << "Shader switches per frame:" << f64(m_renderStats.m_numShaderSwitches) / numFrames << std::endl;
+            std::cout << std::left << std::setw(28) << "Bytes uploaded per frame:" << f64(m_renderStats.m_numBytesUploaded) / numFrames << std::endl;
+
+            if (m_options.m_reportFilePath.empty() == false)
+            {
+                Json::Value root(Json::objectValue);
+                root["NumFrames"] = m_report.m_numFrames;
+                root["NumWarmUpFrames"] = m_options.m_numWarmUpFrames;
+                root["FrameDeltaTime"] = m_options.m_frameDeltaTime;
+                root["TotalMS"] = m_report.m_totalMS;
+                root["MinMS"] = m_report.m_minMS;
+                root["MeanMS"] = m_report.m_meanMS;
+                root["P50MS"] = m_report.m_p50MS;
+                root["P90MS"] = m_report.m_p90MS;
+                root["P95MS"] = m_report.m_p95MS;
+                root["P99MS"] = m_report.m_p99MS;
+                root["MaxMS"] = m_report.m_maxMS;
+
+                Json::Value renderStats(Json::objectValue);
+                renderStats["NumDrawCalls"] = m_renderStats.m_numDrawCalls;
+                renderStats["NumVerticesSubmitted"] = Json::UInt64(m_renderStats.m_numVerticesSubmitted);
+                renderStats["NumIndicesSubmitted"] = Json::UInt64(m_renderStats.m_numIndicesSubmitted);
+                renderStats["NumStateChanges"] = m_renderStats.m_numStateChanges;
+                renderStats["NumMaterialChanges"] = m_renderStats.m_numMaterialChanges;
+                renderStats["NumShaderSwitches"] = m_renderStats.m_numShaderSwitches;
+                renderStats["NumUploads"] = m_renderStats.m_numUploads;
+                renderStats["NumBytesUploaded"] = Json::UInt64(m_renderStats.m_numBytesUploaded);
+                root["RenderStats"] = renderStats;
+
+                std::ofstream file(m_options.m_reportFilePath);
+                if (file.good() == true)
+                {
+                    Json::StyledWriter writer;
+                    file << writer.write(root);
+                }
+                else
+                {
+                    std::cerr << "[Chilli Source] Could not write frame time report to '" << m_options.m_reportFilePath << "'." << std::endl;
+                }
+            }
+        }
+    }
+}
+
+#endif
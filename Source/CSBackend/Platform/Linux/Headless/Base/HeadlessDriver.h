@@ -0,0 +1,178 @@
+//
+//  HeadlessDriver.h
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#ifndef _CSBACKEND_PLATFORM_LINUX_HEADLESS_BASE_HEADLESSDRIVER_H_
+#define _CSBACKEND_PLATFORM_LINUX_HEADLESS_BASE_HEADLESSDRIVER_H_
+
+#include <CSBackend/Platform/Linux/ForwardDeclarations.h>
+#include <CSBackend/Rendering/Null/Base/RenderSystem.h>
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/Singleton.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+
+#include <string>
+#include <vector>
+
+namespace CSBackend
+{
+    namespace Linux
+    {
+        //------------------------------------------------------------------------------
+        /// Drives the application without a window or GPU. A fixed time step is passed
+        /// to the application each frame, regardless of how long the frame actually
+        /// took, so that runs are deterministic. The wall clock time of each frame is
+        /// measured and, once the requested number of frames have been run, a report
+        /// containing the frame time percentiles is output. The report also contains
+        /// the rendering statistics gathered by the null render system over the
+        /// measured frames, which do not vary between runs.
+        ///
+        /// This is intended for running automated performance benchmarks.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        class HeadlessDriver final : public CSCore::Singleton<HeadlessDriver>
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// The options used to run the application.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            struct Options
+            {
+                u32 m_numFrames = 1000;
+                u32 m_numWarmUpFrames = 60;
+                f32 m_frameDeltaTime = 1.0f / 60.0f;
+                CSCore::Integer2 m_resolution = CSCore::Integer2(1280, 720);
+                std::string m_reportFilePath;
+            };
+            //------------------------------------------------------------------------------
+            /// A summary of the measured frame times. All times are in milliseconds.
+            /// Percentiles are calculated using the nearest rank method.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            struct FrameTimeReport
+            {
+                u32 m_numFrames = 0;
+                f64 m_totalMS = 0.0;
+                f64 m_minMS = 0.0;
+                f64 m_meanMS = 0.0;
+                f64 m_p50MS = 0.0;
+                f64 m_p90MS = 0.0;
+                f64 m_p95MS = 0.0;
+                f64 m_p99MS = 0.0;
+                f64 m_maxMS = 0.0;
+            };
+            //------------------------------------------------------------------------------
+            /// Builds a report from the given list of frame times.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The frame times in milliseconds.
+            ///
+            /// @return The report.
+            //------------------------------------------------------------------------------
+            static FrameTimeReport CalculateReport(std::vector<f64> in_frameTimesMS);
+            //------------------------------------------------------------------------------
+            /// Creates the application and runs it for the requested number of frames,
+            /// or until the application quits, then outputs the frame time report to
+            /// standard out and, if requested, to file.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The options.
+            ///
+            /// @return The process exit code. This is non-zero if no frames were
+            /// measured.
+            //------------------------------------------------------------------------------
+            s32 Run(const Options& in_options);
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The size of the virtual screen.
+            //------------------------------------------------------------------------------
+            const CSCore::Integer2& GetResolution() const;
+            //------------------------------------------------------------------------------
+            /// Sets the size of the virtual screen.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The new resolution.
+            //------------------------------------------------------------------------------
+            void SetResolution(const CSCore::Integer2& in_resolution);
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The report for the last completed run.
+            //------------------------------------------------------------------------------
+            const FrameTimeReport& GetReport() const;
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The rendering statistics for the measured frames of the last
+            /// completed run.
+            //------------------------------------------------------------------------------
+            const CSBackend::Null::RenderSystem::Stats& GetRenderStats() const;
+            //------------------------------------------------------------------------------
+            /// Stops the run at the end of the current frame.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            void Quit();
+
+        private:
+            friend class CSCore::Singleton<HeadlessDriver>;
+            //------------------------------------------------------------------------------
+            /// Private constructor to enforce use of the singleton.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            HeadlessDriver() = default;
+            //------------------------------------------------------------------------------
+            /// Writes the report to standard out and, if a path was supplied in the
+            /// options, to the given file in json format.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            void OutputReport() const;
+
+            Options m_options;
+            CSCore::Integer2 m_resolution = CSCore::Integer2(1280, 720);
+            FrameTimeReport m_report;
+            CSBackend::Null::RenderSystem::Stats m_renderStats;
+            bool m_isRunning = false;
+        };
+    }
+}
+
+#endif
+
+#endif
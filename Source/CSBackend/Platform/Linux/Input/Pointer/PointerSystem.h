@@ -0,0 +1,93 @@
+//
+//  PointerSystem.h
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#ifndef _CSBACKEND_PLATFORM_LINUX_INPUT_POINTER_POINTERSYSTEM_H_
+#define _CSBACKEND_PLATFORM_LINUX_INPUT_POINTER_POINTERSYSTEM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Platform/Linux/ForwardDeclarations.h>
+#include <ChilliSource/Input/Pointer/PointerSystem.h>
+
+namespace CSBackend
+{
+    namespace Linux
+    {
+        //------------------------------------------------------------
+        /// The headless Linux backend for the pointer system. There
+        /// is no window to receive mouse events from, so pointer
+        /// events are only generated if they are injected by the
+        /// application.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------
+        class PointerSystem final : public CSInput::PointerSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(PointerSystem);
+            //----------------------------------------------------
+            /// Queries whether or not this system implements the
+            /// interface with the given ID.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The interface Id.
+            ///
+            /// @return Whether or not the interface is implemented.
+            //----------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //----------------------------------------------------
+            /// Does nothing as there is no cursor when headless.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------
+            void HideCursor() override;
+            //----------------------------------------------------
+            /// Does nothing as there is no cursor when headless.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------
+            void ShowCursor() override;
+
+        private:
+            friend class CSInput::PointerSystem;
+            //------------------------------------------------
+            /// Default constructor. Declared private to force
+            /// the use of the factory method.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------
+            PointerSystem() = default;
+        };
+    }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,105 @@
+//
+//  Main.cpp
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#include <CSBackend/Platform/Linux/Headless/Base/HeadlessDriver.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+//----------------------------------------------------------------------------------
+/// Includes the "main" function for the headless Linux backend. This will create
+/// the inherited CS application using the exposed CreateApplication method that
+/// the application code base must implement, run it for a fixed number of frames
+/// and report the frame times. The following options are supported:
+///
+///     --frames <count>        The number of measured frames. Defaults to 1000.
+///     --warmup <count>        The number of unmeasured frames run first.
+///                             Defaults to 60.
+///     --fps <fps>             The fixed frame rate used to calculate the time
+///                             step. Defaults to 60.
+///     --resolution <w> <h>    The virtual screen size. Defaults to 1280 x 720.
+///     --report <path>         Writes the report to the given file as json.
+///
+/// @author Ian Copland
+///
+/// @param The number of arguments.
+/// @param The arguments.
+///
+/// @return Exit status
+//----------------------------------------------------------------------------------
+int main(int in_argc, char** in_argv)
+{
+    CSBackend::Linux::HeadlessDriver::Options options;
+
+    for (int i = 1; i < in_argc; ++i)
+    {
+        const bool hasValue = (i + 1 < in_argc);
+
+        if (std::strcmp(in_argv[i], "--frames") == 0 && hasValue == true)
+        {
+            options.m_numFrames = u32(std::atoi(in_argv[++i]));
+        }
+        else if (std::strcmp(in_argv[i], "--warmup") == 0 && hasValue == true)
+        {
+            options.m_numWarmUpFrames = u32(std::atoi(in_argv[++i]));
+        }
+        else if (std::strcmp(in_argv[i], "--fps") == 0 && hasValue == true)
+        {
+            f32 fps = f32(std::atof(in_argv[++i]));
+            if (fps > 0.0f)
+            {
+                options.m_frameDeltaTime = 1.0f / fps;
+            }
+        }
+        else if (std::strcmp(in_argv[i], "--resolution") == 0 && i + 2 < in_argc)
+        {
+            options.m_resolution.x = std::atoi(in_argv[++i]);
+            options.m_resolution.y = std::atoi(in_argv[++i]);
+        }
+        else if (std::strcmp(in_argv[i], "--report") == 0 && hasValue == true)
+        {
+            options.m_reportFilePath = in_argv[++i];
+        }
+        else
+        {
+            std::cerr << "Unknown or incomplete argument: " << in_argv[i] << std::endl;
+            return 1;
+        }
+    }
+
+    CSBackend::Linux::HeadlessDriver::Create();
+    s32 result = CSBackend::Linux::HeadlessDriver::Get()->Run(options);
+    CSBackend::Linux::HeadlessDriver::Destroy();
+
+    return result;
+}
+
+#endif
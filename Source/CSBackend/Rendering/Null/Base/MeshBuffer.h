@@ -0,0 +1,120 @@
+//
+//  MeshBuffer.h
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_BASE_MESHBUFFER_H_
+#define _CSBACKEND_RENDERING_NULL_BASE_MESHBUFFER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Base/MeshBuffer.h>
+
+#include <vector>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //-----------------------------------------------------------
+        /// A mesh buffer for the null renderer. The vertex and index
+        /// data is held in system memory so that locking the buffer
+        /// behaves as it would on a real renderer. Unlocking the
+        /// buffer records an upload of its full capacity with the
+        /// render system.
+        ///
+        /// @author Ian Copland
+        //-----------------------------------------------------------
+        class MeshBuffer final : public CSRendering::MeshBuffer
+        {
+        public:
+            //-----------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The buffer description.
+            /// @param The render system which created the buffer.
+            //-----------------------------------------------------
+            MeshBuffer(CSRendering::BufferDescription& in_desc, RenderSystem* in_renderSystem);
+            //-----------------------------------------------------
+            /// Does nothing as there is no context to bind to.
+            ///
+            /// @author Ian Copland
+            //-----------------------------------------------------
+            void Bind() override;
+            //-----------------------------------------------------
+            /// Obtain a pointer to the vertex data in order to
+            /// write to it.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param [Out] The pointer to the buffer.
+            /// @param The offset into the buffer.
+            /// @param The vertex layout stride.
+            ///
+            /// @return Whether or not this was successful.
+            //-----------------------------------------------------
+            bool LockVertex(f32** out_buffer, u32 in_dataOffset, u32 in_dataStride) override;
+            //-----------------------------------------------------
+            /// Obtain a pointer to the index data in order to
+            /// write to it.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param [Out] The pointer to the buffer.
+            /// @param The offset into the buffer.
+            /// @param The index stride.
+            ///
+            /// @return Whether or not this was successful.
+            //-----------------------------------------------------
+            bool LockIndex(u16** out_buffer, u32 in_dataOffset, u32 in_dataStride) override;
+            //-----------------------------------------------------
+            /// Releases the vertex data.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not this was successful.
+            //-----------------------------------------------------
+            bool UnlockVertex() override;
+            //-----------------------------------------------------
+            /// Releases the index data.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not this was successful.
+            //-----------------------------------------------------
+            bool UnlockIndex() override;
+
+        private:
+            RenderSystem* m_renderSystem;
+            std::vector<u8> m_vertexData;
+            std::vector<u8> m_indexData;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,79 @@
+//
+//  RenderCapabilities.cpp
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Base/RenderCapabilities.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        namespace
+        {
+            const u32 k_maxTextureSize = 8192;
+            const u32 k_numTextureUnits = 8;
+        }
+
+        CS_DEFINE_NAMEDTYPE(RenderCapabilities);
+        //-------------------------------------------------
+        //-------------------------------------------------
+        bool RenderCapabilities::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return (CSRendering::RenderCapabilities::InterfaceID == in_interfaceId || RenderCapabilities::InterfaceID == in_interfaceId);
+        }
+        //-------------------------------------------------
+        //-------------------------------------------------
+        bool RenderCapabilities::IsShadowMappingSupported() const
+        {
+            return true;
+        }
+        //-------------------------------------------------
+        //-------------------------------------------------
+        bool RenderCapabilities::IsDepthTextureSupported() const
+        {
+            return true;
+        }
+        //-------------------------------------------------
+        //-------------------------------------------------
+        bool RenderCapabilities::IsMapBufferSupported() const
+        {
+            return false;
+        }
+        //-------------------------------------------------
+        //-------------------------------------------------
+        u32 RenderCapabilities::GetMaxTextureSize() const
+        {
+            return k_maxTextureSize;
+        }
+        //-------------------------------------------------
+        //-------------------------------------------------
+        u32 RenderCapabilities::GetNumTextureUnits() const
+        {
+            return k_numTextureUnits;
+        }
+    }
+}
@@ -0,0 +1,388 @@
+//
+//  RenderSystem.cpp
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Base/RenderSystem.h>
+
+#include <CSBackend/Rendering/Null/Base/MeshBuffer.h>
+#include <CSBackend/Rendering/Null/Base/RenderTarget.h>
+#include <ChilliSource/Rendering/Material/Material.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        CS_DEFINE_NAMEDTYPE(RenderSystem);
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        RenderSystem::RenderSystem(CSRendering::RenderCapabilities* in_renderCapabilities)
+        {
+            CS_ASSERT(in_renderCapabilities != nullptr, "Cannot create a render system without render capabilities.");
+
+            m_currentStates.fill(false);
+            m_lockedStates.fill(false);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        bool RenderSystem::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return (CSRendering::RenderSystem::InterfaceID == in_interfaceId || RenderSystem::InterfaceID == in_interfaceId);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Init()
+        {
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Resume()
+        {
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Suspend()
+        {
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Destroy()
+        {
+            m_currentMaterial = nullptr;
+            m_currentShader = nullptr;
+            m_lightComponent = nullptr;
+            m_commandLog.clear();
+            m_commandLog.shrink_to_fit();
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::BeginFrame(CSRendering::RenderTarget* in_activeRenderTarget)
+        {
+            Record(CommandType::k_beginFrame);
+
+            if (in_activeRenderTarget != nullptr)
+            {
+                in_activeRenderTarget->Bind();
+            }
+
+            EnableColourWriting(true);
+            EnableDepthWriting(true);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EndFrame(CSRendering::RenderTarget* in_activeRenderTarget)
+        {
+            if (in_activeRenderTarget != nullptr)
+            {
+                in_activeRenderTarget->Discard();
+            }
+
+            m_currentMaterial = nullptr;
+            m_currentShader = nullptr;
+
+            Record(CommandType::k_endFrame);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::ApplyMaterial(const CSRendering::MaterialCSPtr& in_material, CSRendering::ShaderPass in_shaderPass)
+        {
+            CS_ASSERT(in_material != nullptr, "Cannot apply null material");
+
+            const CSRendering::Shader* shader = in_material->GetShader(in_shaderPass).get();
+            CS_ASSERT(shader != nullptr, "Cannot render with null shader");
+
+            if (m_currentMaterial != in_material.get() || m_currentShader != shader || in_material->IsCacheValid() == false)
+            {
+                m_currentMaterial = in_material.get();
+                m_stats.m_numMaterialChanges++;
+                Record(CommandType::k_applyMaterial);
+
+                if (m_currentShader != shader)
+                {
+                    m_currentShader = shader;
+                    m_stats.m_numShaderSwitches++;
+                    Record(CommandType::k_bindShader);
+                }
+
+                EnableAlphaBlending(in_material->IsTransparencyEnabled());
+                SetBlendFunction(in_material->GetSourceBlendMode(), in_material->GetDestBlendMode());
+                EnableFaceCulling(in_material->IsFaceCullingEnabled());
+                SetCullFace(in_material->GetCullFace());
+                EnableColourWriting(in_material->IsColourWriteEnabled());
+                EnableDepthWriting(in_material->IsDepthWriteEnabled());
+                EnableDepthTesting(in_material->IsDepthTestEnabled());
+
+                const_cast<CSRendering::Material*>(m_currentMaterial)->SetCacheValid();
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::ApplyJoints(const std::vector<CSCore::Matrix4>& in_joints)
+        {
+            CS_ASSERT(m_currentShader != nullptr, "Cannot set joints without binding shader");
+
+            Record(CommandType::k_applyJoints, u32(in_joints.size()));
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::ApplyCamera(const CSCore::Vector3& in_position, const CSCore::Matrix4& in_invView, const CSCore::Matrix4& in_projection, const CSCore::Colour& in_clearColour)
+        {
+            m_clearColour = in_clearColour;
+
+            Record(CommandType::k_applyCamera);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetLight(CSRendering::LightComponent* in_lightComponent)
+        {
+            m_lightComponent = in_lightComponent;
+
+            Record(CommandType::k_setLight);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableAlphaBlending(bool in_enabled)
+        {
+            SetRenderState(RenderState::k_alphaBlending, in_enabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableDepthTesting(bool in_enabled)
+        {
+            SetRenderState(RenderState::k_depthTesting, in_enabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableFaceCulling(bool in_enabled)
+        {
+            SetRenderState(RenderState::k_faceCulling, in_enabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableColourWriting(bool in_enabled)
+        {
+            SetRenderState(RenderState::k_colourWriting, in_enabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableDepthWriting(bool in_enabled)
+        {
+            SetRenderState(RenderState::k_depthWriting, in_enabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableScissorTesting(bool in_enabled)
+        {
+            SetRenderState(RenderState::k_scissorTesting, in_enabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::LockDepthWriting()
+        {
+            m_lockedStates[u32(RenderState::k_depthWriting)] = true;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::UnlockDepthWriting()
+        {
+            m_lockedStates[u32(RenderState::k_depthWriting)] = false;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::LockAlphaBlending()
+        {
+            m_lockedStates[u32(RenderState::k_alphaBlending)] = true;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::UnlockAlphaBlending()
+        {
+            m_lockedStates[u32(RenderState::k_alphaBlending)] = false;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::LockBlendFunction()
+        {
+            m_isBlendFunctionLocked = true;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::UnlockBlendFunction()
+        {
+            m_isBlendFunctionLocked = false;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetBlendFunction(CSRendering::BlendMode in_source, CSRendering::BlendMode in_destination)
+        {
+            if (m_isBlendFunctionLocked == false && (m_sourceBlendMode != in_source || m_destinationBlendMode != in_destination))
+            {
+                m_sourceBlendMode = in_source;
+                m_destinationBlendMode = in_destination;
+
+                m_stats.m_numStateChanges++;
+                Record(CommandType::k_setBlendFunction, u32(in_source), u32(in_destination));
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetDepthFunction(CSRendering::DepthTestComparison in_function)
+        {
+            if (m_depthFunction != in_function)
+            {
+                m_depthFunction = in_function;
+
+                m_stats.m_numStateChanges++;
+                Record(CommandType::k_setDepthFunction, u32(in_function));
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetCullFace(CSRendering::CullFace in_cullFace)
+        {
+            if (m_cullFace != in_cullFace)
+            {
+                m_cullFace = in_cullFace;
+
+                m_stats.m_numStateChanges++;
+                Record(CommandType::k_setCullFace, u32(in_cullFace));
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetScissorRegion(const CSCore::Vector2& in_position, const CSCore::Vector2& in_size)
+        {
+            if (m_scissorPosition != in_position || m_scissorSize != in_size)
+            {
+                m_scissorPosition = in_position;
+                m_scissorSize = in_size;
+
+                m_stats.m_numStateChanges++;
+                Record(CommandType::k_setScissorRegion);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        CSRendering::MeshBuffer* RenderSystem::CreateBuffer(CSRendering::BufferDescription& in_desc)
+        {
+            return new MeshBuffer(in_desc, this);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::RenderVertexBuffer(CSRendering::MeshBuffer* in_buffer, u32 in_offset, u32 in_numVertices, const CSCore::Matrix4& in_world)
+        {
+            CS_ASSERT(m_currentShader != nullptr, "Cannot render without a material applied.");
+            CS_ASSERT(in_buffer != nullptr, "Cannot render a null buffer.");
+
+            m_stats.m_numDrawCalls++;
+            m_stats.m_numVerticesSubmitted += in_numVertices;
+            Record(CommandType::k_renderVertices, in_offset, in_numVertices);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::RenderBuffer(CSRendering::MeshBuffer* in_buffer, u32 in_offset, u32 in_numIndices, const CSCore::Matrix4& in_world)
+        {
+            CS_ASSERT(m_currentShader != nullptr, "Cannot render without a material applied.");
+            CS_ASSERT(in_buffer != nullptr, "Cannot render a null buffer.");
+
+            m_stats.m_numDrawCalls++;
+            m_stats.m_numIndicesSubmitted += in_numIndices;
+            Record(CommandType::k_render, in_offset, in_numIndices);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        CSRendering::RenderTarget* RenderSystem::CreateRenderTarget(u32 in_width, u32 in_height)
+        {
+            return new RenderTarget(in_width, in_height);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::RecordUpload(u32 in_numBytes)
+        {
+            m_stats.m_numUploads++;
+            m_stats.m_numBytesUploaded += in_numBytes;
+            Record(CommandType::k_upload, in_numBytes);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        const RenderSystem::Stats& RenderSystem::GetStats() const
+        {
+            return m_stats;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::ResetStats()
+        {
+            m_stats = Stats();
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetCommandRecordingEnabled(bool in_enabled)
+        {
+            m_isCommandRecordingEnabled = in_enabled;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        bool RenderSystem::IsCommandRecordingEnabled() const
+        {
+            return m_isCommandRecordingEnabled;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        const std::vector<RenderSystem::Command>& RenderSystem::GetCommandLog() const
+        {
+            return m_commandLog;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::ClearCommandLog()
+        {
+            m_commandLog.clear();
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetRenderState(RenderState in_state, bool in_enabled)
+        {
+            const u32 index = u32(in_state);
+            if (m_lockedStates[index] == false && m_currentStates[index] != in_enabled)
+            {
+                m_currentStates[index] = in_enabled;
+
+                m_stats.m_numStateChanges++;
+                Record(CommandType::k_setRenderState, index, in_enabled ? 1 : 0);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Record(CommandType in_type, u32 in_arg0, u32 in_arg1)
+        {
+            if (m_isCommandRecordingEnabled == true)
+            {
+                m_commandLog.push_back(Command{in_type, in_arg0, in_arg1});
+            }
+        }
+    }
+}
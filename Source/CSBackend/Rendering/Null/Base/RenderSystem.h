@@ -0,0 +1,473 @@
+//
+//  RenderSystem.h
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_BASE_RENDERSYSTEM_H_
+#define _CSBACKEND_RENDERING_NULL_BASE_RENDERSYSTEM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Rendering/Base/BlendMode.h>
+#include <ChilliSource/Rendering/Base/CullFace.h>
+#include <ChilliSource/Rendering/Base/DepthTestComparison.h>
+#include <ChilliSource/Rendering/Base/RenderSystem.h>
+
+#include <array>
+#include <vector>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //----------------------------------------------------------
+        /// A render system which performs no rendering. Render
+        /// state is tracked as it would be on a real renderer, but
+        /// no graphics API is called. This allows the engine to run
+        /// headless, and for the cost of everything other than the
+        /// GPU work to be measured.
+        ///
+        /// Statistics are kept on the work which would have been
+        /// submitted to the GPU. State changes and shader switches
+        /// are only counted when the value actually changes, as a
+        /// caching renderer would only issue these calls. If
+        /// enabled, each call is also recorded into a command log.
+        ///
+        /// @author Ian Copland
+        //----------------------------------------------------------
+        class RenderSystem final : public CSRendering::RenderSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(RenderSystem);
+            //----------------------------------------------------------
+            /// The render states which are tracked by the system.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            enum class RenderState
+            {
+                k_alphaBlending,
+                k_depthTesting,
+                k_faceCulling,
+                k_colourWriting,
+                k_depthWriting,
+                k_scissorTesting,
+                k_total
+            };
+            //----------------------------------------------------------
+            /// The types of command which are recorded in the command
+            /// log. The meaning of the command arguments depends on
+            /// the type:
+            ///
+            /// k_setRenderState: The render state and 0 or 1.
+            /// k_setBlendFunction: The source and destination modes.
+            /// k_setDepthFunction: The comparison function.
+            /// k_setCullFace: The cull face.
+            /// k_applyJoints: The number of joints.
+            /// k_render: The index offset and number of indices.
+            /// k_renderVertices: The vertex offset and number of
+            /// vertices.
+            /// k_upload: The number of bytes.
+            ///
+            /// All other commands have no arguments.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            enum class CommandType
+            {
+                k_beginFrame,
+                k_endFrame,
+                k_applyMaterial,
+                k_bindShader,
+                k_applyJoints,
+                k_applyCamera,
+                k_setLight,
+                k_setRenderState,
+                k_setBlendFunction,
+                k_setDepthFunction,
+                k_setCullFace,
+                k_setScissorRegion,
+                k_render,
+                k_renderVertices,
+                k_upload
+            };
+            //----------------------------------------------------------
+            /// A single recorded command.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            struct Command
+            {
+                CommandType m_type;
+                u32 m_arg0;
+                u32 m_arg1;
+            };
+            //----------------------------------------------------------
+            /// Statistics on the work that would have been submitted
+            /// to the GPU since the stats were last reset.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            struct Stats
+            {
+                u32 m_numDrawCalls = 0;
+                u64 m_numVerticesSubmitted = 0;
+                u64 m_numIndicesSubmitted = 0;
+                u32 m_numStateChanges = 0;
+                u32 m_numMaterialChanges = 0;
+                u32 m_numShaderSwitches = 0;
+                u32 m_numUploads = 0;
+                u64 m_numBytesUploaded = 0;
+            };
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The interface Id.
+            ///
+            /// @return Whether or not this object implements the given
+            /// interface.
+            //----------------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //----------------------------------------------------------
+            /// Called when the system is created.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void Init() override;
+            //----------------------------------------------------------
+            /// Called when the app resumes.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void Resume() override;
+            //----------------------------------------------------------
+            /// Called when the app suspends.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void Suspend() override;
+            //----------------------------------------------------------
+            /// Called when the app is being destroyed.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void Destroy() override;
+            //----------------------------------------------------------
+            /// Called at the start of rendering a frame.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The active render target. May be null.
+            //----------------------------------------------------------
+            void BeginFrame(CSRendering::RenderTarget* in_activeRenderTarget) override;
+            //----------------------------------------------------------
+            /// Called at the end of rendering a frame.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The active render target. May be null.
+            //----------------------------------------------------------
+            void EndFrame(CSRendering::RenderTarget* in_activeRenderTarget) override;
+            //----------------------------------------------------------
+            /// Applies the render states described by the given material.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The material.
+            /// @param The shader pass.
+            //----------------------------------------------------------
+            void ApplyMaterial(const CSRendering::MaterialCSPtr& in_material, CSRendering::ShaderPass in_shaderPass) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The joint matrices.
+            //----------------------------------------------------------
+            void ApplyJoints(const std::vector<CSCore::Matrix4>& in_joints) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The camera position.
+            /// @param The inverse view matrix.
+            /// @param The projection matrix.
+            /// @param The clear colour.
+            //----------------------------------------------------------
+            void ApplyCamera(const CSCore::Vector3& in_position, const CSCore::Matrix4& in_invView, const CSCore::Matrix4& in_projection, const CSCore::Colour& in_clearColour) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The light component.
+            //----------------------------------------------------------
+            void SetLight(CSRendering::LightComponent* in_lightComponent) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param Whether or not alpha blending is enabled.
+            //----------------------------------------------------------
+            void EnableAlphaBlending(bool in_enabled) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param Whether or not depth testing is enabled.
+            //----------------------------------------------------------
+            void EnableDepthTesting(bool in_enabled) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param Whether or not face culling is enabled.
+            //----------------------------------------------------------
+            void EnableFaceCulling(bool in_enabled) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param Whether or not colour writing is enabled.
+            //----------------------------------------------------------
+            void EnableColourWriting(bool in_enabled) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param Whether or not depth writing is enabled.
+            //----------------------------------------------------------
+            void EnableDepthWriting(bool in_enabled) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param Whether or not scissor testing is enabled.
+            //----------------------------------------------------------
+            void EnableScissorTesting(bool in_enabled) override;
+            //----------------------------------------------------------
+            /// Prevents depth writing from being changed.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void LockDepthWriting() override;
+            //----------------------------------------------------------
+            /// Allows depth writing to be changed.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void UnlockDepthWriting() override;
+            //----------------------------------------------------------
+            /// Prevents alpha blending from being changed.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void LockAlphaBlending() override;
+            //----------------------------------------------------------
+            /// Allows alpha blending to be changed.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void UnlockAlphaBlending() override;
+            //----------------------------------------------------------
+            /// Prevents the blend function from being changed.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void LockBlendFunction() override;
+            //----------------------------------------------------------
+            /// Allows the blend function to be changed.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void UnlockBlendFunction() override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The source blend mode.
+            /// @param The destination blend mode.
+            //----------------------------------------------------------
+            void SetBlendFunction(CSRendering::BlendMode in_source, CSRendering::BlendMode in_destination) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The depth test comparison function.
+            //----------------------------------------------------------
+            void SetDepthFunction(CSRendering::DepthTestComparison in_function) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The cull face.
+            //----------------------------------------------------------
+            void SetCullFace(CSRendering::CullFace in_cullFace) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The position of the bottom left of the region.
+            /// @param The size of the region.
+            //----------------------------------------------------------
+            void SetScissorRegion(const CSCore::Vector2& in_position, const CSCore::Vector2& in_size) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The buffer description.
+            ///
+            /// @return A new mesh buffer. Ownership is passed to the
+            /// caller.
+            //----------------------------------------------------------
+            CSRendering::MeshBuffer* CreateBuffer(CSRendering::BufferDescription& in_desc) override;
+            //----------------------------------------------------------
+            /// Renders the contents of the given buffer without indices.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The buffer.
+            /// @param The offset into the vertex buffer.
+            /// @param The number of vertices.
+            /// @param The world matrix.
+            //----------------------------------------------------------
+            void RenderVertexBuffer(CSRendering::MeshBuffer* in_buffer, u32 in_offset, u32 in_numVertices, const CSCore::Matrix4& in_world) override;
+            //----------------------------------------------------------
+            /// Renders the contents of the given buffer.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The buffer.
+            /// @param The offset into the index buffer.
+            /// @param The number of indices.
+            /// @param The world matrix.
+            //----------------------------------------------------------
+            void RenderBuffer(CSRendering::MeshBuffer* in_buffer, u32 in_offset, u32 in_numIndices, const CSCore::Matrix4& in_world) override;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The width.
+            /// @param The height.
+            ///
+            /// @return A new render target. Ownership is passed to the
+            /// caller.
+            //----------------------------------------------------------
+            CSRendering::RenderTarget* CreateRenderTarget(u32 in_width, u32 in_height) override;
+            //----------------------------------------------------------
+            /// Records an upload of data to the GPU. This is called by
+            /// the null mesh buffers, textures and cubemaps.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The number of bytes uploaded.
+            //----------------------------------------------------------
+            void RecordUpload(u32 in_numBytes);
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The statistics gathered since they were last
+            /// reset.
+            //----------------------------------------------------------
+            const Stats& GetStats() const;
+            //----------------------------------------------------------
+            /// Resets the gathered statistics.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void ResetStats();
+            //----------------------------------------------------------
+            /// Sets whether or not commands are recorded in the command
+            /// log. This is disabled by default as the log will grow
+            /// every frame until it is cleared.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Whether or not recording is enabled.
+            //----------------------------------------------------------
+            void SetCommandRecordingEnabled(bool in_enabled);
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not commands are recorded in the
+            /// command log.
+            //----------------------------------------------------------
+            bool IsCommandRecordingEnabled() const;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The commands recorded since the log was last
+            /// cleared.
+            //----------------------------------------------------------
+            const std::vector<Command>& GetCommandLog() const;
+            //----------------------------------------------------------
+            /// Clears the command log.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void ClearCommandLog();
+
+        private:
+            friend CSRendering::RenderSystemUPtr CSRendering::RenderSystem::Create(CSRendering::RenderCapabilities*);
+            //----------------------------------------------------------
+            /// Private constructor to force use of factory method
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Render capabilities
+            //----------------------------------------------------------
+            RenderSystem(CSRendering::RenderCapabilities* in_renderCapabilities);
+            //----------------------------------------------------------
+            /// Sets the given render state, unless it is locked. A
+            /// state change is recorded if the value changes.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The render state.
+            /// @param Whether or not it is enabled.
+            //----------------------------------------------------------
+            void SetRenderState(RenderState in_state, bool in_enabled);
+            //----------------------------------------------------------
+            /// Adds a command to the command log if recording is
+            /// enabled.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The command type.
+            /// @param [Optional] The first argument.
+            /// @param [Optional] The second argument.
+            //----------------------------------------------------------
+            void Record(CommandType in_type, u32 in_arg0 = 0, u32 in_arg1 = 0);
+
+            std::array<bool, u32(RenderState::k_total)> m_currentStates;
+            std::array<bool, u32(RenderState::k_total)> m_lockedStates;
+            bool m_isBlendFunctionLocked = false;
+
+            CSRendering::BlendMode m_sourceBlendMode = CSRendering::BlendMode::k_one;
+            CSRendering::BlendMode m_destinationBlendMode = CSRendering::BlendMode::k_zero;
+            CSRendering::DepthTestComparison m_depthFunction = CSRendering::DepthTestComparison::k_less;
+            CSRendering::CullFace m_cullFace = CSRendering::CullFace::k_back;
+            CSCore::Vector2 m_scissorPosition;
+            CSCore::Vector2 m_scissorSize;
+            CSCore::Colour m_clearColour;
+
+            const CSRendering::Material* m_currentMaterial = nullptr;
+            const CSRendering::Shader* m_currentShader = nullptr;
+            CSRendering::LightComponent* m_lightComponent = nullptr;
+
+            Stats m_stats;
+            bool m_isCommandRecordingEnabled = false;
+            std::vector<Command> m_commandLog;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,79 @@
+//
+//  RenderTarget.cpp
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Base/RenderTarget.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //------------------------------------------------------
+        //------------------------------------------------------
+        RenderTarget::RenderTarget(u32 in_width, u32 in_height)
+        {
+            mudwWidth = in_width;
+            mudwHeight = in_height;
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void RenderTarget::SetTargetTextures(const CSRendering::TextureSPtr& in_colourTexture, const CSRendering::TextureSPtr& in_depthTexture)
+        {
+            m_colourTexture = in_colourTexture;
+            m_depthTexture = in_depthTexture;
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        const CSRendering::TextureSPtr& RenderTarget::GetColourTexture() const
+        {
+            return m_colourTexture;
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        const CSRendering::TextureSPtr& RenderTarget::GetDepthTexture() const
+        {
+            return m_depthTexture;
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void RenderTarget::Bind()
+        {
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void RenderTarget::Discard()
+        {
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void RenderTarget::Destroy()
+        {
+            m_colourTexture.reset();
+            m_depthTexture.reset();
+        }
+    }
+}
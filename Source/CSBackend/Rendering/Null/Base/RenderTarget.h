@@ -0,0 +1,105 @@
+//
+//  RenderTarget.h
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_BASE_RENDERTARGET_H_
+#define _CSBACKEND_RENDERING_NULL_BASE_RENDERTARGET_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Base/RenderTarget.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //------------------------------------------------------
+        /// A render target for the null renderer. This simply
+        /// holds on to the target textures.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------
+        class RenderTarget final : public CSRendering::RenderTarget
+        {
+        public:
+            //------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The width.
+            /// @param The height.
+            //------------------------------------------------------
+            RenderTarget(u32 in_width, u32 in_height);
+            //------------------------------------------------------
+            /// Sets the textures which will be rendered into.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The colour texture.
+            /// @param The depth texture.
+            //------------------------------------------------------
+            void SetTargetTextures(const CSRendering::TextureSPtr& in_colourTexture, const CSRendering::TextureSPtr& in_depthTexture) override;
+            //------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The colour texture.
+            //------------------------------------------------------
+            const CSRendering::TextureSPtr& GetColourTexture() const override;
+            //------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The depth texture.
+            //------------------------------------------------------
+            const CSRendering::TextureSPtr& GetDepthTexture() const override;
+            //------------------------------------------------------
+            /// Does nothing as there is no frame buffer to bind.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------
+            void Bind() override;
+            //------------------------------------------------------
+            /// Does nothing as there is no frame buffer to discard.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------
+            void Discard() override;
+            //------------------------------------------------------
+            /// Releases the target textures.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------
+            void Destroy() override;
+
+        private:
+            CSRendering::TextureSPtr m_colourTexture;
+            CSRendering::TextureSPtr m_depthTexture;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,74 @@
+//
+//  Shader.h
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_SHADER_SHADER_H_
+#define _CSBACKEND_RENDERING_NULL_SHADER_SHADER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Shader/Shader.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //------------------------------------------------
+        /// A shader for the null renderer. This holds no
+        /// program; it exists so that materials can be
+        /// built and applied as normal.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------
+        class Shader final : public CSRendering::Shader
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(Shader);
+            //------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The interface Id.
+            ///
+            /// @return Whether or not this object implements
+            /// the given interface.
+            //------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+
+        private:
+            friend CSRendering::ShaderUPtr CSRendering::Shader::Create();
+            //------------------------------------------------
+            /// Private constructor to enforce use of the
+            /// factory method.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------
+            Shader() = default;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,112 @@
+//
+//  ShaderProvider.cpp
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Shader/ShaderProvider.h>
+
+#include <CSBackend/Rendering/Null/Shader/Shader.h>
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        namespace
+        {
+            const std::string k_shaderFileExtension("csshader");
+
+            //----------------------------------------------
+            /// Performs the actual loading for the 2
+            /// create methods
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Location
+            /// @param File path
+            /// @param Completion delegate
+            /// @param [Out] Shader resource
+            //----------------------------------------------
+            void LoadShader(CSCore::StorageLocation in_location, const std::string& in_filePath, const CSCore::ResourceProvider::AsyncLoadDelegate& in_delegate, const CSCore::ResourceSPtr& out_shader)
+            {
+                if (CSCore::Application::Get()->GetFileSystem()->DoesFileExist(in_location, in_filePath) == false)
+                {
+                    CS_LOG_ERROR("Failed to open shader file: " + in_filePath);
+                    out_shader->SetLoadState(CSCore::Resource::LoadState::k_failed);
+                }
+                else
+                {
+                    out_shader->SetLoadState(CSCore::Resource::LoadState::k_loaded);
+                }
+
+                if (in_delegate != nullptr)
+                {
+                    CSCore::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_shader));
+                }
+            }
+        }
+
+        CS_DEFINE_NAMEDTYPE(ShaderProvider);
+        //-------------------------------------------------------------------------
+        //-------------------------------------------------------------------------
+        ShaderProviderUPtr ShaderProvider::Create()
+        {
+            return ShaderProviderUPtr(new ShaderProvider());
+        }
+        //-------------------------------------------------------------------------
+        //-------------------------------------------------------------------------
+        bool ShaderProvider::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return in_interfaceId == ResourceProvider::InterfaceID || in_interfaceId == ShaderProvider::InterfaceID;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        CSCore::InterfaceIDType ShaderProvider::GetResourceType() const
+        {
+            return Shader::InterfaceID;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        bool ShaderProvider::CanCreateResourceWithFileExtension(const std::string& in_extension) const
+        {
+            return in_extension == k_shaderFileExtension;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void ShaderProvider::CreateResourceFromFile(CSCore::StorageLocation in_location, const std::string& in_filePath, const CSCore::IResourceOptionsBaseCSPtr& in_options, const CSCore::ResourceSPtr& out_resource)
+        {
+            LoadShader(in_location, in_filePath, nullptr, out_resource);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void ShaderProvider::CreateResourceFromFileAsync(CSCore::StorageLocation in_location, const std::string& in_filePath, const CSCore::IResourceOptionsBaseCSPtr& in_options, const CSCore::ResourceProvider::AsyncLoadDelegate& in_delegate, const CSCore::ResourceSPtr& out_resource)
+        {
+            LoadShader(in_location, in_filePath, in_delegate, out_resource);
+        }
+    }
+}
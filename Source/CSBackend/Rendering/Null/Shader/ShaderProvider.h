@@ -0,0 +1,117 @@
+//
+//  ShaderProvider.h
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_SHADER_SHADERPROVIDER_H_
+#define _CSBACKEND_RENDERING_NULL_SHADER_SHADERPROVIDER_H_
+
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Resource/ResourceProvider.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //----------------------------------------------------------
+        /// Creates shader resources for the null renderer. The
+        /// shader file must exist, but its contents are not parsed.
+        ///
+        /// @author Ian Copland
+        //----------------------------------------------------------
+        class ShaderProvider final : public CSCore::ResourceProvider
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(ShaderProvider);
+            //-------------------------------------------------------
+            /// Factory method
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return New backend with ownership transferred
+            //-------------------------------------------------------
+            static ShaderProviderUPtr Create();
+            //-------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param Interface to compare
+            ///
+            /// @return Whether the object implements the given interface
+            //-------------------------------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The type of resource loaded by this provider
+            //----------------------------------------------------------------------------
+            CSCore::InterfaceIDType GetResourceType() const override;
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param Extension to compare
+            ///
+            /// @return Whether the object can create a resource with the given extension
+            //----------------------------------------------------------------------------
+            bool CanCreateResourceWithFileExtension(const std::string& in_extension) const override;
+
+        private:
+            //-------------------------------------------------------
+            /// Private constructor to force use of factory method
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------
+            ShaderProvider() = default;
+            //----------------------------------------------------------------------------
+            /// Creates the shader resource. Check resource load state for success or
+            /// failure.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The storage location to load from
+            /// @param File path
+            /// @param Options to customise the creation
+            /// @param [Out] Resource object
+            //----------------------------------------------------------------------------
+            void CreateResourceFromFile(CSCore::StorageLocation in_location, const std::string& in_filePath, const CSCore::IResourceOptionsBaseCSPtr& in_options, const CSCore::ResourceSPtr& out_resource) override;
+            //----------------------------------------------------------------------------
+            /// Creates the shader resource. The delegate is called on the main thread
+            /// once complete. Check resource load state for success or failure.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The storage location to load from
+            /// @param File path
+            /// @param Options to customise the creation
+            /// @param Completion delegate
+            /// @param [Out] Resource object
+            //----------------------------------------------------------------------------
+            void CreateResourceFromFileAsync(CSCore::StorageLocation in_location, const std::string& in_filePath, const CSCore::IResourceOptionsBaseCSPtr& in_options, const CSCore::ResourceProvider::AsyncLoadDelegate& in_delegate, const CSCore::ResourceSPtr& out_resource) override;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,89 @@
+//
+//  Cubemap.cpp
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Texture/Cubemap.h>
+
+#include <CSBackend/Rendering/Null/Base/RenderSystem.h>
+#include <ChilliSource/Core/Base/Application.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        CS_DEFINE_NAMEDTYPE(Cubemap);
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        Cubemap::Cubemap()
+            : m_renderSystem(CSCore::Application::Get()->GetSystem<RenderSystem>())
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool Cubemap::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return (CSRendering::Cubemap::InterfaceID == in_interfaceId || Cubemap::InterfaceID == in_interfaceId);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Cubemap::Build(const std::array<CSRendering::Texture::Descriptor, 6>& in_descs, std::array<CSRendering::Texture::TextureDataUPtr, 6>&& in_datas, bool in_mipMap, bool in_restoreCubemapDataEnabled)
+        {
+            if (m_renderSystem == nullptr)
+            {
+                return;
+            }
+
+            for (u32 i = 0; i < in_descs.size(); ++i)
+            {
+                if (in_datas[i] != nullptr)
+                {
+                    m_renderSystem->RecordUpload(in_descs[i].m_dataSize);
+                }
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Cubemap::Bind(u32 in_texUnit)
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Cubemap::Unbind()
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Cubemap::SetFilterMode(CSRendering::Texture::FilterMode in_mode)
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Cubemap::SetWrapMode(CSRendering::Texture::WrapMode in_sMode, CSRendering::Texture::WrapMode in_tMode)
+        {
+        }
+    }
+}
@@ -0,0 +1,114 @@
+//
+//  Cubemap.h
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_TEXTURE_CUBEMAP_H_
+#define _CSBACKEND_RENDERING_NULL_TEXTURE_CUBEMAP_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Texture/Cubemap.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //--------------------------------------------------------------
+        /// A cubemap for the null renderer. The image data is discarded
+        /// once built. The size of the data which would have been
+        /// uploaded is recorded with the render system.
+        ///
+        /// @author Ian Copland
+        //--------------------------------------------------------------
+        class Cubemap final : public CSRendering::Cubemap
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(Cubemap);
+            //--------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The interface Id.
+            ///
+            /// @return Whether or not this object implements the given
+            /// interface.
+            //--------------------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //--------------------------------------------------------------
+            /// Builds the cubemap. The image data is discarded.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The texture descriptors for each face.
+            /// @param The image data for each face.
+            /// @param Whether the cubemap should have mip maps generated
+            /// @param Whether or not the cubemap data should be restored
+            /// after a context loss. This has no effect.
+            //--------------------------------------------------------------
+            void Build(const std::array<CSRendering::Texture::Descriptor, 6>& in_descs, std::array<CSRendering::Texture::TextureDataUPtr, 6>&& in_datas, bool in_mipMap, bool in_restoreCubemapDataEnabled) override;
+            //--------------------------------------------------------------
+            /// Does nothing as there is no context to bind to.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Texture unit
+            //--------------------------------------------------------------
+            void Bind(u32 in_texUnit = 0) override;
+            //--------------------------------------------------------------
+            /// Does nothing as there is no context to unbind from.
+            ///
+            /// @author Ian Copland
+            //--------------------------------------------------------------
+            void Unbind() override;
+            //--------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param Filter mode
+            //--------------------------------------------------------------
+            void SetFilterMode(CSRendering::Texture::FilterMode in_mode) override;
+            //--------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param Horizontal wrapping
+            /// @param Vertical wrapping
+            //--------------------------------------------------------------
+            void SetWrapMode(CSRendering::Texture::WrapMode in_sMode, CSRendering::Texture::WrapMode in_tMode) override;
+
+        private:
+            friend CSRendering::CubemapUPtr CSRendering::Cubemap::Create();
+            //--------------------------------------------------------------
+            /// Private constructor to enforce use of the factory method.
+            ///
+            /// @author Ian Copland
+            //--------------------------------------------------------------
+            Cubemap();
+
+            RenderSystem* m_renderSystem;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,164 @@
+//
+//  Texture.cpp
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Texture/Texture.h>
+
+#include <CSBackend/Rendering/Null/Base/RenderSystem.h>
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Image/ImageFormatConverter.h>
+
+#include <algorithm>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        CS_DEFINE_NAMEDTYPE(Texture);
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        Texture::Texture()
+            : m_renderSystem(CSCore::Application::Get()->GetSystem<RenderSystem>())
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool Texture::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return (CSRendering::Texture::InterfaceID == in_interfaceId || Texture::InterfaceID == in_interfaceId);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::Build(const Descriptor& in_desc, TextureDataUPtr in_data, bool in_mipMap, bool in_restoreTextureDataEnabled)
+        {
+            m_width = in_desc.m_width;
+            m_height = in_desc.m_height;
+            m_format = in_desc.m_format;
+            m_compression = in_desc.m_compression;
+
+            if (in_data != nullptr)
+            {
+                RecordUpload(in_desc.m_dataSize);
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::BuildEmpty(const Descriptor& in_desc, bool in_mipMap, bool in_restoreTextureDataEnabled)
+        {
+            CS_ASSERT(in_desc.m_compression == CSCore::ImageCompression::k_none, "Only uncompressed textures can be built empty.");
+
+            m_width = in_desc.m_width;
+            m_height = in_desc.m_height;
+            m_format = in_desc.m_format;
+            m_compression = in_desc.m_compression;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::UploadRows(u32 in_firstRow, u32 in_numRows, const u8* in_data)
+        {
+            CS_ASSERT(in_firstRow + in_numRows <= m_height, "Cannot upload rows outside of the texture.");
+
+            RecordUpload(CalcRegionSize(m_width, in_numRows));
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::UploadMipLevel(u32 in_level, const u8* in_data)
+        {
+            CS_ASSERT(in_level > 0, "Cannot upload the base level as a mip level.");
+
+            RecordUpload(CalcRegionSize(std::max(m_width >> in_level, 1u), std::max(m_height >> in_level, 1u)));
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::UploadRegion(u32 in_x, u32 in_y, u32 in_width, u32 in_height, const u8* in_data)
+        {
+            CS_ASSERT(in_x + in_width <= m_width && in_y + in_height <= m_height, "Cannot upload a region outside of the texture.");
+
+            RecordUpload(CalcRegionSize(in_width, in_height));
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::CompleteUpload(TextureDataUPtr in_data)
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::Bind(u32 in_texUnit)
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::Unbind()
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::SetFilterMode(FilterMode in_mode)
+        {
+            m_filterMode = in_mode;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::SetWrapMode(WrapMode in_sMode, WrapMode in_tMode)
+        {
+            m_sWrapMode = in_sMode;
+            m_tWrapMode = in_tMode;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 Texture::GetWidth() const
+        {
+            return m_width;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 Texture::GetHeight() const
+        {
+            return m_height;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 Texture::CalcRegionSize(u32 in_width, u32 in_height) const
+        {
+            if (m_compression != CSCore::ImageCompression::k_none)
+            {
+                return 0;
+            }
+
+            return in_width * in_height * CSCore::ImageFormatConverter::GetBytesPerPixel(m_format);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::RecordUpload(u32 in_numBytes)
+        {
+            if (m_renderSystem != nullptr)
+            {
+                m_renderSystem->RecordUpload(in_numBytes);
+            }
+        }
+    }
+}
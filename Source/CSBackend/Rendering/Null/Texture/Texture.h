@@ -0,0 +1,205 @@
+//
+//  Texture.h
+//  Chilli Source
+//  Created by Ian Copland on 18/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_TEXTURE_TEXTURE_H_
+#define _CSBACKEND_RENDERING_NULL_TEXTURE_TEXTURE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Core/Image/ImageCompression.h>
+#include <ChilliSource/Core/Image/ImageFormat.h>
+#include <ChilliSource/Rendering/Texture/Texture.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //--------------------------------------------------------------
+        /// A texture for the null renderer. Only the description of the
+        /// texture is kept; the image data is discarded once built. The
+        /// size of the data which would have been uploaded is recorded
+        /// with the render system.
+        ///
+        /// @author Ian Copland
+        //--------------------------------------------------------------
+        class Texture final : public CSRendering::Texture
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(Texture);
+            //--------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The interface Id.
+            ///
+            /// @return Whether or not this object implements the given
+            /// interface.
+            //--------------------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //--------------------------------------------------------------
+            /// Builds the texture from the given description. The image
+            /// data is discarded.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Texture descriptor
+            /// @param Image data
+            /// @param Whether the texture should have mip maps generated
+            /// @param Whether or not the texture data should be restored
+            /// after a context loss. This has no effect.
+            //--------------------------------------------------------------
+            void Build(const Descriptor& in_desc, TextureDataUPtr in_data, bool in_mipMap, bool in_restoreTextureDataEnabled) override;
+            //--------------------------------------------------------------
+            /// Builds the texture from the given description without any
+            /// image data.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Texture descriptor
+            /// @param Whether the texture should have mip maps generated
+            /// @param Whether or not to restore the texture data
+            //--------------------------------------------------------------
+            void BuildEmpty(const Descriptor& in_desc, bool in_mipMap, bool in_restoreTextureDataEnabled) override;
+            //--------------------------------------------------------------
+            /// Does nothing as there is no texture storage.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The index of the first row.
+            /// @param The number of rows.
+            /// @param The row data.
+            //--------------------------------------------------------------
+            void UploadRows(u32 in_firstRow, u32 in_numRows, const u8* in_data) override;
+            //--------------------------------------------------------------
+            /// Does nothing as there is no texture storage.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The mip level.
+            /// @param The level data.
+            //--------------------------------------------------------------
+            void UploadMipLevel(u32 in_level, const u8* in_data) override;
+            //--------------------------------------------------------------
+            /// Records the size of the region as an upload.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The x position of the left of the region.
+            /// @param The y position of the top of the region.
+            /// @param The width of the region.
+            /// @param The height of the region.
+            /// @param The region data.
+            //--------------------------------------------------------------
+            void UploadRegion(u32 in_x, u32 in_y, u32 in_width, u32 in_height, const u8* in_data) override;
+            //--------------------------------------------------------------
+            /// Does nothing as there is no texture storage.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The texture data.
+            //--------------------------------------------------------------
+            void CompleteUpload(TextureDataUPtr in_data) override;
+            //--------------------------------------------------------------
+            /// Does nothing as there is no context to bind to.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Texture unit
+            //--------------------------------------------------------------
+            void Bind(u32 in_texUnit = 0) override;
+            //--------------------------------------------------------------
+            /// Does nothing as there is no context to unbind from.
+            ///
+            /// @author Ian Copland
+            //--------------------------------------------------------------
+            void Unbind() override;
+            //--------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param Filter mode
+            //--------------------------------------------------------------
+            void SetFilterMode(FilterMode in_mode) override;
+            //--------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param Horizontal wrapping
+            /// @param Vertical wrapping
+            //--------------------------------------------------------------
+            void SetWrapMode(WrapMode in_sMode, WrapMode in_tMode) override;
+            //--------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The width of the texture in texels
+            //--------------------------------------------------------------
+            u32 GetWidth() const override;
+            //--------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The height of the texture in texels
+            //--------------------------------------------------------------
+            u32 GetHeight() const override;
+
+        private:
+            friend CSRendering::TextureUPtr CSRendering::Texture::Create();
+            //--------------------------------------------------------------
+            /// Private constructor to enforce use of the factory method.
+            ///
+            /// @author Ian Copland
+            //--------------------------------------------------------------
+            Texture();
+            //--------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The width of the region in texels.
+            /// @param The height of the region in texels.
+            ///
+            /// @return The size in bytes of an uncompressed region of the
+            /// texture, or zero if the texture is compressed.
+            //--------------------------------------------------------------
+            u32 CalcRegionSize(u32 in_width, u32 in_height) const;
+            //--------------------------------------------------------------
+            /// Records an upload with the render system, if there is one.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The number of bytes.
+            //--------------------------------------------------------------
+            void RecordUpload(u32 in_numBytes);
+
+            RenderSystem* m_renderSystem = nullptr;
+            CSCore::ImageFormat m_format = CSCore::ImageFormat::k_RGBA8888;
+            CSCore::ImageCompression m_compression = CSCore::ImageCompression::k_none;
+            u32 m_width = 0;
+            u32 m_height = 0;
+            FilterMode m_filterMode = FilterMode::k_bilinear;
+            WrapMode m_sWrapMode = WrapMode::k_clamp;
+            WrapMode m_tWrapMode = WrapMode::k_clamp;
+        };
+    }
+}
+
+#endif
@@ -49,6 +49,17 @@ namespace CSBackend
         {
             if(m_hasContextBeenBackedUp == false)
             {
+                CSCore::ResourcePool* resourcePool = CSCore::Application::Get()->GetResourcePool();
+                
+                //---Textures
+                auto allTextures = resourcePool->GetAllResources<CSRendering::Texture>();
+                for (const auto& texture : allTextures)
+                {
+                    Texture* glTexture = static_cast<Texture*>(const_cast<CSRendering::Texture*>(texture.get()));
+                    glTexture->Backup();
+                }
+                
+                //---Meshes
                 for(auto& buffer : m_meshBuffers)
                 {
                     buffer->Backup();
@@ -59,7 +70,9 @@ namespace CSBackend
         }
         //-----------------------------------------------------
         /// Rebuild the shaders and textures from file. Re-upload
-        /// the mesh buffers
+        /// the mesh buffers. When reloading from source the
+        /// textures are reloaded asynchronously, so they will
+        /// be in the loading state for a number of frames.
         //-----------------------------------------------------
         void ContextRestorer::Restore()
         {
@@ -85,7 +98,14 @@ namespace CSBackend
                         glTexture->Restore();
                     }
                 }
-                resourcePool->RefreshResources<CSRendering::Texture>();
+                if (m_restoreStrategy == RestoreStrategy::k_reloadFromSource)
+                {
+                    resourcePool->RefreshResourcesAsync<CSRendering::Texture>();
+                }
+                else
+                {
+                    resourcePool->RefreshResources<CSRendering::Texture>();
+                }
                 
                 //---Cubemaps
                 auto allCubemaps = resourcePool->GetAllResources<CSRendering::Cubemap>();
@@ -128,6 +148,62 @@ namespace CSBackend
                 }
             }
         }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void ContextRestorer::SetRestoreStrategy(RestoreStrategy in_strategy)
+        {
+            m_restoreStrategy = in_strategy;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        ContextRestorer::RestoreStrategy ContextRestorer::GetRestoreStrategy() const
+        {
+            return m_restoreStrategy;
+        }
+        //-----------------------------------------------------
+        /// Procedural textures which hold a copy of their data
+        /// are resident, while those without a copy will be
+        /// read back on backup.
+        //-----------------------------------------------------
+        ContextRestorer::MemoryStats ContextRestorer::CalculateMemoryStats() const
+        {
+            MemoryStats output;
+            
+            CSCore::ResourcePool* resourcePool = CSCore::Application::Get()->GetResourcePool();
+            
+            auto allTextures = resourcePool->GetAllResources<CSRendering::Texture>();
+            for (const auto& texture : allTextures)
+            {
+                const Texture* glTexture = static_cast<const Texture*>(texture.get());
+                
+                if (glTexture->GetStorageLocation() != CSCore::StorageLocation::k_none)
+                {
+                    output.m_numSourceTextures++;
+                    output.m_sourceTextureBytes += glTexture->GetDataSize();
+                }
+                else if (glTexture->IsRestoreTextureDataEnabled() == true)
+                {
+                    if (glTexture->GetRestorationDataSize() > 0)
+                    {
+                        output.m_numResidentTextures++;
+                        output.m_residentTextureBytes += glTexture->GetRestorationDataSize();
+                    }
+                    else
+                    {
+                        output.m_numBackupTextures++;
+                        output.m_backupTextureBytes += glTexture->GetDataSize();
+                    }
+                }
+            }
+            
+            for (const auto& buffer : m_meshBuffers)
+            {
+                output.m_numMeshBuffers++;
+                output.m_backupMeshBufferBytes += buffer->GetVertexCapacity() + buffer->GetIndexCapacity();
+            }
+            
+            return output;
+        }
     }
 }
 
@@ -46,6 +46,11 @@ namespace CSBackend
         /// as textures, shaders and buffers are destroyed and
         /// must be recreated on resume.
         ///
+        /// Resources that were loaded from file are reloaded from
+        /// their source. How this is done, and how procedural
+        /// textures are preserved, depends on the restore
+        /// strategy.
+        ///
         /// @author S Downie
         //---------------------------------------------------------
         class ContextRestorer final
@@ -54,6 +59,52 @@ namespace CSBackend
             
             CS_DECLARE_NOCOPY(ContextRestorer);
             //-----------------------------------------------------
+            /// The available restore strategies.
+            ///
+            /// * Backup - Procedural textures keep a copy of
+            ///   their data in memory for as long as they exist.
+            ///   Resources loaded from file are reloaded
+            ///   synchronously on resume.
+            /// * Reload from source - Only the source of file
+            ///   based resources is kept, and textures are
+            ///   reloaded through the async loader on resume,
+            ///   with the upload spread over a number of frames.
+            ///   Procedural textures are only backed up when the
+            ///   context is about to be lost, by reading back
+            ///   their contents, so no copy is held while the
+            ///   app is running. Textures in formats that cannot
+            ///   be read back still keep a copy in memory.
+            ///
+            /// @author Ian Copland
+            //-----------------------------------------------------
+            enum class RestoreStrategy
+            {
+                k_backup,
+                k_reloadFromSource
+            };
+            //-----------------------------------------------------
+            /// A breakdown of the memory required to restore the
+            /// context with the current strategy. Resident memory
+            /// is held for as long as the resources exist; backup
+            /// memory is only held between suspend and resume.
+            /// Source restored bytes are the GPU bytes that would
+            /// have to be held in memory if those textures were
+            /// backed up rather than reloaded.
+            ///
+            /// @author Ian Copland
+            //-----------------------------------------------------
+            struct MemoryStats
+            {
+                u32 m_numResidentTextures = 0;
+                u64 m_residentTextureBytes = 0;
+                u32 m_numBackupTextures = 0;
+                u64 m_backupTextureBytes = 0;
+                u32 m_numSourceTextures = 0;
+                u64 m_sourceTextureBytes = 0;
+                u32 m_numMeshBuffers = 0;
+                u64 m_backupMeshBufferBytes = 0;
+            };
+            //-----------------------------------------------------
             /// Constructor
             ///
             /// @author S Downie
@@ -90,10 +141,37 @@ namespace CSBackend
             /// @param Mesh buffer
             //-----------------------------------------------------
             void RemoveMeshBuffer(MeshBuffer* in_meshBuffer);
+            //-----------------------------------------------------
+            /// Sets the strategy used to restore the context. This
+            /// should be set before any procedural textures are
+            /// created as it determines whether or not they keep
+            /// a copy of their data in memory.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The restore strategy.
+            //-----------------------------------------------------
+            void SetRestoreStrategy(RestoreStrategy in_strategy);
+            //-----------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The strategy used to restore the context.
+            //-----------------------------------------------------
+            RestoreStrategy GetRestoreStrategy() const;
+            //-----------------------------------------------------
+            /// Calculates the memory required to restore the
+            /// context with the current strategy.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The memory stats.
+            //-----------------------------------------------------
+            MemoryStats CalculateMemoryStats() const;
         private:
             
             std::vector<MeshBuffer*> m_meshBuffers;
             bool m_hasContextBeenBackedUp = false;
+            RestoreStrategy m_restoreStrategy = RestoreStrategy::k_backup;
         };
     }
 }
@@ -224,6 +224,14 @@ namespace CSBackend
         {
             return m_hasContext;
         }
+#ifdef CS_TARGETPLATFORM_ANDROID
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        ContextRestorer* RenderSystem::GetContextRestorer()
+        {
+            return &m_contextRestorer;
+        }
+#endif
         //----------------------------------------------------------
         /// Set Light
         //----------------------------------------------------------
@@ -590,7 +598,8 @@ namespace CSBackend
 #endif
             
 #ifdef CS_TARGETPLATFORM_ANDROID
-            if (inpActiveRenderTarget != nullptr)
+            //When restoring from source, render targets are read back on backup rather than every frame.
+            if (inpActiveRenderTarget != nullptr && m_contextRestorer.GetRestoreStrategy() == ContextRestorer::RestoreStrategy::k_backup)
             {
                 Texture* colourTexture = static_cast<Texture*>(inpActiveRenderTarget->GetColourTexture().get());
                 if (colourTexture != nullptr)
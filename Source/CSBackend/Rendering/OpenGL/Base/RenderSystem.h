@@ -303,6 +303,15 @@ namespace CSBackend
             /// @return If the GL context still exists
             //----------------------------------------------------------
             bool HasContext() const;
+#ifdef CS_TARGETPLATFORM_ANDROID
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The context restorer, which can be used to
+            /// change the restore strategy and query its memory cost.
+            //----------------------------------------------------------
+            ContextRestorer* GetContextRestorer();
+#endif
 			
 		private:
             
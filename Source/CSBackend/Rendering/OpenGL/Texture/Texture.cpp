@@ -37,6 +37,8 @@
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormatConverter.h>
 
+#include <algorithm>
+
 namespace CSBackend
 {
 	namespace OpenGL
@@ -127,41 +129,117 @@ namespace CSBackend
             /// @param Image width
             /// @param Image height
             /// @param Image data
+            /// @param The mip level
             //---------------------------------------------------
-            void UploadImageDataNoCompression(CSCore::ImageFormat in_format, u32 in_imageWidth, u32 in_imageHeight, const u8* in_imageData)
+            void UploadImageDataNoCompression(CSCore::ImageFormat in_format, u32 in_imageWidth, u32 in_imageHeight, const u8* in_imageData, u32 in_mipLevel = 0)
             {
                 switch(in_format)
                 {
                     default:
                     case CSCore::ImageFormat::k_RGBA8888:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, in_imageWidth, in_imageHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, in_imageData);
+                        glTexImage2D(GL_TEXTURE_2D, in_mipLevel, GL_RGBA, in_imageWidth, in_imageHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, in_imageData);
                         break;
                     case CSCore::ImageFormat::k_RGB888:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, in_imageWidth, in_imageHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, in_imageData);
+                        glTexImage2D(GL_TEXTURE_2D, in_mipLevel, GL_RGB, in_imageWidth, in_imageHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, in_imageData);
                         break;
                     case CSCore::ImageFormat::k_RGBA4444:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, in_imageWidth, in_imageHeight, 0, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, in_imageData);
+                        glTexImage2D(GL_TEXTURE_2D, in_mipLevel, GL_RGBA, in_imageWidth, in_imageHeight, 0, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, in_imageData);
                         break;
                     case CSCore::ImageFormat::k_RGB565:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, in_imageWidth, in_imageHeight, 0, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, in_imageData);
+                        glTexImage2D(GL_TEXTURE_2D, in_mipLevel, GL_RGB, in_imageWidth, in_imageHeight, 0, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, in_imageData);
                         break;
                     case CSCore::ImageFormat::k_LumA88:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE_ALPHA, in_imageWidth, in_imageHeight, 0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, in_imageData);
+                        glTexImage2D(GL_TEXTURE_2D, in_mipLevel, GL_LUMINANCE_ALPHA, in_imageWidth, in_imageHeight, 0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, in_imageData);
                         break;
                     case CSCore::ImageFormat::k_Lum8:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, in_imageWidth, in_imageHeight, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, in_imageData);
+                        glTexImage2D(GL_TEXTURE_2D, in_mipLevel, GL_LUMINANCE, in_imageWidth, in_imageHeight, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, in_imageData);
                         break;
                     case CSCore::ImageFormat::k_Depth16:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, in_imageWidth, in_imageHeight, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT, in_imageData);
+                        glTexImage2D(GL_TEXTURE_2D, in_mipLevel, GL_DEPTH_COMPONENT, in_imageWidth, in_imageHeight, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT, in_imageData);
                         break;
                     case CSCore::ImageFormat::k_Depth32:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, in_imageWidth, in_imageHeight, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, in_imageData);
+                        glTexImage2D(GL_TEXTURE_2D, in_mipLevel, GL_DEPTH_COMPONENT, in_imageWidth, in_imageHeight, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, in_imageData);
                         break;
                 };
                 
                 CS_ASSERT_NOGLERROR("An OpenGL error occurred while uploading uncompressed texture data.");
             }
             //---------------------------------------------------
+            /// Uploads a rectangular region of image data with
+            /// no compression in the given format to a texture
+            /// that has already had storage allocated.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Format
+            /// @param The x position of the left of the region
+            /// @param The y position of the top of the region
+            /// @param The width of the region
+            /// @param The height of the region
+            /// @param Region data
+            /// @param The mip level
+            //---------------------------------------------------
+            void UploadImageSubDataNoCompression(CSCore::ImageFormat in_format, u32 in_x, u32 in_y, u32 in_width, u32 in_height, const u8* in_imageData, u32 in_mipLevel = 0)
+            {
+                switch(in_format)
+                {
+                    default:
+                    case CSCore::ImageFormat::k_RGBA8888:
+                        glTexSubImage2D(GL_TEXTURE_2D, in_mipLevel, in_x, in_y, in_width, in_height, GL_RGBA, GL_UNSIGNED_BYTE, in_imageData);
+                        break;
+                    case CSCore::ImageFormat::k_RGB888:
+                        glTexSubImage2D(GL_TEXTURE_2D, in_mipLevel, in_x, in_y, in_width, in_height, GL_RGB, GL_UNSIGNED_BYTE, in_imageData);
+                        break;
+                    case CSCore::ImageFormat::k_RGBA4444:
+                        glTexSubImage2D(GL_TEXTURE_2D, in_mipLevel, in_x, in_y, in_width, in_height, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, in_imageData);
+                        break;
+                    case CSCore::ImageFormat::k_RGB565:
+                        glTexSubImage2D(GL_TEXTURE_2D, in_mipLevel, in_x, in_y, in_width, in_height, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, in_imageData);
+                        break;
+                    case CSCore::ImageFormat::k_LumA88:
+                        glTexSubImage2D(GL_TEXTURE_2D, in_mipLevel, in_x, in_y, in_width, in_height, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, in_imageData);
+                        break;
+                    case CSCore::ImageFormat::k_Lum8:
+                        glTexSubImage2D(GL_TEXTURE_2D, in_mipLevel, in_x, in_y, in_width, in_height, GL_LUMINANCE, GL_UNSIGNED_BYTE, in_imageData);
+                        break;
+                    case CSCore::ImageFormat::k_Depth16:
+                        glTexSubImage2D(GL_TEXTURE_2D, in_mipLevel, in_x, in_y, in_width, in_height, GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT, in_imageData);
+                        break;
+                    case CSCore::ImageFormat::k_Depth32:
+                        glTexSubImage2D(GL_TEXTURE_2D, in_mipLevel, in_x, in_y, in_width, in_height, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, in_imageData);
+                        break;
+                };
+                
+                CS_ASSERT_NOGLERROR("An OpenGL error occurred while uploading uncompressed texture sub data.");
+            }
+            //---------------------------------------------------
+            /// Uploads the mip levels below the base level from
+            /// uncompressed image data containing a complete mip
+            /// chain, stored consecutively, largest first.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Format
+            /// @param Base level width
+            /// @param Base level height
+            /// @param The number of mip levels, including the base.
+            /// @param Image data, starting with the base level.
+            //---------------------------------------------------
+            void UploadMipLevels(CSCore::ImageFormat in_format, u32 in_imageWidth, u32 in_imageHeight, u32 in_numMipLevels, const u8* in_imageData)
+            {
+                CS_ASSERT(in_numMipLevels == CSCore::ImageFormatConverter::CalcNumMipLevels(in_imageWidth, in_imageHeight), "A texture must be given either no mip levels or a complete mip chain.");
+                
+                const u32 bytesPerPixel = CSCore::ImageFormatConverter::GetBytesPerPixel(in_format);
+                const u8* levelData = in_imageData + in_imageWidth * in_imageHeight * bytesPerPixel;
+                for(u32 level = 1; level < in_numMipLevels; ++level)
+                {
+                    u32 levelWidth = std::max(in_imageWidth >> level, 1u);
+                    u32 levelHeight = std::max(in_imageHeight >> level, 1u);
+                    UploadImageDataNoCompression(in_format, levelWidth, levelHeight, levelData, level);
+                    levelData += levelWidth * levelHeight * bytesPerPixel;
+                }
+            }
+            //---------------------------------------------------
             /// Uploads image data with ETC1 compression. ETC1
             /// only supports RGB images and will aseert on any
             /// other format. It is currently only supported on
@@ -259,6 +337,38 @@ namespace CSBackend
 #endif
                 CS_ASSERT_NOGLERROR("An OpenGL error occurred while uploading PVR4 texture data.");
             }
+#ifdef CS_TARGETPLATFORM_ANDROID
+            //---------------------------------------------------
+            /// Returns whether or not the contents of a texture
+            /// with the given format can be read back from the
+            /// GPU for restoration.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The image format.
+            /// @param The image compression.
+            ///
+            /// @return Whether or not it can be read back.
+            //---------------------------------------------------
+            bool IsReadBackSupported(CSCore::ImageFormat in_format, CSCore::ImageCompression in_compression)
+            {
+                if (in_compression != CSCore::ImageCompression::k_none)
+                {
+                    return false;
+                }
+                
+                switch (in_format)
+                {
+                    case CSCore::ImageFormat::k_RGBA8888:
+                    case CSCore::ImageFormat::k_RGB888:
+                    case CSCore::ImageFormat::k_RGBA4444:
+                    case CSCore::ImageFormat::k_RGB565:
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+#endif
         }
         
         CS_DEFINE_NAMEDTYPE(Texture);
@@ -324,6 +434,10 @@ namespace CSBackend
 			{
 				case CSCore::ImageCompression::k_none:
                     UploadImageDataNoCompression(m_format, m_width, m_height, data);
+                    if(in_mipMap == true && in_desc.m_numMipLevels > 1)
+                    {
+                        UploadMipLevels(m_format, m_width, m_height, in_desc.m_numMipLevels, data);
+                    }
 					break;
 				case CSCore::ImageCompression::k_ETC1:
                     UploadImageDataETC1(m_format, m_width, m_height, data, in_desc.m_dataSize);
@@ -336,7 +450,7 @@ namespace CSBackend
 					break;
 			};
             
-            if(in_mipMap == true)
+            if(in_mipMap == true && in_desc.m_numMipLevels <= 1)
             {
                 glGenerateMipmap(GL_TEXTURE_2D);
             }
@@ -347,13 +461,134 @@ namespace CSBackend
             if (GetStorageLocation() == CSCore::StorageLocation::k_none && in_restoreTextureDataEnabled == true)
             {
             	m_restoreTextureDataEnabled = true;
-                m_restorationDataSize = in_desc.m_dataSize;
-                m_restorationData = std::move(in_data);
+                
+                //If restoring from source, textures that can be read back don't need a copy as one is taken on backup.
+                auto restoreStrategy = static_cast<RenderSystem*>(CSCore::Application::Get()->GetRenderSystem())->GetContextRestorer()->GetRestoreStrategy();
+                if (restoreStrategy == ContextRestorer::RestoreStrategy::k_backup || IsReadBackSupported(m_format, m_compression) == false)
+                {
+                    m_restorationDataSize = in_desc.m_dataSize;
+                    m_restorationNumMipLevels = in_desc.m_numMipLevels;
+                    m_restorationData = std::move(in_data);
+                }
             }
+            m_dataSize = in_desc.m_dataSize;
 #endif
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while building texture.");
         }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        void Texture::BuildEmpty(const Descriptor& in_desc, bool in_mipMap, bool in_restoreTextureDataEnabled)
+        {
+            CS_ASSERT(in_desc.m_compression == CSCore::ImageCompression::k_none, "Only uncompressed textures can be built incrementally.");
+            
+            Destroy();
+            
+            m_width = in_desc.m_width;
+            m_height = in_desc.m_height;
+            m_format = in_desc.m_format;
+            m_compression = in_desc.m_compression;
+            
+            CS_ASSERT(m_width <= m_renderCapabilities->GetMaxTextureSize() && m_height <= m_renderCapabilities->GetMaxTextureSize(),
+                      "OpenGL does not support textures of this size on this device (" + CSCore::ToString(m_width) + ", " + CSCore::ToString(m_height) + ")");
+            
+            glGenTextures(1, &m_texHandle);
+            Bind();
+            
+            UploadImageDataNoCompression(m_format, m_width, m_height, nullptr);
+            
+            if(in_mipMap == true && in_desc.m_numMipLevels > 1)
+            {
+                CS_ASSERT(in_desc.m_numMipLevels == CSCore::ImageFormatConverter::CalcNumMipLevels(m_width, m_height), "A texture must be given either no mip levels or a complete mip chain.");
+                
+                for(u32 level = 1; level < in_desc.m_numMipLevels; ++level)
+                {
+                    UploadImageDataNoCompression(m_format, std::max(m_width >> level, 1u), std::max(m_height >> level, 1u), nullptr, level);
+                }
+                m_hasMipMaps = true;
+            }
+            else
+            {
+                m_hasPendingMipMaps = in_mipMap;
+            }
+            
+#ifdef CS_TARGETPLATFORM_ANDROID
+            if (GetStorageLocation() == CSCore::StorageLocation::k_none && in_restoreTextureDataEnabled == true)
+            {
+                m_restoreTextureDataEnabled = true;
+                m_restorationNumMipLevels = in_desc.m_numMipLevels;
+            }
+            m_dataSize = in_desc.m_dataSize;
+#endif
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while building empty texture.");
+        }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        void Texture::UploadRows(u32 in_firstRow, u32 in_numRows, const u8* in_data)
+        {
+            CS_ASSERT(m_texHandle > 0, "Cannot upload rows to a texture that has not been built.");
+            CS_ASSERT(in_firstRow + in_numRows <= m_height, "Cannot upload rows outside of the texture bounds.");
+            
+            Bind();
+            
+            UploadImageSubDataNoCompression(m_format, 0, in_firstRow, m_width, in_numRows, in_data);
+        }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        void Texture::UploadMipLevel(u32 in_level, const u8* in_data)
+        {
+            CS_ASSERT(m_texHandle > 0, "Cannot upload a mip level to a texture that has not been built.");
+            CS_ASSERT(in_level > 0 && m_hasMipMaps == true, "Cannot upload a mip level to a texture that was not built with mip levels.");
+            
+            Bind();
+            
+            UploadImageSubDataNoCompression(m_format, 0, 0, std::max(m_width >> in_level, 1u), std::max(m_height >> in_level, 1u), in_data, in_level);
+        }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        void Texture::UploadRegion(u32 in_x, u32 in_y, u32 in_width, u32 in_height, const u8* in_data)
+        {
+            CS_ASSERT(m_texHandle > 0, "Cannot upload a region to a texture that has not been built.");
+            CS_ASSERT(in_x + in_width <= m_width && in_y + in_height <= m_height, "Cannot upload a region outside of the texture bounds.");
+            
+            Bind();
+            
+            UploadImageSubDataNoCompression(m_format, in_x, in_y, in_width, in_height, in_data);
+        }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        void Texture::CompleteUpload(TextureDataUPtr in_data)
+        {
+            CS_ASSERT(m_texHandle > 0, "Cannot complete the upload of a texture that has not been built.");
+            
+#ifdef CS_TARGETPLATFORM_ANDROID
+            //As in Build(), a copy is only needed if the data can't be read back from the texture on backup.
+            if (m_restoreTextureDataEnabled == true && in_data != nullptr)
+            {
+                auto restoreStrategy = static_cast<RenderSystem*>(CSCore::Application::Get()->GetRenderSystem())->GetContextRestorer()->GetRestoreStrategy();
+                if (restoreStrategy == ContextRestorer::RestoreStrategy::k_backup || IsReadBackSupported(m_format, m_compression) == false)
+                {
+                    m_restorationDataSize = m_dataSize;
+                    m_restorationData = std::move(in_data);
+                }
+            }
+#endif
+            
+            if(m_hasPendingMipMaps == true)
+            {
+                Bind();
+                glGenerateMipmap(GL_TEXTURE_2D);
+            }
+            
+            m_hasMipMaps = (m_hasMipMaps == true || m_hasPendingMipMaps == true);
+            m_hasPendingMipMaps = false;
+            
+            //The filter mode depends on whether or not there are mip maps so must be re-applied.
+            m_hasFilterModeChanged = true;
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while completing texture upload.");
+        }
         //--------------------------------------------------
 		//--------------------------------------------------
 		void Texture::Unbind()
@@ -463,6 +698,7 @@ namespace CSBackend
 				}
 
 				m_restorationDataSize = convertedData.m_size;
+				m_restorationNumMipLevels = 1;
 				m_restorationData = std::move(convertedData.m_data);
 
 				//clean up the frame buffer.
@@ -484,6 +720,7 @@ namespace CSBackend
             desc.m_format = m_format;
             desc.m_compression = m_compression;
             desc.m_dataSize = m_restorationDataSize;
+            desc.m_numMipLevels = m_restorationNumMipLevels;
             
             WrapMode sWrap = m_sWrapMode;
             WrapMode tWrap = m_tWrapMode;
@@ -493,6 +730,35 @@ namespace CSBackend
             SetWrapMode(sWrap, tWrap);
             SetFilterMode(filterMode);
         }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        void Texture::Backup()
+        {
+            if (GetStorageLocation() == CSCore::StorageLocation::k_none && m_restoreTextureDataEnabled == true && m_restorationData == nullptr && m_texHandle > 0)
+            {
+                UpdateRestorationData();
+            }
+            
+            m_texHandle = 0;
+        }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        bool Texture::IsRestoreTextureDataEnabled() const
+        {
+            return m_restoreTextureDataEnabled;
+        }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        u32 Texture::GetRestorationDataSize() const
+        {
+            return m_restorationDataSize;
+        }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        u32 Texture::GetDataSize() const
+        {
+            return m_dataSize;
+        }
 #endif
         //--------------------------------------------------
         //--------------------------------------------------
@@ -504,6 +770,7 @@ namespace CSBackend
             m_hasFilterModeChanged = true;
             m_hasWrapModeChanged = true;
             m_hasMipMaps = false;
+            m_hasPendingMipMaps = false;
             
             m_filterMode = FilterMode::k_bilinear;
             m_sWrapMode = WrapMode::k_clamp;
@@ -522,7 +789,9 @@ namespace CSBackend
 #ifdef CS_TARGETPLATFORM_ANDROID
             m_restoreTextureDataEnabled = false;
             m_restorationDataSize = 0;
+            m_restorationNumMipLevels = 1;
             m_restorationData.reset();
+            m_dataSize = 0;
 #endif
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while destroying texture.");
@@ -78,6 +78,66 @@ namespace CSBackend
             /// and RGB565 textures.
             //--------------------------------------------------------------
             void Build(const Descriptor& in_desc, TextureDataUPtr in_data, bool in_mipMap, bool in_restoreTextureDataEnabled) override;
+            //--------------------------------------------------------------
+            /// Allocates storage for the texture without supplying any
+            /// image data. The data should then be supplied using
+            /// UploadRows(), followed by a call to CompleteUpload(). Only
+            /// uncompressed textures can be built this way.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Texture descriptor
+            /// @param Whether the texture should have mip maps generated
+            /// once the upload is complete.
+            /// @param Whether or not to restore the texture data after a
+            /// context loss.
+            //--------------------------------------------------------------
+            void BuildEmpty(const Descriptor& in_desc, bool in_mipMap, bool in_restoreTextureDataEnabled) override;
+            //--------------------------------------------------------------
+            /// Uploads a band of rows to a texture that was created using
+            /// BuildEmpty().
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The index of the first row.
+            /// @param The number of rows.
+            /// @param The tightly packed row data.
+            //--------------------------------------------------------------
+            void UploadRows(u32 in_firstRow, u32 in_numRows, const u8* in_data) override;
+            //--------------------------------------------------------------
+            /// Uploads a single mip level below the base level to a
+            /// texture that was created using BuildEmpty() with a mip
+            /// chain.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The mip level.
+            /// @param The tightly packed level data.
+            //--------------------------------------------------------------
+            void UploadMipLevel(u32 in_level, const u8* in_data) override;
+            //--------------------------------------------------------------
+            /// Uploads a rectangular region of the base level to a texture
+            /// that was created using BuildEmpty().
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The x position of the left of the region.
+            /// @param The y position of the top of the region.
+            /// @param The width of the region.
+            /// @param The height of the region.
+            /// @param The tightly packed region data.
+            //--------------------------------------------------------------
+            void UploadRegion(u32 in_x, u32 in_y, u32 in_width, u32 in_height, const u8* in_data) override;
+            //--------------------------------------------------------------
+            /// Completes a texture built using BuildEmpty(), generating
+            /// mip maps if they were requested and not supplied.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The complete texture data, which is kept if it is
+            /// needed for restoration. May be null.
+            //--------------------------------------------------------------
+            void CompleteUpload(TextureDataUPtr in_data) override;
 			//--------------------------------------------------------------
             /// Binds this texture to the given texture unit allowing it to
             /// be accessed by the shaders and operations to be performed on it
@@ -164,6 +224,40 @@ namespace CSBackend
             /// @author Ian Copland
             //--------------------------------------------------
             void Restore();
+            //--------------------------------------------------
+            /// Prepares the texture for context loss. When the
+            /// reload from source restore strategy is used,
+            /// procedural textures which do not keep a copy of
+            /// their data in memory will read it back from the
+            /// GPU so that it can be restored. The GL handle is
+            /// then discarded as it will not be valid in the
+            /// new context.
+            ///
+            /// @author Ian Copland
+            //--------------------------------------------------
+            void Backup();
+            //--------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not the texture data will be
+            /// restored after a context loss.
+            //--------------------------------------------------
+            bool IsRestoreTextureDataEnabled() const;
+            //--------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The size of the copy of the texture data
+            /// currently held for restoration. This is zero if
+            /// no copy is held.
+            //--------------------------------------------------
+            u32 GetRestorationDataSize() const;
+            //--------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The size of the texture data that was
+            /// uploaded to the GPU.
+            //--------------------------------------------------
+            u32 GetDataSize() const;
 #endif
             //--------------------------------------------------
             /// Destroys the texture and resets it to the state
@@ -209,11 +303,14 @@ namespace CSBackend
             bool m_hasFilterModeChanged = true;
             bool m_hasWrapModeChanged = true;
             bool m_hasMipMaps = false;
+            bool m_hasPendingMipMaps = false;
             
 #ifdef CS_TARGETPLATFORM_ANDROID
             bool m_restoreTextureDataEnabled = false;
             u32 m_restorationDataSize = 0;
+            u32 m_restorationNumMipLevels = 1;
             TextureDataUPtr m_restorationData;
+            u32 m_dataSize = 0;
 #endif
 		};
 	}
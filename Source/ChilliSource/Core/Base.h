@@ -37,12 +37,16 @@
 #include <ChilliSource/Core/Base/Colour.h>
 #include <ChilliSource/Core/Base/ColourUtils.h>
 #include <ChilliSource/Core/Base/Device.h>
+#include <ChilliSource/Core/Base/FixedSizePool.h>
 #include <ChilliSource/Core/Base/Logging.h>
+#include <ChilliSource/Core/Base/LZ4.h>
 #include <ChilliSource/Core/Base/MakeSharedArray.h>
 #include <ChilliSource/Core/Base/PlatformSystem.h>
+#include <ChilliSource/Core/Base/PoolAllocator.h>
 #include <ChilliSource/Core/Base/QueryableInterface.h>
 #include <ChilliSource/Core/Base/Screen.h>
 #include <ChilliSource/Core/Base/Singleton.h>
+#include <ChilliSource/Core/Base/SmallObjectAllocator.h>
 #include <ChilliSource/Core/Base/StandardMacros.h>
 #include <ChilliSource/Core/Base/Utils.h>
 
@@ -34,6 +34,7 @@
 #include <ChilliSource/Core/Base/PlatformSystem.h>
 #include <ChilliSource/Core/Base/Screen.h>
 #include <ChilliSource/Core/DialogueBox/DialogueBoxSystem.h>
+#include <ChilliSource/Core/Event/DeferredEventQueue.h>
 #include <ChilliSource/Core/File/AppDataStore.h>
 #include <ChilliSource/Core/File/TaggedFilePathResolver.h>
 #include <ChilliSource/Core/Image/CSImageProvider.h>
@@ -45,6 +46,7 @@
 #include <ChilliSource/Core/State/StateManager.h>
 #include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Core/Time/CoreTimer.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
 #include <ChilliSource/Input/DeviceButtons/DeviceButtonSystem.h>
@@ -57,6 +59,7 @@
 #include <ChilliSource/Rendering/Base/RenderCapabilities.h>
 #include <ChilliSource/Rendering/Base/RenderComponentFactory.h>
 #include <ChilliSource/Rendering/Base/RenderSystem.h>
+#include <ChilliSource/Rendering/Base/UploadScheduler.h>
 #include <ChilliSource/Rendering/Camera/CameraComponent.h>
 #include <ChilliSource/Rendering/Font/Font.h>
 #include <ChilliSource/Rendering/Font/FontProvider.h>
@@ -69,6 +72,7 @@
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawableDefFactory.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDefFactory.h>
 #include <ChilliSource/Rendering/Texture/CubemapProvider.h>
+#include <ChilliSource/Rendering/Texture/DynamicTextureAtlas.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlasProvider.h>
 #include <ChilliSource/Rendering/Texture/TextureProvider.h>
 
@@ -87,8 +91,6 @@ namespace ChilliSource
         namespace
         {
             const f32 k_defaultUpdateInterval = 1.0f/60.0f;
-            const f32 k_updateClampThreshold = 0.33f;
-            const f32 k_updateIntervalMax = k_updateClampThreshold;
         }
         
         Application* Application::s_application = nullptr;
@@ -102,7 +104,7 @@ namespace ChilliSource
         //----------------------------------------------------
         //----------------------------------------------------
 		Application::Application()
-            : m_updateInterval(k_defaultUpdateInterval)
+            : m_fixedStepController(k_defaultUpdateInterval)
 		{
 		}
         //----------------------------------------------------
@@ -133,28 +135,52 @@ namespace ChilliSource
         //----------------------------------------------------
 		void Application::SetUpdateInterval(f32 infUpdateInterval)
 		{
-			m_updateInterval = infUpdateInterval;
+			m_fixedStepController.SetInterval(infUpdateInterval);
 		}
         //----------------------------------------------------
         //----------------------------------------------------
 		f32 Application::GetUpdateInterval() const
 		{
-			return m_updateInterval;
+			return m_fixedStepController.GetInterval();
 		}
         //----------------------------------------------------
         //----------------------------------------------------
 		f32 Application::GetUpdateIntervalMax() const
 		{
-			return k_updateIntervalMax;
+			return m_fixedStepController.GetMaxFrameTime();
 		}
         //----------------------------------------------------
         //----------------------------------------------------
+        FixedStepController* Application::GetFixedStepController()
+        {
+            return &m_fixedStepController;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        const FixedStepController* Application::GetFixedStepController() const
+        {
+            return &m_fixedStepController;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
         void Application::SetUpdateSpeed(f32 infSpeed)
         {
             m_updateSpeed = infSpeed;
         }
         //----------------------------------------------------
         //----------------------------------------------------
+        void Application::SetConcurrentFixedUpdateEnabled(bool in_enabled)
+        {
+            m_isConcurrentFixedUpdateEnabled = in_enabled;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        bool Application::IsConcurrentFixedUpdateEnabled() const
+        {
+            return m_isConcurrentFixedUpdateEnabled;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
         void Application::Quit()
         {
             m_platformSystem->Quit();
@@ -167,6 +193,8 @@ namespace ChilliSource
             s_application = this;
             
 			Logging::Create();
+            
+            CS_PROFILE_THREAD_NAME("Main");
 
             //Create all application systems.
             m_isSystemCreationAllowed = true;
@@ -182,6 +210,15 @@ namespace ChilliSource
                 system->OnInit();
             }
             
+            for (const AppSystemUPtr& system : m_systems)
+            {
+                AppSystem* appSystem = system.get();
+                m_fixedUpdateGraph.AddSystem(appSystem, appSystem->GetFixedUpdateAccess(), [=](f32 in_deltaTime)
+                {
+                    appSystem->OnFixedUpdate(in_deltaTime);
+                });
+            }
+            
             OnInit();
             PushInitialState();
 		}
@@ -201,6 +238,8 @@ namespace ChilliSource
         //----------------------------------------------------
 		void Application::Update(f32 in_deltaTime, TimeIntervalSecs in_timestamp)
 		{
+            CS_PROFILE_SCOPE("Application::Update");
+            
             if(m_shouldNotifyConnectionsResumeEvent == true)
 			{
 				m_shouldNotifyConnectionsResumeEvent = false;
@@ -232,8 +271,11 @@ namespace ChilliSource
             
             //We do not need to render as often as we update so this callback will be triggered
             //less freqenctly than the update frequency suggests. We must work out how many times to update based on the time since last frame
-            //and our actual update frequency. We carry the remainder to the next frame until we have a full update cycle
-            m_updateIntervalRemainder = std::min(m_updateIntervalRemainder + in_deltaTime, GetUpdateIntervalMax());
+            //and our actual update frequency. We carry the remainder to the next frame until we have a full update cycle. The
+            //number of updates in a single frame is capped so that a slow frame cannot cause ever slower frames.
+            //The first frame always performs a fixed update, borrowing the time from the following frames.
+            u32 numFixedUpdates = m_fixedStepController.Advance(in_deltaTime, (m_isFirstFrame == true) ? 1 : 0);
+            m_isFirstFrame = false;
             
 			//process any queued input received by the pointer system.
 			if(m_pointerSystem != nullptr)
@@ -241,28 +283,28 @@ namespace ChilliSource
 				m_pointerSystem->ProcessQueuedInput();
 			}
             
-            while((m_updateIntervalRemainder >= GetUpdateInterval()) || m_isFirstFrame)
+            for (u32 i = 0; i < numFixedUpdates; ++i)
             {
-                m_updateIntervalRemainder -=  GetUpdateInterval();
+                CS_PROFILE_SCOPE("Application::FixedUpdate");
                 
                 //update all of the application systems
-                for (const AppSystemUPtr& system : m_systems)
-                {
-                    system->OnFixedUpdate(GetUpdateInterval());
-                }
+                m_fixedUpdateGraph.Execute(GetUpdateInterval(), m_isConcurrentFixedUpdateEnabled);
                 
                 m_stateManager->FixedUpdateStates(GetUpdateInterval());
-                
-                m_isFirstFrame = false;
             }
             
             //Tell the state manager to update the active state
             OnUpdate(in_deltaTime);
+            
+            //Dispatch any deferred events notified during the update so that they are seen before rendering.
+            DeferredEventQueue::Flush();
 		}
         //----------------------------------------------------
         //----------------------------------------------------
         void Application::Render()
         {
+            CS_PROFILE_SCOPE("Application::Render");
+            
             if(m_isSuspending)
             {
                 // Updating after told to suspend so early out
@@ -348,6 +390,7 @@ namespace ChilliSource
             m_renderSystem->Destroy();
 			m_resourcePool->Destroy();
 
+            m_fixedUpdateGraph.Clear();
             m_systems.clear();
 
             Logging::Destroy();
@@ -386,6 +429,8 @@ namespace ChilliSource
             m_renderSystem = CreateSystem<Rendering::RenderSystem>(renderCapabilities);
             m_renderer = CreateSystem<Rendering::Renderer>(m_renderSystem);
             CreateSystem<Rendering::CanvasRenderer>();
+            CreateSystem<Rendering::UploadScheduler>();
+            CreateSystem<Rendering::DynamicTextureAtlas>();
             CreateSystem<Rendering::MaterialFactory>(renderCapabilities);
             CreateSystem<Rendering::MaterialProvider>(renderCapabilities);
             CreateSystem<Rendering::TextureAtlasProvider>();
@@ -426,9 +471,10 @@ namespace ChilliSource
             //Initialise the render system prior to the OnInit() event.
             m_renderSystem->Init();
             
-            //Texture/Cubemap provider is a compound provider and needs to be informed when the other providers are created.
+            //Texture/Cubemap/Font provider is a compound provider and needs to be informed when the other providers are created.
             GetSystem<Rendering::TextureProvider>()->PostCreate();
             GetSystem<Rendering::CubemapProvider>()->PostCreate();
+            GetSystem<Rendering::FontProvider>()->PostCreate();
             
             //Load the app config set preferred FPS.
             m_appConfig->Load();
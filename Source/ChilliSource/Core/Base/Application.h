@@ -34,6 +34,8 @@
 #include <ChilliSource/Core/File/FileSystem.h>
 #include <ChilliSource/Core/State/StateManager.h>
 #include <ChilliSource/Core/System/AppSystem.h>
+#include <ChilliSource/Core/System/SystemUpdateGraph.h>
+#include <ChilliSource/Core/Time/FixedStepController.h>
 
 #include <limits>
 
@@ -174,7 +176,10 @@ namespace ChilliSource
 			//-----------------------------------------------------
 			void SetUpdateInterval(f32 in_updateInterval);
 			//-----------------------------------------------------
-			/// Returns the time between update calls.
+			/// Returns the time between update calls. This can be
+            /// larger than the requested interval if the adaptive
+            /// update interval is enabled on the fixed step
+            /// controller.
             ///
             /// @author S Downie.
 			///
@@ -190,6 +195,24 @@ namespace ChilliSource
 			/// @return Max time to be processed in a single frame.
 			//-----------------------------------------------------
 			f32 GetUpdateIntervalMax() const;
+            //-----------------------------------------------------
+            /// The fixed step controller decides how many fixed
+            /// updates are performed each frame. It can be used to
+            /// cap the number of steps per frame, enable the
+            /// adaptive update interval and query the step
+            /// statistics and the interpolation alpha.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return A pointer to the fixed step controller.
+            //-----------------------------------------------------
+            FixedStepController* GetFixedStepController();
+            //-----------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return A const pointer to the fixed step controller.
+            //-----------------------------------------------------
+            const FixedStepController* GetFixedStepController() const;
             //-----------------------------------------------------
 			/// Sets a multiplier for slowing or speeding up the
             /// delta time passed to each system and state.
@@ -200,6 +223,28 @@ namespace ChilliSource
 			//-----------------------------------------------------
 			void SetUpdateSpeed(f32 in_speed);
             //-----------------------------------------------------
+            /// Sets whether or not app and state systems which
+            /// declare concurrent fixed update access have their
+            /// fixed updates run in parallel on the task scheduler.
+            /// When disabled, all fixed updates are run serially on
+            /// the main thread in the order the systems were
+            /// created, which is deterministic and can be useful
+            /// for debugging. This is enabled by default.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Whether or not concurrent fixed updates are
+            /// enabled.
+            //-----------------------------------------------------
+            void SetConcurrentFixedUpdateEnabled(bool in_enabled);
+            //-----------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not concurrent fixed updates are
+            /// enabled.
+            //-----------------------------------------------------
+            bool IsConcurrentFixedUpdateEnabled() const;
+            //-----------------------------------------------------
             /// Stop the application and exit gracefully
             ///
             /// @author S Downie.
@@ -483,6 +528,7 @@ namespace ChilliSource
 
         private:
             std::vector<AppSystemUPtr> m_systems;
+            SystemUpdateGraph m_fixedUpdateGraph;
             
             ResourcePool* m_resourcePool = nullptr;
 			StateManager* m_stateManager = nullptr;
@@ -498,15 +544,15 @@ namespace ChilliSource
             UI::WidgetFactory* m_widgetFactory = nullptr;
             
 			TimeIntervalSecs m_currentAppTime = 0;
-			f32 m_updateInterval;
+            FixedStepController m_fixedStepController;
             f32 m_updateSpeed = 1.0f;
-            f32 m_updateIntervalRemainder = 0.0f;
             
             bool m_shouldNotifyConnectionsResumeEvent = false;
             bool m_shouldNotifyConnectionsForegroundEvent = false;
             bool m_isFirstFrame = true;
             bool m_isSuspending = false;
             bool m_isSystemCreationAllowed = false;
+            bool m_isConcurrentFixedUpdateEnabled = true;
             
             static Application* s_application;
 		};
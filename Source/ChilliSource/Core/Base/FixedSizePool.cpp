@@ -0,0 +1,204 @@
+//
+//  FixedSizePool.cpp
+//  Chilli Source
+//  Created by Ian Copland on 16/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Base/FixedSizePool.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const std::size_t k_blockAlignment = 16;
+        }
+        
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        FixedSizePool::FixedSizePool(std::size_t in_blockSize, u32 in_blocksPerPage)
+            : m_blockSize(((std::max(in_blockSize, sizeof(FreeBlock)) + k_blockAlignment - 1) / k_blockAlignment) * k_blockAlignment), m_blocksPerPage(in_blocksPerPage)
+        {
+            CS_ASSERT(m_blocksPerPage > 0, "A fixed size pool must have at least one block per page.");
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        std::size_t FixedSizePool::GetBlockSize() const
+        {
+            return m_blockSize;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        void* FixedSizePool::Allocate()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            if (m_freeList == nullptr)
+            {
+                AllocatePage();
+            }
+            
+            FreeBlock* block = m_freeList;
+            m_freeList = block->m_next;
+            
+            m_stats.m_numBlocksInUse++;
+            m_stats.m_numAllocations++;
+            
+            return block;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        void FixedSizePool::Deallocate(void* in_block)
+        {
+            CS_ASSERT(in_block != nullptr, "Cannot deallocate a null block.");
+            
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            CS_ASSERT(m_stats.m_numBlocksInUse > 0, "Block deallocated from a pool with no blocks in use.");
+            
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(in_block);
+            block->m_next = m_freeList;
+            m_freeList = block;
+            
+            m_stats.m_numBlocksInUse--;
+        }
+        //---------------------------------------------------------
+        /// The number of free blocks in each page is counted by
+        /// looking up the page each free block belongs to in the
+        /// sorted page list. Pages in which every block is free
+        /// are released and the free list is rebuilt from the
+        /// blocks in the remaining pages.
+        //---------------------------------------------------------
+        void FixedSizePool::ReleaseUnusedPages()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            if (m_pages.empty() == true)
+            {
+                return;
+            }
+            
+            std::sort(m_pages.begin(), m_pages.end());
+            std::vector<u32> numFreeBlocks(m_pages.size(), 0);
+            
+            auto findPage = [&](const FreeBlock* in_block) -> std::size_t
+            {
+                auto it = std::upper_bound(m_pages.begin(), m_pages.end(), reinterpret_cast<const u8*>(in_block));
+                CS_ASSERT(it != m_pages.begin(), "Free block does not belong to this pool.");
+                return std::size_t(it - m_pages.begin()) - 1;
+            };
+            
+            for (FreeBlock* block = m_freeList; block != nullptr; block = block->m_next)
+            {
+                numFreeBlocks[findPage(block)]++;
+            }
+            
+            std::vector<bool> isReleased(m_pages.size(), false);
+            bool anyReleased = false;
+            for (std::size_t i = 0; i < m_pages.size(); ++i)
+            {
+                if (numFreeBlocks[i] == m_blocksPerPage)
+                {
+                    isReleased[i] = true;
+                    anyReleased = true;
+                }
+            }
+            
+            if (anyReleased == false)
+            {
+                return;
+            }
+            
+            FreeBlock* freeList = nullptr;
+            FreeBlock* block = m_freeList;
+            while (block != nullptr)
+            {
+                FreeBlock* next = block->m_next;
+                if (isReleased[findPage(block)] == false)
+                {
+                    block->m_next = freeList;
+                    freeList = block;
+                }
+                block = next;
+            }
+            m_freeList = freeList;
+            
+            std::vector<u8*> pages;
+            for (std::size_t i = 0; i < m_pages.size(); ++i)
+            {
+                if (isReleased[i] == true)
+                {
+                    delete[] m_pages[i];
+                }
+                else
+                {
+                    pages.push_back(m_pages[i]);
+                }
+            }
+            m_pages.swap(pages);
+            
+            m_stats.m_numPages = u32(m_pages.size());
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        FixedSizePool::Stats FixedSizePool::GetStats() const
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            return m_stats;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        void FixedSizePool::AllocatePage()
+        {
+            const std::size_t pageSize = m_blockSize * m_blocksPerPage;
+            u8* page = new u8[pageSize];
+            m_pages.push_back(page);
+            
+            //blocks are pushed in reverse so that they are handed out in address order.
+            for (u32 i = m_blocksPerPage; i > 0; --i)
+            {
+                FreeBlock* block = reinterpret_cast<FreeBlock*>(page + (i - 1) * m_blockSize);
+                block->m_next = m_freeList;
+                m_freeList = block;
+            }
+            
+            m_stats.m_numPages++;
+            m_stats.m_numPageAllocations++;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        FixedSizePool::~FixedSizePool()
+        {
+            for (u8* page : m_pages)
+            {
+                delete[] page;
+            }
+        }
+    }
+}
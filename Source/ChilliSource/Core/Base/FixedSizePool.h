@@ -0,0 +1,161 @@
+//
+//  FixedSizePool.h
+//  Chilli Source
+//  Created by Ian Copland on 16/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_BASE_FIXEDSIZEPOOL_H_
+#define _CHILLISOURCE_CORE_BASE_FIXEDSIZEPOOL_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <mutex>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------
+        /// A thread safe pool of memory blocks of a single size.
+        /// Blocks are carved out of larger pages which are kept
+        /// once allocated, so after the pool has grown to its
+        /// peak size, allocating and deallocating never touches
+        /// the heap. Freed blocks are kept in an intrusive free
+        /// list.
+        ///
+        /// Pages which no longer contain any live blocks can be
+        /// returned to the heap with ReleaseUnusedPages().
+        ///
+        /// @author Ian Copland
+        //---------------------------------------------------------
+        class FixedSizePool final
+        {
+        public:
+            //---------------------------------------------------
+            /// A container for statistics on the pool. Page
+            /// allocations are the only allocations the pool
+            /// makes from the heap.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            struct Stats final
+            {
+                u32 m_numPages = 0;
+                u32 m_numBlocksInUse = 0;
+                u64 m_numAllocations = 0;
+                u64 m_numPageAllocations = 0;
+            };
+            //---------------------------------------------------
+            /// Constructor. No memory is allocated until the
+            /// first block is requested.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The size of each block in bytes. This will
+            /// be rounded up to preserve alignment.
+            /// @param The number of blocks in each page.
+            //---------------------------------------------------
+            FixedSizePool(std::size_t in_blockSize, u32 in_blocksPerPage);
+            FixedSizePool(const FixedSizePool&) = delete;
+            FixedSizePool& operator=(const FixedSizePool&) = delete;
+            //---------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The size of each block in bytes.
+            //---------------------------------------------------
+            std::size_t GetBlockSize() const;
+            //---------------------------------------------------
+            /// Allocates a single block, allocating a new page
+            /// if there are no free blocks.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The block.
+            //---------------------------------------------------
+            void* Allocate();
+            //---------------------------------------------------
+            /// Returns a block to the pool. The block must have
+            /// been allocated by this pool.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The block.
+            //---------------------------------------------------
+            void Deallocate(void* in_block);
+            //---------------------------------------------------
+            /// Returns any pages that contain no live blocks to
+            /// the heap. This walks the whole free list, so
+            /// should only be called at a point where a lot of
+            /// memory has been freed, such as a level unload.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            void ReleaseUnusedPages();
+            //---------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The current statistics for the pool.
+            //---------------------------------------------------
+            Stats GetStats() const;
+            //---------------------------------------------------
+            /// Destructor. Releases all pages. Any blocks still
+            /// in use become invalid.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            ~FixedSizePool();
+            
+        private:
+            //---------------------------------------------------
+            /// The header written into each block while it is
+            /// in the free list.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            struct FreeBlock final
+            {
+                FreeBlock* m_next;
+            };
+            //---------------------------------------------------
+            /// Allocates a new page and adds all of its blocks
+            /// to the free list. The mutex must be locked.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            void AllocatePage();
+            
+            std::size_t m_blockSize;
+            u32 m_blocksPerPage;
+            std::vector<u8*> m_pages;
+            FreeBlock* m_freeList = nullptr;
+            Stats m_stats;
+            mutable std::mutex m_mutex;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,330 @@
+//
+//  LZ4.cpp
+//  Chilli Source
+//  Created by Ian Copland on 14/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Base/LZ4.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace LZ4
+        {
+            namespace
+            {
+                const u32 k_minMatch = 4;
+                const u32 k_lastLiterals = 5;
+                const u32 k_matchSearchLimit = 12;
+                const u32 k_maxOffset = 65535;
+                const u32 k_hashLog = 12;
+                const u32 k_fastCopySize = 16;
+
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param Pointer to the data.
+                ///
+                /// @return The four bytes at the given pointer.
+                //---------------------------------------------------
+                u32 ReadU32(const u8* in_data)
+                {
+                    u32 value;
+                    memcpy(&value, in_data, sizeof(u32));
+                    return value;
+                }
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param Four bytes of data.
+                ///
+                /// @return The index into the hash table.
+                //---------------------------------------------------
+                u32 Hash(u32 in_sequence)
+                {
+                    return (in_sequence * 2654435761u) >> (32 - k_hashLog);
+                }
+                //---------------------------------------------------
+                /// Writes a length which has overflowed the four bits
+                /// available in the token.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The remaining length after the 15 stored
+                /// in the token.
+                /// @param [Out] The output position.
+                ///
+                /// @return The new output position.
+                //---------------------------------------------------
+                u8* WriteLength(u32 in_length, u8* out_position)
+                {
+                    while (in_length >= 255)
+                    {
+                        *out_position++ = 255;
+                        in_length -= 255;
+                    }
+                    *out_position++ = u8(in_length);
+                    return out_position;
+                }
+                //---------------------------------------------------
+                /// Reads a length which has overflowed the four bits
+                /// available in the token.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param [In/Out] The input position.
+                /// @param The end of the input.
+                /// @param [Out] The length.
+                ///
+                /// @return Whether or not the length was read
+                /// without exceeding the input.
+                //---------------------------------------------------
+                bool ReadLength(const u8*& inout_position, const u8* in_end, u32& out_length)
+                {
+                    u8 value = 0;
+                    do
+                    {
+                        if (inout_position >= in_end)
+                        {
+                            return false;
+                        }
+                        value = *inout_position++;
+                        out_length += value;
+                    }
+                    while (value == 255);
+                    return true;
+                }
+                //---------------------------------------------------
+                /// Writes a sequence to the output.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The literals.
+                /// @param The number of literals.
+                /// @param The match offset. Unused if the match
+                /// length is zero.
+                /// @param The match length. Zero for the final
+                /// sequence.
+                /// @param [Out] The output position.
+                ///
+                /// @return The new output position.
+                //---------------------------------------------------
+                u8* WriteSequence(const u8* in_literals, u32 in_numLiterals, u32 in_offset, u32 in_matchLength, u8* out_position)
+                {
+                    u8* token = out_position++;
+                    *token = 0;
+
+                    if (in_numLiterals >= 15)
+                    {
+                        *token = 15 << 4;
+                        out_position = WriteLength(in_numLiterals - 15, out_position);
+                    }
+                    else
+                    {
+                        *token = u8(in_numLiterals << 4);
+                    }
+
+                    memcpy(out_position, in_literals, in_numLiterals);
+                    out_position += in_numLiterals;
+
+                    if (in_matchLength > 0)
+                    {
+                        *out_position++ = u8(in_offset & 0xff);
+                        *out_position++ = u8(in_offset >> 8);
+
+                        const u32 matchCode = in_matchLength - k_minMatch;
+                        if (matchCode >= 15)
+                        {
+                            *token |= 15;
+                            out_position = WriteLength(matchCode - 15, out_position);
+                        }
+                        else
+                        {
+                            *token |= u8(matchCode);
+                        }
+                    }
+
+                    return out_position;
+                }
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            u32 CalcMaxCompressedSize(u32 in_dataSize)
+            {
+                return in_dataSize + (in_dataSize / 255) + 16;
+            }
+            //---------------------------------------------------
+            /// A greedy single pass compressor using a small
+            /// hash table of previous positions.
+            //---------------------------------------------------
+            u32 Compress(const u8* in_data, u32 in_dataSize, u8* out_compressedData, u32 in_compressedDataCapacity)
+            {
+                if (in_compressedDataCapacity < CalcMaxCompressedSize(in_dataSize))
+                {
+                    return 0;
+                }
+
+                u8* output = out_compressedData;
+                u32 literalStart = 0;
+
+                if (in_dataSize > k_matchSearchLimit)
+                {
+                    u32 hashTable[1 << k_hashLog];
+                    memset(hashTable, 0xff, sizeof(hashTable));
+
+                    const u32 matchSearchEnd = in_dataSize - k_matchSearchLimit;
+                    const u32 matchEnd = in_dataSize - k_lastLiterals;
+
+                    u32 position = 0;
+                    while (position < matchSearchEnd)
+                    {
+                        const u32 sequence = ReadU32(in_data + position);
+                        const u32 hash = Hash(sequence);
+                        const u32 candidate = hashTable[hash];
+                        hashTable[hash] = position;
+
+                        if (candidate == 0xffffffff || position - candidate > k_maxOffset || ReadU32(in_data + candidate) != sequence)
+                        {
+                            ++position;
+                            continue;
+                        }
+
+                        u32 matchLength = k_minMatch;
+                        while (position + matchLength < matchEnd && in_data[candidate + matchLength] == in_data[position + matchLength])
+                        {
+                            ++matchLength;
+                        }
+
+                        output = WriteSequence(in_data + literalStart, position - literalStart, position - candidate, matchLength, output);
+
+                        position += matchLength;
+                        literalStart = position;
+
+                        //positions inside the match are not hashed, so add one near the end to improve the next search.
+                        if (position < matchSearchEnd)
+                        {
+                            hashTable[Hash(ReadU32(in_data + position - 2))] = position - 2;
+                        }
+                    }
+                }
+
+                output = WriteSequence(in_data + literalStart, in_dataSize - literalStart, 0, 0, output);
+
+                return u32(output - out_compressedData);
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            bool Decompress(const u8* in_compressedData, u32 in_compressedDataSize, u8* out_data, u32 in_dataSize)
+            {
+                const u8* input = in_compressedData;
+                const u8* inputEnd = in_compressedData + in_compressedDataSize;
+                u8* output = out_data;
+                u8* outputEnd = out_data + in_dataSize;
+
+                while (input < inputEnd)
+                {
+                    const u8 token = *input++;
+
+                    u32 numLiterals = token >> 4;
+                    if (numLiterals == 15 && ReadLength(input, inputEnd, numLiterals) == false)
+                    {
+                        return false;
+                    }
+
+                    if (numLiterals > u32(inputEnd - input) || numLiterals > u32(outputEnd - output))
+                    {
+                        return false;
+                    }
+
+                    //short runs are copied with a fixed size copy when there is room, as it is much cheaper
+                    //than a variable size one. The bytes written beyond the run are overwritten later.
+                    if (numLiterals <= k_fastCopySize && u32(inputEnd - input) >= k_fastCopySize && u32(outputEnd - output) >= k_fastCopySize)
+                    {
+                        memcpy(output, input, k_fastCopySize);
+                    }
+                    else
+                    {
+                        memcpy(output, input, numLiterals);
+                    }
+                    input += numLiterals;
+                    output += numLiterals;
+
+                    //the final sequence has no match.
+                    if (input == inputEnd)
+                    {
+                        break;
+                    }
+
+                    if (inputEnd - input < 2)
+                    {
+                        return false;
+                    }
+
+                    const u32 offset = u32(input[0]) | (u32(input[1]) << 8);
+                    input += 2;
+
+                    if (offset == 0 || offset > u32(output - out_data))
+                    {
+                        return false;
+                    }
+
+                    u32 matchLength = token & 15;
+                    if (matchLength == 15 && ReadLength(input, inputEnd, matchLength) == false)
+                    {
+                        return false;
+                    }
+                    matchLength += k_minMatch;
+
+                    if (matchLength > u32(outputEnd - output))
+                    {
+                        return false;
+                    }
+
+                    //overlapping matches repeat the preceding bytes. The repeated run doubles with each
+                    //copy, so the source and destination of each individual copy never overlap.
+                    const u8* match = output - offset;
+                    const u8* matchEnd = output + matchLength;
+                    if (offset >= k_fastCopySize && matchLength <= k_fastCopySize && u32(outputEnd - output) >= k_fastCopySize)
+                    {
+                        memcpy(output, match, k_fastCopySize);
+                        output += matchLength;
+                    }
+                    while (output < matchEnd)
+                    {
+                        const u32 copySize = std::min(u32(output - match), u32(matchEnd - output));
+                        memcpy(output, match, copySize);
+                        output += copySize;
+                    }
+                }
+
+                return (output == outputEnd);
+            }
+        }
+    }
+}
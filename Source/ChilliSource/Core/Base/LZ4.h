@@ -0,0 +1,97 @@
+//
+//  LZ4.h
+//  Chilli Source
+//  Created by Ian Copland on 14/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_BASE_LZ4_H_
+#define _CHILLISOURCE_CORE_BASE_LZ4_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------
+        /// Methods for compressing and decompressing data using
+        /// the LZ4 block format. LZ4 gives a worse compression
+        /// ratio than zlib, but decompresses many times faster,
+        /// making it a good choice for assets where load time
+        /// matters more than disk size.
+        ///
+        /// Only the raw block format is supported; the LZ4 frame
+        /// format is not.
+        ///
+        /// @author Ian Copland
+        //---------------------------------------------------------
+        namespace LZ4
+        {
+            //---------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The size of the uncompressed data.
+            ///
+            /// @return The maximum size the data could be after
+            /// compression.
+            //---------------------------------------------------
+            u32 CalcMaxCompressedSize(u32 in_dataSize);
+            //---------------------------------------------------
+            /// Compresses the given data into a single LZ4 block.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The data to compress.
+            /// @param The size of the data.
+            /// @param [Out] The output buffer. This should be at
+            /// least CalcMaxCompressedSize() bytes.
+            /// @param The size of the output buffer.
+            ///
+            /// @return The size of the compressed data, or zero if
+            /// the output buffer was too small.
+            //---------------------------------------------------
+            u32 Compress(const u8* in_data, u32 in_dataSize, u8* out_compressedData, u32 in_compressedDataCapacity);
+            //---------------------------------------------------
+            /// Decompresses a single LZ4 block. The block is
+            /// validated as it is decoded so malformed data will
+            /// not cause reads or writes outside of the given
+            /// buffers.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The compressed block.
+            /// @param The size of the compressed block.
+            /// @param [Out] The output buffer.
+            /// @param The expected size of the decompressed data.
+            ///
+            /// @return Whether or not the block was decompressed
+            /// successfully and exactly filled the output buffer.
+            //---------------------------------------------------
+            bool Decompress(const u8* in_compressedData, u32 in_compressedDataSize, u8* out_data, u32 in_dataSize);
+        }
+    }
+}
+
+#endif
@@ -173,6 +173,8 @@ namespace ChilliSource
             [message release];
 #elif defined (CS_TARGETPLATFORM_WINDOWS)
 			OutputDebugString(CSBackend::Windows::WindowsStringUtils::UTF8ToUTF16("[Chilli Source] " + in_message + "\n").c_str());
+#elif defined (CS_TARGETPLATFORM_LINUX)
+            std::cerr << "[Chilli Source] " << in_message << std::endl;
 #endif
             
 #ifdef CS_ENABLE_LOGTOFILE
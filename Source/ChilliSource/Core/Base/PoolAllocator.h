@@ -0,0 +1,195 @@
+//
+//  PoolAllocator.h
+//  Chilli Source
+//  Created by Ian Copland on 16/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_BASE_POOLALLOCATOR_H_
+#define _CHILLISOURCE_CORE_BASE_POOLALLOCATOR_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/SmallObjectAllocator.h>
+
+#include <limits>
+#include <memory>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------
+        /// A standard library compatible allocator which takes its
+        /// memory from the small object allocator. This is mainly
+        /// intended for use with std::allocate_shared(), so that
+        /// both the object and the shared pointer control block
+        /// are pooled, but can be used with any container.
+        ///
+        /// All instances are interchangeable.
+        ///
+        /// @author Ian Copland
+        //---------------------------------------------------------
+        template <typename TType> class PoolAllocator final
+        {
+        public:
+            using value_type = TType;
+            using pointer = TType*;
+            using const_pointer = const TType*;
+            using reference = TType&;
+            using const_reference = const TType&;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            
+            template <typename TOtherType> struct rebind
+            {
+                using other = PoolAllocator<TOtherType>;
+            };
+            //---------------------------------------------------
+            /// Constructor.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            PoolAllocator() = default;
+            //---------------------------------------------------
+            /// Converting constructor, required by the standard
+            /// library to rebind the allocator to other types.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            template <typename TOtherType> PoolAllocator(const PoolAllocator<TOtherType>&) {}
+            //---------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The number of objects.
+            ///
+            /// @return Uninitialised memory for the given number
+            /// of objects.
+            //---------------------------------------------------
+            pointer allocate(size_type in_count)
+            {
+                return static_cast<pointer>(SmallObjectAllocator::Allocate(in_count * sizeof(TType)));
+            }
+            //---------------------------------------------------
+            /// Frees memory allocated with allocate().
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The memory.
+            /// @param The number of objects it was allocated for.
+            //---------------------------------------------------
+            void deallocate(pointer in_memory, size_type in_count)
+            {
+                SmallObjectAllocator::Deallocate(in_memory, in_count * sizeof(TType));
+            }
+            //---------------------------------------------------
+            /// Constructs an object in place.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The memory.
+            /// @param The constructor arguments.
+            //---------------------------------------------------
+            template <typename TOtherType, typename... TArgs> void construct(TOtherType* in_memory, TArgs&&... in_args)
+            {
+                ::new(static_cast<void*>(in_memory)) TOtherType(std::forward<TArgs>(in_args)...);
+            }
+            //---------------------------------------------------
+            /// Destroys an object in place.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The object.
+            //---------------------------------------------------
+            template <typename TOtherType> void destroy(TOtherType* in_object)
+            {
+                in_object->~TOtherType();
+            }
+            //---------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The maximum number of objects that can be
+            /// allocated in one go.
+            //---------------------------------------------------
+            size_type max_size() const
+            {
+                return std::numeric_limits<size_type>::max() / sizeof(TType);
+            }
+        };
+        //---------------------------------------------------------
+        /// @author Ian Copland
+        ///
+        /// @return Always true, as all pool allocators share the
+        /// same pools.
+        //---------------------------------------------------------
+        template <typename TType, typename TOtherType> bool operator==(const PoolAllocator<TType>&, const PoolAllocator<TOtherType>&)
+        {
+            return true;
+        }
+        //---------------------------------------------------------
+        /// @author Ian Copland
+        ///
+        /// @return Always false, as all pool allocators share the
+        /// same pools.
+        //---------------------------------------------------------
+        template <typename TType, typename TOtherType> bool operator!=(const PoolAllocator<TType>&, const PoolAllocator<TOtherType>&)
+        {
+            return false;
+        }
+        //---------------------------------------------------------
+        /// Creates a new object owned by a shared pointer, with the
+        /// object and control block in a single pooled allocation.
+        /// The type must have an accessible constructor.
+        ///
+        /// @author Ian Copland
+        ///
+        /// @param The constructor arguments.
+        ///
+        /// @return The new shared pointer.
+        //---------------------------------------------------------
+        template <typename TType, typename... TArgs> std::shared_ptr<TType> AllocateSharedPooled(TArgs&&... in_args)
+        {
+            return std::allocate_shared<TType>(PoolAllocator<TType>(), std::forward<TArgs>(in_args)...);
+        }
+        //---------------------------------------------------------
+        /// Transfers ownership of an object from a unique pointer
+        /// to a new shared pointer, taking the control block from
+        /// the pool rather than the heap. This should be used in
+        /// place of the implicit conversion for objects returned
+        /// from factory methods, such as Entity::Create().
+        ///
+        /// @author Ian Copland
+        ///
+        /// @param The unique pointer.
+        ///
+        /// @return The new shared pointer.
+        //---------------------------------------------------------
+        template <typename TType> std::shared_ptr<TType> MakeSharedPooled(std::unique_ptr<TType> in_object)
+        {
+            return std::shared_ptr<TType>(in_object.release(), std::default_delete<TType>(), PoolAllocator<TType>());
+        }
+    }
+}
+
+#endif
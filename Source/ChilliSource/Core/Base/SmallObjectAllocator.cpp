@@ -0,0 +1,170 @@
+//
+//  SmallObjectAllocator.cpp
+//  Chilli Source
+//  Created by Ian Copland on 16/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Base/SmallObjectAllocator.h>
+
+#include <ChilliSource/Core/Base/FixedSizePool.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace SmallObjectAllocator
+        {
+            namespace
+            {
+                const std::size_t k_sizeClassGranularity = 16;
+                const std::size_t k_maxPooledSize = 1024;
+                const std::size_t k_numSizeClasses = k_maxPooledSize / k_sizeClassGranularity;
+                const std::size_t k_targetPageSize = 16 * 1024;
+                
+                std::atomic<u64> g_numOversizedAllocations(0);
+                
+                //---------------------------------------------------
+                /// The fixed size pool for each size class.
+                ///
+                /// @author Ian Copland
+                //---------------------------------------------------
+                struct Pools final
+                {
+                    std::unique_ptr<FixedSizePool> m_sizeClasses[k_numSizeClasses];
+                };
+                //---------------------------------------------------
+                /// The pools are created on first use and are
+                /// intentionally never destroyed, so objects which
+                /// outlive static destruction can still be freed.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @return The pools.
+                //---------------------------------------------------
+                Pools& GetPools()
+                {
+                    static Pools* pools = []()
+                    {
+                        Pools* output = new Pools();
+                        for (std::size_t i = 0; i < k_numSizeClasses; ++i)
+                        {
+                            const std::size_t blockSize = (i + 1) * k_sizeClassGranularity;
+                            const u32 blocksPerPage = u32(std::max(k_targetPageSize / blockSize, std::size_t(1)));
+                            output->m_sizeClasses[i].reset(new FixedSizePool(blockSize, blocksPerPage));
+                        }
+                        return output;
+                    }();
+                    
+                    return *pools;
+                }
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The allocation size. Must not exceed the
+                /// max pooled size.
+                ///
+                /// @return The pool for the given size.
+                //---------------------------------------------------
+                FixedSizePool& GetPool(std::size_t in_size)
+                {
+                    const std::size_t sizeClass = (std::max(in_size, std::size_t(1)) + k_sizeClassGranularity - 1) / k_sizeClassGranularity - 1;
+                    return *GetPools().m_sizeClasses[sizeClass];
+                }
+            }
+            
+            //---------------------------------------------------
+            //---------------------------------------------------
+            std::size_t GetMaxPooledSize()
+            {
+                return k_maxPooledSize;
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            void* Allocate(std::size_t in_size)
+            {
+                if (in_size > k_maxPooledSize)
+                {
+                    g_numOversizedAllocations++;
+                    return ::operator new(in_size);
+                }
+                
+                return GetPool(in_size).Allocate();
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            void Deallocate(void* in_memory, std::size_t in_size)
+            {
+                if (in_memory == nullptr)
+                {
+                    return;
+                }
+                
+                if (in_size > k_maxPooledSize)
+                {
+                    ::operator delete(in_memory);
+                    return;
+                }
+                
+                GetPool(in_size).Deallocate(in_memory);
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            void ReleaseUnusedMemory()
+            {
+                Pools& pools = GetPools();
+                for (const auto& pool : pools.m_sizeClasses)
+                {
+                    pool->ReleaseUnusedPages();
+                }
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            Stats GetStats()
+            {
+                Stats output;
+                
+                Pools& pools = GetPools();
+                for (const auto& pool : pools.m_sizeClasses)
+                {
+                    FixedSizePool::Stats poolStats = pool->GetStats();
+                    output.m_numPages += poolStats.m_numPages;
+                    output.m_numBlocksInUse += poolStats.m_numBlocksInUse;
+                    output.m_numAllocations += poolStats.m_numAllocations;
+                    output.m_numHeapAllocations += poolStats.m_numPageAllocations;
+                }
+                
+                const u64 numOversizedAllocations = g_numOversizedAllocations;
+                output.m_numAllocations += numOversizedAllocations;
+                output.m_numHeapAllocations += numOversizedAllocations;
+                
+                return output;
+            }
+        }
+    }
+}
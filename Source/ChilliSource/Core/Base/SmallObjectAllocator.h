@@ -0,0 +1,120 @@
+//
+//  SmallObjectAllocator.h
+//  Chilli Source
+//  Created by Ian Copland on 16/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_BASE_SMALLOBJECTALLOCATOR_H_
+#define _CHILLISOURCE_CORE_BASE_SMALLOBJECTALLOCATOR_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------
+        /// A general purpose, thread safe allocator for small,
+        /// frequently created objects such as entities, components
+        /// and shared pointer control blocks. Requests are rounded
+        /// up to a size class and served from a fixed size pool
+        /// for that class. Requests larger than the largest size
+        /// class fall back to the heap.
+        ///
+        /// The pools are never destroyed, so memory allocated here
+        /// can safely be freed during static destruction.
+        ///
+        /// @author Ian Copland
+        //---------------------------------------------------------
+        namespace SmallObjectAllocator
+        {
+            //---------------------------------------------------
+            /// A container for statistics on the allocator. The
+            /// number of heap allocations includes both the pages
+            /// allocated by the pools and any allocations that
+            /// were too large for the pools; if it doesn't change
+            /// over a number of frames then no memory was taken
+            /// from the heap during them.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            struct Stats final
+            {
+                u32 m_numPages = 0;
+                u32 m_numBlocksInUse = 0;
+                u64 m_numAllocations = 0;
+                u64 m_numHeapAllocations = 0;
+            };
+            //---------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The largest allocation in bytes that will
+            /// be served from a pool.
+            //---------------------------------------------------
+            std::size_t GetMaxPooledSize();
+            //---------------------------------------------------
+            /// Allocates memory for an object of the given size.
+            /// The memory is aligned for any fundamental type.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The size in bytes.
+            ///
+            /// @return The memory.
+            //---------------------------------------------------
+            void* Allocate(std::size_t in_size);
+            //---------------------------------------------------
+            /// Frees memory allocated with Allocate(). The size
+            /// must be the same as was requested.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The memory.
+            /// @param The size in bytes.
+            //---------------------------------------------------
+            void Deallocate(void* in_memory, std::size_t in_size);
+            //---------------------------------------------------
+            /// Returns any pool pages which no longer contain live
+            /// objects to the heap. This is relatively expensive,
+            /// so should only be called after freeing a lot of
+            /// objects, for example after clearing the scene
+            /// when unloading a level.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            void ReleaseUnusedMemory();
+            //---------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The current statistics, totalled across
+            /// all size classes.
+            //---------------------------------------------------
+            Stats GetStats();
+        }
+    }
+}
+
+#endif
@@ -37,10 +37,12 @@
 #include <ChilliSource/Core/Container/ParamDictionary.h>
 #include <ChilliSource/Core/Container/ParamDictionarySerialiser.h>
 #include <ChilliSource/Core/Container/random_access_iterator.h>
+#include <ChilliSource/Core/Container/spsc_ring_buffer.h>
 #include <ChilliSource/Core/Container/VectorUtils.h>
 #include <ChilliSource/Core/Container/Property/IProperty.h>
 #include <ChilliSource/Core/Container/Property/IPropertyType.h>
 #include <ChilliSource/Core/Container/Property/Property.h>
+#include <ChilliSource/Core/Container/Property/PropertyKey.h>
 #include <ChilliSource/Core/Container/Property/PropertyMap.h>
 #include <ChilliSource/Core/Container/Property/PropertyType.h>
 #include <ChilliSource/Core/Container/Property/ReferenceProperty.h>
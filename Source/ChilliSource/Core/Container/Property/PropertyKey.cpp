@@ -0,0 +1,292 @@
+//
+//  PropertyKey.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Container/Property/PropertyKey.h>
+
+#include <ChilliSource/Core/Cryptographic/HashCRC32.h>
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const u32 k_initialCapacity = 256;
+            
+            //----------------------------------------------------------------------------------------
+            /// An interned property name. Entries are never released, so pointers to them remain
+            /// valid for the life of the application.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------------------
+            struct InternEntry
+            {
+                std::string m_name;
+                u32 m_hash = 0;
+                u32 m_lookupHash = 0;
+            };
+            //----------------------------------------------------------------------------------------
+            /// An open addressed array of entries. Slots are only ever filled, never cleared, so
+            /// can be read without a lock. The capacity is always a power of two.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------------------
+            struct InternSlots
+            {
+                u32 m_capacity = 0;
+                std::unique_ptr<std::atomic<const InternEntry*>[]> m_slots;
+            };
+            //----------------------------------------------------------------------------------------
+            /// The global table of interned property names. This is a function local static so
+            /// that keys can safely be constructed during static initialisation.
+            ///
+            /// Looking up a name which has already been interned is lock free: the current slot
+            /// array is read through an atomic pointer. New names are added under the mutex. When
+            /// the slots need to grow, a new array is published and the old one is retained, as
+            /// other threads may still be reading it. A reader which misses a name in an old
+            /// array simply falls back to the locked path.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------------------
+            struct InternTable
+            {
+                InternTable();
+                
+                std::mutex m_mutex;
+                std::atomic<InternSlots*> m_currentSlots;
+                std::vector<std::unique_ptr<InternSlots>> m_allSlots;
+                std::vector<std::unique_ptr<InternEntry>> m_entries;
+            };
+            //----------------------------------------------------------------------------------------
+            /// Property names are ascii, so this avoids the locale lookup in std::tolower().
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The character.
+            ///
+            /// @return The lower case character.
+            //----------------------------------------------------------------------------------------
+            inline char ToLower(char in_char)
+            {
+                return (in_char >= 'A' && in_char <= 'Z') ? char(in_char - 'A' + 'a') : in_char;
+            }
+            //----------------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The name.
+            /// @param The length of the name.
+            ///
+            /// @return A case insensitive FNV-1a hash of the name, used for finding the slot.
+            //----------------------------------------------------------------------------------------
+            u32 GenerateLookupHash(const char* in_name, std::size_t in_length)
+            {
+                u32 hash = 2166136261u;
+                for (std::size_t i = 0; i < in_length; ++i)
+                {
+                    hash ^= u32(u8(ToLower(in_name[i])));
+                    hash *= 16777619u;
+                }
+                return hash;
+            }
+            //----------------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The interned entry.
+            /// @param The lookup hash of the name.
+            /// @param The name, in any case.
+            /// @param The length of the name.
+            ///
+            /// @return Whether or not the entry is for the given name.
+            //----------------------------------------------------------------------------------------
+            bool IsEntryForName(const InternEntry* in_entry, u32 in_lookupHash, const char* in_name, std::size_t in_length)
+            {
+                if (in_entry->m_lookupHash != in_lookupHash || in_entry->m_name.size() != in_length)
+                {
+                    return false;
+                }
+                
+                for (std::size_t i = 0; i < in_length; ++i)
+                {
+                    if (in_entry->m_name[i] != ToLower(in_name[i]))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            //----------------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The slots to search.
+            /// @param The lookup hash of the name.
+            /// @param The name, in any case.
+            /// @param The length of the name.
+            ///
+            /// @return The entry for the name, or null if it isn't in the given slots.
+            //----------------------------------------------------------------------------------------
+            const InternEntry* Find(const InternSlots* in_slots, u32 in_lookupHash, const char* in_name, std::size_t in_length)
+            {
+                const u32 mask = in_slots->m_capacity - 1;
+                for (u32 index = in_lookupHash & mask; ; index = (index + 1) & mask)
+                {
+                    const InternEntry* entry = in_slots->m_slots[index].load(std::memory_order_acquire);
+                    if (entry == nullptr || IsEntryForName(entry, in_lookupHash, in_name, in_length) == true)
+                    {
+                        return entry;
+                    }
+                }
+            }
+            //----------------------------------------------------------------------------------------
+            /// Places the entry in the first free slot. The slots must not be full.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The slots.
+            /// @param The entry.
+            //----------------------------------------------------------------------------------------
+            void Insert(InternSlots* in_slots, const InternEntry* in_entry)
+            {
+                const u32 mask = in_slots->m_capacity - 1;
+                u32 index = in_entry->m_lookupHash & mask;
+                while (in_slots->m_slots[index].load(std::memory_order_relaxed) != nullptr)
+                {
+                    index = (index + 1) & mask;
+                }
+                in_slots->m_slots[index].store(in_entry, std::memory_order_release);
+            }
+            //----------------------------------------------------------------------------------------
+            /// Creates a new, empty slot array and adds it to the table. It is not published.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The table.
+            /// @param The capacity. This must be a power of two.
+            ///
+            /// @return The new slots.
+            //----------------------------------------------------------------------------------------
+            InternSlots* CreateSlots(InternTable& in_table, u32 in_capacity)
+            {
+                std::unique_ptr<InternSlots> slots(new InternSlots());
+                slots->m_capacity = in_capacity;
+                slots->m_slots.reset(new std::atomic<const InternEntry*>[in_capacity]);
+                for (u32 i = 0; i < in_capacity; ++i)
+                {
+                    slots->m_slots[i].store(nullptr, std::memory_order_relaxed);
+                }
+                
+                InternSlots* output = slots.get();
+                in_table.m_allSlots.push_back(std::move(slots));
+                return output;
+            }
+            //----------------------------------------------------------------------------------------
+            //----------------------------------------------------------------------------------------
+            InternTable::InternTable()
+            {
+                m_currentSlots.store(CreateSlots(*this, k_initialCapacity), std::memory_order_release);
+            }
+            //----------------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The global intern table.
+            //----------------------------------------------------------------------------------------
+            InternTable& GetInternTable()
+            {
+                static InternTable s_table;
+                return s_table;
+            }
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        PropertyKey::PropertyKey(const std::string& in_name)
+        {
+            Intern(in_name.c_str(), in_name.size());
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        PropertyKey::PropertyKey(const char* in_name)
+        {
+            CS_ASSERT(in_name != nullptr, "Cannot create a property key from a null name.");
+            
+            Intern(in_name, std::strlen(in_name));
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        void PropertyKey::Intern(const char* in_name, std::size_t in_length)
+        {
+            auto& table = GetInternTable();
+            u32 lookupHash = GenerateLookupHash(in_name, in_length);
+            
+            const InternEntry* entry = Find(table.m_currentSlots.load(std::memory_order_acquire), lookupHash, in_name, in_length);
+            if (entry == nullptr)
+            {
+                std::unique_lock<std::mutex> lock(table.m_mutex);
+                
+                InternSlots* currentSlots = table.m_currentSlots.load(std::memory_order_relaxed);
+                entry = Find(currentSlots, lookupHash, in_name, in_length);
+                if (entry == nullptr)
+                {
+                    std::unique_ptr<InternEntry> newEntry(new InternEntry());
+                    newEntry->m_name.reserve(in_length);
+                    for (std::size_t i = 0; i < in_length; ++i)
+                    {
+                        newEntry->m_name.push_back(ToLower(in_name[i]));
+                    }
+                    newEntry->m_hash = HashCRC32::GenerateHashCode(newEntry->m_name);
+                    newEntry->m_lookupHash = lookupHash;
+                    entry = newEntry.get();
+                    table.m_entries.push_back(std::move(newEntry));
+                    
+                    //keep the load factor at or below a half so probe sequences stay short.
+                    if (table.m_entries.size() * 2 > currentSlots->m_capacity)
+                    {
+                        InternSlots* grownSlots = CreateSlots(table, currentSlots->m_capacity * 2);
+                        for (const auto& existingEntry : table.m_entries)
+                        {
+                            Insert(grownSlots, existingEntry.get());
+                        }
+                        table.m_currentSlots.store(grownSlots, std::memory_order_release);
+                    }
+                    else
+                    {
+                        Insert(currentSlots, entry);
+                    }
+                }
+            }
+            
+            m_name = &entry->m_name;
+            m_hash = entry->m_hash;
+        }
+    }
+}
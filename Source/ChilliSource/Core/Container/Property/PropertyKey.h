@@ -0,0 +1,171 @@
+//
+//  PropertyKey.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_CONTAINER_PROPERTY_PROPERTYKEY_H_
+#define _CHILLISOURCE_CORE_CONTAINER_PROPERTY_PROPERTYKEY_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <string>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------------------------------
+        /// An interned, case insensitive property name. On construction the name is
+        /// converted to lower case and looked up in a global table, so that all keys
+        /// with the same name share a single copy of the string. The hash of the name is
+        /// calculated once on interning, and comparison of two keys is simply a pointer
+        /// comparison.
+        ///
+        /// Looking up a name which has already been interned is lock free and doesn't
+        /// allocate, but it still has to hash and compare the name. Keys can be
+        /// implicitly constructed from strings so that any method taking a key can
+        /// also be passed a property name, but code which accesses the same property
+        /// regularly, such as an animation which sets a widget property every frame,
+        /// should construct the key once and retain it, or use one of the predefined
+        /// keys in UI::PropertyKeys.
+        ///
+        /// Interning is thread safe and interned names are never released.
+        ///
+        /// @author Ian Copland
+        //---------------------------------------------------------------------------------
+        class PropertyKey final
+        {
+        public:
+            //----------------------------------------------------------------------------------------
+            /// A hash functor so that the key can be used in unordered containers.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------------------
+            struct Hash
+            {
+                //----------------------------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The key.
+                ///
+                /// @return The pre-calculated hash of the key.
+                //----------------------------------------------------------------------------------------
+                std::size_t operator()(const PropertyKey& in_key) const;
+            };
+            //----------------------------------------------------------------------------------------
+            /// Constructor. Interns the given property name.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The property name. This is case insensitive.
+            //----------------------------------------------------------------------------------------
+            PropertyKey(const std::string& in_name);
+            //----------------------------------------------------------------------------------------
+            /// Constructor. Interns the given property name.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The property name. This is case insensitive.
+            //----------------------------------------------------------------------------------------
+            PropertyKey(const char* in_name);
+            //----------------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The interned, lower case property name.
+            //----------------------------------------------------------------------------------------
+            const std::string& GetName() const;
+            //----------------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The CRC32 hash of the lower case property name. This is stable between runs.
+            //----------------------------------------------------------------------------------------
+            u32 GetHash() const;
+            //----------------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The other key.
+            ///
+            /// @return Whether or not the two keys refer to the same property name.
+            //----------------------------------------------------------------------------------------
+            bool operator==(const PropertyKey& in_other) const;
+            //----------------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The other key.
+            ///
+            /// @return Whether or not the two keys refer to different property names.
+            //----------------------------------------------------------------------------------------
+            bool operator!=(const PropertyKey& in_other) const;
+            
+        private:
+            //----------------------------------------------------------------------------------------
+            /// Looks up the given name in the intern table, adding it if it doesn't already exist.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The property name. This is case insensitive.
+            /// @param The length of the property name.
+            //----------------------------------------------------------------------------------------
+            void Intern(const char* in_name, std::size_t in_length);
+            
+            const std::string* m_name = nullptr;
+            u32 m_hash = 0;
+        };
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        inline std::size_t PropertyKey::Hash::operator()(const PropertyKey& in_key) const
+        {
+            return std::size_t(in_key.m_hash);
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        inline const std::string& PropertyKey::GetName() const
+        {
+            return *m_name;
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        inline u32 PropertyKey::GetHash() const
+        {
+            return m_hash;
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        inline bool PropertyKey::operator==(const PropertyKey& in_other) const
+        {
+            return (m_name == in_other.m_name);
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        inline bool PropertyKey::operator!=(const PropertyKey& in_other) const
+        {
+            return (m_name != in_other.m_name);
+        }
+    }
+}
+
+#endif
@@ -47,25 +47,25 @@ namespace ChilliSource
         {
             for(const auto& propertyDef : in_propertyDefs)
             {
-                CS_ASSERT(m_properties.find(propertyDef.m_name) == m_properties.end(), "Duplicate property name in property map descs: " + propertyDef.m_name);
-                
-                std::string lowerName = propertyDef.m_name;
-                StringUtils::ToLowerCase(lowerName);
+                PropertyKey key(propertyDef.m_name);
+                CS_ASSERT(m_properties.find(key) == m_properties.end(), "Duplicate property name in property map descs: " + propertyDef.m_name);
                 
                 PropertyContainer container;
                 container.m_initialised = false;
                 container.m_property = propertyDef.m_type->CreateProperty();
-                m_properties.insert(std::make_pair(lowerName, std::move(container)));
+                m_properties.insert(std::make_pair(key, std::move(container)));
                 
                 m_propertyKeys.push_back(propertyDef.m_name);
+                m_internedKeys.push_back(key);
             }
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
         PropertyMap::PropertyMap(PropertyMap&& in_move)
-        : m_properties(std::move(in_move.m_properties)), m_propertyKeys(std::move(in_move.m_propertyKeys))
+        : m_properties(std::move(in_move.m_properties)), m_propertyKeys(std::move(in_move.m_propertyKeys)), m_internedKeys(std::move(in_move.m_internedKeys))
         {
             in_move.m_propertyKeys.clear();
+            in_move.m_internedKeys.clear();
             in_move.m_properties.clear();
         }
         //----------------------------------------------------------------------------------------
@@ -82,6 +82,7 @@ namespace ChilliSource
             }
             
             m_propertyKeys = in_copy.m_propertyKeys;
+            m_internedKeys = in_copy.m_internedKeys;
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -89,9 +90,11 @@ namespace ChilliSource
         {
             m_properties = std::move(in_move.m_properties);
             m_propertyKeys = std::move(in_move.m_propertyKeys);
+            m_internedKeys = std::move(in_move.m_internedKeys);
             
             in_move.m_properties.clear();
             in_move.m_propertyKeys.clear();
+            in_move.m_internedKeys.clear();
             
             return *this;
         }
@@ -111,6 +114,7 @@ namespace ChilliSource
             }
             
             m_propertyKeys = in_copy.m_propertyKeys;
+            m_internedKeys = in_copy.m_internedKeys;
             
             return *this;
         }
@@ -122,21 +126,21 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        bool PropertyMap::HasKey(const std::string& in_name) const
+        const std::vector<PropertyKey>& PropertyMap::GetInternedKeys() const
         {
-            std::string lowerCaseName = in_name;
-            Core::StringUtils::ToLowerCase(lowerCaseName);
-            
-            return m_properties.find(lowerCaseName) != m_properties.end();
+            return m_internedKeys;
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        bool PropertyMap::HasValue(const std::string& in_name) const
+        bool PropertyMap::HasKey(const PropertyKey& in_name) const
         {
-            std::string lowerCaseName = in_name;
-            Core::StringUtils::ToLowerCase(lowerCaseName);
-            
-            auto it = m_properties.find(lowerCaseName);
+            return m_properties.find(in_name) != m_properties.end();
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        bool PropertyMap::HasValue(const PropertyKey& in_name) const
+        {
+            auto it = m_properties.find(in_name);
             if (it == m_properties.end())
             {
                 CS_LOG_FATAL("Querying whether a non-existant property has a value.");
@@ -147,19 +151,16 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        void PropertyMap::SetProperty(const std::string& in_name, const char* in_value)
+        void PropertyMap::SetProperty(const PropertyKey& in_name, const char* in_value)
         {
             SetProperty<std::string>(in_name, in_value);
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        void PropertyMap::ParseProperty(const std::string& in_name, const std::string& in_value)
+        void PropertyMap::ParseProperty(const PropertyKey& in_name, const std::string& in_value)
         {
-            std::string lowerCaseName = in_name;
-            Core::StringUtils::ToLowerCase(lowerCaseName);
-            
-            auto entry = m_properties.find(lowerCaseName);
-            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name);
+            auto entry = m_properties.find(in_name);
+            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name.GetName());
             
             IProperty* property = entry->second.m_property.get();
             property->Parse(in_value);
@@ -167,41 +168,32 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        std::string PropertyMap::GetPropertyOrDefault(const std::string& in_name, const char* in_default) const
+        std::string PropertyMap::GetPropertyOrDefault(const PropertyKey& in_name, const char* in_default) const
         {
             return GetPropertyOrDefault<std::string>(in_name, in_default);
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        const IPropertyType* PropertyMap::GetType(const std::string& in_name) const
+        const IPropertyType* PropertyMap::GetType(const PropertyKey& in_name) const
         {
-            std::string lowerCaseName = in_name;
-            Core::StringUtils::ToLowerCase(lowerCaseName);
-            
-            auto entry = m_properties.find(lowerCaseName);
-            CS_ASSERT(entry != m_properties.end(), "No property with name: " + in_name);
+            auto entry = m_properties.find(in_name);
+            CS_ASSERT(entry != m_properties.end(), "No property with name: " + in_name.GetName());
             return entry->second.m_property->GetType();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        IProperty* PropertyMap::GetPropertyObject(const std::string& in_name)
+        IProperty* PropertyMap::GetPropertyObject(const PropertyKey& in_name)
         {
-            std::string lowerCaseName = in_name;
-            Core::StringUtils::ToLowerCase(lowerCaseName);
-            
-            auto entry = m_properties.find(lowerCaseName);
-            CS_ASSERT(entry != m_properties.end(), "No property with name: " + in_name);
+            auto entry = m_properties.find(in_name);
+            CS_ASSERT(entry != m_properties.end(), "No property with name: " + in_name.GetName());
             return entry->second.m_property.get();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        const IProperty* PropertyMap::GetPropertyObject(const std::string& in_name) const
+        const IProperty* PropertyMap::GetPropertyObject(const PropertyKey& in_name) const
         {
-            std::string lowerCaseName = in_name;
-            Core::StringUtils::ToLowerCase(lowerCaseName);
-            
-            auto entry = m_properties.find(lowerCaseName);
-            CS_ASSERT(entry != m_properties.end(), "No property with name: " + in_name);
+            auto entry = m_properties.find(in_name);
+            CS_ASSERT(entry != m_properties.end(), "No property with name: " + in_name.GetName());
             return entry->second.m_property.get();
         }
 		//----------------------------------------------------------------------------------------
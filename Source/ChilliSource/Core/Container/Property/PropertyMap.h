@@ -34,6 +34,7 @@
 #include <ChilliSource/Core/Cryptographic/HashCRC32.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 #include <ChilliSource/Core/Container/Property/Property.h>
+#include <ChilliSource/Core/Container/Property/PropertyKey.h>
 
 #include <cassert>
 #include <unordered_map>
@@ -52,6 +53,10 @@ namespace ChilliSource
         /// a property after SetProperty() has been called for it. HasValue() can be used
         /// to check if a value has been set.
         ///
+        /// Properties are looked up using an interned PropertyKey. Keys can be implicitly
+        /// constructed from a property name, but retaining a key avoids interning the name
+        /// on each access.
+        ///
         /// @author S Downie
         //---------------------------------------------------------------------------------
         class PropertyMap final
@@ -124,13 +129,23 @@ namespace ChilliSource
             //----------------------------------------------------------------------------------------
             const std::vector<std::string>& GetKeys() const;
             //----------------------------------------------------------------------------------------
+            /// Iterating over these rather than the string keys avoids the cost of interning each
+            /// key when looking up properties.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The list of interned keys in the property map, in the same order as the
+            /// keys returned by GetKeys().
+            //----------------------------------------------------------------------------------------
+            const std::vector<PropertyKey>& GetInternedKeys() const;
+            //----------------------------------------------------------------------------------------
             /// @author S Downie
             ///
             /// @param Property name
             ///
             /// @return Whether the property key exists
             //----------------------------------------------------------------------------------------
-            bool HasKey(const std::string& in_name) const;
+            bool HasKey(const PropertyKey& in_name) const;
             //----------------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
@@ -139,7 +154,7 @@ namespace ChilliSource
             /// @return Whether or not property with the given key has a value. This will error if the
             /// property doesn't exist.
             //----------------------------------------------------------------------------------------
-            bool HasValue(const std::string& in_name) const;
+            bool HasValue(const PropertyKey& in_name) const;
             //----------------------------------------------------------------------------------------
             /// Set the value of the property with the given name. If no property exists with the
             /// name then it will assert.
@@ -149,7 +164,7 @@ namespace ChilliSource
             /// @param Name
             /// @param Value
             //----------------------------------------------------------------------------------------
-            template<typename TType> void SetProperty(const std::string& in_name, TType&& in_value);
+            template<typename TType> void SetProperty(const PropertyKey& in_name, TType&& in_value);
             //----------------------------------------------------------------------------------------
             /// Specialisation to store property value for const char* as a std::string
             ///
@@ -158,7 +173,7 @@ namespace ChilliSource
             /// @param Property name
             /// @param Property value
             //----------------------------------------------------------------------------------------
-            void SetProperty(const std::string& in_name, const char* in_value);
+            void SetProperty(const PropertyKey& in_name, const char* in_value);
             //----------------------------------------------------------------------------------------
             /// Sets the property with the given name to the result of parsing the given string.
             /// Not all property types can be parsed depending on whether or not the type specifies
@@ -170,7 +185,7 @@ namespace ChilliSource
             /// @param The name of the property.
             /// @param The value to set in string form.
             //----------------------------------------------------------------------------------------
-            void ParseProperty(const std::string& in_name, const std::string& in_value);
+            void ParseProperty(const PropertyKey& in_name, const std::string& in_value);
             //----------------------------------------------------------------------------------------
             /// Get the value of the property with the given name. If no property exists with the name
             /// or the property doesn't yet have a value, with the name then it will assert.
@@ -181,7 +196,7 @@ namespace ChilliSource
             ///
             /// @return Value
             //----------------------------------------------------------------------------------------
-            template<typename TType> TType GetProperty(const std::string& in_name) const;
+            template<typename TType> TType GetProperty(const PropertyKey& in_name) const;
             //----------------------------------------------------------------------------------------
             /// Get the value of the property with the given name. If the property has not been set
             /// the default will be returned instead. If the property doesn't exist it will assert.
@@ -192,7 +207,7 @@ namespace ChilliSource
             ///
             /// @return Value (or default)
             //----------------------------------------------------------------------------------------
-            template<typename TType> TType GetPropertyOrDefault(const std::string& in_name, TType&& in_default) const;
+            template<typename TType> TType GetPropertyOrDefault(const PropertyKey& in_name, TType&& in_default) const;
             //----------------------------------------------------------------------------------------
             /// Specialisation to return property value for const char* which is stored as a std::string
             ///
@@ -203,7 +218,7 @@ namespace ChilliSource
             ///
             /// @return Property value or default if name not found
             //----------------------------------------------------------------------------------------
-			std::string GetPropertyOrDefault(const std::string& in_name, const char* in_default) const;
+			std::string GetPropertyOrDefault(const PropertyKey& in_name, const char* in_default) const;
             //----------------------------------------------------------------------------------------
             /// @author S Downie
             ///
@@ -211,7 +226,7 @@ namespace ChilliSource
             ///
             /// @return The type of the property with the given name
             //----------------------------------------------------------------------------------------
-            const IPropertyType* GetType(const std::string& in_name) const;
+            const IPropertyType* GetType(const PropertyKey& in_name) const;
             //----------------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
@@ -220,7 +235,7 @@ namespace ChilliSource
             /// @return The underlying property object for the given key. If there is no property
             /// with the given name, or the property has no value this will assert.
             //----------------------------------------------------------------------------------------
-            IProperty* GetPropertyObject(const std::string& in_name);
+            IProperty* GetPropertyObject(const PropertyKey& in_name);
             //----------------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
@@ -229,7 +244,7 @@ namespace ChilliSource
             /// @return A constant version of the underlying property object for the given key. If
             /// there is no property with the given name, or the property has no value this will assert.
             //----------------------------------------------------------------------------------------
-            const IProperty* GetPropertyObject(const std::string& in_name) const;
+            const IProperty* GetPropertyObject(const PropertyKey& in_name) const;
             
         private:
             //----------------------------------------------------------------------------------------
@@ -273,53 +288,45 @@ namespace ChilliSource
             };
     
             std::vector<std::string> m_propertyKeys;
-            std::unordered_map<std::string, PropertyContainer> m_properties;
+            std::vector<PropertyKey> m_internedKeys;
+            std::unordered_map<PropertyKey, PropertyContainer, PropertyKey::Hash> m_properties;
         };
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        template<typename TType> void PropertyMap::SetProperty(const std::string& in_name, TType&& in_value)
+        template<typename TType> void PropertyMap::SetProperty(const PropertyKey& in_name, TType&& in_value)
         {
             typedef typename std::decay<TType>::type TValueType;
             
-            std::string lowerCaseName = in_name;
-            Core::StringUtils::ToLowerCase(lowerCaseName);
-            
-            auto entry = m_properties.find(lowerCaseName);
-            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name);
+            auto entry = m_properties.find(in_name);
+            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name.GetName());
 
-            Property<TValueType>* property = CS_SMARTCAST(Property<TValueType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name);
+            Property<TValueType>* property = CS_SMARTCAST(Property<TValueType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name.GetName());
             property->Set(std::forward<TType>(in_value));
             entry->second.m_initialised = true;
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        template<typename TType> TType PropertyMap::GetProperty(const std::string& in_name) const
+        template<typename TType> TType PropertyMap::GetProperty(const PropertyKey& in_name) const
         {
             typedef typename std::decay<TType>::type TValueType;
             
-            std::string lowerCaseName = in_name;
-            Core::StringUtils::ToLowerCase(lowerCaseName);
-            
-            auto entry = m_properties.find(lowerCaseName);
-            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name);
+            auto entry = m_properties.find(in_name);
+            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name.GetName());
             CS_ASSERT(entry->second.m_initialised == true, "Cannot get the value for an uninitialised property.");
             
-            Property<TValueType>* property = CS_SMARTCAST(Property<TValueType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name);
+            Property<TValueType>* property = CS_SMARTCAST(Property<TValueType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name.GetName());
             return property->Get();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        template<typename TType> TType PropertyMap::GetPropertyOrDefault(const std::string& in_name, TType&& in_default) const
+        template<typename TType> TType PropertyMap::GetPropertyOrDefault(const PropertyKey& in_name, TType&& in_default) const
         {
             typedef typename std::decay<TType>::type TValueType;
             
-            std::string lowerCaseName = in_name;
-            Core::StringUtils::ToLowerCase(lowerCaseName);
-            
-            auto entry = m_properties.find(lowerCaseName);
-            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name);
+            auto entry = m_properties.find(in_name);
+            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name.GetName());
             
-            Property<TValueType>* property = CS_SMARTCAST(Property<TValueType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name);
+            Property<TValueType>* property = CS_SMARTCAST(Property<TValueType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name.GetName());
             if (entry->second.m_initialised == true)
             {
                 return property->Get();
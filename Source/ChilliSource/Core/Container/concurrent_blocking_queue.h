@@ -212,7 +212,7 @@ namespace ChilliSource
             CS_ASSERT(m_finished == false, "Concurrent blocking queue is being pushed after calling abort().");
 
 			//Push the object onto the queue
-			m_queue.push(in_object);
+			m_queue.push(std::move(in_object));
 
 			//Wakey wakey!!!!
 			m_emptyWaitCondition.notify_one();
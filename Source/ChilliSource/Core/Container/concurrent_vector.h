@@ -461,7 +461,7 @@ namespace ChilliSource
         //--------------------------------------------------------------------
         template <typename TType> const TType& concurrent_vector<TType>::at(size_type in_index) const
         {
-            std::unique_lock<std::recursive_mutex> scopedLock(m_mutex);
+            std::unique_lock<std::recursive_mutex> scopedLock(const_cast<std::recursive_mutex&>(m_mutex));
             if(m_requiresGC == false)
             {
                 return m_container.at(in_index).first;
@@ -0,0 +1,179 @@
+//
+//  spsc_ring_buffer.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_CONTAINER_SPSCRINGBUFFER_H_
+#define _CHILLISOURCE_CORE_CONTAINER_SPSCRINGBUFFER_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------
+        /// A fixed capacity, lock-free ring buffer for passing objects from
+        /// a single producer thread to a single consumer thread. Only one
+        /// thread may push at any time and only one thread may pop at any
+        /// time, though the two may be different threads. Neither thread
+        /// ever blocks; pushing to a full buffer and popping from an empty
+        /// buffer simply fail.
+        ///
+        /// The capacity is rounded up to the next power of two.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------
+        template <typename TType> class spsc_ring_buffer final
+        {
+        public:
+            CS_DECLARE_NOCOPY(spsc_ring_buffer);
+            
+            using size_type = std::size_t;
+            
+            //---------------------------------------------------------
+            /// Constructor.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The minimum number of objects the buffer can hold.
+            //---------------------------------------------------------
+            explicit spsc_ring_buffer(size_type in_capacity);
+            //---------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The maximum number of objects the buffer can hold.
+            //---------------------------------------------------------
+            size_type capacity() const;
+            //---------------------------------------------------------
+            /// This can only be relied upon from the consumer thread, as
+            /// the producer may push at any time.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return Whether the buffer has no objects in it.
+            //---------------------------------------------------------
+            bool empty() const;
+            //---------------------------------------------------------
+            /// Pushes an object onto the back of the buffer. This must
+            /// only be called from the producer thread.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The object.
+            ///
+            /// @return Whether or not there was space for the object.
+            //---------------------------------------------------------
+            bool try_push(const TType& in_object);
+            //---------------------------------------------------------
+            /// Pops the object at the front of the buffer. This must
+            /// only be called from the consumer thread.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param [Out] The popped object. This will only be set if
+            /// the buffer was not empty.
+            ///
+            /// @return Whether or not an object was popped.
+            //---------------------------------------------------------
+            bool try_pop(TType& out_object);
+            
+        private:
+            
+            std::vector<TType> m_buffer;
+            size_type m_mask;
+            
+            //the indices increase forever and are masked on access, so a full buffer can be told
+            //apart from an empty one. They are padded onto separate cache lines to avoid false
+            //sharing between the producer and consumer.
+            std::atomic<size_type> m_head;
+            u8 m_padding[64];
+            std::atomic<size_type> m_tail;
+        };
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        template <typename TType> spsc_ring_buffer<TType>::spsc_ring_buffer(size_type in_capacity)
+            : m_head(0), m_tail(0)
+        {
+            size_type capacity = 1;
+            while (capacity < in_capacity)
+            {
+                capacity <<= 1;
+            }
+            
+            m_buffer.resize(capacity);
+            m_mask = capacity - 1;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        template <typename TType> typename spsc_ring_buffer<TType>::size_type spsc_ring_buffer<TType>::capacity() const
+        {
+            return m_buffer.size();
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        template <typename TType> bool spsc_ring_buffer<TType>::empty() const
+        {
+            return (m_head.load(std::memory_order_relaxed) == m_tail.load(std::memory_order_acquire));
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        template <typename TType> bool spsc_ring_buffer<TType>::try_push(const TType& in_object)
+        {
+            const size_type tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_head.load(std::memory_order_acquire) == m_buffer.size())
+            {
+                return false;
+            }
+            
+            m_buffer[tail & m_mask] = in_object;
+            m_tail.store(tail + 1, std::memory_order_release);
+            
+            return true;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        template <typename TType> bool spsc_ring_buffer<TType>::try_pop(TType& out_object)
+        {
+            const size_type head = m_head.load(std::memory_order_relaxed);
+            if (head == m_tail.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            
+            out_object = m_buffer[head & m_mask];
+            m_head.store(head + 1, std::memory_order_release);
+            
+            return true;
+        }
+    }
+}
+
+#endif
@@ -31,6 +31,7 @@
 #include <base64/base64.h>
 
 #include <algorithm>
+#include <limits>
 
 namespace ChilliSource
 {
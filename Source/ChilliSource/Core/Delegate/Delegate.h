@@ -0,0 +1,417 @@
+//
+//  Delegate.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_DELEGATE_DELEGATE_H_
+#define _CHILLISOURCE_CORE_DELEGATE_DELEGATE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ChilliSource
+{
+	namespace Core
+	{
+        //------------------------------------------------------------------
+        /// The non-templated base of all Delegates, which keeps track of the
+        /// number of callables that were too large to be stored inline and
+        /// had to be allocated on the heap. This can be used to tune the
+        /// inline capacity of frequently used delegate types.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------
+        class DelegateBase
+        {
+        public:
+            //------------------------------------------------------------------
+            /// This is thread-safe.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The number of heap allocations made by all delegates
+            /// since the counter was last reset.
+            //------------------------------------------------------------------
+            static u64 GetNumHeapAllocations();
+            //------------------------------------------------------------------
+            /// Resets the heap allocation counter to zero. This is thread-safe.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------
+            static void ResetNumHeapAllocations();
+            
+        protected:
+            //------------------------------------------------------------------
+            /// Increments the heap allocation counter. This is thread-safe.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------
+            static void RecordHeapAllocation();
+            
+        private:
+            static std::atomic<u64> s_numHeapAllocations;
+        };
+        //------------------------------------------------------------------
+        /// A move-only, type erased wrapper around a callable object, such
+        /// as a lambda, function pointer or the result of std::bind(). Unlike
+        /// std::function, callables up to the given capacity in bytes are
+        /// stored inline without allocating. Larger callables, or those that
+        /// cannot be moved without throwing, fall back to the heap and are
+        /// counted by DelegateBase::GetNumHeapAllocations().
+        ///
+        /// As the delegate cannot be copied, captured state such as a
+        /// std::unique_ptr can be moved into it.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------
+        template <typename TSignature, std::size_t TCapacity = 64> class Delegate;
+        
+        template <typename TReturnType, typename... TArgTypes, std::size_t TCapacity> class Delegate<TReturnType(TArgTypes...), TCapacity> final : public DelegateBase
+        {
+        public:
+            //------------------------------------------------------------------
+            /// Constructs an empty delegate.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------
+            Delegate() = default;
+            //------------------------------------------------------------------
+            /// Constructs an empty delegate.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------
+            Delegate(std::nullptr_t) {}
+            //------------------------------------------------------------------
+            /// Constructs the delegate from the given callable. If the callable
+            /// is a null function pointer or an empty std::function then the
+            /// delegate will be empty.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The callable.
+            //------------------------------------------------------------------
+            template <typename TCallable, typename = typename std::enable_if<std::is_same<typename std::decay<TCallable>::type, Delegate>::value == false>::type>
+            Delegate(TCallable&& in_callable)
+            {
+                Assign(std::forward<TCallable>(in_callable));
+            }
+            //------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The delegate to move. It will be left empty.
+            //------------------------------------------------------------------
+            Delegate(Delegate&& in_toMove) noexcept
+            {
+                MoveFrom(in_toMove);
+            }
+            //------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The delegate to move. It will be left empty.
+            ///
+            /// @return A reference to this after the move.
+            //------------------------------------------------------------------
+            Delegate& operator=(Delegate&& in_toMove) noexcept
+            {
+                if (this != &in_toMove)
+                {
+                    Reset();
+                    MoveFrom(in_toMove);
+                }
+                
+                return *this;
+            }
+            //------------------------------------------------------------------
+            /// Empties the delegate.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return A reference to this.
+            //------------------------------------------------------------------
+            Delegate& operator=(std::nullptr_t)
+            {
+                Reset();
+                return *this;
+            }
+            
+            Delegate(const Delegate&) = delete;
+            Delegate& operator=(const Delegate&) = delete;
+            //------------------------------------------------------------------
+            /// Invokes the callable. The delegate must not be empty.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The arguments.
+            ///
+            /// @return The return value of the callable.
+            //------------------------------------------------------------------
+            TReturnType operator()(TArgTypes... in_args) const
+            {
+                CS_ASSERT(m_operations != nullptr, "Cannot invoke an empty delegate.");
+                return m_operations->m_invoke(&m_storage, std::forward<TArgTypes>(in_args)...);
+            }
+            //------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not the delegate contains a callable.
+            //------------------------------------------------------------------
+            explicit operator bool() const
+            {
+                return (m_operations != nullptr);
+            }
+            //------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not the callable is stored inline. This will
+            /// be false if the delegate is empty.
+            //------------------------------------------------------------------
+            bool IsStoredInline() const
+            {
+                return (m_operations != nullptr && m_operations->m_isInline == true);
+            }
+            //------------------------------------------------------------------
+            /// Destroys the contained callable.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------
+            ~Delegate()
+            {
+                Reset();
+            }
+            
+        private:
+            //------------------------------------------------------------------
+            /// The functions required to invoke, move and destroy a specific
+            /// type of callable held in the storage.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------
+            struct Operations
+            {
+                TReturnType (*m_invoke)(void*, TArgTypes&&...);
+                void (*m_move)(void*, void*);
+                void (*m_destroy)(void*);
+                bool m_isInline;
+            };
+            //------------------------------------------------------------------
+            /// Operations for a callable constructed directly in the storage.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------
+            template <typename TCallable> struct InlineOperations
+            {
+                static TReturnType Invoke(void* in_storage, TArgTypes&&... in_args)
+                {
+                    return (*static_cast<TCallable*>(in_storage))(std::forward<TArgTypes>(in_args)...);
+                }
+                static void Move(void* in_source, void* out_destination)
+                {
+                    TCallable* source = static_cast<TCallable*>(in_source);
+                    new (out_destination) TCallable(std::move(*source));
+                    source->~TCallable();
+                }
+                static void Destroy(void* in_storage)
+                {
+                    static_cast<TCallable*>(in_storage)->~TCallable();
+                }
+                static const Operations k_operations;
+            };
+            //------------------------------------------------------------------
+            /// Operations for a callable allocated on the heap, a pointer to
+            /// which is held in the storage.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------
+            template <typename TCallable> struct HeapOperations
+            {
+                static TReturnType Invoke(void* in_storage, TArgTypes&&... in_args)
+                {
+                    return (**static_cast<TCallable**>(in_storage))(std::forward<TArgTypes>(in_args)...);
+                }
+                static void Move(void* in_source, void* out_destination)
+                {
+                    *static_cast<TCallable**>(out_destination) = *static_cast<TCallable**>(in_source);
+                }
+                static void Destroy(void* in_storage)
+                {
+                    delete *static_cast<TCallable**>(in_storage);
+                }
+                static const Operations k_operations;
+            };
+            //------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The callable.
+            ///
+            /// @return Whether or not the callable is null.
+            //------------------------------------------------------------------
+            template <typename TCallable> static bool IsNull(const TCallable& in_callable)
+            {
+                return false;
+            }
+            template <typename TCallable> static bool IsNull(TCallable* in_callable)
+            {
+                return (in_callable == nullptr);
+            }
+            template <typename TSignature> static bool IsNull(const std::function<TSignature>& in_callable)
+            {
+                return (in_callable == nullptr);
+            }
+            //------------------------------------------------------------------
+            /// Stores the given callable, either inline or on the heap. The
+            /// delegate must be empty.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The callable.
+            //------------------------------------------------------------------
+            template <typename TCallable> void Assign(TCallable&& in_callable)
+            {
+                using CallableType = typename std::decay<TCallable>::type;
+                
+                if (IsNull(in_callable) == true)
+                {
+                    return;
+                }
+                
+                const bool canStoreInline = (sizeof(CallableType) <= TCapacity && alignof(CallableType) <= alignof(Storage) && std::is_nothrow_move_constructible<CallableType>::value == true);
+                Construct<CallableType>(std::forward<TCallable>(in_callable), std::integral_constant<bool, canStoreInline>());
+            }
+            //------------------------------------------------------------------
+            /// Constructs the callable inline.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The callable.
+            //------------------------------------------------------------------
+            template <typename TCallableType, typename TCallable> void Construct(TCallable&& in_callable, std::true_type)
+            {
+                new (&m_storage) TCallableType(std::forward<TCallable>(in_callable));
+                m_operations = &InlineOperations<TCallableType>::k_operations;
+            }
+            //------------------------------------------------------------------
+            /// Constructs the callable on the heap.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The callable.
+            //------------------------------------------------------------------
+            template <typename TCallableType, typename TCallable> void Construct(TCallable&& in_callable, std::false_type)
+            {
+                *reinterpret_cast<TCallableType**>(&m_storage) = new TCallableType(std::forward<TCallable>(in_callable));
+                m_operations = &HeapOperations<TCallableType>::k_operations;
+                RecordHeapAllocation();
+            }
+            //------------------------------------------------------------------
+            /// Moves the callable from the given delegate into this, leaving
+            /// the other empty. This must be empty.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The delegate to move from.
+            //------------------------------------------------------------------
+            void MoveFrom(Delegate& in_toMove)
+            {
+                if (in_toMove.m_operations != nullptr)
+                {
+                    in_toMove.m_operations->m_move(&in_toMove.m_storage, &m_storage);
+                    m_operations = in_toMove.m_operations;
+                    in_toMove.m_operations = nullptr;
+                }
+            }
+            //------------------------------------------------------------------
+            /// Destroys the contained callable, if there is one.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------
+            void Reset()
+            {
+                if (m_operations != nullptr)
+                {
+                    m_operations->m_destroy(&m_storage);
+                    m_operations = nullptr;
+                }
+            }
+            
+            static_assert(TCapacity >= sizeof(void*), "The inline capacity of a delegate must be large enough to hold a pointer.");
+            
+            using Storage = typename std::aligned_storage<TCapacity, alignof(std::max_align_t)>::type;
+            
+            mutable Storage m_storage;
+            const Operations* m_operations = nullptr;
+        };
+        
+        template <typename TReturnType, typename... TArgTypes, std::size_t TCapacity> template <typename TCallable>
+        const typename Delegate<TReturnType(TArgTypes...), TCapacity>::Operations Delegate<TReturnType(TArgTypes...), TCapacity>::InlineOperations<TCallable>::k_operations =
+        {
+            &InlineOperations<TCallable>::Invoke, &InlineOperations<TCallable>::Move, &InlineOperations<TCallable>::Destroy, true
+        };
+        
+        template <typename TReturnType, typename... TArgTypes, std::size_t TCapacity> template <typename TCallable>
+        const typename Delegate<TReturnType(TArgTypes...), TCapacity>::Operations Delegate<TReturnType(TArgTypes...), TCapacity>::HeapOperations<TCallable>::k_operations =
+        {
+            &HeapOperations<TCallable>::Invoke, &HeapOperations<TCallable>::Move, &HeapOperations<TCallable>::Destroy, false
+        };
+        //------------------------------------------------------------------
+        /// @author Ian Copland
+        ///
+        /// @param The delegate.
+        ///
+        /// @return Whether or not the delegate is empty.
+        //------------------------------------------------------------------
+        template <typename TSignature, std::size_t TCapacity> bool operator==(const Delegate<TSignature, TCapacity>& in_delegate, std::nullptr_t)
+        {
+            return !in_delegate;
+        }
+        //------------------------------------------------------------------
+        /// @author Ian Copland
+        ///
+        /// @param The delegate.
+        ///
+        /// @return Whether or not the delegate is not empty.
+        //------------------------------------------------------------------
+        template <typename TSignature, std::size_t TCapacity> bool operator!=(const Delegate<TSignature, TCapacity>& in_delegate, std::nullptr_t)
+        {
+            return static_cast<bool>(in_delegate);
+        }
+        //------------------------------------------------------------------
+        /// A move-only task which takes no arguments, as used by the task
+        /// scheduler.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------
+        using Task = Delegate<void()>;
+	}
+}
+
+#endif
@@ -32,6 +32,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Entity/Component.h>
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Entity/EntityHandle.h>
 #include <ChilliSource/Core/Entity/Transform.h>
 
 #endif
\ No newline at end of file
@@ -28,6 +28,7 @@
 
 #include <ChilliSource/Core/Entity/Component.h>
 
+#include <ChilliSource/Core/Base/SmallObjectAllocator.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 
 namespace ChilliSource
@@ -41,6 +42,18 @@ namespace ChilliSource
 		{
 			
 		}
+        //----------------------------------------------------
+        //----------------------------------------------------
+        void* Component::operator new(std::size_t in_size)
+        {
+            return SmallObjectAllocator::Allocate(in_size);
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        void Component::operator delete(void* in_memory, std::size_t in_size)
+        {
+            SmallObjectAllocator::Deallocate(in_memory, in_size);
+        }
 		//----------------------------------------------------
 		//----------------------------------------------------
 		Entity * Component::GetEntity()
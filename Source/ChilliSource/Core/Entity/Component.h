@@ -36,6 +36,20 @@ namespace ChilliSource
 {
 	namespace Core
 	{
+        //----------------------------------------------------
+        /// The base class for all components which can be
+        /// attached to an entity.
+        ///
+        /// While the owning entity is in a scene, components
+        /// which require an update or fixed update are held in
+        /// per-type lists by the scene and updated in batches of
+        /// the same type. Components which don't need either
+        /// should override RequiresUpdate() and
+        /// RequiresFixedUpdate() to return false, so that the
+        /// scene doesn't call the empty methods every frame.
+        ///
+        /// @author Ian Copland
+        //----------------------------------------------------
 		class Component : public QueryableInterface
 		{
 		public:
@@ -52,6 +66,32 @@ namespace ChilliSource
             /// @author S McGaw
             //----------------------------------------------------
 			virtual ~Component(){}
+            //----------------------------------------------------
+            /// Components are allocated from the small object
+            /// allocator rather than the heap. This applies to
+            /// all derived types, including those outside the
+            /// engine. To also pool the shared pointer control
+            /// block, create components with AllocateSharedPooled()
+            /// or convert a unique pointer with MakeSharedPooled().
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The size of the component in bytes.
+            ///
+            /// @return The memory for the component.
+            //----------------------------------------------------
+            static void* operator new(std::size_t in_size);
+            //----------------------------------------------------
+            /// Returns the memory for a component to the small
+            /// object allocator. As the destructor is virtual,
+            /// the size is that of the most derived type.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The memory.
+            /// @param The size of the component in bytes.
+            //----------------------------------------------------
+            static void operator delete(void* in_memory, std::size_t in_size);
 			//----------------------------------------------------
 			/// @author S Downie
 			///
@@ -72,6 +112,32 @@ namespace ChilliSource
             /// @author S Downie
             //----------------------------------------------------
             void RemoveFromEntity();
+            //----------------------------------------------------
+            /// Whether or not OnUpdate() should be called on this
+            /// component. This is queried when the component is
+            /// added to the scene and must return the same value
+            /// for every instance of a type. A non-final component
+            /// which returns false should only do so for its exact
+            /// type, so that subclasses which override OnUpdate()
+            /// are still updated.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not the component requires an
+            /// update. Defaults to true.
+            //----------------------------------------------------
+            virtual bool RequiresUpdate() const { return true; }
+            //----------------------------------------------------
+            /// Whether or not OnFixedUpdate() should be called on
+            /// this component. This has the same restrictions as
+            /// RequiresUpdate().
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not the component requires a
+            /// fixed update. Defaults to true.
+            //----------------------------------------------------
+            virtual bool RequiresFixedUpdate() const { return true; }
 			
 		protected:
 		
@@ -170,6 +236,19 @@ namespace ChilliSource
         private:
             
             friend class Entity;
+            friend class Scene;
+            //----------------------------------------------------
+            /// The position of the component in one of the
+            /// scene's update lists.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------
+            struct UpdateListLocation final
+            {
+                u32 m_listIndex = 0;
+                u32 m_index = 0;
+                bool m_isInList = false;
+            };
             //----------------------------------------------------
 			/// @author S Downie
             ///
@@ -180,6 +259,8 @@ namespace ChilliSource
 		private:
             
 			Entity * m_entity;
+            UpdateListLocation m_updateLocation;
+            UpdateListLocation m_fixedUpdateLocation;
 		};
 	}
 }
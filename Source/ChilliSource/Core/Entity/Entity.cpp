@@ -27,10 +27,12 @@
 //
 
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Base/SmallObjectAllocator.h>
 #include <ChilliSource/Core/Scene/Scene.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 
 #include <algorithm>
+#include <limits>
 
 namespace ChilliSource
 {
@@ -48,6 +50,18 @@ namespace ChilliSource
 		{
 			return EntityUPtr(new Entity());
 		}
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        void* Entity::operator new(std::size_t in_size)
+        {
+            return SmallObjectAllocator::Allocate(in_size);
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        void Entity::operator delete(void* in_memory, std::size_t in_size)
+        {
+            SmallObjectAllocator::Deallocate(in_memory, in_size);
+        }
 		//-------------------------------------------------------------
 		//-------------------------------------------------------------
 		void Entity::AddEntity(const EntitySPtr& in_child)
@@ -215,6 +229,8 @@ namespace ChilliSource
             if(GetScene() != nullptr)
             {
                 in_component->OnAddedToScene();
+                m_scene->AddComponentToUpdateLists(in_component.get());
+                
                 if (m_appActive == true)
                 {
                     in_component->OnResume();
@@ -246,6 +262,7 @@ namespace ChilliSource
                             }
                             in_component->OnSuspend();
                         }
+                        m_scene->RemoveComponentFromUpdateLists(in_component);
                         in_component->OnRemovedFromScene();
                     }
                     
@@ -276,6 +293,7 @@ namespace ChilliSource
                         }
                         component->OnSuspend();
                     }
+                    m_scene->RemoveComponentFromUpdateLists(component);
                     component->OnRemovedFromScene();
                 }
                 
@@ -377,15 +395,6 @@ namespace ChilliSource
         {
             return m_transform;
         }
-        //----------------------------------------------------
-        //----------------------------------------------------
-        void Entity::OnUpdate(f32 in_timeSinceLastUpdate)
-        {
-            for(u32 i=0; i<m_components.size(); ++i)
-			{
-                m_components[i]->OnUpdate(in_timeSinceLastUpdate);
-			}
-        }
         //-------------------------------------------------------------
 		//-------------------------------------------------------------
 		void Entity::OnAddedToScene()
@@ -393,6 +402,7 @@ namespace ChilliSource
             for (u32 i = 0; i < m_components.size(); ++i)
             {
                 m_components[i]->OnAddedToScene();
+                m_scene->AddComponentToUpdateLists(m_components[i].get());
             }
             
             for (u32 i = 0; i < m_children.size(); ++i)
@@ -435,18 +445,10 @@ namespace ChilliSource
             
             for (auto it = m_components.rbegin(); it != m_components.rend(); ++it)
             {
+                m_scene->RemoveComponentFromUpdateLists(it->get());
                 (*it)->OnRemovedFromScene();
             }
 		}
-        //----------------------------------------------------
-        //----------------------------------------------------
-        void Entity::OnFixedUpdate(f32 in_fixedTimeSinceLastUpdate)
-        {
-            for(u32 i=0; i<m_components.size(); ++i)
-			{
-                m_components[i]->OnFixedUpdate(in_fixedTimeSinceLastUpdate);
-			}
-        }
         //-------------------------------------------------------------
         //-------------------------------------------------------------
         void Entity::OnBackground()
@@ -68,6 +68,27 @@ namespace ChilliSource
             /// @return Entity
             //------------------------------------------------------------------
             static EntityUPtr Create();
+            //------------------------------------------------------------------
+            /// Entities are allocated from the small object allocator rather
+            /// than the heap. To also pool the shared pointer control block,
+            /// convert the result of Create() with MakeSharedPooled().
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The size of the entity in bytes.
+            ///
+            /// @return The memory for the entity.
+            //------------------------------------------------------------------
+            static void* operator new(std::size_t in_size);
+            //------------------------------------------------------------------
+            /// Returns the memory for an entity to the small object allocator.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The memory.
+            /// @param The size of the entity in bytes.
+            //------------------------------------------------------------------
+            static void operator delete(void* in_memory, std::size_t in_size);
             
             //----------------------------------------------------------------
             /// Destructor
@@ -425,20 +446,6 @@ namespace ChilliSource
             /// @author Ian Copland
 			//-------------------------------------------------------------
 			void OnForeground();
-            //-------------------------------------------------------------
-            /// @author S Downie
-            ///
-            /// @param Time since last update in seconds
-            //-------------------------------------------------------------
-            void OnUpdate(f32 in_timeSinceLastUpdate);
-            //-------------------------------------------------------------
-            /// Fixed update is triggered at fixed time periods
-            ///
-            /// @author S Downie
-            ///
-            /// @param Time since last fixed update in seconds
-            //-------------------------------------------------------------
-            void OnFixedUpdate(f32 in_fixedTimeSinceLastUpdate);
             //-------------------------------------------------------------
 			/// Called when the application is backgrounded while the entity
             /// is in the scene. This will also be called when the entity is
@@ -474,6 +481,7 @@ namespace ChilliSource
 			
 			Entity* m_parent = nullptr;
 			Scene* m_scene = nullptr;
+            u32 m_sceneSlotIndex = 0;
             
             bool m_appActive = false;
             bool m_appForegrounded = false;
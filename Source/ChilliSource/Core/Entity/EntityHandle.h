@@ -0,0 +1,91 @@
+//
+//  EntityHandle.h
+//  Chilli Source
+//  Created by Ian Copland on 16/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_ENTITY_ENTITYHANDLE_H_
+#define _CHILLISOURCE_CORE_ENTITY_ENTITYHANDLE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// A weak reference to an entity in a scene. The handle refers to a slot in
+        /// the scene along with the generation of that slot when the handle was
+        /// created. When the entity is removed the generation of the slot changes,
+        /// so a stale handle can be detected safely even after the slot has been
+        /// reused. Handles are resolved using Scene::GetEntity().
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        struct EntityHandle final
+        {
+            static const u32 k_invalidIndex = 0xffffffff;
+
+            u32 m_index = k_invalidIndex;
+            u32 m_generation = 0;
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not the handle was ever assigned to an entity. This
+            /// does not mean the entity is still in the scene.
+            //------------------------------------------------------------------------------
+            bool IsNull() const
+            {
+                return (m_index == k_invalidIndex);
+            }
+        };
+        //------------------------------------------------------------------------------
+        /// @author Ian Copland
+        ///
+        /// @param The first handle.
+        /// @param The second handle.
+        ///
+        /// @return Whether or not the handles refer to the same entity.
+        //------------------------------------------------------------------------------
+        inline bool operator==(const EntityHandle& in_a, const EntityHandle& in_b)
+        {
+            return (in_a.m_index == in_b.m_index && in_a.m_generation == in_b.m_generation);
+        }
+        //------------------------------------------------------------------------------
+        /// @author Ian Copland
+        ///
+        /// @param The first handle.
+        /// @param The second handle.
+        ///
+        /// @return Whether or not the handles refer to different entities.
+        //------------------------------------------------------------------------------
+        inline bool operator!=(const EntityHandle& in_a, const EntityHandle& in_b)
+        {
+            return !(in_a == in_b);
+        }
+    }
+}
+
+#endif
@@ -30,9 +30,12 @@
 #define _CHILLISOURCE_CORE_EVENT_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Event/DeferredEvent.h>
+#include <ChilliSource/Core/Event/DeferredEventQueue.h>
 #include <ChilliSource/Core/Event/Event.h>
 #include <ChilliSource/Core/Event/EventConnection.h>
 #include <ChilliSource/Core/Event/IConnectableEvent.h>
+#include <ChilliSource/Core/Event/IDeferredEvent.h>
 #include <ChilliSource/Core/Event/IDisconnectableEvent.h>
 
 #endif
\ No newline at end of file
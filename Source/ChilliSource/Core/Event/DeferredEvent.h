@@ -0,0 +1,208 @@
+//
+//  DeferredEvent.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_EVENT_DEFERREDEVENT_H_
+#define _CHILLISOURCE_CORE_EVENT_DEFERREDEVENT_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/ForwardDeclarations.h>
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Delegate/Delegate.h>
+#include <ChilliSource/Core/Event/DeferredEventQueue.h>
+#include <ChilliSource/Core/Event/Event.h>
+#include <ChilliSource/Core/Event/IConnectableEvent.h>
+#include <ChilliSource/Core/Event/IDeferredEvent.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+#include <functional>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //-----------------------------------------------------------------
+        /// A DeferredEvent is an event which doesn't notify its connections
+        /// immediately. Instead the notification is queued and dispatched
+        /// when the DeferredEventQueue is next flushed, which happens once
+        /// per frame at the end of the application update. Any further
+        /// notifications before then are coalesced so that each connection
+        /// is notified only once, with the arguments of the latest
+        /// notification.
+        ///
+        /// This is suited to high-frequency events whose connections only
+        /// need the latest state, and which don't need it straight away.
+        /// Since the arguments are copied and delivered later, pointers
+        /// passed as arguments must remain valid until the flush. Like
+        /// Event, this exposes the IConnectableEvent interface so the
+        /// choice of dispatch is transparent to the connections.
+        ///
+        /// Deferred events can only be notified on the main thread.
+        ///
+        /// @author Ian Copland
+        //-----------------------------------------------------------------
+        template <typename TDelegateType> class DeferredEvent;
+        
+        template <typename... TArgTypes> class DeferredEvent<std::function<void(TArgTypes...)>> final : public IConnectableEvent<std::function<void(TArgTypes...)>>, public IDeferredEvent
+        {
+        public:
+            
+            using DelegateType = std::function<void(TArgTypes...)>;
+            using StoredDelegateType = typename IConnectableEvent<DelegateType>::StoredDelegateType;
+            
+            //-------------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------------
+            DeferredEvent(){}
+            //-------------------------------------------------------------
+            /// Deferred events are neither copyable nor movable as the
+            /// queue holds a pointer to them.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------------
+            DeferredEvent(const DeferredEvent&) = delete;
+            DeferredEvent& operator= (const DeferredEvent&) = delete;
+            DeferredEvent(DeferredEvent&&) = delete;
+            DeferredEvent& operator= (DeferredEvent&&) = delete;
+            //-------------------------------------------------------------
+            /// Opens a new connection to the event. While this connection
+            /// remains in scope the delegate will be notified of events
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Delegate to notify
+            ///
+            /// @return Scoped connection
+            //-------------------------------------------------------------
+            EventConnectionUPtr OpenStoredConnection(StoredDelegateType in_delegate) override
+            {
+                return m_event.OpenConnection(std::move(in_delegate));
+            }
+            //-------------------------------------------------------------
+            /// Queues a notification of the connections, replacing any
+            /// notification that is already pending. This must be called
+            /// on the main thread.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Arguments to pass to the connection delegates
+            //-------------------------------------------------------------
+            void NotifyConnections(TArgTypes... in_args)
+            {
+                CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Deferred events can only be notified on the main thread.");
+                
+                m_pendingNotification = [this, in_args...]()
+                {
+                    m_event.NotifyConnections(in_args...);
+                };
+                
+                if (m_isQueued == false)
+                {
+                    m_isQueued = true;
+                    DeferredEventQueue::Add(this);
+                }
+            }
+            //-------------------------------------------------------------
+            /// Immediately notifies the connections of the pending
+            /// notification, if there is one, rather than waiting for
+            /// the queue to be flushed.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------------
+            void DispatchImmediately()
+            {
+                if (m_isQueued == true)
+                {
+                    DeferredEventQueue::Remove(this);
+                    Dispatch();
+                }
+            }
+            //-------------------------------------------------------------
+            /// Closes all the currently open connections and discards any
+            /// pending notification.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------------
+            void CloseAllConnections()
+            {
+                Discard();
+                m_event.CloseAllConnections();
+            }
+            //-------------------------------------------------------------
+            /// Destructor discards any pending notification and closes all
+            /// open connections.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------------
+            ~DeferredEvent()
+            {
+                Discard();
+            }
+            
+        private:
+            //-------------------------------------------------------------
+            /// Called by the queue, which has already removed this, when
+            /// it is flushed. Notifies the connections of the pending
+            /// notification.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------------
+            void Dispatch() override
+            {
+                m_isQueued = false;
+                
+                //the notification is moved out first as the connections may notify this event again.
+                Task notification = std::move(m_pendingNotification);
+                notification();
+            }
+            //-------------------------------------------------------------
+            /// Discards the pending notification, removing this from the
+            /// queue.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------------
+            void Discard()
+            {
+                if (m_isQueued == true)
+                {
+                    m_isQueued = false;
+                    DeferredEventQueue::Remove(this);
+                    m_pendingNotification = nullptr;
+                }
+            }
+            
+            Event<DelegateType> m_event;
+            Task m_pendingNotification;
+            bool m_isQueued = false;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,110 @@
+//
+//  DeferredEventQueue.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Event/DeferredEventQueue.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Event/IDeferredEvent.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace DeferredEventQueue
+        {
+            namespace
+            {
+                std::vector<IDeferredEvent*> g_queuedEvents;
+                bool g_isFlushing = false;
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            void Add(IDeferredEvent* in_event)
+            {
+                CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Deferred events can only be queued on the main thread.");
+                CS_ASSERT(in_event != nullptr, "Cannot queue a null event.");
+                
+                g_queuedEvents.push_back(in_event);
+            }
+            //---------------------------------------------------
+            /// Events removed during a flush are nulled rather
+            /// than erased so that the flush can continue to
+            /// iterate over the queue.
+            //---------------------------------------------------
+            void Remove(IDeferredEvent* in_event)
+            {
+                auto it = std::find(g_queuedEvents.begin(), g_queuedEvents.end(), in_event);
+                if (it != g_queuedEvents.end())
+                {
+                    if (g_isFlushing == true)
+                    {
+                        *it = nullptr;
+                    }
+                    else
+                    {
+                        g_queuedEvents.erase(it);
+                    }
+                }
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            void Flush()
+            {
+                CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "The deferred event queue can only be flushed on the main thread.");
+                CS_ASSERT(g_isFlushing == false, "Cannot flush the deferred event queue while it is already being flushed.");
+                
+                g_isFlushing = true;
+                
+                //the size is re-read each iteration as dispatching an event can queue further events.
+                for (std::size_t i = 0; i < g_queuedEvents.size(); ++i)
+                {
+                    IDeferredEvent* event = g_queuedEvents[i];
+                    if (event != nullptr)
+                    {
+                        g_queuedEvents[i] = nullptr;
+                        event->Dispatch();
+                    }
+                }
+                
+                g_queuedEvents.clear();
+                g_isFlushing = false;
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            u32 GetNumQueued()
+            {
+                return u32(std::count_if(g_queuedEvents.begin(), g_queuedEvents.end(), [](IDeferredEvent* in_event) { return in_event != nullptr; }));
+            }
+        }
+    }
+}
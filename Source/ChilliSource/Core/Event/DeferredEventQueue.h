@@ -0,0 +1,89 @@
+//
+//  DeferredEventQueue.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_EVENT_DEFERREDEVENTQUEUE_H_
+#define _CHILLISOURCE_CORE_EVENT_DEFERREDEVENTQUEUE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/ForwardDeclarations.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------
+        /// The queue of deferred events which have been notified
+        /// since the queue was last flushed. The application
+        /// flushes the queue at the end of each update, before
+        /// rendering. Events must only be queued, removed and
+        /// flushed on the main thread.
+        ///
+        /// @author Ian Copland
+        //---------------------------------------------------------
+        namespace DeferredEventQueue
+        {
+            //---------------------------------------------------
+            /// Adds an event to the queue. An event must not be
+            /// added more than once between flushes.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The event.
+            //---------------------------------------------------
+            void Add(IDeferredEvent* in_event);
+            //---------------------------------------------------
+            /// Removes an event from the queue without it being
+            /// dispatched. This must be called if a queued event
+            /// is destroyed.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The event.
+            //---------------------------------------------------
+            void Remove(IDeferredEvent* in_event);
+            //---------------------------------------------------
+            /// Dispatches all queued events in the order they
+            /// were first notified. Events which are notified
+            /// by the connections of another event are dispatched
+            /// by the same flush.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            void Flush();
+            //---------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The number of events awaiting dispatch.
+            //---------------------------------------------------
+            u32 GetNumQueued();
+        }
+    }
+}
+
+#endif
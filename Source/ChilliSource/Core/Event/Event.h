@@ -31,10 +31,12 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/ForwardDeclarations.h>
+#include <ChilliSource/Core/Delegate/Delegate.h>
 #include <ChilliSource/Core/Event/EventConnection.h>
 #include <ChilliSource/Core/Event/IConnectableEvent.h>
 #include <ChilliSource/Core/Event/IDisconnectableEvent.h>
 
+#include <deque>
 #include <vector>
 
 namespace ChilliSource
@@ -52,6 +54,9 @@ namespace ChilliSource
         template <typename TDelegateType> class Event final : public IConnectableEvent<TDelegateType>, public IDisconnectableEvent
         {
         public:
+            
+            using StoredDelegateType = typename IConnectableEvent<TDelegateType>::StoredDelegateType;
+
             //-------------------------------------------------------------
             /// Constructor
             ///
@@ -129,15 +134,15 @@ namespace ChilliSource
             ///
             /// @return Scoped connection
             //-------------------------------------------------------------
-            EventConnectionUPtr OpenConnection(const TDelegateType& in_delegate) override
+            EventConnectionUPtr OpenStoredConnection(StoredDelegateType in_delegate) override
             {
                 EventConnectionUPtr connection(new EventConnection());
                 connection->SetOwningEvent(this);
             
                 ConnectionDesc desc;
-                desc.m_delegate = in_delegate;
+                desc.m_delegate = std::move(in_delegate);
                 desc.m_connection = connection.get();
-                m_connections.push_back(desc);
+                m_connections.push_back(std::move(desc));
             
                 return connection;
             }
@@ -178,6 +183,9 @@ namespace ChilliSource
             //-------------------------------------------------------------
             template <typename... TArgTypes> void NotifyConnections(TArgTypes&&... in_args)
             {
+                //Closed connections are only removed by the outermost notify, as removal
+                //would move the delegates of any notify further up the stack.
+                bool wasNotifying = m_isNotifying;
                 m_isNotifying = true;
                 
                 //Take a snapshot of the number of delegates so any new ones added
@@ -191,9 +199,12 @@ namespace ChilliSource
                     }
                 }
                 
-                m_isNotifying = false;
+                m_isNotifying = wasNotifying;
                 
-                RemoveClosedConnections();
+                if (m_isNotifying == false)
+                {
+                    RemoveClosedConnections();
+                }
             }
             //-------------------------------------------------------------
             /// Closes all the currently open connections
@@ -236,14 +247,16 @@ namespace ChilliSource
             }
     
         private:
-                                    
+            
             struct ConnectionDesc
             {
-                TDelegateType m_delegate;
+                StoredDelegateType m_delegate;
                 EventConnection* m_connection = nullptr;
             };
     
-            typedef std::vector<ConnectionDesc> ConnectionList;
+            //A deque is used as new connections can be opened while notifying, and
+            //unlike a vector this will not move the delegates that are being run.
+            typedef std::deque<ConnectionDesc> ConnectionList;
             ConnectionList m_connections;
         
             bool m_isNotifying = false;
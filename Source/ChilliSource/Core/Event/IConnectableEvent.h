@@ -30,12 +30,31 @@
 #define _CHILLISOURCE_CORE_EVENT_ICONNECTABLEEVENT_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Delegate/Delegate.h>
 #include <ChilliSource/Core/ForwardDeclarations.h>
 
+#include <functional>
+#include <utility>
+
 namespace ChilliSource
 {
     namespace Core
     {
+        //-----------------------------------------------------------------
+        /// Maps the delegate type of an event to the move-only, inline
+        /// delegate used to store each connection. Delegate types that
+        /// are not std::functions are stored as they are.
+        ///
+        /// @author Ian Copland
+        //-----------------------------------------------------------------
+        template <typename TFunction> struct EventStoredDelegate
+        {
+            using Type = TFunction;
+        };
+        template <typename TSignature> struct EventStoredDelegate<std::function<TSignature>>
+        {
+            using Type = Delegate<TSignature>;
+        };
         //-----------------------------------------------------------------
         /// An IConnectableEvent represents an object which can have multiple listeners
         /// (connections) with the given DelegateType. The subclass Event is what
@@ -49,6 +68,8 @@ namespace ChilliSource
         {
         public:
             
+            using StoredDelegateType = typename EventStoredDelegate<TDelegateType>::Type;
+            
             //-------------------------------------------------------------
             /// Constructor
             ///
@@ -66,7 +87,10 @@ namespace ChilliSource
             
             //-------------------------------------------------------------
             /// Opens a new connection to the event. While this connection
-            /// remains in scope the delegate will be notified of events
+            /// remains in scope the delegate will be notified of events.
+            /// Any callable matching the delegate type is accepted and
+            /// stored directly in the event, so lambdas are not first
+            /// wrapped in a std::function.
             ///
             /// @author S Downie
             ///
@@ -74,13 +98,29 @@ namespace ChilliSource
             ///
             /// @return Scoped connection
             //-------------------------------------------------------------
-            virtual EventConnectionUPtr OpenConnection(const TDelegateType& in_delegate) = 0;
+            template <typename TCallable> EventConnectionUPtr OpenConnection(TCallable&& in_delegate)
+            {
+                return OpenStoredConnection(StoredDelegateType(std::forward<TCallable>(in_delegate)));
+            }
 			//-------------------------------------------------------------
 			/// Virtual destructor
 			///
 			/// @author Ian Copland
 			//-------------------------------------------------------------
 			virtual ~IConnectableEvent() {};
+            
+        protected:
+            //-------------------------------------------------------------
+            /// Opens a new connection to the event with a delegate that
+            /// has already been converted to the stored type.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Delegate to notify
+            ///
+            /// @return Scoped connection
+            //-------------------------------------------------------------
+            virtual EventConnectionUPtr OpenStoredConnection(StoredDelegateType in_delegate) = 0;
         };
     }
 }
@@ -0,0 +1,83 @@
+//
+//  IDeferredEvent.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_EVENT_IDEFERREDEVENT_H_
+#define _CHILLISOURCE_CORE_EVENT_IDEFERREDEVENT_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/ForwardDeclarations.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //-----------------------------------------------------------------
+        /// An interface for events which queue their notifications in the
+        /// DeferredEventQueue rather than notifying their connections
+        /// immediately.
+        ///
+        /// @author Ian Copland
+        //-----------------------------------------------------------------
+        class IDeferredEvent
+        {
+        public:
+            //-------------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------------
+            IDeferredEvent(){}
+            //-------------------------------------------------------------
+            /// No copying of events is allowed. If you wish to make a
+            /// shallow copy of an event then hold a pointer to it.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------------
+            IDeferredEvent(const IDeferredEvent&) = delete;
+            IDeferredEvent& operator= (const IDeferredEvent&) = delete;
+            
+            //-------------------------------------------------------------
+            /// Notifies the connections of the pending notification. This
+            /// is called by the DeferredEventQueue when it is flushed,
+            /// after the event has been removed from the queue.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------------
+            virtual void Dispatch() = 0;
+			//-------------------------------------------------------------
+			/// Virtual destructor
+			///
+			/// @author Ian Copland
+			//-------------------------------------------------------------
+			virtual ~IDeferredEvent() {};
+        };
+    }
+}
+
+#endif
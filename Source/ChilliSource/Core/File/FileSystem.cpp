@@ -44,9 +44,14 @@
 #include <CSBackend/Platform/Windows/Core/File/FileSystem.h>
 #endif
 
+#ifdef CS_TARGETPLATFORM_LINUX
+#include <CSBackend/Platform/Linux/Core/File/FileSystem.h>
+#endif
+
 #include <md5/md5.h>
 
 #include <algorithm>
+#include <limits>
 
 namespace ChilliSource
 {
@@ -70,6 +75,9 @@ namespace ChilliSource
 #endif
 #ifdef CS_TARGETPLATFORM_WINDOWS
             return FileSystemUPtr(new CSBackend::Windows::FileSystem());
+#endif
+#ifdef CS_TARGETPLATFORM_LINUX
+            return FileSystemUPtr(new CSBackend::Linux::FileSystem());
 #endif
             return nullptr;
         }
@@ -55,6 +55,7 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(ParamDictionary);
         CS_FORWARDDECLARE_CLASS(IProperty);
         CS_FORWARDDECLARE_CLASS(IPropertyType);
+        CS_FORWARDDECLARE_CLASS(PropertyKey);
         CS_FORWARDDECLARE_CLASS(PropertyMap);
         template <typename TKey, typename TValue> class HashedArray;
         template <typename TType> class ObjectPool;
@@ -64,6 +65,7 @@ namespace ChilliSource
         template <typename TType> class Property;
         template <typename TType> class PropertyType;
         template <typename TType> class random_access_iterator;
+        template <typename TType> class spsc_ring_buffer;
         template <typename TType> class ReferenceProperty;
         template <typename TType> class ValueProperty;
         //---------------------------------------------------------
@@ -80,12 +82,15 @@ namespace ChilliSource
         //---------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(Component);
         CS_FORWARDDECLARE_CLASS(Entity);
+        CS_FORWARDDECLARE_STRUCT(EntityHandle);
         CS_FORWARDDECLARE_CLASS(Transform);
         //---------------------------------------------------------
         /// Event
         //---------------------------------------------------------
         template <typename TDelegateType> class Event;
+        template <typename TDelegateType> class DeferredEvent;
         template <typename TDelegateType> class IConnectableEvent;
+        CS_FORWARDDECLARE_CLASS(IDeferredEvent);
         CS_FORWARDDECLARE_CLASS(IDisconnectableEvent);
         CS_FORWARDDECLARE_CLASS(EventConnection);
         //---------------------------------------------------------
@@ -193,6 +198,8 @@ namespace ChilliSource
         //---------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(AppSystem);
         CS_FORWARDDECLARE_CLASS(StateSystem);
+        CS_FORWARDDECLARE_STRUCT(SystemAccess);
+        CS_FORWARDDECLARE_CLASS(SystemUpdateGraph);
         CS_FORWARDDECLARE_CLASS(IComponentProducer);
         //---------------------------------------------------------
         /// Threading
@@ -204,6 +211,7 @@ namespace ChilliSource
         /// Time
         //---------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(CoreTimer);
+        CS_FORWARDDECLARE_CLASS(FixedStepController);
         CS_FORWARDDECLARE_CLASS(PerformanceTimer);
         CS_FORWARDDECLARE_CLASS(Timer);
         //---------------------------------------------------------
@@ -30,7 +30,9 @@
 #define _CHILLISOURCE_CORE_IMAGE_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Image/CSImageEncoder.h>
 #include <ChilliSource/Core/Image/CSImageProvider.h>
+#include <ChilliSource/Core/Image/CSImageWriter.h>
 #include <ChilliSource/Core/Image/ETC1ImageProvider.h>
 #include <ChilliSource/Core/Image/Image.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
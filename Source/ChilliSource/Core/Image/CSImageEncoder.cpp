@@ -0,0 +1,249 @@
+//
+//  CSImageEncoder.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Image/CSImageEncoder.h>
+
+#include <ChilliSource/Core/Base/LZ4.h>
+#include <ChilliSource/Core/Cryptographic/HashCRC32.h>
+
+#include <zlib.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace CSImageEncoder
+        {
+            namespace
+            {
+                const u32 k_byteOrderMark = 123456;
+                const u32 k_version = 4;
+                const u32 k_lz4BlockSize = 64 * 1024;
+
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The image format.
+                ///
+                /// @return The integer value used to describe the
+                /// format in a csimage file, or 0 if the format is
+                /// not supported.
+                //---------------------------------------------------
+                u32 GetFileFormatValue(ImageFormat in_format)
+                {
+                    switch (in_format)
+                    {
+                        case ImageFormat::k_Lum8:
+                            return 1;
+                        case ImageFormat::k_LumA88:
+                            return 2;
+                        case ImageFormat::k_RGB565:
+                            return 3;
+                        case ImageFormat::k_RGBA4444:
+                            return 4;
+                        case ImageFormat::k_RGB888:
+                            return 5;
+                        case ImageFormat::k_RGBA8888:
+                            return 6;
+                        default:
+                            return 0;
+                    }
+                }
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The compression type.
+                ///
+                /// @return The integer value used to describe the
+                /// compression type in a csimage file.
+                //---------------------------------------------------
+                u32 GetFileCompressionValue(Compression in_compression)
+                {
+                    switch (in_compression)
+                    {
+                        case Compression::k_zlib:
+                            return 1;
+                        case Compression::k_lz4:
+                            return 2;
+                        default:
+                            return 0;
+                    }
+                }
+                //---------------------------------------------------
+                /// Appends a little endian u32 to the output.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The value.
+                /// @param [Out] The output buffer.
+                //---------------------------------------------------
+                void AppendU32(u32 in_value, std::vector<u8>& out_data)
+                {
+                    const u8 bytes[4] = { u8(in_value), u8(in_value >> 8), u8(in_value >> 16), u8(in_value >> 24) };
+                    out_data.insert(out_data.end(), bytes, bytes + 4);
+                }
+                //---------------------------------------------------
+                /// Appends a little endian u64 to the output.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The value.
+                /// @param [Out] The output buffer.
+                //---------------------------------------------------
+                void AppendU64(u64 in_value, std::vector<u8>& out_data)
+                {
+                    AppendU32(u32(in_value), out_data);
+                    AppendU32(u32(in_value >> 32), out_data);
+                }
+                //---------------------------------------------------
+                /// Appends the given data to the output, compressed
+                /// as a series of independent LZ4 blocks, each
+                /// prefixed with its decompressed and compressed
+                /// size. This allows the data to be decompressed
+                /// one block at a time while streaming from disk.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The data to compress.
+                /// @param The size of the data.
+                /// @param [Out] The output buffer.
+                ///
+                /// @return Whether or not the data was compressed
+                /// successfully.
+                //---------------------------------------------------
+                bool CompressLZ4Blocks(const u8* in_data, u32 in_dataSize, std::vector<u8>& out_data)
+                {
+                    std::vector<u8> block(LZ4::CalcMaxCompressedSize(k_lz4BlockSize));
+                    for (u32 offset = 0; offset < in_dataSize; offset += k_lz4BlockSize)
+                    {
+                        const u32 blockDataSize = std::min(k_lz4BlockSize, in_dataSize - offset);
+                        const u32 blockCompressedSize = LZ4::Compress(in_data + offset, blockDataSize, block.data(), u32(block.size()));
+                        if (blockCompressedSize == 0)
+                        {
+                            return false;
+                        }
+
+                        AppendU32(blockDataSize, out_data);
+                        AppendU32(blockCompressedSize, out_data);
+                        out_data.insert(out_data.end(), block.data(), block.data() + blockCompressedSize);
+                    }
+
+                    return true;
+                }
+                //---------------------------------------------------
+                /// Compresses a single level.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The level.
+                /// @param The compression type.
+                /// @param [Out] The compressed data.
+                ///
+                /// @return Whether or not the level was compressed
+                /// successfully.
+                //---------------------------------------------------
+                bool CompressLevel(const Level& in_level, Compression in_compression, std::vector<u8>& out_data)
+                {
+                    switch (in_compression)
+                    {
+                        case Compression::k_zlib:
+                        {
+                            uLongf compressedSize = compressBound(in_level.m_dataSize);
+                            out_data.resize(compressedSize);
+                            if (compress2(out_data.data(), &compressedSize, in_level.m_data, in_level.m_dataSize, Z_BEST_COMPRESSION) != Z_OK)
+                            {
+                                return false;
+                            }
+                            out_data.resize(compressedSize);
+                            return true;
+                        }
+                        case Compression::k_lz4:
+                            return CompressLZ4Blocks(in_level.m_data, in_level.m_dataSize, out_data);
+                        default:
+                            out_data.assign(in_level.m_data, in_level.m_data + in_level.m_dataSize);
+                            return true;
+                    }
+                }
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            bool IsFormatSupported(ImageFormat in_format)
+            {
+                return (GetFileFormatValue(in_format) != 0);
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            bool Encode(const std::vector<Level>& in_levels, ImageFormat in_format, Compression in_compression, std::vector<u8>& out_fileData)
+            {
+                const u32 formatValue = GetFileFormatValue(in_format);
+                if (in_levels.empty() == true || formatValue == 0)
+                {
+                    return false;
+                }
+
+                std::vector<std::vector<u8>> compressedLevels(in_levels.size());
+                for (u32 i = 0; i < in_levels.size(); ++i)
+                {
+                    if (CompressLevel(in_levels[i], in_compression, compressedLevels[i]) == false)
+                    {
+                        return false;
+                    }
+                }
+
+                out_fileData.clear();
+                AppendU32(k_byteOrderMark, out_fileData);
+                AppendU32(k_version, out_fileData);
+                AppendU32(in_levels[0].m_width, out_fileData);
+                AppendU32(in_levels[0].m_height, out_fileData);
+                AppendU32(formatValue, out_fileData);
+                AppendU32(GetFileCompressionValue(in_compression), out_fileData);
+                AppendU32(u32(in_levels.size()), out_fileData);
+
+                for (u32 i = 0; i < in_levels.size(); ++i)
+                {
+                    const Level& level = in_levels[i];
+                    AppendU32(level.m_width, out_fileData);
+                    AppendU32(level.m_height, out_fileData);
+                    AppendU64(HashCRC32::GenerateHashCode((const s8*)level.m_data, level.m_dataSize), out_fileData);
+                    AppendU32(level.m_dataSize, out_fileData);
+                    AppendU32(u32(compressedLevels[i].size()), out_fileData);
+                }
+
+                //level data is stored smallest first so that it can be streamed in that order.
+                for (auto it = compressedLevels.rbegin(); it != compressedLevels.rend(); ++it)
+                {
+                    out_fileData.insert(out_fileData.end(), it->begin(), it->end());
+                }
+
+                return true;
+            }
+        }
+    }
+}
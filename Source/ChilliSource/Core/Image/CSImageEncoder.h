@@ -0,0 +1,111 @@
+//
+//  CSImageEncoder.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_IMAGE_CSIMAGEENCODER_H_
+#define _CHILLISOURCE_CORE_IMAGE_CSIMAGEENCODER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Image/ImageFormat.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------
+        /// A collection of methods for encoding image data in
+        /// version 4 of the .csimage format. This only handles the
+        /// layout of the file and the compression of each level;
+        /// the image data must already be in the output format.
+        ///
+        /// The encoder doesn't rely on the application, the file
+        /// system or logging, so that it can be built into the
+        /// tools which write csimage files as well as the engine.
+        ///
+        /// @author Ian Copland
+        //---------------------------------------------------------
+        namespace CSImageEncoder
+        {
+            //---------------------------------------------------
+            /// The compression used for the image data in a
+            /// .csimage file. LZ4 files are larger than zlib files
+            /// but decompress several times faster.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            enum class Compression
+            {
+                k_none,
+                k_zlib,
+                k_lz4
+            };
+            //---------------------------------------------------
+            /// A single level of the image, already converted to
+            /// the output format. The data is not owned by the
+            /// level.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            struct Level final
+            {
+                u32 m_width = 0;
+                u32 m_height = 0;
+                const u8* m_data = nullptr;
+                u32 m_dataSize = 0;
+            };
+            //---------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The image format.
+            ///
+            /// @return Whether or not the format can be stored in
+            /// a .csimage file. Depth formats are not supported.
+            //---------------------------------------------------
+            bool IsFormatSupported(ImageFormat in_format);
+            //---------------------------------------------------
+            /// Encodes the given levels as the contents of a
+            /// .csimage file, compressing each level as requested.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The levels, base level first.
+            /// @param The format the levels are in.
+            /// @param The compression type.
+            /// @param [Out] The contents of the file.
+            ///
+            /// @return Whether or not the image was encoded
+            /// successfully. This will fail if there are no levels,
+            /// the format isn't supported or compression fails.
+            //---------------------------------------------------
+            bool Encode(const std::vector<Level>& in_levels, ImageFormat in_format, Compression in_compression, std::vector<u8>& out_fileData);
+        }
+    }
+}
+
+#endif
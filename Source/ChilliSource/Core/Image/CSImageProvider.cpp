@@ -29,14 +29,19 @@
 #include <ChilliSource/Core/Image/CSImageProvider.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Base/LZ4.h>
 #include <ChilliSource/Core/Cryptographic/HashCRC32.h>
 #include <ChilliSource/Core/Image/Image.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
+#include <ChilliSource/Core/Image/ImageFormatConverter.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
 #include <minizip/unzip.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace ChilliSource
 {
     namespace Core
@@ -45,6 +50,11 @@ namespace ChilliSource
         {
             const std::string k_csImageExtension("csimage");
             
+            const u32 k_compressionNone = 0;
+            const u32 k_compressionZlib = 1;
+            const u32 k_compressionLZ4 = 2;
+            const u32 k_streamBlockSize = 16 * 1024;
+            
             //------------------------------------------------------
             /// A container for the imformation provided in the
             /// csimage header version 2.
@@ -75,6 +85,36 @@ namespace ChilliSource
                 u32 m_originalDataSize;
                 u32 m_compressedDataSize;
             };
+            //------------------------------------------------------
+            /// A container for the imformation provided in the
+            /// csimage header version 4. The header is followed by
+            /// a table of level headers, base level first, and
+            /// then the data for each level, smallest level first.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------
+            struct ImageHeaderVersion4
+            {
+                u32 m_width;
+                u32 m_height;
+                u32 m_imageFormat;
+                u32 m_compression;
+                u32 m_numMipLevels;
+            };
+            //------------------------------------------------------
+            /// A container for the information on a single mip
+            /// level in a version 4 csimage file.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------
+            struct ImageLevelHeaderVersion4
+            {
+                u32 m_width;
+                u32 m_height;
+                u64 m_checksum;
+                u32 m_originalDataSize;
+                u32 m_compressedDataSize;
+            };
             //-------------------------------------------------------
             /// @author S Downie
             ///
@@ -121,6 +161,115 @@ namespace ChilliSource
                 return false;
             }
             //-------------------------------------------------------
+            /// Inflates zlib compressed data directly from the given
+            /// stream into the output buffer. The compressed data is
+            /// read in fixed size blocks so that it never needs to
+            /// be held in memory all at once.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The stream, positioned at the compressed data.
+            /// @param The size of the compressed data.
+            /// @param [Out] The output buffer.
+            /// @param The expected size of the inflated data.
+            ///
+            /// @return Whether or not the data was inflated
+            /// successfully.
+            //-------------------------------------------------------
+            bool InflateFromStream(const FileStreamSPtr& in_stream, u32 in_compressedDataSize, u8* out_data, u32 in_dataSize)
+            {
+                u8 block[k_streamBlockSize];
+                
+                z_stream infstream;
+                infstream.zalloc = Z_NULL;
+                infstream.zfree = Z_NULL;
+                infstream.opaque = Z_NULL;
+                infstream.avail_in = 0;
+                infstream.next_in = Z_NULL;
+                infstream.avail_out = in_dataSize;
+                infstream.next_out = (Bytef*)out_data;
+                
+                if (inflateInit(&infstream) != Z_OK)
+                {
+                    return false;
+                }
+                
+                s32 result = Z_OK;
+                u32 remaining = in_compressedDataSize;
+                while (result == Z_OK && remaining > 0)
+                {
+                    const u32 blockSize = std::min(remaining, k_streamBlockSize);
+                    in_stream->Read((s8*)block, blockSize);
+                    if (in_stream->IsBad() == true)
+                    {
+                        break;
+                    }
+                    remaining -= blockSize;
+                    
+                    infstream.avail_in = blockSize;
+                    infstream.next_in = (Bytef*)block;
+                    result = inflate(&infstream, (remaining == 0) ? Z_FINISH : Z_NO_FLUSH);
+                }
+                
+                inflateEnd(&infstream);
+                
+                return (result == Z_STREAM_END && infstream.avail_out == 0);
+            }
+            //-------------------------------------------------------
+            /// Decompresses LZ4 compressed data directly from the
+            /// given stream into the output buffer. The data is
+            /// stored as a series of independent blocks, each
+            /// prefixed by its decompressed and compressed size, so
+            /// only a single block needs to be held in memory.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The stream, positioned at the compressed data.
+            /// @param The size of the compressed data, including the
+            /// block headers.
+            /// @param [Out] The output buffer.
+            /// @param The expected size of the decompressed data.
+            ///
+            /// @return Whether or not the data was decompressed
+            /// successfully.
+            //-------------------------------------------------------
+            bool DecompressLZ4FromStream(const FileStreamSPtr& in_stream, u32 in_compressedDataSize, u8* out_data, u32 in_dataSize)
+            {
+                std::vector<u8> block;
+                u32 remainingInput = in_compressedDataSize;
+                u32 outputOffset = 0;
+                
+                while (remainingInput > 0)
+                {
+                    u32 blockDataSize = 0;
+                    u32 blockCompressedSize = 0;
+                    if (remainingInput < 2 * sizeof(u32))
+                    {
+                        return false;
+                    }
+                    in_stream->Read((s8*)&blockDataSize, sizeof(u32));
+                    in_stream->Read((s8*)&blockCompressedSize, sizeof(u32));
+                    remainingInput -= 2 * sizeof(u32);
+                    
+                    if (in_stream->IsBad() == true || blockCompressedSize > remainingInput || blockDataSize > in_dataSize - outputOffset)
+                    {
+                        return false;
+                    }
+                    
+                    block.resize(std::max(u32(block.size()), blockCompressedSize));
+                    in_stream->Read((s8*)block.data(), blockCompressedSize);
+                    remainingInput -= blockCompressedSize;
+                    
+                    if (LZ4::Decompress(block.data(), blockCompressedSize, out_data + outputOffset, blockDataSize) == false)
+                    {
+                        return false;
+                    }
+                    outputOffset += blockDataSize;
+                }
+                
+                return (outputOffset == in_dataSize);
+            }
+            //-------------------------------------------------------
             /// Reads a version 3 formatted .csimage file
             ///
             /// @author S Downie
@@ -148,27 +297,15 @@ namespace ChilliSource
                 u8* pubyBitmapData = nullptr;
                 if(sHeader.m_compression != 0)
                 {
-                    // Allocated memory needed for the compressed image data
-                    u8* pubyCompressedData = (u8*)malloc(sHeader.m_compressedDataSize);
-                    in_stream->Read((s8*)pubyCompressedData, sHeader.m_compressedDataSize);
-                    in_stream->Close();
-                    
                     // Allocated memory need for for the bitmap context
                     pubyBitmapData = new u8[sHeader.m_originalDataSize];
                     
                     // Inflate data (I like to think this is the machine equvilent to eating lots of pizza!)
-                    z_stream infstream;
-                    infstream.zalloc = Z_NULL;
-                    infstream.zfree = Z_NULL;
-                    infstream.opaque = Z_NULL;
-                    infstream.avail_in = sHeader.m_compressedDataSize;		// size of input
-                    infstream.next_in = (Bytef*)pubyCompressedData;			// input data
-                    infstream.avail_out = sHeader.m_originalDataSize;		// size of output
-                    infstream.next_out = (Bytef*)pubyBitmapData;			// output char array
-                    
-                    inflateInit(&infstream);
-                    inflate(&infstream, Z_FINISH);
-                    inflateEnd(&infstream);
+                    if(InflateFromStream(in_stream, sHeader.m_compressedDataSize, pubyBitmapData, sHeader.m_originalDataSize) == false)
+                    {
+                        CS_LOG_ERROR("Failed to inflate CSImage.");
+                    }
+                    in_stream->Close();
                     
                     // Checksum test
                     u32 udwInflatedChecksum = HashCRC32::GenerateHashCode((const s8*)pubyBitmapData, sHeader.m_originalDataSize);
@@ -176,8 +313,6 @@ namespace ChilliSource
                     {
                         CS_LOG_ERROR("CSImage checksum of "+ToString(udwInflatedChecksum)+" does not match expected checksum "+ToString(sHeader.m_checksum));
                     }
-                    
-                    free(pubyCompressedData);
                 }
                 else
                 {
@@ -199,6 +334,135 @@ namespace ChilliSource
                 Image* outpImage = (Image*)out_resource.get();
                 outpImage->Build(desc, std::move(imageData));
             }
+            //-------------------------------------------------------
+            /// Reads a version 4 formatted .csimage file. Version 4
+            /// files can contain a pre-generated mip chain. Each level
+            /// is compressed separately and is inflated directly into
+            /// its position in the output buffer, smallest first.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Pointer to image data file
+            /// @param Pointer to resource destination
+            ///
+            /// @return Whether or not the file was read successfully.
+            //-------------------------------------------------------
+            bool ReadFileVersion4(const FileStreamSPtr& in_stream, const ResourceSPtr& out_resource)
+            {
+                ImageHeaderVersion4 header;
+                in_stream->Read((s8*)&header.m_width, sizeof(u32));
+                in_stream->Read((s8*)&header.m_height, sizeof(u32));
+                in_stream->Read((s8*)&header.m_imageFormat, sizeof(u32));
+                in_stream->Read((s8*)&header.m_compression, sizeof(u32));
+                in_stream->Read((s8*)&header.m_numMipLevels, sizeof(u32));
+                
+                u32 baseDataSize = 0;
+                ImageFormat format = ImageFormat::k_RGBA8888;
+                if (GetFormatInfo(header.m_imageFormat, header.m_width, header.m_height, format, baseDataSize) == false)
+                {
+                    CS_LOG_ERROR("Invalid CSImage format.");
+                    return false;
+                }
+                
+                if (header.m_compression != k_compressionNone && header.m_compression != k_compressionZlib && header.m_compression != k_compressionLZ4)
+                {
+                    CS_LOG_ERROR("Invalid CSImage compression type.");
+                    return false;
+                }
+                
+                //textures can only be given either just the base level or a complete mip chain.
+                if (header.m_numMipLevels != 1 && header.m_numMipLevels != ImageFormatConverter::CalcNumMipLevels(header.m_width, header.m_height))
+                {
+                    CS_LOG_ERROR("Invalid number of mip levels in CSImage. A CSImage must contain either one level or a complete mip chain.");
+                    return false;
+                }
+                
+                std::vector<ImageLevelHeaderVersion4> levelHeaders(header.m_numMipLevels);
+                std::vector<u32> levelOffsets(header.m_numMipLevels);
+                u32 totalDataSize = 0;
+                for (u32 level = 0; level < header.m_numMipLevels; ++level)
+                {
+                    ImageLevelHeaderVersion4& levelHeader = levelHeaders[level];
+                    in_stream->Read((s8*)&levelHeader.m_width, sizeof(u32));
+                    in_stream->Read((s8*)&levelHeader.m_height, sizeof(u32));
+                    in_stream->Read((s8*)&levelHeader.m_checksum, sizeof(u64));
+                    in_stream->Read((s8*)&levelHeader.m_originalDataSize, sizeof(u32));
+                    in_stream->Read((s8*)&levelHeader.m_compressedDataSize, sizeof(u32));
+                    
+                    if (levelHeader.m_width != std::max(header.m_width >> level, 1u) || levelHeader.m_height != std::max(header.m_height >> level, 1u))
+                    {
+                        CS_LOG_ERROR("CSImage mip level " + ToString(level) + " has invalid dimensions.");
+                        return false;
+                    }
+                    
+                    u32 expectedDataSize = 0;
+                    GetFormatInfo(header.m_imageFormat, levelHeader.m_width, levelHeader.m_height, format, expectedDataSize);
+                    if (levelHeader.m_originalDataSize != expectedDataSize)
+                    {
+                        CS_LOG_ERROR("CSImage mip level " + ToString(level) + " has an invalid data size.");
+                        return false;
+                    }
+                    
+                    levelOffsets[level] = totalDataSize;
+                    totalDataSize += levelHeader.m_originalDataSize;
+                }
+                
+                if (in_stream->IsBad() == true)
+                {
+                    CS_LOG_ERROR("Failed to read CSImage header.");
+                    return false;
+                }
+                
+                Image::ImageDataUPtr imageData(new u8[totalDataSize]);
+                
+                for (s32 level = s32(header.m_numMipLevels) - 1; level >= 0; --level)
+                {
+                    const ImageLevelHeaderVersion4& levelHeader = levelHeaders[level];
+                    u8* levelData = imageData.get() + levelOffsets[level];
+                    
+                    if (header.m_compression == k_compressionZlib)
+                    {
+                        if (InflateFromStream(in_stream, levelHeader.m_compressedDataSize, levelData, levelHeader.m_originalDataSize) == false)
+                        {
+                            CS_LOG_ERROR("Failed to inflate CSImage mip level " + ToString(level) + ".");
+                            return false;
+                        }
+                    }
+                    else if (header.m_compression == k_compressionLZ4)
+                    {
+                        if (DecompressLZ4FromStream(in_stream, levelHeader.m_compressedDataSize, levelData, levelHeader.m_originalDataSize) == false)
+                        {
+                            CS_LOG_ERROR("Failed to decompress CSImage mip level " + ToString(level) + ".");
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        in_stream->Read((s8*)levelData, levelHeader.m_originalDataSize);
+                    }
+                    
+                    u32 checksum = HashCRC32::GenerateHashCode((const s8*)levelData, levelHeader.m_originalDataSize);
+                    if (levelHeader.m_checksum != (u64)checksum)
+                    {
+                        CS_LOG_ERROR("CSImage mip level " + ToString(level) + " checksum of " + ToString(checksum) + " does not match expected checksum " + ToString(levelHeader.m_checksum));
+                    }
+                }
+                
+                in_stream->Close();
+                
+                Image::Descriptor desc;
+                desc.m_format = format;
+                desc.m_compression = ImageCompression::k_none;
+                desc.m_width = header.m_width;
+                desc.m_height = header.m_height;
+                desc.m_dataSize = totalDataSize;
+                desc.m_numMipLevels = header.m_numMipLevels;
+                
+                Image* image = (Image*)out_resource.get();
+                image->Build(desc, std::move(imageData));
+                
+                return true;
+            }
             //----------------------------------------------------
             /// Performs the heavy lifting for the 2 create methods
             ///
@@ -233,7 +497,22 @@ namespace ChilliSource
                 pImageFile->Read((s8*)&udwVersion, sizeof(u32));
                 CS_ASSERT(udwVersion >= 3, "Only version 3 and above supported");
    
-                ReadFileVersion3(pImageFile, out_resource);
+                if (udwVersion >= 4)
+                {
+                    if (ReadFileVersion4(pImageFile, out_resource) == false)
+                    {
+                        out_resource->SetLoadState(Resource::LoadState::k_failed);
+                        if(in_delegate != nullptr)
+                        {
+                            Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
+                        }
+                        return;
+                    }
+                }
+                else
+                {
+                    ReadFileVersion3(pImageFile, out_resource);
+                }
                 
                 out_resource->SetLoadState(Resource::LoadState::k_loaded);
                 if(in_delegate != nullptr)
@@ -0,0 +1,149 @@
+//
+//  CSImageWriter.cpp
+//  Chilli Source
+//  Created by Ian Copland on 12/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Image/CSImageWriter.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/Image/ImageFormatConverter.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace CSImageWriter
+        {
+            namespace
+            {
+                //---------------------------------------------------
+                /// Converts RGBA8888 image data to the given format.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The RGBA8888 image data.
+                /// @param The size of the RGBA8888 image data.
+                /// @param The output format.
+                /// @param [Out] The output buffer.
+                //---------------------------------------------------
+                void ConvertFromRGBA8888(const u8* in_imageData, u32 in_imageDataSize, ImageFormat in_format, u8* out_imageData)
+                {
+                    switch (in_format)
+                    {
+                        case ImageFormat::k_Lum8:
+                            ImageFormatConverter::RGBA8888ToLum8(in_imageData, in_imageDataSize, out_imageData);
+                            break;
+                        case ImageFormat::k_LumA88:
+                            ImageFormatConverter::RGBA8888ToLumA88(in_imageData, in_imageDataSize, out_imageData);
+                            break;
+                        case ImageFormat::k_RGB565:
+                            ImageFormatConverter::RGBA8888ToRGB565(in_imageData, in_imageDataSize, out_imageData);
+                            break;
+                        case ImageFormat::k_RGBA4444:
+                            ImageFormatConverter::RGBA8888ToRGBA4444(in_imageData, in_imageDataSize, out_imageData);
+                            break;
+                        case ImageFormat::k_RGB888:
+                            ImageFormatConverter::RGBA8888ToRGB888(in_imageData, in_imageDataSize, out_imageData);
+                            break;
+                        case ImageFormat::k_RGBA8888:
+                            memcpy(out_imageData, in_imageData, in_imageDataSize);
+                            break;
+                        default:
+                            CS_LOG_FATAL("Unsupported csimage format.");
+                            break;
+                    }
+                }
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            bool WriteFile(StorageLocation in_storageLocation, const std::string& in_filePath, const u8* in_imageData, u32 in_width, u32 in_height, const Options& in_options)
+            {
+                CS_ASSERT(in_imageData != nullptr, "Cannot write null image data.");
+                CS_ASSERT(in_width > 0 && in_height > 0, "Cannot write an image with a size of zero.");
+
+                if (CSImageEncoder::IsFormatSupported(in_options.m_format) == false)
+                {
+                    CS_LOG_ERROR("Cannot write csimage '" + in_filePath + "': unsupported image format.");
+                    return false;
+                }
+
+                const u32 numLevels = (in_options.m_generateMipMaps == true) ? ImageFormatConverter::CalcNumMipLevels(in_width, in_height) : 1;
+
+                std::unique_ptr<u8[]> mipChain;
+                if (numLevels > 1)
+                {
+                    mipChain.reset(new u8[ImageFormatConverter::CalcMipChainDataSizeRGBA8888(in_width, in_height)]);
+                    ImageFormatConverter::GenerateMipChainRGBA8888(in_imageData, in_width, in_height, mipChain.get(), in_options.m_gammaCorrectMipMaps);
+                }
+
+                const u32 bytesPerPixel = ImageFormatConverter::GetBytesPerPixel(in_options.m_format);
+
+                std::vector<std::vector<u8>> convertedLevels(numLevels);
+                std::vector<CSImageEncoder::Level> levels(numLevels);
+                const u8* levelData = in_imageData;
+                u32 width = in_width;
+                u32 height = in_height;
+                for (u32 level = 0; level < numLevels; ++level)
+                {
+                    convertedLevels[level].resize(width * height * bytesPerPixel);
+                    ConvertFromRGBA8888(levelData, width * height * 4, in_options.m_format, convertedLevels[level].data());
+
+                    levels[level].m_width = width;
+                    levels[level].m_height = height;
+                    levels[level].m_data = convertedLevels[level].data();
+                    levels[level].m_dataSize = u32(convertedLevels[level].size());
+
+                    levelData = (level == 0) ? mipChain.get() : levelData + width * height * 4;
+                    width = std::max(width / 2, 1u);
+                    height = std::max(height / 2, 1u);
+                }
+
+                std::vector<u8> fileData;
+                if (CSImageEncoder::Encode(levels, in_options.m_format, in_options.m_compression, fileData) == false)
+                {
+                    CS_LOG_ERROR("Cannot write csimage '" + in_filePath + "': failed to compress image data.");
+                    return false;
+                }
+
+                FileStreamSPtr stream = Application::Get()->GetFileSystem()->CreateFileStream(in_storageLocation, in_filePath, FileMode::k_writeBinaryTruncate);
+                if (stream == nullptr || stream->IsBad() == true)
+                {
+                    CS_LOG_ERROR("Cannot write csimage '" + in_filePath + "': failed to open file.");
+                    return false;
+                }
+
+                stream->Write((const s8*)fileData.data(), s32(fileData.size()));
+                stream->Close();
+                return true;
+            }
+        }
+    }
+}
@@ -0,0 +1,99 @@
+//
+//  CSImageWriter.h
+//  Chilli Source
+//  Created by Ian Copland on 12/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_IMAGE_CSIMAGEWRITER_H_
+#define _CHILLISOURCE_CORE_IMAGE_CSIMAGEWRITER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/StorageLocation.h>
+#include <ChilliSource/Core/Image/CSImageEncoder.h>
+#include <ChilliSource/Core/Image/ImageFormat.h>
+
+#include <string>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------
+        /// A collection of methods for writing RGBA8888 image data
+        /// to a .csimage file. Files are written in version 4 of
+        /// the format, which can include a pre-generated mip chain
+        /// so that mip maps do not need to be generated on device
+        /// at load time. This can be used by tools to convert
+        /// images, or at runtime to cache procedurally generated
+        /// images. The file itself is laid out by CSImageEncoder.
+        ///
+        /// @author Ian Copland
+        //---------------------------------------------------------
+        namespace CSImageWriter
+        {
+            //---------------------------------------------------
+            /// The compression used for the image data in a
+            /// .csimage file.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            using Compression = CSImageEncoder::Compression;
+            //---------------------------------------------------
+            /// The options used when writing a .csimage file.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            struct Options final
+            {
+                ImageFormat m_format = ImageFormat::k_RGBA8888;
+                bool m_generateMipMaps = true;
+                bool m_gammaCorrectMipMaps = true;
+                Compression m_compression = Compression::k_zlib;
+            };
+            //---------------------------------------------------
+            /// Writes the given RGBA8888 image data to a .csimage
+            /// file, converting it to the requested format. If
+            /// requested, a complete mip chain is generated from
+            /// the RGBA8888 data before conversion. Depth formats
+            /// are not supported.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The storage location to write to.
+            /// @param The file path.
+            /// @param The RGBA8888 image data.
+            /// @param The width of the image.
+            /// @param The height of the image.
+            /// @param The options.
+            ///
+            /// @return Whether or not the file was written
+            /// successfully.
+            //---------------------------------------------------
+            bool WriteFile(StorageLocation in_storageLocation, const std::string& in_filePath, const u8* in_imageData, u32 in_width, u32 in_height, const Options& in_options = Options());
+        }
+    }
+}
+
+#endif
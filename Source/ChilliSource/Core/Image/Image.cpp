@@ -98,5 +98,11 @@ namespace ChilliSource
 		{
 			return m_dataDesc.m_dataSize;
 		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		u32 Image::GetNumMipLevels() const
+		{
+			return m_dataDesc.m_numMipLevels;
+		}
 	}
 }
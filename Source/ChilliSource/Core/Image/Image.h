@@ -51,7 +51,10 @@ namespace ChilliSource
             
             //----------------------------------------------------------------
             /// Holds the information about the image data such as size,
-            /// compression, etc. Used to build the image resource
+            /// compression, etc. Used to build the image resource. The
+            /// number of mip levels includes the base level; if greater
+            /// than one the data contains each level stored consecutively,
+            /// largest first, and the data size is that of the whole chain.
             ///
             /// @author S Downie
             //----------------------------------------------------------------
@@ -62,6 +65,7 @@ namespace ChilliSource
                 u32 m_width;
                 u32 m_height;
                 u32 m_dataSize;
+                u32 m_numMipLevels = 1;
             };
 			//----------------------------------------------------------------
 			/// @author S Downie
@@ -112,6 +116,13 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			u32 GetDataSize() const;
 			//----------------------------------------------------------------
+			/// @author Ian Copland
+			///
+			/// @return The number of mip levels contained in the image data,
+			/// including the base level.
+			//----------------------------------------------------------------
+			u32 GetNumMipLevels() const;
+			//----------------------------------------------------------------
 			/// Use datasize, width, height, format and compression
             /// to decode
             ///
@@ -125,6 +136,7 @@ namespace ChilliSource
             friend class ResourcePool;
             friend class Rendering::TextureProvider;
             friend class Rendering::CubemapProvider;
+            friend class Rendering::FontProvider;
             //----------------------------------------------------------------
             /// Factory create method. Only called by resource pool or by
             /// texture provider.
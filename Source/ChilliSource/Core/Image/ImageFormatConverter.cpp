@@ -28,9 +28,25 @@
 
 #include <ChilliSource/Core/Image/ImageFormatConverter.h>
 
-#include <ChilliSource/Core/Base/ByteColour.h>
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Base/Device.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define CS_IMAGEFORMATCONVERTER_SSE2
+#   include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#   define CS_IMAGEFORMATCONVERTER_NEON
+#   include <arm_neon.h>
+#endif
 
 namespace ChilliSource
 {
@@ -38,6 +54,500 @@ namespace ChilliSource
     {
         namespace ImageFormatConverter
         {
+            namespace
+            {
+                const u32 k_minPixelsPerTask = 64 * 1024;
+                
+                using RangeKernel = std::function<void(u32, u32)>;
+                //---------------------------------------------------
+                /// Shared state for a single ParallelFor() call.
+                ///
+                /// @author Ian Copland
+                //---------------------------------------------------
+                struct ParallelForState final
+                {
+                    std::atomic<u32> m_nextBand;
+                    u32 m_numBandsComplete = 0;
+                    std::mutex m_mutex;
+                    std::condition_variable m_condition;
+                };
+                //---------------------------------------------------
+                /// Performs the given kernel over the range
+                /// [0, in_numItems), splitting it into bands which
+                /// are processed by the calling thread and the
+                /// worker threads. Bands are claimed from a shared
+                /// counter, so the calling thread never waits on a
+                /// band which has not yet been started. This means
+                /// it is safe to call from a worker thread.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The number of items.
+                /// @param The minimum number of items in a band.
+                /// @param The kernel, which takes the first item
+                /// and the number of items in a band.
+                //---------------------------------------------------
+                void ParallelFor(u32 in_numItems, u32 in_minItemsPerBand, const RangeKernel& in_kernel)
+                {
+                    u32 numBands = 1;
+                    
+                    Application* application = Application::Get();
+                    if (application != nullptr && in_numItems >= 2 * in_minItemsPerBand)
+                    {
+                        Device* device = application->GetSystem<Device>();
+                        u32 numCores = (device != nullptr) ? device->GetNumberOfCPUCores() : 1;
+                        numBands = std::min(numCores, in_numItems / in_minItemsPerBand);
+                    }
+                    
+                    if (numBands <= 1)
+                    {
+                        in_kernel(0, in_numItems);
+                        return;
+                    }
+                    
+                    auto state = std::make_shared<ParallelForState>();
+                    state->m_nextBand = 0;
+                    
+                    const u32 itemsPerBand = (in_numItems + numBands - 1) / numBands;
+                    
+                    //The kernel is only referenced while a band is in progress, during which the calling
+                    //thread is guaranteed to still be waiting.
+                    const RangeKernel* kernel = &in_kernel;
+                    auto performBands = [state, kernel, numBands, itemsPerBand, in_numItems]()
+                    {
+                        u32 band = 0;
+                        while ((band = state->m_nextBand++) < numBands)
+                        {
+                            u32 first = band * itemsPerBand;
+                            if (first < in_numItems)
+                            {
+                                (*kernel)(first, std::min(itemsPerBand, in_numItems - first));
+                            }
+                            
+                            std::unique_lock<std::mutex> lock(state->m_mutex);
+                            if (++state->m_numBandsComplete == numBands)
+                            {
+                                state->m_condition.notify_all();
+                            }
+                        }
+                    };
+                    
+                    TaskScheduler* taskScheduler = application->GetTaskScheduler();
+                    for (u32 i = 1; i < numBands; ++i)
+                    {
+                        taskScheduler->ScheduleTask(performBands);
+                    }
+                    
+                    performBands();
+                    
+                    std::unique_lock<std::mutex> lock(state->m_mutex);
+                    while (state->m_numBandsComplete < numBands)
+                    {
+                        state->m_condition.wait(lock);
+                    }
+                }
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param An RGBA8888 pixel.
+                ///
+                /// @return The pixel in RGBA4444 format.
+                //---------------------------------------------------
+                inline u16 ToRGBA4444(u32 in_pixel)
+                {
+                    return u16((((in_pixel >> 0) & 0xFF) >> 4) << 12 | // R
+                        (((in_pixel >> 8) & 0xFF) >> 4) << 8 | // G
+                        (((in_pixel >> 16) & 0xFF) >> 4) << 4 | // B
+                        (((in_pixel >> 24) & 0xFF) >> 4) << 0); // A
+                }
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param An RGBA8888 pixel.
+                ///
+                /// @return The pixel in RGB565 format.
+                //---------------------------------------------------
+                inline u16 ToRGB565(u32 in_pixel)
+                {
+                    return u16((((in_pixel >> 0) & 0xFF) >> 3) << 11 |
+                        (((in_pixel >> 8) & 0xFF) >> 2) << 5 |
+                        (((in_pixel >> 16) & 0xFF) >> 3) << 0);
+                }
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param An RGBA8888 pixel.
+                ///
+                /// @return The pixel in LumA88 format.
+                //---------------------------------------------------
+                inline u16 ToLumA88(u32 in_pixel)
+                {
+                    return u16((in_pixel & 0xFF) | // L
+                        ((in_pixel >> 16) & 0xFF00)); // A
+                }
+                //---------------------------------------------------
+                /// Multiplies two 8-bit channel values, dividing by
+                /// 255 with correct rounding.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The first value.
+                /// @param The second value.
+                ///
+                /// @return The product.
+                //---------------------------------------------------
+                inline u8 MultiplyChannel(u32 in_a, u32 in_b)
+                {
+                    u32 product = in_a * in_b + 128;
+                    return u8((product + (product >> 8)) >> 8);
+                }
+                //---------------------------------------------------
+                //---------------------------------------------------
+                void RGBA8888ToRGB888Kernel(const u8* in_pixels, u8* out_pixels, u32 in_numPixels)
+                {
+                    u32 i = 0;
+#if defined(CS_IMAGEFORMATCONVERTER_NEON)
+                    for (; i + 16 <= in_numPixels; i += 16)
+                    {
+                        uint8x16x4_t rgba = vld4q_u8(in_pixels + i * 4);
+                        uint8x16x3_t rgb;
+                        rgb.val[0] = rgba.val[0];
+                        rgb.val[1] = rgba.val[1];
+                        rgb.val[2] = rgba.val[2];
+                        vst3q_u8(out_pixels + i * 3, rgb);
+                    }
+#endif
+                    for (; i < in_numPixels; ++i)
+                    {
+                        out_pixels[i * 3 + 0] = in_pixels[i * 4 + 0];
+                        out_pixels[i * 3 + 1] = in_pixels[i * 4 + 1];
+                        out_pixels[i * 3 + 2] = in_pixels[i * 4 + 2];
+                    }
+                }
+                //---------------------------------------------------
+                //---------------------------------------------------
+                void RGBA8888ToRGBA4444Kernel(const u32* in_pixels, u16* out_pixels, u32 in_numPixels)
+                {
+                    u32 i = 0;
+#if defined(CS_IMAGEFORMATCONVERTER_SSE2)
+                    const __m128i maskR = _mm_set1_epi32(0xF0);
+                    const __m128i maskG = _mm_set1_epi32(0xF000);
+                    const __m128i maskB = _mm_set1_epi32(0xF00000);
+                    for (; i + 8 <= in_numPixels; i += 8)
+                    {
+                        __m128i packed[2];
+                        for (u32 j = 0; j < 2; ++j)
+                        {
+                            __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in_pixels + i + j * 4));
+                            __m128i value = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(pixels, maskR), 8), _mm_srli_epi32(_mm_and_si128(pixels, maskG), 4)),
+                                _mm_or_si128(_mm_srli_epi32(_mm_and_si128(pixels, maskB), 16), _mm_srli_epi32(pixels, 28)));
+                            
+                            //sign extend so the signed saturating pack preserves the bit pattern.
+                            packed[j] = _mm_srai_epi32(_mm_slli_epi32(value, 16), 16);
+                        }
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out_pixels + i), _mm_packs_epi32(packed[0], packed[1]));
+                    }
+#elif defined(CS_IMAGEFORMATCONVERTER_NEON)
+                    for (; i + 16 <= in_numPixels; i += 16)
+                    {
+                        uint8x16x4_t rgba = vld4q_u8(reinterpret_cast<const u8*>(in_pixels + i));
+                        
+                        uint16x8_t low = vsriq_n_u16(vshll_n_u8(vget_low_u8(rgba.val[0]), 8), vshll_n_u8(vget_low_u8(rgba.val[1]), 8), 4);
+                        low = vsriq_n_u16(low, vshll_n_u8(vget_low_u8(rgba.val[2]), 8), 8);
+                        low = vsriq_n_u16(low, vshll_n_u8(vget_low_u8(rgba.val[3]), 8), 12);
+                        
+                        uint16x8_t high = vsriq_n_u16(vshll_n_u8(vget_high_u8(rgba.val[0]), 8), vshll_n_u8(vget_high_u8(rgba.val[1]), 8), 4);
+                        high = vsriq_n_u16(high, vshll_n_u8(vget_high_u8(rgba.val[2]), 8), 8);
+                        high = vsriq_n_u16(high, vshll_n_u8(vget_high_u8(rgba.val[3]), 8), 12);
+                        
+                        vst1q_u16(out_pixels + i, low);
+                        vst1q_u16(out_pixels + i + 8, high);
+                    }
+#endif
+                    for (; i < in_numPixels; ++i)
+                    {
+                        out_pixels[i] = ToRGBA4444(in_pixels[i]);
+                    }
+                }
+                //---------------------------------------------------
+                //---------------------------------------------------
+                void RGBA8888ToRGB565Kernel(const u32* in_pixels, u16* out_pixels, u32 in_numPixels)
+                {
+                    u32 i = 0;
+#if defined(CS_IMAGEFORMATCONVERTER_SSE2)
+                    const __m128i maskR = _mm_set1_epi32(0xF8);
+                    const __m128i maskG = _mm_set1_epi32(0xFC00);
+                    const __m128i maskB = _mm_set1_epi32(0xF80000);
+                    for (; i + 8 <= in_numPixels; i += 8)
+                    {
+                        __m128i packed[2];
+                        for (u32 j = 0; j < 2; ++j)
+                        {
+                            __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in_pixels + i + j * 4));
+                            __m128i value = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(pixels, maskR), 8), _mm_srli_epi32(_mm_and_si128(pixels, maskG), 5)),
+                                _mm_srli_epi32(_mm_and_si128(pixels, maskB), 19));
+                            
+                            //sign extend so the signed saturating pack preserves the bit pattern.
+                            packed[j] = _mm_srai_epi32(_mm_slli_epi32(value, 16), 16);
+                        }
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out_pixels + i), _mm_packs_epi32(packed[0], packed[1]));
+                    }
+#elif defined(CS_IMAGEFORMATCONVERTER_NEON)
+                    for (; i + 16 <= in_numPixels; i += 16)
+                    {
+                        uint8x16x4_t rgba = vld4q_u8(reinterpret_cast<const u8*>(in_pixels + i));
+                        
+                        uint16x8_t low = vsriq_n_u16(vshll_n_u8(vget_low_u8(rgba.val[0]), 8), vshll_n_u8(vget_low_u8(rgba.val[1]), 8), 5);
+                        low = vsriq_n_u16(low, vshll_n_u8(vget_low_u8(rgba.val[2]), 8), 11);
+                        
+                        uint16x8_t high = vsriq_n_u16(vshll_n_u8(vget_high_u8(rgba.val[0]), 8), vshll_n_u8(vget_high_u8(rgba.val[1]), 8), 5);
+                        high = vsriq_n_u16(high, vshll_n_u8(vget_high_u8(rgba.val[2]), 8), 11);
+                        
+                        vst1q_u16(out_pixels + i, low);
+                        vst1q_u16(out_pixels + i + 8, high);
+                    }
+#endif
+                    for (; i < in_numPixels; ++i)
+                    {
+                        out_pixels[i] = ToRGB565(in_pixels[i]);
+                    }
+                }
+                //---------------------------------------------------
+                //---------------------------------------------------
+                void RGBA8888ToLumA88Kernel(const u32* in_pixels, u16* out_pixels, u32 in_numPixels)
+                {
+                    u32 i = 0;
+#if defined(CS_IMAGEFORMATCONVERTER_SSE2)
+                    const __m128i maskL = _mm_set1_epi32(0xFF);
+                    const __m128i maskA = _mm_set1_epi32(0xFF00);
+                    for (; i + 8 <= in_numPixels; i += 8)
+                    {
+                        __m128i packed[2];
+                        for (u32 j = 0; j < 2; ++j)
+                        {
+                            __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in_pixels + i + j * 4));
+                            __m128i value = _mm_or_si128(_mm_and_si128(pixels, maskL), _mm_and_si128(_mm_srli_epi32(pixels, 16), maskA));
+                            
+                            //sign extend so the signed saturating pack preserves the bit pattern.
+                            packed[j] = _mm_srai_epi32(_mm_slli_epi32(value, 16), 16);
+                        }
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out_pixels + i), _mm_packs_epi32(packed[0], packed[1]));
+                    }
+#elif defined(CS_IMAGEFORMATCONVERTER_NEON)
+                    for (; i + 16 <= in_numPixels; i += 16)
+                    {
+                        uint8x16x4_t rgba = vld4q_u8(reinterpret_cast<const u8*>(in_pixels + i));
+                        uint8x16x2_t la;
+                        la.val[0] = rgba.val[0];
+                        la.val[1] = rgba.val[3];
+                        vst2q_u8(reinterpret_cast<u8*>(out_pixels + i), la);
+                    }
+#endif
+                    for (; i < in_numPixels; ++i)
+                    {
+                        out_pixels[i] = ToLumA88(in_pixels[i]);
+                    }
+                }
+                //---------------------------------------------------
+                //---------------------------------------------------
+                void RGBA8888ToLum8Kernel(const u32* in_pixels, u8* out_pixels, u32 in_numPixels)
+                {
+                    u32 i = 0;
+#if defined(CS_IMAGEFORMATCONVERTER_SSE2)
+                    const __m128i maskL = _mm_set1_epi32(0xFF);
+                    for (; i + 16 <= in_numPixels; i += 16)
+                    {
+                        __m128i l0 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in_pixels + i + 0)), maskL);
+                        __m128i l1 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in_pixels + i + 4)), maskL);
+                        __m128i l2 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in_pixels + i + 8)), maskL);
+                        __m128i l3 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in_pixels + i + 12)), maskL);
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out_pixels + i), _mm_packus_epi16(_mm_packs_epi32(l0, l1), _mm_packs_epi32(l2, l3)));
+                    }
+#elif defined(CS_IMAGEFORMATCONVERTER_NEON)
+                    for (; i + 16 <= in_numPixels; i += 16)
+                    {
+                        uint8x16x4_t rgba = vld4q_u8(reinterpret_cast<const u8*>(in_pixels + i));
+                        vst1q_u8(out_pixels + i, rgba.val[0]);
+                    }
+#endif
+                    for (; i < in_numPixels; ++i)
+                    {
+                        out_pixels[i] = u8(in_pixels[i] & 0xFF);
+                    }
+                }
+                //---------------------------------------------------
+                //---------------------------------------------------
+                void PremultiplyAlphaKernel(const u8* in_pixels, u8* out_pixels, u32 in_numPixels)
+                {
+                    u32 i = 0;
+#if defined(CS_IMAGEFORMATCONVERTER_SSE2)
+                    const __m128i zero = _mm_setzero_si128();
+                    const __m128i rounding = _mm_set1_epi16(128);
+                    const __m128i colourMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+                    const __m128i alphaOne = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+                    for (; i + 4 <= in_numPixels; i += 4)
+                    {
+                        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in_pixels + i * 4));
+                        __m128i halves[2] = { _mm_unpacklo_epi8(pixels, zero), _mm_unpackhi_epi8(pixels, zero) };
+                        for (u32 j = 0; j < 2; ++j)
+                        {
+                            //broadcast the alpha of each pixel to its channels, leaving alpha multiplied by one.
+                            __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(halves[j], _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+                            alpha = _mm_or_si128(_mm_and_si128(alpha, colourMask), alphaOne);
+                            
+                            __m128i product = _mm_add_epi16(_mm_mullo_epi16(halves[j], alpha), rounding);
+                            halves[j] = _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+                        }
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out_pixels + i * 4), _mm_packus_epi16(halves[0], halves[1]));
+                    }
+#elif defined(CS_IMAGEFORMATCONVERTER_NEON)
+                    for (; i + 16 <= in_numPixels; i += 16)
+                    {
+                        uint8x16x4_t rgba = vld4q_u8(in_pixels + i * 4);
+                        for (u32 j = 0; j < 3; ++j)
+                        {
+                            uint16x8_t low = vmull_u8(vget_low_u8(rgba.val[j]), vget_low_u8(rgba.val[3]));
+                            uint16x8_t high = vmull_u8(vget_high_u8(rgba.val[j]), vget_high_u8(rgba.val[3]));
+                            rgba.val[j] = vcombine_u8(vrshrn_n_u16(vrsraq_n_u16(low, low, 8), 8), vrshrn_n_u16(vrsraq_n_u16(high, high, 8), 8));
+                        }
+                        vst4q_u8(out_pixels + i * 4, rgba);
+                    }
+#endif
+                    for (; i < in_numPixels; ++i)
+                    {
+                        const u8 alpha = in_pixels[i * 4 + 3];
+                        out_pixels[i * 4 + 0] = MultiplyChannel(in_pixels[i * 4 + 0], alpha);
+                        out_pixels[i * 4 + 1] = MultiplyChannel(in_pixels[i * 4 + 1], alpha);
+                        out_pixels[i * 4 + 2] = MultiplyChannel(in_pixels[i * 4 + 2], alpha);
+                        out_pixels[i * 4 + 3] = alpha;
+                    }
+                }
+                //---------------------------------------------------
+                /// Lookup tables for converting between sRGB and
+                /// linear colour values. Linear values are stored
+                /// with 16-bit precision.
+                ///
+                /// @author Ian Copland
+                //---------------------------------------------------
+                struct GammaTables final
+                {
+                    static const u32 k_linearToSRGBSize = 4096;
+                    
+                    //---------------------------------------------------
+                    /// Constructor. Builds the tables.
+                    ///
+                    /// @author Ian Copland
+                    //---------------------------------------------------
+                    GammaTables()
+                    {
+                        for (u32 i = 0; i < 256; ++i)
+                        {
+                            f64 srgb = f64(i) / 255.0;
+                            f64 linear = (srgb <= 0.04045) ? srgb / 12.92 : std::pow((srgb + 0.055) / 1.055, 2.4);
+                            m_sRGBToLinear[i] = u16(linear * 65535.0 + 0.5);
+                        }
+                        
+                        for (u32 i = 0; i < k_linearToSRGBSize; ++i)
+                        {
+                            f64 linear = (f64(i) + 0.5) / f64(k_linearToSRGBSize);
+                            f64 srgb = (linear <= 0.0031308) ? linear * 12.92 : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+                            m_linearToSRGB[i] = u8(std::min(srgb * 255.0 + 0.5, 255.0));
+                        }
+                    }
+                    
+                    u16 m_sRGBToLinear[256];
+                    u8 m_linearToSRGB[k_linearToSRGBSize];
+                };
+                
+                const GammaTables k_gammaTables;
+                //---------------------------------------------------
+                /// Downscales a single row of output pixels from the
+                /// two given input rows in linear space.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The first input row.
+                /// @param The second input row.
+                /// @param The width of the input rows.
+                /// @param [Out] The output row.
+                /// @param The width of the output row.
+                //---------------------------------------------------
+                void DownscaleRowGammaCorrectKernel(const u8* in_row0, const u8* in_row1, u32 in_inputWidth, u8* out_row, u32 in_outputWidth)
+                {
+                    for (u32 x = 0; x < in_outputWidth; ++x)
+                    {
+                        const u32 x0 = std::min(x * 2, in_inputWidth - 1);
+                        const u32 x1 = std::min(x * 2 + 1, in_inputWidth - 1);
+                        for (u32 channel = 0; channel < 3; ++channel)
+                        {
+                            u32 sum = k_gammaTables.m_sRGBToLinear[in_row0[x0 * 4 + channel]] + k_gammaTables.m_sRGBToLinear[in_row0[x1 * 4 + channel]] +
+                                k_gammaTables.m_sRGBToLinear[in_row1[x0 * 4 + channel]] + k_gammaTables.m_sRGBToLinear[in_row1[x1 * 4 + channel]];
+                            u32 linear = (sum + 2) >> 2;
+                            out_row[x * 4 + channel] = k_gammaTables.m_linearToSRGB[(linear * GammaTables::k_linearToSRGBSize) >> 16];
+                        }
+                        
+                        u32 alphaSum = in_row0[x0 * 4 + 3] + in_row0[x1 * 4 + 3] + in_row1[x0 * 4 + 3] + in_row1[x1 * 4 + 3];
+                        out_row[x * 4 + 3] = u8((alphaSum + 2) >> 2);
+                    }
+                }
+                //---------------------------------------------------
+                /// Downscales a single row of output pixels from the
+                /// two given input rows.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The first input row.
+                /// @param The second input row.
+                /// @param The width of the input rows.
+                /// @param [Out] The output row.
+                /// @param The width of the output row.
+                //---------------------------------------------------
+                void DownscaleRowKernel(const u8* in_row0, const u8* in_row1, u32 in_inputWidth, u8* out_row, u32 in_outputWidth)
+                {
+                    u32 x = 0;
+#if defined(CS_IMAGEFORMATCONVERTER_SSE2)
+                    const __m128i zero = _mm_setzero_si128();
+                    const __m128i rounding = _mm_set1_epi16(2);
+                    for (; x * 2 + 4 <= in_inputWidth && x + 2 <= in_outputWidth; x += 2)
+                    {
+                        __m128i top = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in_row0 + x * 8));
+                        __m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in_row1 + x * 8));
+                        
+                        //sum vertically, then add each pair of horizontally adjacent pixels.
+                        __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));
+                        __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero));
+                        low = _mm_add_epi16(low, _mm_srli_si128(low, 8));
+                        high = _mm_add_epi16(high, _mm_srli_si128(high, 8));
+                        
+                        __m128i sum = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(low, high), rounding), 2);
+                        _mm_storel_epi64(reinterpret_cast<__m128i*>(out_row + x * 4), _mm_packus_epi16(sum, sum));
+                    }
+#elif defined(CS_IMAGEFORMATCONVERTER_NEON)
+                    for (; x * 2 + 16 <= in_inputWidth && x + 8 <= in_outputWidth; x += 8)
+                    {
+                        uint8x16x4_t top = vld4q_u8(in_row0 + x * 8);
+                        uint8x16x4_t bottom = vld4q_u8(in_row1 + x * 8);
+                        uint8x8x4_t output;
+                        for (u32 j = 0; j < 4; ++j)
+                        {
+                            uint16x8_t sum = vaddq_u16(vpaddlq_u8(top.val[j]), vpaddlq_u8(bottom.val[j]));
+                            output.val[j] = vrshrn_n_u16(sum, 2);
+                        }
+                        vst4_u8(out_row + x * 4, output);
+                    }
+#endif
+                    for (; x < in_outputWidth; ++x)
+                    {
+                        const u32 x0 = std::min(x * 2, in_inputWidth - 1);
+                        const u32 x1 = std::min(x * 2 + 1, in_inputWidth - 1);
+                        for (u32 channel = 0; channel < 4; ++channel)
+                        {
+                            u32 sum = in_row0[x0 * 4 + channel] + in_row0[x1 * 4 + channel] + in_row1[x0 * 4 + channel] + in_row1[x1 * 4 + channel];
+                            out_row[x * 4 + channel] = u8((sum + 2) >> 2);
+                        }
+                    }
+                }
+            }
 #ifdef CS_TARGETPLATFORM_WINDOWS
 			//------------------------------------------------
 			//------------------------------------------------
@@ -133,13 +643,6 @@ namespace ChilliSource
 			{
             	CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
 
-				struct PixelRGB888
-				{
-					u8 m_r;
-					u8 m_g;
-					u8 m_b;
-				};
-
                 const u32 k_outputBytesPerPixel = 3;
                 const u32 area = in_imageDataSize / 4;
 
@@ -147,116 +650,287 @@ namespace ChilliSource
                 outputBuffer.m_size = area * k_outputBytesPerPixel;
                 outputBuffer.m_data = std::unique_ptr<u8[]>(new u8[outputBuffer.m_size]);
 
-                const ByteColour* pixel32 = reinterpret_cast<const ByteColour*>(in_imageData);
-                PixelRGB888* pixel24 = reinterpret_cast<PixelRGB888*>(outputBuffer.m_data.get());
-
-                for(u32 i = 0; i < area; ++i, ++pixel32, ++pixel24)
-                {
-                	pixel24->m_r = pixel32->r;
-                	pixel24->m_g = pixel32->g;
-                	pixel24->m_b = pixel32->b;
-                }
+                RGBA8888ToRGB888(in_imageData, in_imageDataSize, outputBuffer.m_data.get());
 
                 return std::move(outputBuffer);
 			}
-			//---------------------------------------------------
+            //---------------------------------------------------
 			//---------------------------------------------------
             ImageBuffer RGBA8888ToRGBA4444(const u8* in_imageData, u32 in_imageDataSize)
 			{
             	CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
 
-				const u32 k_outputBytesPerPixel = 2;
-				const u32 area = in_imageDataSize / 4;
+                const u32 k_outputBytesPerPixel = 2;
+                const u32 area = in_imageDataSize / 4;
 
                 ImageBuffer outputBuffer;
                 outputBuffer.m_size = area * k_outputBytesPerPixel;
                 outputBuffer.m_data = std::unique_ptr<u8[]>(new u8[outputBuffer.m_size]);
 
-                const u32* pixel32 = reinterpret_cast<const u32*>(in_imageData);
-                u16* pixel16 = reinterpret_cast<u16*>(outputBuffer.m_data.get());
+                RGBA8888ToRGBA4444(in_imageData, in_imageDataSize, outputBuffer.m_data.get());
 
-				for(u32 i = 0; i < area; ++i, ++pixel32, ++pixel16)
-				{
-					*pixel16 = ((((*pixel32 >> 0) & 0xFF) >> 4) << 12) | // R
-						((((*pixel32 >> 8) & 0xFF) >> 4) << 8) | // G
-						((((*pixel32 >> 16) & 0xFF) >> 4) << 4) | // B
-						((((*pixel32 >> 24) & 0xFF) >> 4) << 0); // A
-				}
-
-				return std::move(outputBuffer);
+                return std::move(outputBuffer);
 			}
-			//---------------------------------------------------
+            //---------------------------------------------------
 			//---------------------------------------------------
             ImageBuffer RGBA8888ToRGB565(const u8* in_imageData, u32 in_imageDataSize)
 			{
             	CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
 
-            	const u32 k_outputBytesPerPixel = 2;
-				const u32 area = in_imageDataSize / 4;
+                const u32 k_outputBytesPerPixel = 2;
+                const u32 area = in_imageDataSize / 4;
 
                 ImageBuffer outputBuffer;
                 outputBuffer.m_size = area * k_outputBytesPerPixel;
                 outputBuffer.m_data = std::unique_ptr<u8[]>(new u8[outputBuffer.m_size]);
 
-                const u32* pixel32 = reinterpret_cast<const u32*>(in_imageData);
-                u16* pixel16 = reinterpret_cast<u16*>(outputBuffer.m_data.get());
-
-                for(u32 i = 0; i < area; ++i, ++pixel32, ++pixel16)
-                {
-                    *pixel16 = ((((*pixel32 >> 0) & 0xFF) >> 3) << 11) |
-                    	((((*pixel32 >> 8) & 0xFF) >> 2) << 5) |
-                    	((((*pixel32 >> 16) & 0xFF) >> 3) << 0);
-                }
+                RGBA8888ToRGB565(in_imageData, in_imageDataSize, outputBuffer.m_data.get());
 
                 return std::move(outputBuffer);
 			}
-			//---------------------------------------------------
+            //---------------------------------------------------
 			//---------------------------------------------------
             ImageBuffer RGBA8888ToLumA88(const u8* in_imageData, u32 in_imageDataSize)
 			{
             	CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
 
-            	const u32 k_outputBytesPerPixel = 2;
-				const u32 area = in_imageDataSize / 4;
+                const u32 k_outputBytesPerPixel = 2;
+                const u32 area = in_imageDataSize / 4;
 
                 ImageBuffer outputBuffer;
                 outputBuffer.m_size = area * k_outputBytesPerPixel;
                 outputBuffer.m_data = std::unique_ptr<u8[]>(new u8[outputBuffer.m_size]);
 
-                const u32* pixel32 = reinterpret_cast<const u32*>(in_imageData);
-                u16* pixel16 = reinterpret_cast<u16*>(outputBuffer.m_data.get());
-
-                for(u32 i = 0; i < area; ++i, ++pixel32, ++pixel16)
-                {
-                    *pixel16 = ((*pixel32) & 0xFF) | // L
-                    	((*pixel32 >> 16) & 0xFF00); // A
-                }
+                RGBA8888ToLumA88(in_imageData, in_imageDataSize, outputBuffer.m_data.get());
 
                 return std::move(outputBuffer);
 			}
-			//---------------------------------------------------
+            //---------------------------------------------------
 			//---------------------------------------------------
             ImageBuffer RGBA8888ToLum8(const u8* in_imageData, u32 in_imageDataSize)
 			{
             	CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
 
-            	const u32 k_outputBytesPerPixel = 1;
-				const u32 area = in_imageDataSize / 4;
+                const u32 k_outputBytesPerPixel = 1;
+                const u32 area = in_imageDataSize / 4;
 
                 ImageBuffer outputBuffer;
                 outputBuffer.m_size = area * k_outputBytesPerPixel;
                 outputBuffer.m_data = std::unique_ptr<u8[]>(new u8[outputBuffer.m_size]);
 
+                RGBA8888ToLum8(in_imageData, in_imageDataSize, outputBuffer.m_data.get());
+
+                return std::move(outputBuffer);
+			}
+            //---------------------------------------------------
+			//---------------------------------------------------
+            void RGBA8888ToRGB888(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData)
+			{
+            	CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
+                CS_ASSERT(out_imageData != nullptr, "Output image data buffer cannot be null.");
+
+                const u32 area = in_imageDataSize / 4;
+
+                ParallelFor(area, k_minPixelsPerTask, [=](u32 in_first, u32 in_count)
+                {
+                    RGBA8888ToRGB888Kernel(in_imageData + in_first * 4, out_imageData + in_first * 3, in_count);
+                });
+			}
+            //---------------------------------------------------
+			//---------------------------------------------------
+            void RGBA8888ToRGBA4444(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData)
+			{
+            	CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
+                CS_ASSERT(out_imageData != nullptr, "Output image data buffer cannot be null.");
+
+                const u32 area = in_imageDataSize / 4;
+
                 const u32* pixel32 = reinterpret_cast<const u32*>(in_imageData);
-                u8* pixel8 = outputBuffer.m_data.get();
+                u16* pixel16 = reinterpret_cast<u16*>(out_imageData);
 
-				for(u32 i = 0; i < area; ++i, ++pixel32, ++pixel8)
-				{
-					*pixel8 = ((*pixel32)& 0xFF);
-				}
+                ParallelFor(area, k_minPixelsPerTask, [=](u32 in_first, u32 in_count)
+                {
+                    RGBA8888ToRGBA4444Kernel(pixel32 + in_first, pixel16 + in_first, in_count);
+                });
+			}
+            //---------------------------------------------------
+			//---------------------------------------------------
+            void RGBA8888ToRGB565(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData)
+			{
+            	CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
+                CS_ASSERT(out_imageData != nullptr, "Output image data buffer cannot be null.");
+
+                const u32 area = in_imageDataSize / 4;
 
-				return std::move(outputBuffer);
+                const u32* pixel32 = reinterpret_cast<const u32*>(in_imageData);
+                u16* pixel16 = reinterpret_cast<u16*>(out_imageData);
+
+                ParallelFor(area, k_minPixelsPerTask, [=](u32 in_first, u32 in_count)
+                {
+                    RGBA8888ToRGB565Kernel(pixel32 + in_first, pixel16 + in_first, in_count);
+                });
 			}
+            //---------------------------------------------------
+			//---------------------------------------------------
+            void RGBA8888ToLumA88(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData)
+			{
+            	CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
+                CS_ASSERT(out_imageData != nullptr, "Output image data buffer cannot be null.");
+
+                const u32 area = in_imageDataSize / 4;
+
+                const u32* pixel32 = reinterpret_cast<const u32*>(in_imageData);
+                u16* pixel16 = reinterpret_cast<u16*>(out_imageData);
+
+                ParallelFor(area, k_minPixelsPerTask, [=](u32 in_first, u32 in_count)
+                {
+                    RGBA8888ToLumA88Kernel(pixel32 + in_first, pixel16 + in_first, in_count);
+                });
+			}
+            //---------------------------------------------------
+			//---------------------------------------------------
+            void RGBA8888ToLum8(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData)
+			{
+            	CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
+                CS_ASSERT(out_imageData != nullptr, "Output image data buffer cannot be null.");
+
+                const u32 area = in_imageDataSize / 4;
+
+                const u32* pixel32 = reinterpret_cast<const u32*>(in_imageData);
+
+                ParallelFor(area, k_minPixelsPerTask, [=](u32 in_first, u32 in_count)
+                {
+                    RGBA8888ToLum8Kernel(pixel32 + in_first, out_imageData + in_first, in_count);
+                });
+			}
+			//---------------------------------------------------
+			//---------------------------------------------------
+            void PremultiplyAlphaRGBA8888(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData)
+            {
+                CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
+                CS_ASSERT(out_imageData != nullptr, "Output image data buffer cannot be null.");
+
+                const u32 area = in_imageDataSize / 4;
+
+                ParallelFor(area, k_minPixelsPerTask, [=](u32 in_first, u32 in_count)
+                {
+                    PremultiplyAlphaKernel(in_imageData + in_first * 4, out_imageData + in_first * 4, in_count);
+                });
+            }
+			//---------------------------------------------------
+			//---------------------------------------------------
+            void DownscaleRGBA8888(const u8* in_imageData, u32 in_width, u32 in_height, u8* out_imageData)
+            {
+                CS_ASSERT(in_width > 0 && in_height > 0, "Invalid input image size.");
+                CS_ASSERT(out_imageData != nullptr, "Output image data buffer cannot be null.");
+
+                const u32 outputWidth = std::max(in_width / 2, 1u);
+                const u32 outputHeight = std::max(in_height / 2, 1u);
+                const u32 minRowsPerTask = std::max(k_minPixelsPerTask / outputWidth, 1u);
+
+                ParallelFor(outputHeight, minRowsPerTask, [=](u32 in_first, u32 in_count)
+                {
+                    for (u32 y = in_first; y < in_first + in_count; ++y)
+                    {
+                        const u8* row0 = in_imageData + std::min(y * 2, in_height - 1) * in_width * 4;
+                        const u8* row1 = in_imageData + std::min(y * 2 + 1, in_height - 1) * in_width * 4;
+                        DownscaleRowKernel(row0, row1, in_width, out_imageData + y * outputWidth * 4, outputWidth);
+                    }
+                });
+            }
+			//---------------------------------------------------
+			//---------------------------------------------------
+            void DownscaleRGBA8888GammaCorrect(const u8* in_imageData, u32 in_width, u32 in_height, u8* out_imageData)
+            {
+                CS_ASSERT(in_width > 0 && in_height > 0, "Invalid input image size.");
+                CS_ASSERT(out_imageData != nullptr, "Output image data buffer cannot be null.");
+
+                const u32 outputWidth = std::max(in_width / 2, 1u);
+                const u32 outputHeight = std::max(in_height / 2, 1u);
+                const u32 minRowsPerTask = std::max(k_minPixelsPerTask / outputWidth, 1u);
+
+                ParallelFor(outputHeight, minRowsPerTask, [=](u32 in_first, u32 in_count)
+                {
+                    for (u32 y = in_first; y < in_first + in_count; ++y)
+                    {
+                        const u8* row0 = in_imageData + std::min(y * 2, in_height - 1) * in_width * 4;
+                        const u8* row1 = in_imageData + std::min(y * 2 + 1, in_height - 1) * in_width * 4;
+                        DownscaleRowGammaCorrectKernel(row0, row1, in_width, out_imageData + y * outputWidth * 4, outputWidth);
+                    }
+                });
+            }
+			//---------------------------------------------------
+			//---------------------------------------------------
+            u32 GetBytesPerPixel(ImageFormat in_format)
+            {
+                switch (in_format)
+                {
+                    case ImageFormat::k_RGBA8888:
+                    case ImageFormat::k_Depth32:
+                        return 4;
+                    case ImageFormat::k_RGB888:
+                        return 3;
+                    case ImageFormat::k_RGBA4444:
+                    case ImageFormat::k_RGB565:
+                    case ImageFormat::k_LumA88:
+                    case ImageFormat::k_Depth16:
+                        return 2;
+                    case ImageFormat::k_Lum8:
+                        return 1;
+                    default:
+                        CS_LOG_FATAL("Unknown image format.");
+                        return 0;
+                }
+            }
+			//---------------------------------------------------
+			//---------------------------------------------------
+            u32 CalcNumMipLevels(u32 in_width, u32 in_height)
+            {
+                u32 numLevels = 1;
+                while (in_width > 1 || in_height > 1)
+                {
+                    in_width = std::max(in_width / 2, 1u);
+                    in_height = std::max(in_height / 2, 1u);
+                    ++numLevels;
+                }
+                return numLevels;
+            }
+			//---------------------------------------------------
+			//---------------------------------------------------
+            u32 CalcMipChainDataSizeRGBA8888(u32 in_width, u32 in_height)
+            {
+                u32 size = 0;
+                while (in_width > 1 || in_height > 1)
+                {
+                    in_width = std::max(in_width / 2, 1u);
+                    in_height = std::max(in_height / 2, 1u);
+                    size += in_width * in_height * 4;
+                }
+                return size;
+            }
+			//---------------------------------------------------
+			//---------------------------------------------------
+            void GenerateMipChainRGBA8888(const u8* in_imageData, u32 in_width, u32 in_height, u8* out_imageData, bool in_gammaCorrect)
+            {
+                const u8* source = in_imageData;
+                u8* destination = out_imageData;
+                while (in_width > 1 || in_height > 1)
+                {
+                    if (in_gammaCorrect == true)
+                    {
+                        DownscaleRGBA8888GammaCorrect(source, in_width, in_height, destination);
+                    }
+                    else
+                    {
+                        DownscaleRGBA8888(source, in_width, in_height, destination);
+                    }
+
+                    in_width = std::max(in_width / 2, 1u);
+                    in_height = std::max(in_height / 2, 1u);
+                    source = destination;
+                    destination += in_width * in_height * 4;
+                }
+            }
         }
     }
 }
@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Image/Image.h>
+#include <ChilliSource/Core/Image/ImageFormat.h>
 
 namespace ChilliSource
 {
@@ -191,6 +192,169 @@ namespace ChilliSource
 			/// @return The output Lum8 image data.
 			//---------------------------------------------------
 			ImageBuffer RGBA8888ToLum8(const u8* in_imageData, u32 in_imageDataSize);
+			//---------------------------------------------------
+			/// Converts RGBA8888 image data to RGB888, writing
+			/// into the given buffer, which must be at least
+			/// 3 bytes per pixel in size and must not overlap
+			/// the input. Large images are split across the
+			/// worker threads.
+			///
+			/// @author Ian Copland
+			///
+			/// @param The input RGBA8888 image data buffer.
+			/// @param The size of the RGBA8888 image data buffer.
+			/// @param [Out] The output RGB888 image data buffer.
+			//---------------------------------------------------
+			void RGBA8888ToRGB888(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData);
+			//---------------------------------------------------
+			/// Converts RGBA8888 image data to RGBA4444, writing
+			/// into the given buffer, which must be at least
+			/// 2 bytes per pixel in size and must not overlap
+			/// the input. Large images are split across the
+			/// worker threads.
+			///
+			/// @author Ian Copland
+			///
+			/// @param The input RGBA8888 image data buffer.
+			/// @param The size of the RGBA8888 image data buffer.
+			/// @param [Out] The output RGBA4444 image data buffer.
+			//---------------------------------------------------
+			void RGBA8888ToRGBA4444(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData);
+			//---------------------------------------------------
+			/// Converts RGBA8888 image data to RGB565, writing
+			/// into the given buffer, which must be at least
+			/// 2 bytes per pixel in size and must not overlap
+			/// the input. Large images are split across the
+			/// worker threads.
+			///
+			/// @author Ian Copland
+			///
+			/// @param The input RGBA8888 image data buffer.
+			/// @param The size of the RGBA8888 image data buffer.
+			/// @param [Out] The output RGB565 image data buffer.
+			//---------------------------------------------------
+			void RGBA8888ToRGB565(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData);
+			//---------------------------------------------------
+			/// Converts RGBA8888 image data to LumA88, writing
+			/// into the given buffer, which must be at least
+			/// 2 bytes per pixel in size and must not overlap
+			/// the input. Large images are split across the
+			/// worker threads.
+			///
+			/// @author Ian Copland
+			///
+			/// @param The input RGBA8888 image data buffer.
+			/// @param The size of the RGBA8888 image data buffer.
+			/// @param [Out] The output LumA88 image data buffer.
+			//---------------------------------------------------
+			void RGBA8888ToLumA88(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData);
+			//---------------------------------------------------
+			/// Converts RGBA8888 image data to Lum8, writing
+			/// into the given buffer, which must be at least
+			/// 1 byte per pixel in size and must not overlap
+			/// the input. Large images are split across the
+			/// worker threads.
+			///
+			/// @author Ian Copland
+			///
+			/// @param The input RGBA8888 image data buffer.
+			/// @param The size of the RGBA8888 image data buffer.
+			/// @param [Out] The output Lum8 image data buffer.
+			//---------------------------------------------------
+			void RGBA8888ToLum8(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData);
+			//---------------------------------------------------
+			/// Multiplies the colour channels of RGBA8888 image
+			/// data by the alpha channel. The output buffer must
+			/// be the same size as the input and may be the
+			/// input buffer. Large images are split across the
+			/// worker threads.
+			///
+			/// @author Ian Copland
+			///
+			/// @param The input RGBA8888 image data buffer.
+			/// @param The size of the RGBA8888 image data buffer.
+			/// @param [Out] The output premultiplied RGBA8888
+			/// image data buffer.
+			//---------------------------------------------------
+			void PremultiplyAlphaRGBA8888(const u8* in_imageData, u32 in_imageDataSize, u8* out_imageData);
+			//---------------------------------------------------
+			/// Halves the size of RGBA8888 image data using a
+			/// 2x2 box filter. Each dimension of the output is
+			/// half that of the input rounded down, to a minimum
+			/// of 1. The output buffer must not overlap the input.
+			/// Large images are split across the worker threads.
+			///
+			/// @author Ian Copland
+			///
+			/// @param The input RGBA8888 image data buffer.
+			/// @param The width of the input image.
+			/// @param The height of the input image.
+			/// @param [Out] The output RGBA8888 image data buffer.
+			//---------------------------------------------------
+			void DownscaleRGBA8888(const u8* in_imageData, u32 in_width, u32 in_height, u8* out_imageData);
+			//---------------------------------------------------
+			/// Halves the size of sRGB encoded RGBA8888 image data
+			/// using a 2x2 box filter. The colour channels are
+			/// converted to linear space before filtering, which
+			/// avoids the darkening caused by averaging gamma
+			/// encoded values. Alpha is filtered linearly. This is
+			/// otherwise the same as DownscaleRGBA8888().
+			///
+			/// @author Ian Copland
+			///
+			/// @param The input RGBA8888 image data buffer.
+			/// @param The width of the input image.
+			/// @param The height of the input image.
+			/// @param [Out] The output RGBA8888 image data buffer.
+			//---------------------------------------------------
+			void DownscaleRGBA8888GammaCorrect(const u8* in_imageData, u32 in_width, u32 in_height, u8* out_imageData);
+			//---------------------------------------------------
+			/// @author Ian Copland
+			///
+			/// @param An uncompressed image format.
+			///
+			/// @return The number of bytes per pixel.
+			//---------------------------------------------------
+			u32 GetBytesPerPixel(ImageFormat in_format);
+			//---------------------------------------------------
+			/// @author Ian Copland
+			///
+			/// @param The width of the base image.
+			/// @param The height of the base image.
+			///
+			/// @return The number of levels in a complete mip
+			/// chain for an image of the given size, including
+			/// the base level.
+			//---------------------------------------------------
+			u32 CalcNumMipLevels(u32 in_width, u32 in_height);
+			//---------------------------------------------------
+			/// @author Ian Copland
+			///
+			/// @param The width of the base image.
+			/// @param The height of the base image.
+			///
+			/// @return The size of the data required to store
+			/// all mip levels below the base level of an RGBA8888
+			/// image of the given size.
+			//---------------------------------------------------
+			u32 CalcMipChainDataSizeRGBA8888(u32 in_width, u32 in_height);
+			//---------------------------------------------------
+			/// Generates all mip levels below the base level for
+			/// the given RGBA8888 image data, down to 1x1. The
+			/// levels are written consecutively, largest first,
+			/// into the output buffer, which must be at least the
+			/// size returned by CalcMipChainDataSizeRGBA8888().
+			///
+			/// @author Ian Copland
+			///
+			/// @param The base level RGBA8888 image data.
+			/// @param The width of the base level.
+			/// @param The height of the base level.
+			/// @param [Out] The output mip chain data buffer.
+			/// @param Whether or not the image is sRGB encoded and
+			/// should be filtered in linear space.
+			//---------------------------------------------------
+			void GenerateMipChainRGBA8888(const u8* in_imageData, u32 in_width, u32 in_height, u8* out_imageData, bool in_gammaCorrect = false);
         }
     }
 }
@@ -56,6 +56,9 @@ namespace ChilliSource
 #endif
 #ifdef CS_TARGETPLATFORM_WINDOWS
             return PNGImageProviderUPtr(new CSBackend::Windows::PNGImageProvider());
+#endif
+#ifdef CS_TARGETPLATFORM_LINUX
+            return nullptr;
 #endif
         }
     }
@@ -26,14 +26,202 @@
 //  THE SOFTWARE.
 //
 
+
 #include <ChilliSource/Core/Localisation/LocalisedText.h>
 
-#include <ChilliSource/Core/String/StringUtils.h>
+#include <ChilliSource/Core/String/ToString.h>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
 
 namespace ChilliSource
 {
 	namespace Core
-	{	
+	{
+        namespace
+        {
+            const u32 k_keysPerBucket = 4;
+            const u32 k_maxDisplacement = 1 << 24;
+            const u32 k_emptySlot = 0xffffffff;
+            const u32 k_keyTableHeaderSize = 2;
+            const u32 k_textTableHeaderSize = 1;
+            
+            //---------------------------------------------------------------------
+            /// The 64-bit murmur3 finaliser, used to spread the bits of a key Id.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The value to mix.
+            ///
+            /// @return The mixed value.
+            //---------------------------------------------------------------------
+            u64 Mix(u64 in_value)
+            {
+                in_value ^= in_value >> 33;
+                in_value *= 0xff51afd7ed558ccdull;
+                in_value ^= in_value >> 33;
+                in_value *= 0xc4ceb9fe1a85ec53ull;
+                in_value ^= in_value >> 33;
+                return in_value;
+            }
+            //---------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The key Id.
+            /// @param The number of buckets.
+            ///
+            /// @return The hash bucket the key Id belongs to.
+            //---------------------------------------------------------------------
+            u32 CalculateBucket(LocalisedText::KeyId in_keyId, u32 in_numBuckets)
+            {
+                return u32(in_keyId % in_numBuckets);
+            }
+            //---------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The key Id.
+            /// @param The displacement of the key's bucket.
+            /// @param The number of keys.
+            ///
+            /// @return The slot the key Id is stored in.
+            //---------------------------------------------------------------------
+            u32 CalculateSlot(LocalisedText::KeyId in_keyId, u32 in_displacement, u32 in_numKeys)
+            {
+                return u32(Mix(in_keyId + u64(in_displacement) * 0x9e3779b97f4a7c15ull) % in_numKeys);
+            }
+            //---------------------------------------------------------------------
+            /// Finds a displacement for each bucket such that every key maps to a
+            /// unique slot, using the hash and displace method. Buckets are placed
+            /// largest first, as they are the hardest to fit.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The sorted, unique key Ids.
+            /// @param [Out] The displacement of each bucket.
+            /// @param [Out] The index of the key Id in each slot.
+            ///
+            /// @return Whether or not the hash could be built.
+            //---------------------------------------------------------------------
+            bool BuildPerfectHash(const std::vector<LocalisedText::KeyId>& in_keyIds, std::vector<u32>& out_displacements, std::vector<u32>& out_slotKeys)
+            {
+                const u32 numKeys = u32(in_keyIds.size());
+                const u32 numBuckets = std::max((numKeys + k_keysPerBucket - 1) / k_keysPerBucket, 1u);
+                
+                std::vector<std::vector<u32>> buckets(numBuckets);
+                for (u32 keyIndex = 0; keyIndex < numKeys; ++keyIndex)
+                {
+                    buckets[CalculateBucket(in_keyIds[keyIndex], numBuckets)].push_back(keyIndex);
+                }
+                
+                std::vector<u32> bucketOrder(numBuckets);
+                std::iota(bucketOrder.begin(), bucketOrder.end(), 0);
+                std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&](u32 in_a, u32 in_b)
+                {
+                    return buckets[in_a].size() > buckets[in_b].size();
+                });
+                
+                out_displacements.assign(numBuckets, 0);
+                out_slotKeys.assign(numKeys, k_emptySlot);
+                
+                std::vector<u32> bucketSlots;
+                for (u32 bucketIndex : bucketOrder)
+                {
+                    const auto& bucket = buckets[bucketIndex];
+                    if (bucket.empty() == true)
+                    {
+                        break;
+                    }
+                    
+                    bool placed = false;
+                    for (u32 displacement = 0; displacement < k_maxDisplacement && placed == false; ++displacement)
+                    {
+                        bucketSlots.clear();
+                        for (u32 keyIndex : bucket)
+                        {
+                            const u32 slot = CalculateSlot(in_keyIds[keyIndex], displacement, numKeys);
+                            if (out_slotKeys[slot] != k_emptySlot || std::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+                            {
+                                break;
+                            }
+                            
+                            bucketSlots.push_back(slot);
+                        }
+                        
+                        if (bucketSlots.size() == bucket.size())
+                        {
+                            for (u32 i = 0; i < bucket.size(); ++i)
+                            {
+                                out_slotKeys[bucketSlots[i]] = bucket[i];
+                            }
+                            
+                            out_displacements[bucketIndex] = displacement;
+                            placed = true;
+                        }
+                    }
+                    
+                    if (placed == false)
+                    {
+                        return false;
+                    }
+                }
+                
+                return true;
+            }
+            //---------------------------------------------------------------------
+            /// Creates a table blob from the given u32 values followed by the given
+            /// string data.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The values.
+            /// @param The string data.
+            /// @param [Out] The size of the table in bytes.
+            ///
+            /// @return The table.
+            //---------------------------------------------------------------------
+            std::unique_ptr<u8[]> CreateTable(const std::vector<u32>& in_values, const std::string& in_strings, u32& out_size)
+            {
+                const u32 valuesSize = u32(in_values.size() * sizeof(u32));
+                out_size = valuesSize + u32(in_strings.size());
+                
+                std::unique_ptr<u8[]> table(new u8[out_size]);
+                memcpy(table.get(), in_values.data(), valuesSize);
+                memcpy(table.get() + valuesSize, in_strings.data(), in_strings.size());
+                
+                return table;
+            }
+            //---------------------------------------------------------------------
+            /// Confirms that all of the given string offsets are within the string
+            /// data, and that the data ends in a null terminator, guaranteeing that
+            /// every string is terminated.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The string offsets.
+            /// @param The number of strings.
+            /// @param The string data.
+            /// @param The size of the string data.
+            ///
+            /// @return Whether or not the strings are valid.
+            //---------------------------------------------------------------------
+            bool ValidateStrings(const u32* in_offsets, u32 in_numStrings, const u8* in_strings, u64 in_stringsSize)
+            {
+                if (in_numStrings == 0)
+                {
+                    return true;
+                }
+                
+                if (in_stringsSize == 0 || in_strings[in_stringsSize - 1] != '\0')
+                {
+                    return false;
+                }
+                
+                return std::all_of(in_offsets, in_offsets + in_numStrings, [=](u32 in_offset) { return in_offset < in_stringsSize; });
+            }
+        }
+        
 		CS_DEFINE_NAMEDTYPE(LocalisedText);
 
 		//---------------------------------------------------------------------
@@ -42,6 +230,19 @@ namespace ChilliSource
 		{
 			return LocalisedTextUPtr(new LocalisedText());
 		}
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        LocalisedText::KeyId LocalisedText::CalculateKeyId(const std::string& in_key)
+        {
+            u64 hash = 14695981039346656037ull;
+            for (u8 character : in_key)
+            {
+                hash ^= character;
+                hash *= 1099511628211ull;
+            }
+            
+            return hash;
+        }
 		//---------------------------------------------------------------------
 		//---------------------------------------------------------------------
 		bool LocalisedText::IsA(InterfaceIDType in_interfaceId) const
@@ -50,29 +251,222 @@ namespace ChilliSource
 		}
 		//---------------------------------------------------------------------
 		//---------------------------------------------------------------------
-		void LocalisedText::Build(const std::unordered_map<std::string, std::string>& in_textMap)
+		bool LocalisedText::Build(const std::unordered_map<std::string, std::string>& in_textMap)
 		{
-			m_text = in_textMap;
+            using Entry = std::pair<KeyId, const std::pair<const std::string, std::string>*>;
+            
+            std::vector<Entry> entries;
+            entries.reserve(in_textMap.size());
+            for (const auto& entry : in_textMap)
+            {
+                entries.push_back(std::make_pair(CalculateKeyId(entry.first), &entry));
+            }
+            
+            std::sort(entries.begin(), entries.end(), [](const Entry& in_a, const Entry& in_b)
+            {
+                return in_a.first < in_b.first;
+            });
+            
+            std::vector<KeyId> keyIds;
+            keyIds.reserve(entries.size());
+            for (const auto& entry : entries)
+            {
+                if (keyIds.empty() == false && keyIds.back() == entry.first)
+                {
+                    CS_LOG_ERROR("Localised text key '" + entry.second->first + "' has the same Id as another key.");
+                    return false;
+                }
+                
+                keyIds.push_back(entry.first);
+            }
+            
+            std::vector<u32> displacements;
+            std::vector<u32> slotKeys;
+            if (BuildPerfectHash(keyIds, displacements, slotKeys) == false)
+            {
+                CS_LOG_ERROR("Could not build localised text hash.");
+                return false;
+            }
+            
+            const u32 numKeys = u32(keyIds.size());
+            
+            std::vector<u32> keyValues;
+            keyValues.reserve(k_keyTableHeaderSize + displacements.size() + 3 * numKeys);
+            keyValues.push_back(numKeys);
+            keyValues.push_back(u32(displacements.size()));
+            keyValues.insert(keyValues.end(), displacements.begin(), displacements.end());
+            
+            std::vector<u32> textValues;
+            textValues.reserve(k_textTableHeaderSize + numKeys);
+            textValues.push_back(numKeys);
+            
+            std::vector<u32> keyOffsets;
+            keyOffsets.reserve(numKeys);
+            std::string keyStrings;
+            std::string textStrings;
+            for (u32 keyIndex : slotKeys)
+            {
+                const auto& entry = *entries[keyIndex].second;
+                
+                keyValues.push_back(u32(keyIds[keyIndex]));
+                keyValues.push_back(u32(keyIds[keyIndex] >> 32));
+                keyOffsets.push_back(u32(keyStrings.size()));
+                keyStrings.append(entry.first.c_str(), entry.first.size() + 1);
+                
+                textValues.push_back(u32(textStrings.size()));
+                textStrings.append(entry.second.c_str(), entry.second.size() + 1);
+            }
+            keyValues.insert(keyValues.end(), keyOffsets.begin(), keyOffsets.end());
+            
+            u32 keyTableSize = 0;
+            u32 textTableSize = 0;
+            auto keyTable = CreateTable(keyValues, keyStrings, keyTableSize);
+            auto textTable = CreateTable(textValues, textStrings, textTableSize);
+            
+            return Build(std::move(keyTable), keyTableSize, std::move(textTable), textTableSize);
 		}
         //---------------------------------------------------------------------
         //---------------------------------------------------------------------
+        bool LocalisedText::Build(std::unique_ptr<u8[]> in_keyTable, u32 in_keyTableSize, std::unique_ptr<u8[]> in_textTable, u32 in_textTableSize)
+        {
+            if (in_keyTableSize < k_keyTableHeaderSize * sizeof(u32) || in_textTableSize < k_textTableHeaderSize * sizeof(u32))
+            {
+                return false;
+            }
+            
+            const u32* keyValues = reinterpret_cast<const u32*>(in_keyTable.get());
+            const u32* textValues = reinterpret_cast<const u32*>(in_textTable.get());
+            
+            const u32 numKeys = keyValues[0];
+            const u32 numBuckets = keyValues[1];
+            if (numBuckets == 0 || textValues[0] != numKeys)
+            {
+                return false;
+            }
+            
+            //sizes are calculated as u64 so that a corrupt header cannot cause them to wrap.
+            const u64 keyValuesSize = (u64(k_keyTableHeaderSize) + u64(numBuckets) + 3 * u64(numKeys)) * sizeof(u32);
+            const u64 textValuesSize = (u64(k_textTableHeaderSize) + u64(numKeys)) * sizeof(u32);
+            if (keyValuesSize > in_keyTableSize || textValuesSize > in_textTableSize)
+            {
+                return false;
+            }
+            
+            const u32* keyOffsets = keyValues + k_keyTableHeaderSize + numBuckets + 2 * numKeys;
+            const u32* textOffsets = textValues + k_textTableHeaderSize;
+            if (ValidateStrings(keyOffsets, numKeys, in_keyTable.get() + keyValuesSize, in_keyTableSize - keyValuesSize) == false ||
+                ValidateStrings(textOffsets, numKeys, in_textTable.get() + textValuesSize, in_textTableSize - textValuesSize) == false)
+            {
+                return false;
+            }
+            
+            m_numKeys = numKeys;
+            m_numBuckets = numBuckets;
+            m_displacements = keyValues + k_keyTableHeaderSize;
+            m_keyIds = m_displacements + numBuckets;
+            m_keyOffsets = keyOffsets;
+            m_keyStrings = reinterpret_cast<const s8*>(in_keyTable.get() + keyValuesSize);
+            m_textOffsets = textOffsets;
+            m_textStrings = reinterpret_cast<const s8*>(in_textTable.get() + textValuesSize);
+            
+            m_keyTable = std::move(in_keyTable);
+            m_textTable = std::move(in_textTable);
+            
+            return true;
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
         bool LocalisedText::Contains(const std::string& in_key) const
         {
-            return (m_text.find(in_key) != m_text.end());
+            return (FindSlot(in_key) < m_numKeys);
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        bool LocalisedText::Contains(KeyId in_keyId) const
+        {
+            return (FindSlot(in_keyId) < m_numKeys);
         }
         //---------------------------------------------------------------------
         //---------------------------------------------------------------------
-        const std::string& LocalisedText::GetText(const std::string& in_key) const
+        const s8* LocalisedText::GetTextCString(const std::string& in_key) const
         {
-			auto it = m_text.find(in_key);
+			u32 slot = FindSlot(in_key);
 
-			if (it != m_text.end())
+			if (slot < m_numKeys)
 			{
-				return it->second;
+				return GetTextInSlot(slot);
 			}
 
 			CS_LOG_ERROR("No localised text for key: " + in_key);
-			return StringUtils::BLANK;
+			return "";
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        const s8* LocalisedText::GetTextCString(KeyId in_keyId) const
+        {
+            u32 slot = FindSlot(in_keyId);
+            
+            if (slot < m_numKeys)
+            {
+                return GetTextInSlot(slot);
+            }
+            
+            CS_LOG_ERROR("No localised text for key Id: " + ToString(in_keyId));
+            return "";
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        std::string LocalisedText::GetText(const std::string& in_key) const
+        {
+            return std::string(GetTextCString(in_key));
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        std::string LocalisedText::GetText(KeyId in_keyId) const
+        {
+            return std::string(GetTextCString(in_keyId));
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        u32 LocalisedText::FindSlot(KeyId in_keyId) const
+        {
+            if (m_numKeys == 0)
+            {
+                return m_numKeys;
+            }
+            
+            const u32 displacement = m_displacements[CalculateBucket(in_keyId, m_numBuckets)];
+            const u32 slot = CalculateSlot(in_keyId, displacement, m_numKeys);
+            
+            return (GetKeyIdInSlot(slot) == in_keyId) ? slot : m_numKeys;
+        }
+        //---------------------------------------------------------------------
+        /// The key string is compared as well as the Id, so that an unknown key
+        /// which happens to share an Id with another key is not found.
+        //---------------------------------------------------------------------
+        u32 LocalisedText::FindSlot(const std::string& in_key) const
+        {
+            u32 slot = FindSlot(CalculateKeyId(in_key));
+            if (slot < m_numKeys && strcmp(m_keyStrings + m_keyOffsets[slot], in_key.c_str()) != 0)
+            {
+                return m_numKeys;
+            }
+            
+            return slot;
+        }
+        //---------------------------------------------------------------------
+        /// Ids are stored as two u32s as the table is only guaranteed to be
+        /// 4 byte aligned.
+        //---------------------------------------------------------------------
+        LocalisedText::KeyId LocalisedText::GetKeyIdInSlot(u32 in_slot) const
+        {
+            return KeyId(m_keyIds[2 * in_slot]) | (KeyId(m_keyIds[2 * in_slot + 1]) << 32);
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        const s8* LocalisedText::GetTextInSlot(u32 in_slot) const
+        {
+            return m_textStrings + m_textOffsets[in_slot];
         }
 	}
 }
@@ -26,6 +26,7 @@
 //  THE SOFTWARE.
 //
 
+
 #ifndef _CHILLISOURCE_CORE_LOCALISATION_LOCALISEDTEXT_H_
 #define _CHILLISOURCE_CORE_LOCALISATION_LOCALISEDTEXT_H_
 
@@ -43,6 +44,24 @@ namespace ChilliSource
 		/// The text comprises of Ids which act as the key and the text value.
         ///
         /// All localised text is in UTF-8 encoding format
+        ///
+        /// The text is stored in two flat tables, which are either read
+        /// directly from a compiled cstext file or built from a json cstext
+        /// file. The key table contains a minimal perfect hash over the key
+        /// Ids, so any key can be found with a single probe. All values are
+        /// little endian u32s:
+        ///
+        /// * Key table - The number of keys and the number of hash buckets,
+        ///   followed by the displacement of each bucket, the Id of the key in
+        ///   each slot as two values with the low word first, the offset of
+        ///   the key string in each slot and the null terminated key string
+        ///   data.
+        /// * Text table - The number of keys, followed by the offset of the
+        ///   text in each slot and the null terminated text data.
+        ///
+        /// Key Ids can be calculated ahead of time using CalculateKeyId(), or
+        /// generated as constants by the compile_text_file.py tool, avoiding
+        /// the need to hash strings during lookup.
 		///
 		/// @author S Downie
 		//----------------------------------------------------------------------
@@ -51,7 +70,21 @@ namespace ChilliSource
 		public:
             
 			CS_DECLARE_NAMEDTYPE(LocalisedText);
-
+            
+            using KeyId = u64;
+            
+            //---------------------------------------------------------------------
+            /// Calculates the Id of the given key. This is the 64-bit FNV-1a hash
+            /// of the key string, so two keys in the same text are very unlikely
+            /// to share an Id.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The string key.
+            ///
+            /// @return The key Id.
+            //---------------------------------------------------------------------
+            static KeyId CalculateKeyId(const std::string& in_key);
 			//---------------------------------------------------------------------
 			/// @author S Downie
 			///
@@ -61,14 +94,33 @@ namespace ChilliSource
 			//---------------------------------------------------------------------
 			bool IsA(InterfaceIDType in_interfaceId) const override;
 			//---------------------------------------------------------------------
-			/// Populate the resource with the given keys and values
+			/// Populate the resource with the given keys and values. The key and
+            /// text tables are built from the map.
 			///
 			/// @author S Downie
 			///
 			/// @param A map containing the localised text. The text is in UTF-8
             /// format.
+            ///
+            /// @return Whether or not the text could be built. This will fail if
+            /// two keys have the same Id.
 			//---------------------------------------------------------------------
-			void Build(const std::unordered_map<std::string, std::string>& in_textMap);
+			bool Build(const std::unordered_map<std::string, std::string>& in_textMap);
+            //---------------------------------------------------------------------
+            /// Populate the resource with the given key and text tables, taking
+            /// ownership of them. The tables are validated, and then used in
+            /// place.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The key table.
+            /// @param The size of the key table in bytes.
+            /// @param The text table.
+            /// @param The size of the text table in bytes.
+            ///
+            /// @return Whether or not the tables were valid.
+            //---------------------------------------------------------------------
+            bool Build(std::unique_ptr<u8[]> in_keyTable, u32 in_keyTableSize, std::unique_ptr<u8[]> in_textTable, u32 in_textTableSize);
             //---------------------------------------------------------------------
             /// @author Ian Copland
             ///
@@ -78,13 +130,63 @@ namespace ChilliSource
             //---------------------------------------------------------------------
             bool Contains(const std::string& in_key) const;
             //---------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The key Id.
+            ///
+            /// @return Whether or not this has a key with the given Id.
+            //---------------------------------------------------------------------
+            bool Contains(KeyId in_keyId) const;
+            //---------------------------------------------------------------------
+            /// The returned text points directly into the text table, so no copy
+            /// is made and no lock is taken. It remains valid for the life of the
+            /// resource, or until it is rebuilt. This should be preferred over
+            /// GetText() where the text is looked up frequently.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param String key
+            ///
+            /// @return Null terminated UTF8 text that maps to this key, or an
+            /// empty string if there is no such key.
+            //---------------------------------------------------------------------
+            const s8* GetTextCString(const std::string& in_key) const;
+            //---------------------------------------------------------------------
+            /// The returned text points directly into the text table, so no copy
+            /// is made and no lock is taken. It remains valid for the life of the
+            /// resource, or until it is rebuilt.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The key Id.
+            ///
+            /// @return Null terminated UTF8 text that maps to the key with this
+            /// Id, or an empty string if there is no such key.
+            //---------------------------------------------------------------------
+            const s8* GetTextCString(KeyId in_keyId) const;
+            //---------------------------------------------------------------------
+            /// A convenience wrapper around GetTextCString() which copies the
+            /// text into a string.
+            ///
             /// @author S Downie
             ///
             /// @param String key
             ///
             /// @return String containing UTF8 codepoints that maps to this key
             //---------------------------------------------------------------------
-            const std::string& GetText(const std::string& in_key) const;
+            std::string GetText(const std::string& in_key) const;
+            //---------------------------------------------------------------------
+            /// A convenience wrapper around GetTextCString() which copies the
+            /// text into a string.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The key Id.
+            ///
+            /// @return String containing UTF8 codepoints that maps to the key
+            /// with this Id.
+            //---------------------------------------------------------------------
+            std::string GetText(KeyId in_keyId) const;
 
 		private:
 
@@ -104,12 +206,56 @@ namespace ChilliSource
 			/// @author S Downie
 			//---------------------------------------------------------------------
 			LocalisedText() = default;
+            //---------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The key Id.
+            ///
+            /// @return The slot containing the key with the given Id, or the
+            /// number of keys if there is no such key.
+            //---------------------------------------------------------------------
+            u32 FindSlot(KeyId in_keyId) const;
+            //---------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The string key.
+            ///
+            /// @return The slot containing the given key, or the number of keys
+            /// if there is no such key.
+            //---------------------------------------------------------------------
+            u32 FindSlot(const std::string& in_key) const;
+            //---------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The slot.
+            ///
+            /// @return The Id of the key in the given slot.
+            //---------------------------------------------------------------------
+            KeyId GetKeyIdInSlot(u32 in_slot) const;
+            //---------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The slot.
+            ///
+            /// @return The null terminated text in the given slot.
+            //---------------------------------------------------------------------
+            const s8* GetTextInSlot(u32 in_slot) const;
             
         private:
             
-			std::unordered_map<std::string, std::string> m_text;
+            std::unique_ptr<u8[]> m_keyTable;
+            std::unique_ptr<u8[]> m_textTable;
+            
+            u32 m_numKeys = 0;
+            u32 m_numBuckets = 0;
+            const u32* m_displacements = nullptr;
+            const u32* m_keyIds = nullptr;
+            const u32* m_keyOffsets = nullptr;
+            const s8* m_keyStrings = nullptr;
+            const u32* m_textOffsets = nullptr;
+            const s8* m_textStrings = nullptr;
 		};
 	}
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -30,12 +30,19 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/Device.h>
+#include <ChilliSource/Core/File/CSBinaryChunk.h>
+#include <ChilliSource/Core/File/CSBinaryInputStream.h>
+#include <ChilliSource/Core/File/FileSystem.h>
 #include <ChilliSource/Core/Json/JsonUtils.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Core/Localisation/LocalisedText.h>
+#include <ChilliSource/Core/String/StringUtils.h>
+#include <ChilliSource/Core/String/ToString.h>
 
 #include <json/json.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
 	namespace Core
@@ -45,6 +52,162 @@ namespace ChilliSource
             const u32 k_version = 1;
 			const std::string k_fileExtension("cstext");
             
+            const u32 k_compiledFileFormatId = 3;
+            const u32 k_compiledFileFormatVersion = 2;
+            
+            //----------------------------------------------------
+            /// A compiled cstext file is a Chilli Source chunked
+            /// binary file containing the text for a number of
+            /// languages. The LANG chunk contains the number of
+            /// languages and the index of the default language,
+            /// followed by the offset of each language code and
+            /// the null terminated codes. The KEYS chunk
+            /// contains the key table shared by all languages, and
+            /// the text table for each language is stored in its
+            /// own chunk, named T followed by the three digit index
+            /// of the language. This allows only the active
+            /// language to be read from disk.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The storage location.
+            /// @param The filepath.
+            ///
+            /// @return Whether or not the given file is a compiled
+            /// cstext file.
+            //----------------------------------------------------
+            bool IsCompiledTextFile(StorageLocation in_storageLocation, const std::string& in_filePath)
+            {
+                auto fileStream = Application::Get()->GetFileSystem()->CreateFileStream(in_storageLocation, in_filePath, FileMode::k_readBinary);
+                if (fileStream == nullptr || fileStream->IsBad() == true || fileStream->IsOpen() == false)
+                {
+                    return false;
+                }
+                
+                const u32 k_fileIdSize = 4;
+                s8 fileId[k_fileIdSize] = {};
+                fileStream->Read(fileId, k_fileIdSize);
+                
+                return (fileStream->IsBad() == false && fileId[0] == 'C' && fileId[1] == 'S' && fileId[2] == 'C' && fileId[3] == 'S');
+            }
+            //----------------------------------------------------
+            /// Chooses which of the languages in a compiled cstext
+            /// file to load. This is the device language if it is
+            /// available, otherwise a language with the same base
+            /// language code, i.e "pt" for "pt-BR", falling back on
+            /// the default language of the file.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The LANG chunk.
+            /// @param [Out] The index of the chosen language.
+            ///
+            /// @return Whether or not the chunk was valid.
+            //----------------------------------------------------
+            bool SelectLanguage(const CSBinaryChunk* in_languageChunk, u32& out_languageIndex)
+            {
+                const u32 chunkSize = in_languageChunk->GetSize();
+                const u8* chunkData = in_languageChunk->GetData();
+                const u32 k_headerSize = 2;
+                if (chunkSize < k_headerSize * sizeof(u32))
+                {
+                    return false;
+                }
+                
+                const u32 numLanguages = reinterpret_cast<const u32*>(chunkData)[0];
+                const u32 defaultLanguageIndex = reinterpret_cast<const u32*>(chunkData)[1];
+                const u64 offsetsSize = (k_headerSize + u64(numLanguages)) * sizeof(u32);
+                if (numLanguages == 0 || defaultLanguageIndex >= numLanguages || offsetsSize >= chunkSize || chunkData[chunkSize - 1] != '\0')
+                {
+                    return false;
+                }
+                
+                const u32* offsets = reinterpret_cast<const u32*>(chunkData) + k_headerSize;
+                const s8* codes = reinterpret_cast<const s8*>(chunkData + offsetsSize);
+                const u64 codesSize = chunkSize - offsetsSize;
+                if (std::any_of(offsets, offsets + numLanguages, [=](u32 in_offset) { return in_offset >= codesSize; }) == true)
+                {
+                    return false;
+                }
+                
+                auto getBaseLanguage = [](std::string in_language) -> std::string
+                {
+                    StringUtils::ToLowerCase(in_language);
+                    return in_language.substr(0, in_language.find_first_of("-_"));
+                };
+                
+                std::string deviceLanguage = Application::Get()->GetSystem<Device>()->GetLanguage();
+                StringUtils::ToLowerCase(deviceLanguage);
+                const std::string deviceBaseLanguage = getBaseLanguage(deviceLanguage);
+                
+                out_languageIndex = defaultLanguageIndex;
+                bool foundBaseLanguage = false;
+                for (u32 languageIndex = 0; languageIndex < numLanguages; ++languageIndex)
+                {
+                    std::string language = codes + offsets[languageIndex];
+                    StringUtils::ToLowerCase(language);
+                    
+                    if (language == deviceLanguage)
+                    {
+                        out_languageIndex = languageIndex;
+                        break;
+                    }
+                    else if (foundBaseLanguage == false && getBaseLanguage(language) == deviceBaseLanguage)
+                    {
+                        out_languageIndex = languageIndex;
+                        foundBaseLanguage = true;
+                    }
+                }
+                
+                return true;
+            }
+            //----------------------------------------------------
+            /// Builds the given resource from a compiled cstext
+            /// file, reading only the text for the active language.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The storage location.
+            /// @param The filepath.
+            /// @param [Out] The output resource.
+            ///
+            /// @return Whether or not the resource was built.
+            //----------------------------------------------------
+            bool LoadCompiledText(StorageLocation in_storageLocation, const std::string& in_filePath, LocalisedText* out_resource)
+            {
+                CSBinaryInputStream stream(in_storageLocation, in_filePath);
+                if (stream.IsValid() == false || stream.GetFileFormatId() != k_compiledFileFormatId || stream.GetFileFormatVersion() != k_compiledFileFormatVersion)
+                {
+                    CS_LOG_ERROR("Cannot read compiled cstext file: " + in_filePath);
+                    return false;
+                }
+                
+                CSBinaryChunkUPtr languageChunk = stream.ReadChunk("LANG");
+                u32 languageIndex = 0;
+                if (languageChunk == nullptr || SelectLanguage(languageChunk.get(), languageIndex) == false)
+                {
+                    CS_LOG_ERROR("Invalid language table in compiled cstext file: " + in_filePath);
+                    return false;
+                }
+                
+                CSBinaryChunkUPtr keyChunk = stream.ReadChunk("KEYS");
+                CSBinaryChunkUPtr textChunk = stream.ReadChunk("T" + ToString(languageIndex, 3, '0'));
+                if (keyChunk == nullptr || textChunk == nullptr)
+                {
+                    CS_LOG_ERROR("Missing chunk in compiled cstext file: " + in_filePath);
+                    return false;
+                }
+                
+                const u32 keyTableSize = keyChunk->GetSize();
+                const u32 textTableSize = textChunk->GetSize();
+                if (out_resource->Build(keyChunk->ClaimData(), keyTableSize, textChunk->ClaimData(), textTableSize) == false)
+                {
+                    CS_LOG_ERROR("Invalid text tables in compiled cstext file: " + in_filePath);
+                    return false;
+                }
+                
+                return true;
+            }
 			//----------------------------------------------------
 			/// Performs the heavy lifting for the 2 create methods
 			/// by loading the keys and text files into a single resource
@@ -60,6 +223,17 @@ namespace ChilliSource
 			{
                 LocalisedText* textResource((LocalisedText*)out_resource.get());
                 
+                if (IsCompiledTextFile(in_storageLocation, in_filePath) == true)
+                {
+                    const bool loaded = LoadCompiledText(in_storageLocation, in_filePath, textResource);
+                    textResource->SetLoadState(loaded == true ? Resource::LoadState::k_loaded : Resource::LoadState::k_failed);
+                    if(in_delegate != nullptr)
+                    {
+                        Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
+                    }
+                    return;
+                }
+                
                 Json::Value jsonRoot;
                 if (Core::JsonUtils::ReadJson(in_storageLocation, in_filePath, jsonRoot) == false)
                 {
@@ -104,8 +278,15 @@ namespace ChilliSource
                     map.emplace(member, jsonText[member].asString());
                 }
                 
-                textResource->Build(map);
-                textResource->SetLoadState(Resource::LoadState::k_loaded);
+                if (textResource->Build(map) == true)
+                {
+                    textResource->SetLoadState(Resource::LoadState::k_loaded);
+                }
+                else
+                {
+                    CS_LOG_ERROR("Cannot build localised text from cstext file: " + in_filePath);
+                    textResource->SetLoadState(Resource::LoadState::k_failed);
+                }
                 
                 if(in_delegate != nullptr)
                 {
@@ -37,6 +37,7 @@
 #include <ChilliSource/Core/Resource/ResourceProvider.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 
 #include <functional>
 #include <mutex>
@@ -170,6 +171,19 @@ namespace ChilliSource
             //-------------------------------------------------------------------------------------
             template <typename TResourceType> void RefreshResources();
             //------------------------------------------------------------------------------------
+            /// Force the reload of the resources of the given type that are currently cached
+            /// using the async loading path of the resource providers. Only the source of each
+            /// resource (storage location, file path and options) is required to do this. The
+            /// resources will be in the loading state until they have finished reloading, and
+            /// the given delegate will be called once all of them have reloaded or failed.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Delegate called on the main thread once all resources have been
+            /// refreshed. May be null.
+            //-------------------------------------------------------------------------------------
+            template <typename TResourceType> void RefreshResourcesAsync(const std::function<void()>& in_delegate = nullptr);
+            //------------------------------------------------------------------------------------
             /// Load the resource of given type from the file location. If the resource at this
             /// location has previously been loaded then the cached version will be returned in the
             /// delegate.
@@ -386,6 +400,8 @@ namespace ChilliSource
         //-------------------------------------------------------------------------------------
         template <typename TResourceType> std::shared_ptr<const TResourceType> ResourcePool::LoadResource(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsCSPtr<TResourceType>& in_options)
         {
+            CS_PROFILE_SCOPE("ResourcePool::LoadResource");
+            
             CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be loaded on the main thread - use LoadResourceAsync");
             CS_ASSERT(in_filePath.empty() == false, "Cannot load resource with no file path");
             
@@ -558,6 +574,86 @@ namespace ChilliSource
                 }
             }
         }
+        //------------------------------------------------------------------------------------
+        /// The resources to refresh are gathered first so that the lock is not held while
+        /// calling into the providers.
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> void ResourcePool::RefreshResourcesAsync(const std::function<void()>& in_delegate)
+        {
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be refreshed on the main thread");
+            
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
+            
+            if(itDescriptor == m_descriptors.end())
+            {
+                CS_LOG_ERROR("Failed to find resource provider for " + TResourceType::TypeName);
+                if(in_delegate != nullptr)
+                {
+                    in_delegate();
+                }
+                return;
+            }
+            
+            PoolDesc& desc(itDescriptor->second);
+            
+            std::vector<std::pair<ResourceProvider*, ResourceSPtr>> toRefresh;
+            for(auto& resourceEntry : desc.m_cachedResources)
+            {
+                const ResourceSPtr& resource(resourceEntry.second);
+                
+                if(resource->GetStorageLocation() != CSCore::StorageLocation::k_none)
+                {
+                    //Find a provider that can load this resource
+                    ResourceProvider* provider = FindProvider(resource->GetFilePath(), desc);
+                    if(provider == nullptr)
+                    {
+                        CS_LOG_ERROR("Failed to find resource provider for " + resource->GetName());
+                        continue;
+                    }
+                    
+                    toRefresh.push_back(std::make_pair(provider, resource));
+                }
+            }
+            
+            lock.unlock();
+            
+            if(toRefresh.empty() == true)
+            {
+                if(in_delegate != nullptr)
+                {
+                    in_delegate();
+                }
+                return;
+            }
+            
+            //The delegates are always called on the main thread so the count doesn't need to be atomic.
+            auto numRemaining = std::make_shared<u32>(u32(toRefresh.size()));
+            ResourceProvider::AsyncLoadDelegate refreshDelegate([=](const ResourceSPtr& in_resource)
+            {
+                if(in_resource->GetLoadState() != Resource::LoadState::k_loaded)
+                {
+                    CS_LOG_ERROR("Failed to refresh resource for " + in_resource->GetName());
+                }
+                
+                --(*numRemaining);
+                if(*numRemaining == 0 && in_delegate != nullptr)
+                {
+                    in_delegate();
+                }
+            });
+            
+            for(auto& entry : toRefresh)
+            {
+                ResourceProvider* provider = entry.first;
+                ResourceSPtr& resource(entry.second);
+                
+                resource->SetLoadState(Resource::LoadState::k_loading);
+                std::string deviceFilePath = Application::Get()->GetTaggedFilePathResolver()->ResolveFilePath(resource->GetStorageLocation(), resource->GetFilePath());
+                provider->CreateResourceFromFileAsync(resource->GetStorageLocation(), deviceFilePath, resource->GetOptions(), refreshDelegate, resource);
+            }
+        }
         //-------------------------------------------------------------------------------------
         //-------------------------------------------------------------------------------------
         template <typename TResourceType> void ResourcePool::LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate)
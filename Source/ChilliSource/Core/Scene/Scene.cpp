@@ -28,7 +28,9 @@
 
 #include <ChilliSource/Core/Scene/Scene.h>
 
-#include <algorithm>
+#include <ChilliSource/Core/Base/SmallObjectAllocator.h>
+
+#include <limits>
 
 namespace ChilliSource
 {
@@ -60,10 +62,15 @@ namespace ChilliSource
             CS_ASSERT(m_entitiesActive == false, "Received resume entities event while entities are already active.")
             m_entitiesActive = true;
             
+            BeginEntityIteration();
             for(u32 i = 0; i < m_entities.size(); ++i)
 			{
-                m_entities[i]->OnResume();
+                if (m_entities[i] != nullptr)
+                {
+                    m_entities[i]->OnResume();
+                }
             }
+            EndEntityIteration();
         }
         //-------------------------------------------------------
 		//-------------------------------------------------------
@@ -72,28 +79,53 @@ namespace ChilliSource
             CS_ASSERT(m_entitiesForegrounded == false, "Received foreground entities event while entities are already foregrounded.")
             m_entitiesForegrounded = true;
             
+            BeginEntityIteration();
             for(u32 i = 0; i<m_entities.size(); ++i)
 			{
-                m_entities[i]->OnForeground();
+                if (m_entities[i] != nullptr)
+                {
+                    m_entities[i]->OnForeground();
+                }
             }
+            EndEntityIteration();
 		}
         //-------------------------------------------------------
 		//-------------------------------------------------------
 		void Scene::UpdateEntities(f32 in_timeSinceLastUpdate)
 		{
-            for(u32 i = 0; i < m_entities.size(); ++i)
-			{
-                m_entities[i]->OnUpdate(in_timeSinceLastUpdate);
+            BeginEntityIteration();
+            //the lists can grow while updating, so they're re-fetched each iteration rather than referenced.
+            for (u32 listIndex = 0; listIndex < m_updateLists.size(); ++listIndex)
+            {
+                for (u32 i = 0; i < m_updateLists[listIndex].m_components.size(); ++i)
+                {
+                    Component* component = m_updateLists[listIndex].m_components[i];
+                    if (component != nullptr)
+                    {
+                        component->OnUpdate(in_timeSinceLastUpdate);
+                    }
+                }
             }
+            EndEntityIteration();
 		}
         //-------------------------------------------------------
 		//-------------------------------------------------------
 		void Scene::FixedUpdateEntities(f32 in_fixedTimeSinceLastUpdate)
 		{
-            for(u32 i=0; i<m_entities.size(); ++i)
-			{
-                m_entities[i]->OnFixedUpdate(in_fixedTimeSinceLastUpdate);
+            BeginEntityIteration();
+            //the lists can grow while updating, so they're re-fetched each iteration rather than referenced.
+            for (u32 listIndex = 0; listIndex < m_fixedUpdateLists.size(); ++listIndex)
+            {
+                for (u32 i = 0; i < m_fixedUpdateLists[listIndex].m_components.size(); ++i)
+                {
+                    Component* component = m_fixedUpdateLists[listIndex].m_components[i];
+                    if (component != nullptr)
+                    {
+                        component->OnFixedUpdate(in_fixedTimeSinceLastUpdate);
+                    }
+                }
             }
+            EndEntityIteration();
 		}
         //-------------------------------------------------------
 		//-------------------------------------------------------
@@ -102,10 +134,15 @@ namespace ChilliSource
             CS_ASSERT(m_entitiesForegrounded == true, "Received background entities event while entities are already backgrounded.")
             m_entitiesForegrounded = false;
             
-            for (auto it = m_entities.rbegin(); it != m_entities.rend(); ++it)
+            BeginEntityIteration();
+            for (u32 i = u32(m_entities.size()); i > 0; --i)
             {
-                (*it)->OnBackground();
+                if (m_entities[i - 1] != nullptr)
+                {
+                    m_entities[i - 1]->OnBackground();
+                }
             }
+            EndEntityIteration();
 		}
         //-------------------------------------------------------
 		//-------------------------------------------------------
@@ -114,10 +151,15 @@ namespace ChilliSource
             CS_ASSERT(m_entitiesActive == true, "Received suspend entities event while entities are already suspended.")
             m_entitiesActive = false;
             
-            for (auto it = m_entities.rbegin(); it != m_entities.rend(); ++it)
+            BeginEntityIteration();
+            for (u32 i = u32(m_entities.size()); i > 0; --i)
             {
-                (*it)->OnSuspend();
+                if (m_entities[i - 1] != nullptr)
+                {
+                    m_entities[i - 1]->OnSuspend();
+                }
             }
+            EndEntityIteration();
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
@@ -129,8 +171,25 @@ namespace ChilliSource
             CS_ASSERT(m_entities.size() < static_cast<std::vector<EntitySPtr>::size_type>(std::numeric_limits<u32>::max()), "There are too many entities in the scene. It cannot exceed "
                       + CSCore::ToString(std::numeric_limits<u32>::max()) + ".");
             
+            u32 slotIndex = 0;
+            if (m_freeEntitySlots.empty() == false)
+            {
+                slotIndex = m_freeEntitySlots.back();
+                m_freeEntitySlots.pop_back();
+            }
+            else
+            {
+                slotIndex = u32(m_entitySlots.size());
+                m_entitySlots.push_back(EntitySlot());
+            }
+            
+            EntitySlot& slot = m_entitySlots[slotIndex];
+            slot.m_entityIndex = u32(m_entities.size());
+            slot.m_inUse = true;
+            
 			m_entities.push_back(in_entity);
 
+            in_entity->m_sceneSlotIndex = slotIndex;
 			in_entity->SetScene(this);
             in_entity->OnAddedToScene();
             
@@ -145,29 +204,26 @@ namespace ChilliSource
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
-		void Scene::RemoveAllEntities()
+		void Scene::RemoveAllEntities(bool in_releaseUnusedMemory)
 		{
+            //removing a root entity also removes its children.
+            BeginEntityIteration();
 			for(u32 i=0; i<m_entities.size(); ++i)
 			{
                 Entity* ent = m_entities[i].get();
                 
-                if (ent->GetParent() == nullptr)
+                if (ent != nullptr && ent->GetParent() == nullptr)
                 {
-                    if (m_entitiesActive == true)
-                    {
-                        if (m_entitiesForegrounded == true)
-                        {
-                            ent->OnBackground();
-                        }
-                        ent->OnSuspend();
-                    }
-                    
-                    ent->OnRemovedFromScene();
-                    ent->SetScene(nullptr);
+                    Remove(ent);
                 }
 			}
+            EndEntityIteration();
             
-            m_entities.clear();
+            //memory is only released if the entities are no longer referenced elsewhere.
+            if (in_releaseUnusedMemory == true)
+            {
+                SmallObjectAllocator::ReleaseUnusedMemory();
+            }
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
@@ -175,6 +231,35 @@ namespace ChilliSource
 		{
 			return m_entities;
 		}
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        EntityHandle Scene::GetEntityHandle(const Entity* in_entity) const
+        {
+            CS_ASSERT(in_entity != nullptr, "Cannot get the handle of a null entity.");
+            CS_ASSERT(in_entity->m_scene == this, "Cannot get the handle of an entity in a different scene.");
+            
+            EntityHandle handle;
+            handle.m_index = in_entity->m_sceneSlotIndex;
+            handle.m_generation = m_entitySlots[in_entity->m_sceneSlotIndex].m_generation;
+            return handle;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        Entity* Scene::GetEntity(const EntityHandle& in_handle) const
+        {
+            if (in_handle.m_index >= m_entitySlots.size())
+            {
+                return nullptr;
+            }
+            
+            const EntitySlot& slot = m_entitySlots[in_handle.m_index];
+            if (slot.m_inUse == false || slot.m_generation != in_handle.m_generation)
+            {
+                return nullptr;
+            }
+            
+            return m_entities[slot.m_entityIndex].get();
+        }
         //------------------------------------------------------
 		//------------------------------------------------------
 		void Scene::SetClearColour(const Core::Colour& in_colour)
@@ -218,27 +303,197 @@ namespace ChilliSource
             CS_ASSERT(in_entity->GetScene() == this, "Cannot add an entity without a pre-exisitng scene");
             CS_ASSERT((in_entity->GetParent() == nullptr || in_entity->GetParent()->GetScene() == this), "Cannot remove an entity from a different scene than it's parent.");
             
-            SharedEntityList::iterator it = std::find_if(m_entities.begin(), m_entities.end(), [in_entity](const EntitySPtr& in_entityInList)
+            const u32 slotIndex = in_entity->m_sceneSlotIndex;
+            CS_ASSERT(slotIndex < m_entitySlots.size() && m_entitySlots[slotIndex].m_inUse == true, "Entity is not in the scene.");
+            
+            if (m_entitiesActive == true)
             {
-                return in_entityInList.get() == in_entity;
-            });
+                if (m_entitiesForegrounded == true)
+                {
+                    in_entity->OnBackground();
+                }
+                in_entity->OnSuspend();
+            }
+            
+            in_entity->OnRemovedFromScene();
+            in_entity->SetScene(nullptr);
+            
+            //The slot index is re-read as removing children may have moved this entity in the list.
+            EntitySlot& slot = m_entitySlots[slotIndex];
+            const u32 entityIndex = slot.m_entityIndex;
+            slot.m_inUse = false;
+            slot.m_generation++;
+            m_freeEntitySlots.push_back(slotIndex);
             
-            if(it != m_entities.end())
+            if (m_entityIterationDepth > 0)
+            {
+                //the entity is kept alive until the iteration has finished as it may still be in use.
+                m_removedEntities.push_back(std::move(m_entities[entityIndex]));
+                m_entities[entityIndex] = nullptr;
+            }
+            else
             {
-                if (m_entitiesActive == true)
+                if (entityIndex != m_entities.size() - 1)
                 {
-                    if (m_entitiesForegrounded == true)
+                    m_entities[entityIndex] = std::move(m_entities.back());
+                    m_entitySlots[m_entities[entityIndex]->m_sceneSlotIndex].m_entityIndex = entityIndex;
+                }
+                m_entities.pop_back();
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::BeginEntityIteration()
+        {
+            ++m_entityIterationDepth;
+        }
+        //--------------------------------------------------------------------------------------------------
+        /// Compaction preserves the relative order of the remaining entities, so entities added during
+        /// the iteration are still updated after those that were already in the scene.
+        //--------------------------------------------------------------------------------------------------
+        void Scene::EndEntityIteration()
+        {
+            CS_ASSERT(m_entityIterationDepth > 0, "Mismatched entity iteration.");
+            
+            --m_entityIterationDepth;
+            if (m_entityIterationDepth > 0)
+            {
+                return;
+            }
+            
+            if (m_hasRemovedComponents == true)
+            {
+                m_hasRemovedComponents = false;
+                CompactUpdateLists(m_updateLists, &Component::m_updateLocation);
+                CompactUpdateLists(m_fixedUpdateLists, &Component::m_fixedUpdateLocation);
+            }
+            
+            if (m_removedEntities.empty() == true)
+            {
+                return;
+            }
+            
+            u32 numEntities = 0;
+            for (u32 i = 0; i < m_entities.size(); ++i)
+            {
+                if (m_entities[i] != nullptr)
+                {
+                    if (numEntities != i)
                     {
-                        in_entity->OnBackground();
+                        m_entities[numEntities] = std::move(m_entities[i]);
+                        m_entitySlots[m_entities[numEntities]->m_sceneSlotIndex].m_entityIndex = numEntities;
                     }
-                    in_entity->OnSuspend();
+                    ++numEntities;
                 }
+            }
+            m_entities.resize(numEntities);
+            
+            //releasing the entities may cause further removals, so the list is swapped out first.
+            SharedEntityList removedEntities;
+            removedEntities.swap(m_removedEntities);
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::AddComponentToUpdateLists(Component* in_component)
+        {
+            CS_ASSERT(in_component->m_updateLocation.m_isInList == false && in_component->m_fixedUpdateLocation.m_isInList == false, "Component is already in the update lists.");
+            
+            if (in_component->RequiresUpdate() == true)
+            {
+                AddToUpdateList(in_component, m_updateLists, in_component->m_updateLocation);
+            }
+            
+            if (in_component->RequiresFixedUpdate() == true)
+            {
+                AddToUpdateList(in_component, m_fixedUpdateLists, in_component->m_fixedUpdateLocation);
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::RemoveComponentFromUpdateLists(Component* in_component)
+        {
+            const bool defer = (m_entityIterationDepth > 0);
+            
+            if (in_component->m_updateLocation.m_isInList == true)
+            {
+                RemoveFromUpdateList(m_updateLists, defer, in_component->m_updateLocation, &Component::m_updateLocation);
+            }
+            
+            if (in_component->m_fixedUpdateLocation.m_isInList == true)
+            {
+                RemoveFromUpdateList(m_fixedUpdateLists, defer, in_component->m_fixedUpdateLocation, &Component::m_fixedUpdateLocation);
+            }
+            
+            m_hasRemovedComponents = (m_hasRemovedComponents == true || defer == true);
+        }
+        //--------------------------------------------------------------------------------------------------
+        /// There are typically few enough component types that a linear search is faster than a map.
+        //--------------------------------------------------------------------------------------------------
+        void Scene::AddToUpdateList(Component* in_component, std::vector<ComponentUpdateList>& inout_lists, Component::UpdateListLocation& out_location)
+        {
+            const InterfaceIDType componentType = in_component->GetInterfaceID();
+            
+            u32 listIndex = 0;
+            while (listIndex < inout_lists.size() && inout_lists[listIndex].m_componentType != componentType)
+            {
+                ++listIndex;
+            }
+            
+            if (listIndex == inout_lists.size())
+            {
+                inout_lists.push_back(ComponentUpdateList());
+                inout_lists.back().m_componentType = componentType;
+            }
+            
+            std::vector<Component*>& components = inout_lists[listIndex].m_components;
+            out_location.m_listIndex = listIndex;
+            out_location.m_index = u32(components.size());
+            out_location.m_isInList = true;
+            components.push_back(in_component);
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::RemoveFromUpdateList(std::vector<ComponentUpdateList>& inout_lists, bool in_defer, Component::UpdateListLocation& inout_location, Component::UpdateListLocation Component::* in_locationMember)
+        {
+            std::vector<Component*>& components = inout_lists[inout_location.m_listIndex].m_components;
+            
+            if (in_defer == true)
+            {
+                components[inout_location.m_index] = nullptr;
+            }
+            else
+            {
+                if (inout_location.m_index != components.size() - 1)
+                {
+                    Component* moved = components.back();
+                    components[inout_location.m_index] = moved;
+                    (moved->*in_locationMember).m_index = inout_location.m_index;
+                }
+                components.pop_back();
+            }
+            
+            inout_location = Component::UpdateListLocation();
+        }
+        //--------------------------------------------------------------------------------------------------
+        /// Compaction preserves the order of the remaining components.
+        //--------------------------------------------------------------------------------------------------
+        void Scene::CompactUpdateLists(std::vector<ComponentUpdateList>& inout_lists, Component::UpdateListLocation Component::* in_locationMember)
+        {
+            for (auto& list : inout_lists)
+            {
+                std::vector<Component*>& components = list.m_components;
                 
-                in_entity->OnRemovedFromScene();
-                in_entity->SetScene(nullptr);
-                
-                it->swap(m_entities.back());
-                m_entities.pop_back();
+                u32 numComponents = 0;
+                for (u32 i = 0; i < components.size(); ++i)
+                {
+                    if (components[i] != nullptr)
+                    {
+                        components[numComponents] = components[i];
+                        (components[numComponents]->*in_locationMember).m_index = numComponents;
+                        ++numComponents;
+                    }
+                }
+                components.resize(numComponents);
             }
         }
 		//--------------------------------------------------------------------------------------------------
@@ -31,7 +31,9 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Entity/Component.h>
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Entity/EntityHandle.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 #include <ChilliSource/Core/System/StateSystem.h>
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
@@ -44,6 +46,17 @@ namespace ChilliSource
         /// Holds the entities that form the scene. Entities will be updated from the scene and the
         /// scene is queried by other systems for render components etc.
         ///
+        /// Each entity in the scene occupies a slot, allowing it to be removed in constant time and
+        /// referred to using a generation checked EntityHandle. Entities removed while the scene is
+        /// iterating its entities, for example during the update, remain alive until the iteration
+        /// has finished.
+        ///
+        /// Components are not updated through their entities. Instead, the scene keeps a contiguous
+        /// list per component type for each of the update and fixed update, containing only the
+        /// components which require it. Each list is updated in turn, so components of the same type
+        /// are updated together. The order in which types are updated is the order in which they were
+        /// first added to the scene.
+        ///
         /// @author S Downie
 		//--------------------------------------------------------------------------------------------------
 		class Scene final : public StateSystem
@@ -88,17 +101,49 @@ namespace ChilliSource
 			//-------------------------------------------------------
 			void Add(const EntitySPtr& in_entity);
             //-------------------------------------------------------
-			/// Remove all the entities from the scene
+			/// Remove all the entities from the scene. Optionally, any
+            /// pooled memory which is no longer in use by entities,
+            /// components or anything else allocated from the small
+            /// object allocator can then be returned to the heap. This
+            /// is useful when unloading a level, but means that memory
+            /// will have to be allocated again when the scene is next
+            /// populated.
             ///
             /// @author S Downie
+            ///
+            /// @param Whether or not to release unused pooled memory
+            /// after the entities have been removed. Defaults to false.
 			//-------------------------------------------------------
-			void RemoveAllEntities();
+			void RemoveAllEntities(bool in_releaseUnusedMemory = false);
 			//-------------------------------------------------------
             /// @author A Mackie
             ///
 			/// @return the list of all the entities in the scene.
+            /// Entities removed while the scene is iterating over
+            /// its entities are left as null entries until the
+            /// iteration has finished.
 			//-------------------------------------------------------
 			const SharedEntityList& GetEntities() const;
+            //-------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param An entity in this scene.
+            ///
+            /// @return A handle to the entity which can be used to
+            /// safely refer to it after it has been removed.
+            //-------------------------------------------------------
+            EntityHandle GetEntityHandle(const Entity* in_entity) const;
+            //-------------------------------------------------------
+            /// Resolves the given handle in constant time.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The handle.
+            ///
+            /// @return The entity the handle refers to, or null if
+            /// it has since been removed from the scene.
+            //-------------------------------------------------------
+            Entity* GetEntity(const EntityHandle& in_handle) const;
             //------------------------------------------------------
 			/// @author S Downie
 			///
@@ -174,6 +219,11 @@ namespace ChilliSource
 			{
 				for(SharedEntityList::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
 				{
+					if (*it == nullptr)
+					{
+						continue;
+					}
+					
 					(*it)->GetComponents<TComponentType>(out_components);
 				}
 			}
@@ -190,6 +240,11 @@ namespace ChilliSource
 			{
 				for(SharedEntityList::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
 				{
+					if (*it == nullptr)
+					{
+						continue;
+					}
+					
 					(*it)->GetComponents<TComponentType1, TComponentType2>(out_components1, out_components2);
 				}
 			}
@@ -207,13 +262,40 @@ namespace ChilliSource
 			{
 				for(SharedEntityList::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
 				{
+					if (*it == nullptr)
+					{
+						continue;
+					}
+					
 					(*it)->GetComponents<TComponentType1, TComponentType2, TComponentType3>(out_components1, out_components2, out_components3);
 				}
 			}
             
         private:
             friend class Entity;
-            
+            //-------------------------------------------------------
+            /// Maps a handle to the entity's position in the entity
+            /// list.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------
+            struct EntitySlot final
+            {
+                u32 m_entityIndex = 0;
+                u32 m_generation = 0;
+                bool m_inUse = false;
+            };
+            //-------------------------------------------------------
+            /// A list of components of a single type which require
+            /// either an update or a fixed update.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------
+            struct ComponentUpdateList final
+            {
+                InterfaceIDType m_componentType = 0;
+                std::vector<Component*> m_components;
+            };
             //-------------------------------------------------------
             /// Private to enforce use of factory method
             ///
@@ -221,6 +303,80 @@ namespace ChilliSource
             //-------------------------------------------------------
             Scene();
             //-------------------------------------------------------
+            /// Adds the component to the update and fixed update
+            /// lists, if it requires them. This is called by the
+            /// owning entity when the component enters the scene.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The component.
+            //-------------------------------------------------------
+            void AddComponentToUpdateLists(Component* in_component);
+            //-------------------------------------------------------
+            /// Removes the component from any update lists it is in.
+            /// This is called by the owning entity when the
+            /// component leaves the scene.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The component.
+            //-------------------------------------------------------
+            void RemoveComponentFromUpdateLists(Component* in_component);
+            //-------------------------------------------------------
+            /// Adds the component to the list for its type in the
+            /// given set of lists, creating the list if needed.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The component.
+            /// @param [In/Out] The set of lists.
+            /// @param [Out] The location of the component.
+            //-------------------------------------------------------
+            static void AddToUpdateList(Component* in_component, std::vector<ComponentUpdateList>& inout_lists, Component::UpdateListLocation& out_location);
+            //-------------------------------------------------------
+            /// Removes the component at the given location from the
+            /// given set of lists. If the scene is iterating the
+            /// entry is set to null, otherwise it is removed with a
+            /// swap and pop.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param [In/Out] The set of lists.
+            /// @param Whether or not the removal should be deferred.
+            /// @param [In/Out] The location of the component.
+            /// @param The location member of a component which
+            /// should be updated if it is moved.
+            //-------------------------------------------------------
+            static void RemoveFromUpdateList(std::vector<ComponentUpdateList>& inout_lists, bool in_defer, Component::UpdateListLocation& inout_location, Component::UpdateListLocation Component::* in_locationMember);
+            //-------------------------------------------------------
+            /// Removes any null entries left in the given set of
+            /// lists by deferred removals.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param [In/Out] The set of lists.
+            /// @param The location member of a component which
+            /// should be updated if it is moved.
+            //-------------------------------------------------------
+            static void CompactUpdateLists(std::vector<ComponentUpdateList>& inout_lists, Component::UpdateListLocation Component::* in_locationMember);
+            //-------------------------------------------------------
+            /// Marks the start of an iteration over the entity list.
+            /// Until the matching EndEntityIteration() call,
+            /// removed entities are replaced with null rather than
+            /// being removed from the list. Iterations can be nested.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------
+            void BeginEntityIteration();
+            //-------------------------------------------------------
+            /// Marks the end of an iteration over the entity list.
+            /// If this was the outermost iteration, entities removed
+            /// during it are released and the list is compacted.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------
+            void EndEntityIteration();
+            //-------------------------------------------------------
             /// Remove the entity from the scene
             ///
             /// @author S Downie
@@ -232,6 +388,13 @@ namespace ChilliSource
 		private:
 			
 			SharedEntityList m_entities;
+            std::vector<EntitySlot> m_entitySlots;
+            std::vector<u32> m_freeEntitySlots;
+            SharedEntityList m_removedEntities;
+            u32 m_entityIterationDepth = 0;
+            std::vector<ComponentUpdateList> m_updateLists;
+            std::vector<ComponentUpdateList> m_fixedUpdateLists;
+            bool m_hasRemovedComponents = false;
             Colour m_clearColour;
             bool m_entitiesActive = false;
             bool m_entitiesForegrounded = false;
@@ -59,6 +59,15 @@ namespace ChilliSource
                 system->OnInit();
             }
             
+            for(auto& system : m_systems)
+            {
+                StateSystem* stateSystem = system.get();
+                m_fixedUpdateGraph.AddSystem(stateSystem, stateSystem->GetFixedUpdateAccess(), [=](f32 in_deltaTime)
+                {
+                    stateSystem->OnFixedUpdate(in_deltaTime);
+                });
+            }
+            
             OnInit();
         }
         //-----------------------------------------
@@ -104,10 +113,7 @@ namespace ChilliSource
         //-----------------------------------------
         void State::FixedUpdate(f32 in_fixedTimeSinceLastUpdate)
         {
-            for(auto& system : m_systems)
-            {
-                system->OnFixedUpdate(in_fixedTimeSinceLastUpdate);
-            }
+            m_fixedUpdateGraph.Execute(in_fixedTimeSinceLastUpdate, Application::Get()->IsConcurrentFixedUpdateEnabled());
             
             m_scene->FixedUpdateEntities(in_fixedTimeSinceLastUpdate);
             
@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/System/StateSystem.h>
+#include <ChilliSource/Core/System/SystemUpdateGraph.h>
 
 #include <vector>
 
@@ -331,6 +332,7 @@ namespace ChilliSource
         private:
 			
             std::vector<StateSystemUPtr> m_systems;
+            SystemUpdateGraph m_fixedUpdateGraph;
             
 			Scene* m_scene = nullptr;
             UI::Canvas* m_canvas = nullptr;
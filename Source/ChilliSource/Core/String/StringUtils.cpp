@@ -35,6 +35,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <limits>
 
 namespace ChilliSource
 {
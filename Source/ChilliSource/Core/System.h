@@ -32,5 +32,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Core/System/StateSystem.h>
+#include <ChilliSource/Core/System/SystemAccess.h>
+#include <ChilliSource/Core/System/SystemUpdateGraph.h>
 
 #endif
\ No newline at end of file
@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/QueryableInterface.h>
+#include <ChilliSource/Core/System/SystemAccess.h>
 
 namespace ChilliSource
 {
@@ -103,7 +104,8 @@ namespace ChilliSource
             /// An update method called at a fixed interval.
             /// The time between fixed updates is defined in
             /// Application. System update is called in the
-            /// order the systems were created.
+            /// order the systems were created, unless the
+            /// system declares concurrent access.
             ///
             /// @author Ian Copland
             ///
@@ -111,6 +113,20 @@ namespace ChilliSource
             //------------------------------------------------
             virtual void OnFixedUpdate(f32 in_deltaTime) {};
             //------------------------------------------------
+            /// Declares the systems accessed during the fixed
+            /// update. Systems which declare concurrent access
+            /// may have their fixed update called on a worker
+            /// thread, at the same time as other systems which
+            /// they do not conflict with. This is called once,
+            /// after all systems have been initialised.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The fixed update access. By default the
+            /// system is updated serially on the main thread.
+            //------------------------------------------------
+            virtual SystemAccess GetFixedUpdateAccess() const { return SystemAccess(); };
+            //------------------------------------------------
             /// Called when the application transitions from
             /// being active app into the background. This
             /// is also called when the application is
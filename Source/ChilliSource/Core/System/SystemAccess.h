@@ -0,0 +1,69 @@
+//
+//  SystemAccess.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_SYSTEM_SYSTEMACCESS_H_
+#define _CHILLISOURCE_CORE_SYSTEM_SYSTEMACCESS_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/QueryableInterface.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //-------------------------------------------------------
+        /// Describes the data a system accesses during its fixed
+        /// update, allowing independent systems to be updated
+        /// concurrently on the task scheduler.
+        ///
+        /// By default a system is not concurrent: it is updated
+        /// on the main thread, after every system created before
+        /// it and before every system created after it. A
+        /// concurrent system is updated on any thread, and is
+        /// only ordered against the systems it conflicts with. A
+        /// system always writes itself; in addition it lists the
+        /// interface Ids of the other systems it reads and writes.
+        /// Two systems conflict if either writes something the
+        /// other reads or writes. Systems which only read the
+        /// same thing do not conflict.
+        ///
+        /// @author Ian Copland
+        //-------------------------------------------------------
+        struct SystemAccess final
+        {
+            bool m_isConcurrent = false;
+            std::vector<InterfaceIDType> m_reads;
+            std::vector<InterfaceIDType> m_writes;
+        };
+    }
+}
+
+#endif
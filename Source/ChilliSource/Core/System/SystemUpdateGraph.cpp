@@ -0,0 +1,324 @@
+//
+//  SystemUpdateGraph.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/System/SystemUpdateGraph.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            //------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The list of interface Ids.
+            /// @param The interface Id to look for.
+            ///
+            /// @return Whether or not the list contains the Id.
+            //------------------------------------------------
+            bool Contains(const std::vector<InterfaceIDType>& in_interfaceIds, InterfaceIDType in_interfaceId)
+            {
+                return (std::find(in_interfaceIds.begin(), in_interfaceIds.end(), in_interfaceId) != in_interfaceIds.end());
+            }
+        }
+        //------------------------------------------------
+        //------------------------------------------------
+        void SystemUpdateGraph::AddSystem(const QueryableInterface* in_system, const SystemAccess& in_access, const UpdateDelegate& in_update)
+        {
+            CS_ASSERT(in_system != nullptr, "Cannot add a null system to the update graph.");
+            CS_ASSERT(in_update != nullptr, "Cannot add a system with a null update delegate to the update graph.");
+            
+            Node node;
+            node.m_system = in_system;
+            node.m_access = in_access;
+            node.m_update = in_update;
+            m_nodes.push_back(std::move(node));
+            
+            m_isBuilt = false;
+        }
+        //------------------------------------------------
+        //------------------------------------------------
+        void SystemUpdateGraph::Clear()
+        {
+            m_nodes.clear();
+            m_isBuilt = false;
+        }
+        //------------------------------------------------
+        //------------------------------------------------
+        u32 SystemUpdateGraph::GetNumSystems() const
+        {
+            return u32(m_nodes.size());
+        }
+        //------------------------------------------------
+        /// The main thread takes part in the update rather
+        /// than just waiting, so the update always completes
+        /// even if the thread pool is busy with other tasks.
+        /// It prefers systems which may only be updated on the
+        /// main thread, leaving concurrent systems to the
+        /// workers. Execution returns once every node has been
+        /// updated and no worker is still running one. Workers
+        /// which are still queued at that point don't hold up
+        /// the update; when they eventually start they find the
+        /// execution complete and return without touching the
+        /// graph.
+        //------------------------------------------------
+        void SystemUpdateGraph::Execute(f32 in_deltaTime, bool in_concurrent)
+        {
+            if (m_isBuilt == false)
+            {
+                Build();
+            }
+            
+            if (in_concurrent == false || m_hasConcurrentNodes == false)
+            {
+                for (const auto& node : m_nodes)
+                {
+                    CS_PROFILE_SCOPE("System Fixed Update");
+                    node.m_update(in_deltaTime);
+                }
+                
+                return;
+            }
+            
+            auto state = std::make_shared<ExecutionState>();
+            state->m_deltaTime = in_deltaTime;
+            state->m_numNodes = u32(m_nodes.size());
+            state->m_remainingDependencies.resize(m_nodes.size());
+            
+            u32 numConcurrentRoots = 0;
+            for (u32 i = 0; i < m_nodes.size(); ++i)
+            {
+                state->m_remainingDependencies[i] = m_nodes[i].m_numDependencies;
+                if (m_nodes[i].m_numDependencies == 0)
+                {
+                    state->m_readyNodes.push_back(i);
+                    if (m_nodes[i].m_access.m_isConcurrent == true)
+                    {
+                        ++numConcurrentRoots;
+                    }
+                }
+            }
+            
+            for (u32 i = 0; i < numConcurrentRoots; ++i)
+            {
+                ScheduleWorker(state);
+            }
+            
+            std::unique_lock<std::mutex> lock(state->m_mutex);
+            while (state->m_numCompletedNodes < state->m_numNodes || state->m_numRunningWorkers > 0)
+            {
+                if (state->m_readyNodes.empty() == false)
+                {
+                    auto it = std::find_if(state->m_readyNodes.begin(), state->m_readyNodes.end(), [&](u32 in_nodeIndex)
+                    {
+                        return (m_nodes[in_nodeIndex].m_access.m_isConcurrent == false);
+                    });
+                    
+                    if (it == state->m_readyNodes.end())
+                    {
+                        it = state->m_readyNodes.begin();
+                    }
+                    
+                    u32 nodeIndex = *it;
+                    state->m_readyNodes.erase(it);
+                    
+                    lock.unlock();
+                    RunNode(state, nodeIndex);
+                    lock.lock();
+                }
+                else
+                {
+                    state->m_condition.wait(lock);
+                }
+            }
+        }
+        //------------------------------------------------
+        /// Only the direct dependencies on earlier nodes are
+        /// needed, as the order in which systems were added
+        /// is preserved between any two that conflict.
+        //------------------------------------------------
+        void SystemUpdateGraph::Build()
+        {
+            m_hasConcurrentNodes = false;
+            for (auto& node : m_nodes)
+            {
+                node.m_dependents.clear();
+                node.m_numDependencies = 0;
+                
+                if (node.m_access.m_isConcurrent == true)
+                {
+                    m_hasConcurrentNodes = true;
+                }
+            }
+            
+            for (u32 later = 0; later < m_nodes.size(); ++later)
+            {
+                for (u32 earlier = 0; earlier < later; ++earlier)
+                {
+                    if (Conflicts(m_nodes[earlier], m_nodes[later]) == true)
+                    {
+                        m_nodes[earlier].m_dependents.push_back(later);
+                        m_nodes[later].m_numDependencies++;
+                    }
+                }
+            }
+            
+            m_isBuilt = true;
+        }
+        //------------------------------------------------
+        //------------------------------------------------
+        bool SystemUpdateGraph::Conflicts(const Node& in_a, const Node& in_b) const
+        {
+            if (in_a.m_access.m_isConcurrent == false || in_b.m_access.m_isConcurrent == false)
+            {
+                return true;
+            }
+            
+            //a system always writes itself, in addition to anything it declares.
+            auto writes = [](const Node& in_node, InterfaceIDType in_interfaceId)
+            {
+                return (in_node.m_system->IsA(in_interfaceId) == true || Contains(in_node.m_access.m_writes, in_interfaceId) == true);
+            };
+            
+            for (auto interfaceId : in_a.m_access.m_writes)
+            {
+                if (writes(in_b, interfaceId) == true || Contains(in_b.m_access.m_reads, interfaceId) == true)
+                {
+                    return true;
+                }
+            }
+            
+            for (auto interfaceId : in_b.m_access.m_writes)
+            {
+                if (writes(in_a, interfaceId) == true || Contains(in_a.m_access.m_reads, interfaceId) == true)
+                {
+                    return true;
+                }
+            }
+            
+            for (auto interfaceId : in_a.m_access.m_reads)
+            {
+                if (in_b.m_system->IsA(interfaceId) == true)
+                {
+                    return true;
+                }
+            }
+            
+            for (auto interfaceId : in_b.m_access.m_reads)
+            {
+                if (in_a.m_system->IsA(interfaceId) == true)
+                {
+                    return true;
+                }
+            }
+            
+            return false;
+        }
+        //------------------------------------------------
+        //------------------------------------------------
+        void SystemUpdateGraph::RunNode(const ExecutionStateSPtr& in_state, u32 in_nodeIndex)
+        {
+            {
+                CS_PROFILE_SCOPE("System Fixed Update");
+                m_nodes[in_nodeIndex].m_update(in_state->m_deltaTime);
+            }
+            
+            u32 numConcurrentReady = 0;
+            
+            std::unique_lock<std::mutex> lock(in_state->m_mutex);
+            
+            for (auto dependent : m_nodes[in_nodeIndex].m_dependents)
+            {
+                if (--in_state->m_remainingDependencies[dependent] == 0)
+                {
+                    in_state->m_readyNodes.push_back(dependent);
+                    if (m_nodes[dependent].m_access.m_isConcurrent == true)
+                    {
+                        ++numConcurrentReady;
+                    }
+                }
+            }
+            
+            ++in_state->m_numCompletedNodes;
+            in_state->m_condition.notify_all();
+            
+            lock.unlock();
+            for (u32 i = 0; i < numConcurrentReady; ++i)
+            {
+                ScheduleWorker(in_state);
+            }
+        }
+        //------------------------------------------------
+        /// The graph is only guaranteed to exist while the
+        /// execution is incomplete, so a worker must check this
+        /// before touching it. Once a worker has claimed a node
+        /// it counts as running, which keeps Execute() waiting
+        /// until it is done.
+        //------------------------------------------------
+        void SystemUpdateGraph::ScheduleWorker(const ExecutionStateSPtr& in_state)
+        {
+            ExecutionStateSPtr state = in_state;
+            Application::Get()->GetTaskScheduler()->ScheduleTask([this, state]()
+            {
+                std::unique_lock<std::mutex> lock(state->m_mutex);
+                
+                if (state->m_numCompletedNodes == state->m_numNodes)
+                {
+                    return;
+                }
+                
+                auto it = std::find_if(state->m_readyNodes.begin(), state->m_readyNodes.end(), [&](u32 in_nodeIndex)
+                {
+                    return (m_nodes[in_nodeIndex].m_access.m_isConcurrent == true);
+                });
+                
+                if (it != state->m_readyNodes.end())
+                {
+                    u32 nodeIndex = *it;
+                    state->m_readyNodes.erase(it);
+                    ++state->m_numRunningWorkers;
+                    
+                    lock.unlock();
+                    RunNode(state, nodeIndex);
+                    lock.lock();
+                    
+                    --state->m_numRunningWorkers;
+                    state->m_condition.notify_all();
+                }
+            });
+        }
+    }
+}
@@ -0,0 +1,191 @@
+//
+//  SystemUpdateGraph.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_SYSTEM_SYSTEMUPDATEGRAPH_H_
+#define _CHILLISOURCE_CORE_SYSTEM_SYSTEMUPDATEGRAPH_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/System/SystemAccess.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //-------------------------------------------------------
+        /// A graph of system fixed updates, ordered by the access
+        /// each system declares. Whenever two systems conflict
+        /// the one added first is updated first. Otherwise,
+        /// concurrent systems are updated in parallel on the task
+        /// scheduler while the main thread updates the others.
+        /// If serial execution is requested, every system is
+        /// updated on the main thread in the order it was added,
+        /// which is deterministic and useful for debugging.
+        ///
+        /// The graph must only be built and executed on the main
+        /// thread.
+        ///
+        /// @author Ian Copland
+        //-------------------------------------------------------
+        class SystemUpdateGraph final
+        {
+        public:
+            CS_DECLARE_NOCOPY(SystemUpdateGraph);
+            
+            using UpdateDelegate = std::function<void(f32)>;
+            //------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------
+            SystemUpdateGraph() = default;
+            //------------------------------------------------
+            /// Adds a system to the graph. The graph will be
+            /// rebuilt the next time it is executed.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The system, used to resolve which interface
+            /// Ids it implements.
+            /// @param The access the system declares.
+            /// @param The delegate which updates the system.
+            //------------------------------------------------
+            void AddSystem(const QueryableInterface* in_system, const SystemAccess& in_access, const UpdateDelegate& in_update);
+            //------------------------------------------------
+            /// Removes all systems from the graph.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------
+            void Clear();
+            //------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The number of systems in the graph.
+            //------------------------------------------------
+            u32 GetNumSystems() const;
+            //------------------------------------------------
+            /// Updates every system in the graph, returning once
+            /// they have all finished.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The delta time.
+            /// @param Whether or not concurrent systems should be
+            /// updated in parallel. If false, all systems are
+            /// updated serially in the order they were added.
+            //------------------------------------------------
+            void Execute(f32 in_deltaTime, bool in_concurrent);
+            
+        private:
+            //------------------------------------------------
+            /// A single system in the graph.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------
+            struct Node
+            {
+                const QueryableInterface* m_system;
+                SystemAccess m_access;
+                UpdateDelegate m_update;
+                std::vector<u32> m_dependents;
+                u32 m_numDependencies = 0;
+            };
+            //------------------------------------------------
+            /// The state of a single execution of the graph.
+            /// This is shared with the worker tasks so that any
+            /// which only start after the execution has finished
+            /// can safely see that there is nothing left to do.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------
+            struct ExecutionState
+            {
+                f32 m_deltaTime = 0.0f;
+                u32 m_numNodes = 0;
+                std::mutex m_mutex;
+                std::condition_variable m_condition;
+                std::vector<u32> m_remainingDependencies;
+                std::deque<u32> m_readyNodes;
+                u32 m_numCompletedNodes = 0;
+                u32 m_numRunningWorkers = 0;
+            };
+            using ExecutionStateSPtr = std::shared_ptr<ExecutionState>;
+            //------------------------------------------------
+            /// Builds the dependencies between the nodes.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------
+            void Build();
+            //------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The first node.
+            /// @param The second node.
+            ///
+            /// @return Whether or not the two nodes must not be
+            /// updated at the same time.
+            //------------------------------------------------
+            bool Conflicts(const Node& in_a, const Node& in_b) const;
+            //------------------------------------------------
+            /// Updates the given node and then makes ready any
+            /// dependents which are no longer waiting on other
+            /// nodes. Dependents which are concurrent are
+            /// scheduled on the task scheduler.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The execution state.
+            /// @param The node index.
+            //------------------------------------------------
+            void RunNode(const ExecutionStateSPtr& in_state, u32 in_nodeIndex);
+            //------------------------------------------------
+            /// Schedules a task which will update a ready
+            /// concurrent node, if there is still one by the time
+            /// the task runs.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The execution state.
+            //------------------------------------------------
+            void ScheduleWorker(const ExecutionStateSPtr& in_state);
+            
+            std::vector<Node> m_nodes;
+            bool m_isBuilt = false;
+            bool m_hasConcurrentNodes = false;
+        };
+    }
+}
+
+#endif
@@ -30,6 +30,7 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/Device.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 
 namespace ChilliSource
 {
@@ -72,16 +73,16 @@ namespace ChilliSource
         }
 		//------------------------------------------------
 		//------------------------------------------------
-		void TaskScheduler::ScheduleTask(const GenericTaskType& in_task)
+		void TaskScheduler::ScheduleTask(GenericTaskType in_task)
 		{
-			m_threadPool->Schedule(in_task);
+			m_threadPool->Schedule(std::move(in_task));
 		}
 		//----------------------------------------------------
 		//----------------------------------------------------
-		void TaskScheduler::ScheduleMainThreadTask(const GenericTaskType& in_task)
+		void TaskScheduler::ScheduleMainThreadTask(GenericTaskType in_task)
 		{
 			std::unique_lock<std::recursive_mutex> lock(m_mainThreadQueueMutex);
-			m_mainThreadTasks.push_back(in_task);
+			m_mainThreadTasks.push_back(std::move(in_task));
 		}
         //----------------------------------------------------
         //----------------------------------------------------
@@ -91,7 +92,11 @@ namespace ChilliSource
             
             for (u32 i = 0; i < m_mainThreadTasks.size(); ++i)
             {
-				m_mainThreadTasks[i]();
+                CS_PROFILE_SCOPE("Main Thread Task");
+                
+                //the task is moved out before it is run as it may schedule further tasks, reallocating the list.
+                GenericTaskType task = std::move(m_mainThreadTasks[i]);
+				task();
             }
             
 			m_mainThreadTasks.clear();
@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_CORE_THREADING_TASKSCHEDULER_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Delegate/Delegate.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Core/Threading/ThreadPool.h>
 
@@ -50,7 +51,7 @@ namespace ChilliSource
         
 			CS_DECLARE_NAMEDTYPE(TaskScheduler);
 
-            typedef std::function<void()> GenericTaskType;
+            typedef Task GenericTaskType;
 
 			//------------------------------------------------
 			/// @author S Downie
@@ -63,13 +64,14 @@ namespace ChilliSource
             //------------------------------------------------
             /// The task will be placed into the
             /// task queue and be performed when a thread
-            /// becomes available.
+            /// becomes available. Tasks are move-only and
+            /// small tasks are stored without allocating.
 			///
 			/// @author S Downie
             ///
             /// @param Task
             //------------------------------------------------
-			void ScheduleTask(const GenericTaskType& in_task);
+			void ScheduleTask(GenericTaskType in_task);
             //----------------------------------------------------
             /// Schedule a task to be executed by the main
             /// thread
@@ -78,7 +80,7 @@ namespace ChilliSource
 			///
 			/// @param Task
             //----------------------------------------------------
-			void ScheduleMainThreadTask(const GenericTaskType& insTask);
+			void ScheduleMainThreadTask(GenericTaskType in_task);
             //----------------------------------------------------
             /// Execute any tasks that have been scehduled
             /// for the main thread
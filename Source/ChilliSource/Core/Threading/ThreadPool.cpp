@@ -29,6 +29,7 @@
 #include <ChilliSource/Core/Threading/ThreadPool.h>
 
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 
 namespace ChilliSource
 {
@@ -47,7 +48,7 @@ namespace ChilliSource
         }
         //----------------------------------------------
         //----------------------------------------------
-        void ThreadPool::Schedule(const GenericTaskType& in_task)
+        void ThreadPool::Schedule(GenericTaskType in_task)
         {
             m_tasks.push(std::move(in_task));
         }
@@ -67,11 +68,14 @@ namespace ChilliSource
         //----------------------------------------------
         void ThreadPool::DoTaskOrWait()
         {
+            CS_PROFILE_THREAD_NAME("Worker");
+            
 			while (m_isFinished == false)
 			{
 				GenericTaskType task;
 				if (m_tasks.pop_or_wait(task) == true)
 				{
+                    CS_PROFILE_SCOPE("Task");
 					task();
 				}
             }
@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Container/concurrent_blocking_queue.h>
+#include <ChilliSource/Core/Delegate/Delegate.h>
 
 #include <atomic>
 #include <thread>
@@ -44,7 +45,7 @@ namespace ChilliSource
         {
         public:
 
-            typedef std::function<void()> GenericTaskType;
+            typedef Task GenericTaskType;
             
             //------------------------------------------------
             /// Constructor
@@ -62,7 +63,7 @@ namespace ChilliSource
             ///
             /// @param Task to execute.
             //----------------------------------------------
-            void Schedule(const GenericTaskType& in_task);
+            void Schedule(GenericTaskType in_task);
             //----------------------------------------------
             /// @author Scott Downie
             ///
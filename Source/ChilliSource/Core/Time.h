@@ -31,7 +31,9 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Time/CoreTimer.h>
+#include <ChilliSource/Core/Time/FixedStepController.h>
 #include <ChilliSource/Core/Time/PerformanceTimer.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 #include <ChilliSource/Core/Time/Timer.h>
 
 #endif
\ No newline at end of file
@@ -0,0 +1,235 @@
+//
+//  FixedStepController.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Time/FixedStepController.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const u32 k_defaultMaxStepsPerFrame = 5;
+            const f32 k_defaultMaxFrameTime = 0.33f;
+            
+            const u32 k_loadedFramesBeforeIncrease = 30;
+            const u32 k_idleFramesBeforeDecrease = 120;
+            const f32 k_adaptiveIntervalFactor = 1.25f;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        FixedStepController::FixedStepController(f32 in_interval)
+            : m_requestedInterval(in_interval), m_interval(in_interval), m_maxStepsPerFrame(k_defaultMaxStepsPerFrame), m_maxFrameTime(k_defaultMaxFrameTime)
+        {
+            CS_ASSERT(in_interval > 0.0f, "The fixed update interval must be greater than zero.");
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        void FixedStepController::SetInterval(f32 in_interval)
+        {
+            CS_ASSERT(in_interval > 0.0f, "The fixed update interval must be greater than zero.");
+            
+            m_requestedInterval = in_interval;
+            m_interval = in_interval;
+            m_numLoadedFrames = 0;
+            m_numIdleFrames = 0;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        f32 FixedStepController::GetInterval() const
+        {
+            return m_interval;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        f32 FixedStepController::GetRequestedInterval() const
+        {
+            return m_requestedInterval;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        void FixedStepController::SetMaxStepsPerFrame(u32 in_maxSteps)
+        {
+            CS_ASSERT(in_maxSteps > 0, "The maximum number of fixed update steps per frame must be at least one.");
+            
+            m_maxStepsPerFrame = in_maxSteps;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        u32 FixedStepController::GetMaxStepsPerFrame() const
+        {
+            return m_maxStepsPerFrame;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        void FixedStepController::SetMaxFrameTime(f32 in_maxFrameTime)
+        {
+            m_maxFrameTime = in_maxFrameTime;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        f32 FixedStepController::GetMaxFrameTime() const
+        {
+            return m_maxFrameTime;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        void FixedStepController::SetAdaptiveIntervalEnabled(bool in_enabled, f32 in_maxInterval)
+        {
+            CS_ASSERT(in_enabled == false || in_maxInterval >= m_requestedInterval, "The maximum adaptive interval cannot be less than the requested interval.");
+            
+            m_isAdaptive = in_enabled;
+            m_maxAdaptiveInterval = in_maxInterval;
+            m_numLoadedFrames = 0;
+            m_numIdleFrames = 0;
+            
+            if (m_isAdaptive == false)
+            {
+                m_interval = m_requestedInterval;
+            }
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        bool FixedStepController::IsAdaptiveIntervalEnabled() const
+        {
+            return m_isAdaptive;
+        }
+        //---------------------------------------------------------
+        /// The remainder keeps the fraction of an interval left
+        /// over, even when whole steps are dropped, so that the
+        /// interpolation alpha stays continuous. Forced steps make
+        /// the remainder negative until enough time has passed to
+        /// pay them back.
+        //---------------------------------------------------------
+        u32 FixedStepController::Advance(f32 in_deltaTime, u32 in_minSteps)
+        {
+            f32 accumulated = m_remainder + in_deltaTime;
+            f32 droppedTime = 0.0f;
+            
+            if (accumulated > m_maxFrameTime)
+            {
+                droppedTime += accumulated - m_maxFrameTime;
+                accumulated = m_maxFrameTime;
+            }
+            
+            u32 numSteps = u32(std::max(accumulated, 0.0f) / m_interval);
+            m_remainder = accumulated - f32(numSteps) * m_interval;
+            
+            if (numSteps < in_minSteps)
+            {
+                m_remainder -= f32(in_minSteps - numSteps) * m_interval;
+                numSteps = in_minSteps;
+            }
+            
+            if (numSteps > m_maxStepsPerFrame)
+            {
+                droppedTime += f32(numSteps - m_maxStepsPerFrame) * m_interval;
+                numSteps = m_maxStepsPerFrame;
+            }
+            
+            m_stats.m_numFrames++;
+            m_stats.m_numSteps += numSteps;
+            m_stats.m_stepsLastFrame = numSteps;
+            m_stats.m_maxStepsPerFrame = std::max(m_stats.m_maxStepsPerFrame, numSteps);
+            m_stats.m_droppedTimeLastFrame = droppedTime;
+            if (droppedTime > 0.0f)
+            {
+                m_stats.m_numFramesWithDroppedTime++;
+                m_stats.m_totalDroppedTime += droppedTime;
+            }
+            
+            if (m_isAdaptive == true)
+            {
+                Adapt(in_deltaTime, numSteps);
+            }
+            
+            return numSteps;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        f32 FixedStepController::GetInterpolationAlpha() const
+        {
+            return std::min(std::max(m_remainder / m_interval, 0.0f), 1.0f);
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        const FixedStepController::Stats& FixedStepController::GetStats() const
+        {
+            return m_stats;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        void FixedStepController::ResetStats()
+        {
+            m_stats = Stats();
+        }
+        //---------------------------------------------------------
+        /// A frame at the step cap counts as loaded even if no time
+        /// was dropped, as the fractional remainder means that time
+        /// is only dropped on some of the frames under a steady load.
+        /// The interval returns towards the requested interval more
+        /// slowly than it moves away from it, so that it doesn't
+        /// oscillate under a borderline load.
+        //---------------------------------------------------------
+        void FixedStepController::Adapt(f32 in_deltaTime, u32 in_numSteps)
+        {
+            if (in_numSteps >= m_maxStepsPerFrame)
+            {
+                m_numLoadedFrames++;
+                m_numIdleFrames = 0;
+            }
+            else
+            {
+                m_numLoadedFrames = 0;
+                
+                if (in_deltaTime <= m_requestedInterval * f32(m_maxStepsPerFrame) * 0.5f)
+                {
+                    m_numIdleFrames++;
+                }
+                else
+                {
+                    m_numIdleFrames = 0;
+                }
+            }
+            
+            if (m_numLoadedFrames >= k_loadedFramesBeforeIncrease && m_interval < m_maxAdaptiveInterval)
+            {
+                m_interval = std::min(m_interval * k_adaptiveIntervalFactor, m_maxAdaptiveInterval);
+                m_numLoadedFrames = 0;
+            }
+            else if (m_numIdleFrames >= k_idleFramesBeforeDecrease && m_interval > m_requestedInterval)
+            {
+                m_interval = std::max(m_interval / k_adaptiveIntervalFactor, m_requestedInterval);
+                m_numIdleFrames = 0;
+            }
+        }
+    }
+}
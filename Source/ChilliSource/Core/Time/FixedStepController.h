@@ -0,0 +1,229 @@
+//
+//  FixedStepController.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_TIME_FIXEDSTEPCONTROLLER_H_
+#define _CHILLISOURCE_CORE_TIME_FIXEDSTEPCONTROLLER_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------
+        /// Decides how many fixed updates should be performed each
+        /// frame. Frame time is accumulated and consumed in steps of
+        /// the update interval. The number of steps in a single frame
+        /// is capped, and any time over the cap is dropped rather
+        /// than carried to the next frame. On a slow device this
+        /// stops the fixed updates from taking longer each frame until
+        /// the application stalls. Instead, the simulation runs slower
+        /// than real time.
+        ///
+        /// The adaptive interval is optional. Under sustained load it
+        /// increases the update interval, so fewer and larger steps
+        /// are taken. When the load passes, the interval returns to
+        /// the requested value.
+        ///
+        /// @author Ian Copland
+        //---------------------------------------------------------
+        class FixedStepController final
+        {
+        public:
+            //---------------------------------------------------------
+            /// Statistics on the steps taken. These are accumulated
+            /// until ResetStats() is called.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------------
+            struct Stats
+            {
+                u32 m_numFrames = 0;
+                u32 m_numSteps = 0;
+                u32 m_stepsLastFrame = 0;
+                u32 m_maxStepsPerFrame = 0;
+                u32 m_numFramesWithDroppedTime = 0;
+                f32 m_droppedTimeLastFrame = 0.0f;
+                f64 m_totalDroppedTime = 0.0;
+            };
+            //---------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The update interval in seconds.
+            //---------------------------------------------------------
+            FixedStepController(f32 in_interval);
+            //---------------------------------------------------------
+            /// Sets the requested update interval. If the adaptive
+            /// interval is enabled, this is the smallest interval used.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The update interval in seconds.
+            //---------------------------------------------------------
+            void SetInterval(f32 in_interval);
+            //---------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The update interval currently in use. This can
+            /// be larger than the requested interval if the adaptive
+            /// interval is enabled.
+            //---------------------------------------------------------
+            f32 GetInterval() const;
+            //---------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The requested update interval.
+            //---------------------------------------------------------
+            f32 GetRequestedInterval() const;
+            //---------------------------------------------------------
+            /// Sets the maximum number of steps that will be taken in
+            /// a single frame. This must be at least one.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The maximum number of steps.
+            //---------------------------------------------------------
+            void SetMaxStepsPerFrame(u32 in_maxSteps);
+            //---------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The maximum number of steps that will be taken
+            /// in a single frame.
+            //---------------------------------------------------------
+            u32 GetMaxStepsPerFrame() const;
+            //---------------------------------------------------------
+            /// Sets the maximum frame time that will be processed. Any
+            /// longer frames, such as those after hitting a breakpoint,
+            /// are treated as being this long.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The maximum frame time in seconds.
+            //---------------------------------------------------------
+            void SetMaxFrameTime(f32 in_maxFrameTime);
+            //---------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The maximum frame time that will be processed.
+            //---------------------------------------------------------
+            f32 GetMaxFrameTime() const;
+            //---------------------------------------------------------
+            /// Enables or disables the adaptive update interval. When
+            /// enabled, the interval is increased after a number of
+            /// consecutive frames take the maximum number of steps,
+            /// up to the given maximum.
+            /// It is decreased again, down to the requested interval,
+            /// after a number of consecutive frames short enough to
+            /// need at most half the maximum steps at the requested
+            /// interval.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Whether or not the interval should adapt.
+            /// @param The largest interval that can be used.
+            //---------------------------------------------------------
+            void SetAdaptiveIntervalEnabled(bool in_enabled, f32 in_maxInterval);
+            //---------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not the adaptive interval is enabled.
+            //---------------------------------------------------------
+            bool IsAdaptiveIntervalEnabled() const;
+            //---------------------------------------------------------
+            /// Adds the time for a frame and calculates the number of
+            /// steps which should be taken.
+            ///
+            /// If fewer than the minimum number of steps are due, the
+            /// minimum is taken anyway and the time for the extra steps
+            /// is borrowed from the next frames.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The frame time in seconds.
+            /// @param [Optional] The minimum number of steps to take
+            /// this frame. Defaults to 0.
+            ///
+            /// @return The number of steps to take this frame.
+            //---------------------------------------------------------
+            u32 Advance(f32 in_deltaTime, u32 in_minSteps = 0);
+            //---------------------------------------------------------
+            /// The interpolation alpha is the fraction of an interval
+            /// left over after the steps for this frame. It can be
+            /// used at render time to blend between the previous and
+            /// current fixed update state.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The interpolation alpha, in the range [0, 1].
+            //---------------------------------------------------------
+            f32 GetInterpolationAlpha() const;
+            //---------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The step statistics.
+            //---------------------------------------------------------
+            const Stats& GetStats() const;
+            //---------------------------------------------------------
+            /// Resets the step statistics.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------------
+            void ResetStats();
+            
+        private:
+            //---------------------------------------------------------
+            /// Adjusts the interval, if the adaptive interval is
+            /// enabled, based on the frame just advanced.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The frame time in seconds.
+            /// @param The number of steps taken this frame.
+            //---------------------------------------------------------
+            void Adapt(f32 in_deltaTime, u32 in_numSteps);
+            
+            f32 m_requestedInterval;
+            f32 m_interval;
+            f32 m_remainder = 0.0f;
+            u32 m_maxStepsPerFrame;
+            f32 m_maxFrameTime;
+            
+            bool m_isAdaptive = false;
+            f32 m_maxAdaptiveInterval = 0.0f;
+            u32 m_numLoadedFrames = 0;
+            u32 m_numIdleFrames = 0;
+            
+            Stats m_stats;
+        };
+    }
+}
+
+#endif
@@ -55,6 +55,8 @@ namespace ChilliSource
 			LARGE_INTEGER startTime;
 			QueryPerformanceCounter(&startTime);
 			m_startTime = startTime.QuadPart;
+#else
+			m_startTime = std::chrono::steady_clock::now();
 #endif
         }
         
@@ -70,6 +72,8 @@ namespace ChilliSource
 			LARGE_INTEGER end;
 			QueryPerformanceCounter(&end);
 			m_lastDurationMicroS = (static_cast<f64>(end.QuadPart - m_startTime) / m_frequency) * 1000000.0;
+#else
+			m_lastDurationMicroS = std::chrono::duration<f64, std::micro>(std::chrono::steady_clock::now() - m_startTime).count();
 #endif
         }
         
@@ -33,6 +33,8 @@
 
 #if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID   
 #include <sys/time.h>
+#elif !defined CS_TARGETPLATFORM_WINDOWS
+#include <chrono>
 #endif
 
 namespace ChilliSource
@@ -56,6 +58,8 @@ namespace ChilliSource
 #elif defined CS_TARGETPLATFORM_WINDOWS
 			s64 m_frequency;
 			s64 m_startTime;
+#else
+			std::chrono::steady_clock::time_point m_startTime;
 #endif
         };
     }
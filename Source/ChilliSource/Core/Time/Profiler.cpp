@@ -0,0 +1,391 @@
+//
+//  Profiler.cpp
+//  Chilli Source
+//  Created by Ian Copland on 17/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Time/Profiler.h>
+
+#ifdef CS_ENABLE_PROFILER
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/String/StringUtils.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+#ifndef CS_TARGETPLATFORM_WINDOWS
+#include <pthread.h>
+#endif
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace Profiler
+        {
+            namespace
+            {
+                const u32 k_maxEventsPerThread = 64 * 1024;
+                
+                //---------------------------------------------------
+                /// A single completed profile event.
+                ///
+                /// @author Ian Copland
+                //---------------------------------------------------
+                struct Event final
+                {
+                    const char* m_name;
+                    u64 m_startNS;
+                    u64 m_endNS;
+                };
+                //---------------------------------------------------
+                /// The events recorded by a single thread. Only the
+                /// owning thread writes to the buffer. The event count
+                /// is published with release semantics after each
+                /// event is written, so the events below the count
+                /// can be safely read from another thread. Buffers are
+                /// never freed, so that a capture can still be
+                /// exported after the thread has exited.
+                ///
+                /// @author Ian Copland
+                //---------------------------------------------------
+                struct ThreadBuffer final
+                {
+                    std::unique_ptr<Event[]> m_events;
+                    std::atomic<u32> m_numEvents;
+                    std::atomic<u32> m_numDropped;
+                    std::atomic<u32> m_captureId;
+                    u32 m_threadIndex = 0;
+                    std::string m_name;
+                };
+                
+                std::atomic<bool> g_isCapturing(false);
+                std::atomic<u32> g_captureId(0);
+                std::atomic<u64> g_captureStartNS(0);
+                
+                std::mutex g_threadBuffersMutex;
+                std::vector<ThreadBuffer*> g_threadBuffers;
+                
+#ifdef CS_TARGETPLATFORM_WINDOWS
+                __declspec(thread) ThreadBuffer* g_threadBuffer = nullptr;
+                
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @return The current thread's buffer, or null if
+                /// it doesn't yet have one.
+                //---------------------------------------------------
+                ThreadBuffer* GetThreadLocalBuffer()
+                {
+                    return g_threadBuffer;
+                }
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The buffer for the current thread.
+                //---------------------------------------------------
+                void SetThreadLocalBuffer(ThreadBuffer* in_buffer)
+                {
+                    g_threadBuffer = in_buffer;
+                }
+#else
+                //---------------------------------------------------
+                /// thread_local is not available with all of the
+                /// supported compilers, so a pthread key is used.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @return The key for the thread buffer.
+                //---------------------------------------------------
+                pthread_key_t GetThreadBufferKey()
+                {
+                    static pthread_key_t key;
+                    static std::once_flag onceFlag;
+                    std::call_once(onceFlag, []()
+                    {
+                        pthread_key_create(&key, nullptr);
+                    });
+                    return key;
+                }
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @return The current thread's buffer, or null if
+                /// it doesn't yet have one.
+                //---------------------------------------------------
+                ThreadBuffer* GetThreadLocalBuffer()
+                {
+                    return static_cast<ThreadBuffer*>(pthread_getspecific(GetThreadBufferKey()));
+                }
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The buffer for the current thread.
+                //---------------------------------------------------
+                void SetThreadLocalBuffer(ThreadBuffer* in_buffer)
+                {
+                    pthread_setspecific(GetThreadBufferKey(), in_buffer);
+                }
+#endif
+                //---------------------------------------------------
+                /// Gets the buffer for the current thread, creating
+                /// and registering it on first use. Registration is
+                /// the only time the profiler takes a lock.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @return The buffer.
+                //---------------------------------------------------
+                ThreadBuffer* GetThreadBuffer()
+                {
+                    ThreadBuffer* buffer = GetThreadLocalBuffer();
+                    if (buffer == nullptr)
+                    {
+                        buffer = new ThreadBuffer();
+                        buffer->m_numEvents = 0;
+                        buffer->m_numDropped = 0;
+                        buffer->m_captureId = 0;
+                        
+                        std::unique_lock<std::mutex> lock(g_threadBuffersMutex);
+                        buffer->m_threadIndex = u32(g_threadBuffers.size());
+                        g_threadBuffers.push_back(buffer);
+                        lock.unlock();
+                        
+                        SetThreadLocalBuffer(buffer);
+                    }
+                    
+                    return buffer;
+                }
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The string to escape.
+                ///
+                /// @return The string escaped for use in JSON.
+                //---------------------------------------------------
+                std::string EscapeJsonString(const char* in_string)
+                {
+                    std::string output;
+                    for (const char* character = in_string; *character != '\0'; ++character)
+                    {
+                        switch (*character)
+                        {
+                            case '"':
+                                output += "\\\"";
+                                break;
+                            case '\\':
+                                output += "\\\\";
+                                break;
+                            case '\n':
+                                output += "\\n";
+                                break;
+                            case '\t':
+                                output += "\\t";
+                                break;
+                            default:
+                                if (u8(*character) < 0x20)
+                                {
+                                    output += ' ';
+                                }
+                                else
+                                {
+                                    output += *character;
+                                }
+                                break;
+                        }
+                    }
+                    return output;
+                }
+                //---------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param A duration in nanoseconds.
+                ///
+                /// @return The duration in microseconds, as used
+                /// by the trace format, formatted as a string.
+                //---------------------------------------------------
+                std::string ToMicrosecondsString(u64 in_timeNS)
+                {
+                    char buffer[32];
+                    CS_SPRINTF(buffer, "%.3f", f64(in_timeNS) / 1000.0);
+                    return buffer;
+                }
+            }
+            
+            //---------------------------------------------------
+            //---------------------------------------------------
+            void BeginCapture()
+            {
+                CS_ASSERT(IsCapturing() == false, "Cannot begin a profiler capture while one is active.");
+                
+                //buffers reset themselves the next time they are written to from a new capture.
+                g_captureStartNS = GetTimestampNS();
+                g_captureId++;
+                g_isCapturing = true;
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            void EndCapture()
+            {
+                g_isCapturing = false;
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            bool IsCapturing()
+            {
+                return g_isCapturing.load(std::memory_order_relaxed);
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            void SetThreadName(const std::string& in_name)
+            {
+                GetThreadBuffer()->m_name = in_name;
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            u64 GetTimestampNS()
+            {
+                return u64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            void RecordEvent(const char* in_name, u64 in_startNS, u64 in_endNS)
+            {
+                ThreadBuffer* buffer = GetThreadBuffer();
+                
+                const u32 captureId = g_captureId.load(std::memory_order_acquire);
+                if (buffer->m_captureId.load(std::memory_order_relaxed) != captureId)
+                {
+                    if (buffer->m_events == nullptr)
+                    {
+                        buffer->m_events.reset(new Event[k_maxEventsPerThread]);
+                    }
+                    
+                    buffer->m_numEvents.store(0, std::memory_order_relaxed);
+                    buffer->m_numDropped.store(0, std::memory_order_relaxed);
+                    buffer->m_captureId.store(captureId, std::memory_order_release);
+                }
+                
+                const u32 numEvents = buffer->m_numEvents.load(std::memory_order_relaxed);
+                if (numEvents >= k_maxEventsPerThread)
+                {
+                    buffer->m_numDropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                
+                Event& event = buffer->m_events[numEvents];
+                event.m_name = in_name;
+                event.m_startNS = in_startNS;
+                event.m_endNS = in_endNS;
+                
+                buffer->m_numEvents.store(numEvents + 1, std::memory_order_release);
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            std::string GenerateChromeTrace()
+            {
+                CS_ASSERT(IsCapturing() == false, "Cannot generate a trace while a profiler capture is active.");
+                
+                std::vector<ThreadBuffer*> threadBuffers;
+                {
+                    std::unique_lock<std::mutex> lock(g_threadBuffersMutex);
+                    threadBuffers = g_threadBuffers;
+                }
+                
+                const u32 captureId = g_captureId.load(std::memory_order_acquire);
+                const u64 captureStartNS = g_captureStartNS;
+                
+                std::string output = "{\"traceEvents\":[";
+                bool isFirstEvent = true;
+                
+                auto appendSeparator = [&]()
+                {
+                    output += isFirstEvent ? "\n" : ",\n";
+                    isFirstEvent = false;
+                };
+                
+                for (ThreadBuffer* buffer : threadBuffers)
+                {
+                    const std::string threadId = ToString(buffer->m_threadIndex);
+                    
+                    if (buffer->m_name.empty() == false)
+                    {
+                        appendSeparator();
+                        output += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" + threadId + ",\"args\":{\"name\":\"" + EscapeJsonString(buffer->m_name.c_str()) + "\"}}";
+                    }
+                    
+                    if (buffer->m_captureId.load(std::memory_order_acquire) != captureId)
+                    {
+                        continue;
+                    }
+                    
+                    const u32 numEvents = buffer->m_numEvents.load(std::memory_order_acquire);
+                    for (u32 i = 0; i < numEvents; ++i)
+                    {
+                        const Event& event = buffer->m_events[i];
+                        const u64 startNS = (event.m_startNS > captureStartNS) ? event.m_startNS - captureStartNS : 0;
+                        
+                        appendSeparator();
+                        output += "{\"name\":\"" + EscapeJsonString(event.m_name) + "\",\"cat\":\"cs\",\"ph\":\"X\",\"pid\":0,\"tid\":" + threadId +
+                            ",\"ts\":" + ToMicrosecondsString(startNS) + ",\"dur\":" + ToMicrosecondsString(event.m_endNS - event.m_startNS) + "}";
+                    }
+                    
+                    const u32 numDropped = buffer->m_numDropped.load(std::memory_order_relaxed);
+                    if (numDropped > 0)
+                    {
+                        appendSeparator();
+                        output += "{\"name\":\"Dropped Events\",\"ph\":\"C\",\"pid\":0,\"tid\":" + threadId + ",\"ts\":0,\"args\":{\"count\":" + ToString(numDropped) + "}}";
+                    }
+                }
+                
+                output += "\n],\"displayTimeUnit\":\"ms\"}\n";
+                return output;
+            }
+            //---------------------------------------------------
+            //---------------------------------------------------
+            bool WriteChromeTrace(StorageLocation in_storageLocation, const std::string& in_filePath)
+            {
+                FileStreamSPtr stream = Application::Get()->GetFileSystem()->CreateFileStream(in_storageLocation, in_filePath, FileMode::k_writeTruncate);
+                if (stream == nullptr || stream->IsBad() == true)
+                {
+                    CS_LOG_ERROR("Cannot write profiler trace '" + in_filePath + "': failed to open file.");
+                    return false;
+                }
+                
+                stream->Write(GenerateChromeTrace());
+                stream->Close();
+                return true;
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,210 @@
+//
+//  Profiler.h
+//  Chilli Source
+//  Created by Ian Copland on 17/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_TIME_PROFILER_H_
+#define _CHILLISOURCE_CORE_TIME_PROFILER_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+//------------------------------------------------------------
+/// Profiling macros. These compile to nothing unless
+/// CS_ENABLE_PROFILER is defined, in which case the rest of
+/// this file is also available.
+///
+/// CS_PROFILE_SCOPE records the time from the point it is
+/// declared to the end of the enclosing scope. The name must
+/// be a string literal, or otherwise outlive the capture.
+///
+/// CS_PROFILE_THREAD_NAME sets the name the current thread
+/// will be given in exported traces.
+//------------------------------------------------------------
+#ifdef CS_ENABLE_PROFILER
+#define CS_PROFILE_CONCAT_IMPL(in_a, in_b) in_a##in_b
+#define CS_PROFILE_CONCAT(in_a, in_b) CS_PROFILE_CONCAT_IMPL(in_a, in_b)
+#define CS_PROFILE_SCOPE(in_name) CSCore::ProfileScope CS_PROFILE_CONCAT(csProfileScope, __LINE__)(in_name)
+#define CS_PROFILE_THREAD_NAME(in_name) CSCore::Profiler::SetThreadName(in_name)
+#else
+#define CS_PROFILE_SCOPE(in_name)
+#define CS_PROFILE_THREAD_NAME(in_name)
+#endif
+
+#ifdef CS_ENABLE_PROFILER
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------
+        /// A hierarchical CPU profiler. While a capture is active,
+        /// each profile scope records its name, start time and
+        /// duration to a buffer owned by the thread it ran on, so
+        /// recording never takes a lock. Scopes nest naturally, as
+        /// an inner scope always starts and ends within its outer
+        /// scope. The capture can then be exported in the Chrome
+        /// trace event format and viewed in chrome://tracing.
+        ///
+        /// Each thread buffer has a fixed capacity. Any events past
+        /// that are dropped, and the number dropped is reported in
+        /// the trace.
+        ///
+        /// The profiler only exists if CS_ENABLE_PROFILER is
+        /// defined, so calls to it should be wrapped in the same
+        /// check.
+        ///
+        /// @author Ian Copland
+        //---------------------------------------------------------
+        namespace Profiler
+        {
+            //---------------------------------------------------
+            /// Starts a new capture, discarding any previously
+            /// recorded events. This must not be called while
+            /// a trace is being exported.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            void BeginCapture();
+            //---------------------------------------------------
+            /// Stops the current capture. Scopes which started
+            /// during the capture will still be recorded when
+            /// they end.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            void EndCapture();
+            //---------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not a capture is active.
+            //---------------------------------------------------
+            bool IsCapturing();
+            //---------------------------------------------------
+            /// Sets the name of the current thread in exported
+            /// traces. This should be called when the thread
+            /// starts, rather than during a capture.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The thread name.
+            //---------------------------------------------------
+            void SetThreadName(const std::string& in_name);
+            //---------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return A monotonic timestamp in nanoseconds.
+            //---------------------------------------------------
+            u64 GetTimestampNS();
+            //---------------------------------------------------
+            /// Records a single completed event for the current
+            /// thread. This is typically called by ProfileScope
+            /// rather than directly.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The event name. This must outlive the
+            /// capture.
+            /// @param The start timestamp in nanoseconds.
+            /// @param The end timestamp in nanoseconds.
+            //---------------------------------------------------
+            void RecordEvent(const char* in_name, u64 in_startNS, u64 in_endNS);
+            //---------------------------------------------------
+            /// Builds a Chrome trace event format JSON document
+            /// from the last capture. The capture must have
+            /// ended.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The JSON document.
+            //---------------------------------------------------
+            std::string GenerateChromeTrace();
+            //---------------------------------------------------
+            /// Writes the last capture to the given file in the
+            /// Chrome trace event format. The capture must have
+            /// ended.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The storage location.
+            /// @param The file path.
+            ///
+            /// @return Whether or not the file was written.
+            //---------------------------------------------------
+            bool WriteChromeTrace(StorageLocation in_storageLocation, const std::string& in_filePath);
+        }
+        //---------------------------------------------------------
+        /// Records the time between its construction and
+        /// destruction as a profiler event, if a capture was active
+        /// on construction. Use CS_PROFILE_SCOPE rather than
+        /// creating this directly.
+        ///
+        /// @author Ian Copland
+        //---------------------------------------------------------
+        class ProfileScope final
+        {
+        public:
+            CS_DECLARE_NOCOPY(ProfileScope);
+            //---------------------------------------------------
+            /// Constructor.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The scope name. This must outlive the
+            /// capture.
+            //---------------------------------------------------
+            ProfileScope(const char* in_name)
+                : m_name(in_name), m_isRecording(Profiler::IsCapturing())
+            {
+                if (m_isRecording == true)
+                {
+                    m_startNS = Profiler::GetTimestampNS();
+                }
+            }
+            //---------------------------------------------------
+            /// Destructor. Records the event.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------
+            ~ProfileScope()
+            {
+                if (m_isRecording == true)
+                {
+                    Profiler::RecordEvent(m_name, m_startNS, Profiler::GetTimestampNS());
+                }
+            }
+            
+        private:
+            const char* m_name;
+            bool m_isRecording;
+            u64 m_startNS = 0;
+        };
+    }
+}
+
+#endif
+
+#endif
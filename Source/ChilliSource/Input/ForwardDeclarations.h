@@ -69,7 +69,10 @@ namespace ChilliSource
         /// Pointer
         //--------------------------------------------------
         CS_FORWARDDECLARE_CLASS(Pointer);
+        CS_FORWARDDECLARE_STRUCT(PointerEvent);
+        CS_FORWARDDECLARE_CLASS(PointerRecording);
         CS_FORWARDDECLARE_CLASS(PointerSystem);
+        enum class PointerEventType;
         //--------------------------------------------------
         /// Text Entry
         //--------------------------------------------------
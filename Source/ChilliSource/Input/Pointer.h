@@ -32,6 +32,8 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Input/Pointer/Pointer.h>
+#include <ChilliSource/Input/Pointer/PointerEvent.h>
+#include <ChilliSource/Input/Pointer/PointerRecording.h>
 #include <ChilliSource/Input/Pointer/PointerSystem.h>
 
 #endif
\ No newline at end of file
@@ -0,0 +1,73 @@
+//
+//  PointerEvent.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_INPUT_POINTER_POINTEREVENT_H_
+#define _CHILLISOURCE_INPUT_POINTER_POINTEREVENT_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Input/Pointer/Pointer.h>
+
+namespace ChilliSource
+{
+    namespace Input
+    {
+        //------------------------------------------------------------------------------
+        /// An enum describing the different types of pointer event.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        enum class PointerEventType
+        {
+            k_add,
+            k_down,
+            k_move,
+            k_up,
+            k_scroll,
+            k_remove
+        };
+        //------------------------------------------------------------------------------
+        /// A container for information on a single raw pointer event, as received from
+        /// the OS by the pointer system. The position is the scroll delta for scroll
+        /// events.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        struct PointerEvent
+        {
+            PointerEventType m_type = PointerEventType::k_add;
+            Pointer::Id m_pointerUniqueId = 0;
+            Core::Vector2 m_position;
+            Pointer::InputType m_inputType = Pointer::InputType::k_none;
+            f64 m_timestamp = 0.0;
+        };
+    }
+}
+
+#endif
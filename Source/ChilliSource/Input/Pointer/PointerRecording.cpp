@@ -0,0 +1,199 @@
+//
+//  PointerRecording.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Input/Pointer/PointerRecording.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace Input
+    {
+        namespace
+        {
+            const char k_fileId[4] = {'C', 'S', 'P', 'R'};
+            const u32 k_fileVersion = 1;
+            
+            //------------------------------------------------------------------------------
+            /// Appends the bytes of the given value to the given buffer.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param in_value - The value.
+            /// @param out_buffer - [Out] The buffer.
+            //------------------------------------------------------------------------------
+            template <typename TType> void WriteValue(TType in_value, std::string& out_buffer)
+            {
+                out_buffer.append(reinterpret_cast<const char*>(&in_value), sizeof(TType));
+            }
+            //------------------------------------------------------------------------------
+            /// Reads a value from the given buffer at the given position, moving the
+            /// position on past the value.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param in_buffer - The buffer.
+            /// @param inout_position - [In/Out] The read position.
+            /// @param out_value - [Out] The value.
+            ///
+            /// @return Whether or not there was enough data left to read the value.
+            //------------------------------------------------------------------------------
+            template <typename TType> bool ReadValue(const std::string& in_buffer, std::size_t& inout_position, TType& out_value)
+            {
+                if (in_buffer.size() - inout_position < sizeof(TType))
+                {
+                    return false;
+                }
+                
+                memcpy(&out_value, in_buffer.data() + inout_position, sizeof(TType));
+                inout_position += sizeof(TType);
+                return true;
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void PointerRecording::AddFrame(const std::vector<PointerEvent>& in_events)
+        {
+            m_frames.push_back(in_events);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 PointerRecording::GetNumFrames() const
+        {
+            return u32(m_frames.size());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<PointerEvent>& PointerRecording::GetFrame(u32 in_index) const
+        {
+            CS_ASSERT(in_index < m_frames.size(), "Pointer recording frame index out of bounds.");
+            return m_frames[in_index];
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void PointerRecording::Clear()
+        {
+            m_frames.clear();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PointerRecording::Save(Core::StorageLocation in_storageLocation, const std::string& in_filePath) const
+        {
+            std::string buffer(k_fileId, sizeof(k_fileId));
+            WriteValue(k_fileVersion, buffer);
+            WriteValue(u32(m_frames.size()), buffer);
+            
+            for (const auto& frame : m_frames)
+            {
+                WriteValue(u32(frame.size()), buffer);
+                for (const auto& event : frame)
+                {
+                    WriteValue(u32(event.m_type), buffer);
+                    WriteValue(event.m_pointerUniqueId, buffer);
+                    WriteValue(event.m_position.x, buffer);
+                    WriteValue(event.m_position.y, buffer);
+                    WriteValue(u32(event.m_inputType), buffer);
+                    WriteValue(event.m_timestamp, buffer);
+                }
+            }
+            
+            auto fileStream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_storageLocation, in_filePath, Core::FileMode::k_writeBinary);
+            if (fileStream == nullptr || fileStream->IsOpen() == false || fileStream->IsBad() == true)
+            {
+                CS_LOG_ERROR("Could not open pointer recording file for writing: " + in_filePath);
+                return false;
+            }
+            
+            fileStream->Write(reinterpret_cast<const s8*>(buffer.data()), s32(buffer.size()));
+            return (fileStream->IsBad() == false);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PointerRecording::Load(Core::StorageLocation in_storageLocation, const std::string& in_filePath)
+        {
+            m_frames.clear();
+            
+            auto fileStream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_storageLocation, in_filePath, Core::FileMode::k_readBinary);
+            if (fileStream == nullptr || fileStream->IsOpen() == false || fileStream->IsBad() == true)
+            {
+                CS_LOG_ERROR("Could not open pointer recording file: " + in_filePath);
+                return false;
+            }
+            
+            std::string buffer;
+            fileStream->GetAll(buffer);
+            
+            std::size_t position = sizeof(k_fileId);
+            u32 version = 0;
+            u32 numFrames = 0;
+            if (buffer.size() < sizeof(k_fileId) || memcmp(buffer.data(), k_fileId, sizeof(k_fileId)) != 0 ||
+                ReadValue(buffer, position, version) == false || version != k_fileVersion || ReadValue(buffer, position, numFrames) == false)
+            {
+                CS_LOG_ERROR("Invalid pointer recording file: " + in_filePath);
+                return false;
+            }
+            
+            for (u32 frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+            {
+                u32 numEvents = 0;
+                bool isValid = ReadValue(buffer, position, numEvents);
+                
+                std::vector<PointerEvent> frame;
+                for (u32 eventIndex = 0; eventIndex < numEvents && isValid == true; ++eventIndex)
+                {
+                    u32 type = 0;
+                    u32 inputType = 0;
+                    PointerEvent event;
+                    isValid = ReadValue(buffer, position, type) && ReadValue(buffer, position, event.m_pointerUniqueId) && ReadValue(buffer, position, event.m_position.x) &&
+                        ReadValue(buffer, position, event.m_position.y) && ReadValue(buffer, position, inputType) && ReadValue(buffer, position, event.m_timestamp) &&
+                        type <= u32(PointerEventType::k_remove) && inputType <= u32(Pointer::InputType::k_rightMouseButton);
+                    
+                    event.m_type = PointerEventType(type);
+                    event.m_inputType = Pointer::InputType(inputType);
+                    frame.push_back(event);
+                }
+                
+                if (isValid == false)
+                {
+                    CS_LOG_ERROR("Invalid pointer recording file: " + in_filePath);
+                    m_frames.clear();
+                    return false;
+                }
+                
+                m_frames.push_back(std::move(frame));
+            }
+            
+            return true;
+        }
+    }
+}
@@ -0,0 +1,119 @@
+//
+//  PointerRecording.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_INPUT_POINTER_POINTERRECORDING_H_
+#define _CHILLISOURCE_INPUT_POINTER_POINTERRECORDING_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/StorageLocation.h>
+#include <ChilliSource/Input/Pointer/PointerEvent.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Input
+    {
+        //------------------------------------------------------------------------------
+        /// A recording of the raw pointer events received by the pointer system over a
+        /// number of frames. Recordings are created by the pointer system and can be
+        /// played back through it, allowing input heavy frames to be reproduced
+        /// exactly, for example when benchmarking.
+        ///
+        /// The first frame of a recording describes the pointers which existed when
+        /// recording started, so that the recording can be played back regardless of
+        /// the pointers that exist at the time.
+        ///
+        /// Recordings can be saved to and loaded from a little endian binary file.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        class PointerRecording final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// Adds a frame containing the given events to the end of the recording.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param in_events - The events received during the frame, in order.
+            //------------------------------------------------------------------------------
+            void AddFrame(const std::vector<PointerEvent>& in_events);
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The number of frames in the recording.
+            //------------------------------------------------------------------------------
+            u32 GetNumFrames() const;
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param in_index - The index of the frame.
+            ///
+            /// @return The events received during the frame, in order.
+            //------------------------------------------------------------------------------
+            const std::vector<PointerEvent>& GetFrame(u32 in_index) const;
+            //------------------------------------------------------------------------------
+            /// Removes all frames from the recording.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            void Clear();
+            //------------------------------------------------------------------------------
+            /// Saves the recording to the given file.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param in_storageLocation - The storage location.
+            /// @param in_filePath - The file path.
+            ///
+            /// @return Whether or not the recording was saved.
+            //------------------------------------------------------------------------------
+            bool Save(Core::StorageLocation in_storageLocation, const std::string& in_filePath) const;
+            //------------------------------------------------------------------------------
+            /// Replaces the contents of this recording with the recording in the given
+            /// file.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param in_storageLocation - The storage location.
+            /// @param in_filePath - The file path.
+            ///
+            /// @return Whether or not the recording was loaded. If not, the recording is
+            /// left empty.
+            //------------------------------------------------------------------------------
+            bool Load(Core::StorageLocation in_storageLocation, const std::string& in_filePath);
+            
+        private:
+            std::vector<std::vector<PointerEvent>> m_frames;
+        };
+    }
+}
+
+#endif
@@ -29,6 +29,7 @@
 #include <ChilliSource/Input/Pointer/PointerSystem.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 #include <ChilliSource/Input/Base/Filter.h>
 
 #include <thread>
@@ -46,10 +47,19 @@
 #include <CSBackend/Platform/Windows/Input/Pointer/PointerSystem.h>
 #endif
 
+#ifdef CS_TARGETPLATFORM_LINUX
+#include <CSBackend/Platform/Linux/Input/Pointer/PointerSystem.h>
+#endif
+
 namespace ChilliSource
 {
     namespace Input
     {
+        namespace
+        {
+            const u32 k_eventRingCapacity = 1024;
+        }
+        
         CS_DEFINE_NAMEDTYPE(PointerSystem);
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -61,6 +71,8 @@ namespace ChilliSource
             return PointerSystemUPtr(new CSBackend::iOS::PointerSystem());
 #elif defined CS_TARGETPLATFORM_WINDOWS
             return PointerSystemUPtr(new CSBackend::Windows::PointerSystem());
+#elif defined CS_TARGETPLATFORM_LINUX
+            return PointerSystemUPtr(new CSBackend::Linux::PointerSystem());
 #else
             return nullptr;
 #endif
@@ -68,7 +80,7 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
         PointerSystem::PointerSystem()
-            : m_nextUniqueId(0)
+            : m_eventRing(k_eventRingCapacity), m_hasOverflowEvents(false), m_nextUniqueId(0)
         {
         }
         //------------------------------------------------------------------------------
@@ -175,46 +187,165 @@ namespace ChilliSource
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
-        void PointerSystem::ProcessQueuedInput()
+        void PointerSystem::SetMoveCoalescingEnabled(bool in_enabled)
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            std::queue<PointerEvent> eventQueue = m_eventQueue;
-            while (m_eventQueue.empty() == false)
+            m_moveCoalescingEnabled = in_enabled;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PointerSystem::IsMoveCoalescingEnabled() const
+        {
+            return m_moveCoalescingEnabled;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::vector<PointerSystem::MoveSample> PointerSystem::GetMoveHistory(Pointer::Id in_uniqueId) const
+        {
+            std::vector<MoveSample> output;
+            for (const auto& entry : m_moveHistory)
             {
-                m_eventQueue.pop();
+                if (entry.first == in_uniqueId)
+                {
+                    output.push_back(entry.second);
+                }
             }
-            lock.unlock();
             
-            while (eventQueue.empty() == false)
+            return output;
+        }
+        //------------------------------------------------------------------------------
+        /// The first frame of the recording creates the pointers which already exist,
+        /// putting them in their current state.
+        //------------------------------------------------------------------------------
+        void PointerSystem::StartRecording()
+        {
+            CS_ASSERT(m_isRecording == false && m_isPlayingBack == false, "Cannot start recording while recording or playing back.");
+            
+            std::vector<PointerEvent> initialEvents;
+            for (const Pointer& pointer : m_pointers)
             {
-                PointerEvent& event = eventQueue.front();
+                PointerEvent event;
+                event.m_type = PointerEventType::k_add;
+                event.m_pointerUniqueId = pointer.GetId();
+                event.m_position = pointer.GetPosition();
+                initialEvents.push_back(event);
                 
-                switch (event.m_type)
+                for (Pointer::InputType inputType : pointer.GetActiveInputs())
                 {
-                    case PointerEventType::k_add:
-                        CreatePointer(event.m_pointerUniqueId, event.m_timestamp, event.m_position);
-                        break;
-                    case PointerEventType::k_down:
-                        PointerDown(event.m_pointerUniqueId, event.m_timestamp, event.m_InputType);
-                        break;
-                    case PointerEventType::k_move:
-                        PointerMoved(event.m_pointerUniqueId, event.m_timestamp, event.m_position);
-                        break;
-                    case PointerEventType::k_up:
-                        PointerUp(event.m_pointerUniqueId, event.m_timestamp, event.m_InputType);
-                        break;
-                    case PointerEventType::k_scroll:
-                        PointerScrolled(event.m_pointerUniqueId, event.m_timestamp, event.m_position);
-                        break;
-                    case PointerEventType::k_remove:
-                        RemovePointer(event.m_pointerUniqueId, event.m_timestamp);
-                        break;
-                    default:
-                        CS_LOG_FATAL("Something has gone very wrong while processing buffered input");
-                        break;
+                    event.m_type = PointerEventType::k_down;
+                    event.m_inputType = inputType;
+                    initialEvents.push_back(event);
+                }
+            }
+            
+            m_recording.Clear();
+            m_recording.AddFrame(initialEvents);
+            m_isRecording = true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PointerRecording PointerSystem::StopRecording()
+        {
+            CS_ASSERT(m_isRecording == true, "Cannot stop recording when not recording.");
+            
+            m_isRecording = false;
+            
+            PointerRecording output = std::move(m_recording);
+            m_recording.Clear();
+            return output;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PointerSystem::IsRecording() const
+        {
+            return m_isRecording;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void PointerSystem::StartPlayback(const PointerRecording& in_recording)
+        {
+            CS_ASSERT(m_isRecording == false && m_isPlayingBack == false, "Cannot start playback while recording or playing back.");
+            
+            m_playback = in_recording;
+            m_playbackFrame = 0;
+            m_isPlayingBack = true;
+        }
+        //------------------------------------------------------------------------------
+        /// Pointers created by the playback are released and removed immediately so
+        /// that listeners are left in a consistent state.
+        //------------------------------------------------------------------------------
+        void PointerSystem::StopPlayback()
+        {
+            if (m_isPlayingBack == false)
+            {
+                return;
+            }
+            
+            m_isPlayingBack = false;
+            m_playback.Clear();
+            
+            const f64 timestamp = ((f64)Core::Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
+            for (const auto& pointerIds : m_playbackPointerIds)
+            {
+                const Pointer::Id pointerId = pointerIds.second;
+                auto pointerIt = std::find_if(m_pointers.begin(), m_pointers.end(), [pointerId](const Pointer& in_pointer)
+                {
+                    return (pointerId == in_pointer.GetId());
+                });
+                
+                if (pointerIt != m_pointers.end())
+                {
+                    const std::set<Pointer::InputType> activeInput = pointerIt->GetActiveInputs();
+                    for (Pointer::InputType inputType : activeInput)
+                    {
+                        PointerUp(pointerId, timestamp, inputType);
+                    }
+                    
+                    RemovePointer(pointerId, timestamp);
                 }
+            }
+            
+            m_playbackPointerIds.clear();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PointerSystem::IsPlayingBack() const
+        {
+            return m_isPlayingBack;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void PointerSystem::ProcessQueuedInput()
+        {
+            CS_PROFILE_SCOPE("PointerSystem::ProcessQueuedInput");
+            
+            m_frameEvents.clear();
+            
+            if (m_isPlayingBack == true)
+            {
+                TakeQueuedEvents(m_deferredEvents);
+                TakePlaybackEvents(m_frameEvents);
+            }
+            else
+            {
+                m_frameEvents.swap(m_deferredEvents);
+                TakeQueuedEvents(m_frameEvents);
                 
-                eventQueue.pop();
+                if (m_isRecording == true)
+                {
+                    m_recording.AddFrame(m_frameEvents);
+                }
+            }
+            
+            CoalesceMoveEvents(m_frameEvents);
+            
+            for (const PointerEvent& event : m_frameEvents)
+            {
+                ProcessEvent(event);
+            }
+            
+            if (m_isPlayingBack == true && m_playbackFrame >= m_playback.GetNumFrames())
+            {
+                StopPlayback();
             }
         }
         //------------------------------------------------------------------------------
@@ -226,11 +357,11 @@ namespace ChilliSource
             PointerEvent event;
             event.m_type = PointerEventType::k_add;
             event.m_pointerUniqueId = m_nextUniqueId++;
-            event.m_InputType = Pointer::InputType::k_none;
+            event.m_inputType = Pointer::InputType::k_none;
             event.m_position = in_position;
             event.m_timestamp = 0.0;
             
-            m_eventQueue.push(event);
+            AddEvent(event);
             
             return event.m_pointerUniqueId;
         }
@@ -243,11 +374,11 @@ namespace ChilliSource
             PointerEvent event;
             event.m_type = PointerEventType::k_down;
             event.m_pointerUniqueId = in_pointerUniqueId;
-            event.m_InputType = in_inputType;
+            event.m_inputType = in_inputType;
             event.m_position = Core::Vector2::k_zero;
             event.m_timestamp = ((f64)Core::Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
             
-            m_eventQueue.push(event);
+            AddEvent(event);
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -258,11 +389,11 @@ namespace ChilliSource
             PointerEvent event;
             event.m_type = PointerEventType::k_move;
             event.m_pointerUniqueId = in_pointerUniqueId;
-            event.m_InputType = Pointer::InputType::k_none;
+            event.m_inputType = Pointer::InputType::k_none;
             event.m_position = in_position;
             event.m_timestamp = ((f64)Core::Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
             
-            m_eventQueue.push(event);
+            AddEvent(event);
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -273,11 +404,11 @@ namespace ChilliSource
             PointerEvent event;
             event.m_type = PointerEventType::k_up;
             event.m_pointerUniqueId = in_pointerUniqueId;
-            event.m_InputType = in_inputType;
+            event.m_inputType = in_inputType;
             event.m_position = Core::Vector2::k_zero;
             event.m_timestamp = ((f64)Core::Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
             
-            m_eventQueue.push(event);
+            AddEvent(event);
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -288,11 +419,11 @@ namespace ChilliSource
             PointerEvent event;
             event.m_type = PointerEventType::k_scroll;
             event.m_pointerUniqueId = in_pointerUniqueId;
-            event.m_InputType = Pointer::InputType::k_none;
+            event.m_inputType = Pointer::InputType::k_none;
             event.m_timestamp = ((f64)Core::Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
             event.m_position = in_delta;
             
-            m_eventQueue.push(event);
+            AddEvent(event);
         }
         //------------------------------------------------------------------------------
         //-------------------------------------------------------------------------------
@@ -303,11 +434,11 @@ namespace ChilliSource
             PointerEvent event;
             event.m_type = PointerEventType::k_remove;
             event.m_pointerUniqueId = in_pointerUniqueId;
-            event.m_InputType = Pointer::InputType::k_none;
+            event.m_inputType = Pointer::InputType::k_none;
             event.m_position = Core::Vector2::k_zero;
             event.m_timestamp = 0.0;
             
-            m_eventQueue.push(event);
+            AddEvent(event);
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -315,16 +446,182 @@ namespace ChilliSource
         {
             std::unique_lock<std::mutex> lock(m_mutex);
             
-            while (m_eventQueue.empty() == false)
+            PointerEvent event;
+            while (m_eventRing.try_pop(event) == true)
             {
-                m_eventQueue.pop();
             }
             
+            m_overflowEvents.clear();
+            m_hasOverflowEvents = false;
+            
             lock.unlock();
             
+            m_deferredEvents.clear();
+            m_isPlayingBack = false;
+            m_playback.Clear();
+            m_playbackPointerIds.clear();
+            
             m_pointers.clear();
         }
         //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void PointerSystem::AddEvent(const PointerEvent& in_event)
+        {
+            if (m_overflowEvents.empty() == false || m_eventRing.try_push(in_event) == false)
+            {
+                m_overflowEvents.push_back(in_event);
+                m_hasOverflowEvents.store(true, std::memory_order_release);
+            }
+        }
+        //------------------------------------------------------------------------------
+        /// Any events left in the ring buffer once the producer mutex is held were
+        /// added before those in the overflow list, as producers do not return to the
+        /// ring buffer until the overflow list is empty.
+        //------------------------------------------------------------------------------
+        void PointerSystem::TakeQueuedEvents(std::vector<PointerEvent>& out_events)
+        {
+            PointerEvent event;
+            while (m_eventRing.try_pop(event) == true)
+            {
+                out_events.push_back(event);
+            }
+            
+            if (m_hasOverflowEvents.load(std::memory_order_acquire) == true)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                
+                while (m_eventRing.try_pop(event) == true)
+                {
+                    out_events.push_back(event);
+                }
+                
+                out_events.insert(out_events.end(), m_overflowEvents.begin(), m_overflowEvents.end());
+                m_overflowEvents.clear();
+                m_hasOverflowEvents.store(false, std::memory_order_relaxed);
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void PointerSystem::TakePlaybackEvents(std::vector<PointerEvent>& out_events)
+        {
+            if (m_playbackFrame >= m_playback.GetNumFrames())
+            {
+                return;
+            }
+            
+            for (PointerEvent event : m_playback.GetFrame(m_playbackFrame++))
+            {
+                if (event.m_type == PointerEventType::k_add)
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    const Pointer::Id pointerId = m_nextUniqueId++;
+                    lock.unlock();
+                    
+                    m_playbackPointerIds[event.m_pointerUniqueId] = pointerId;
+                    event.m_pointerUniqueId = pointerId;
+                }
+                else
+                {
+                    auto pointerIdIt = m_playbackPointerIds.find(event.m_pointerUniqueId);
+                    if (pointerIdIt == m_playbackPointerIds.end())
+                    {
+                        CS_LOG_ERROR("PointerSystem: Pointer recording contains an event for an unknown pointer Id.");
+                        continue;
+                    }
+                    
+                    event.m_pointerUniqueId = pointerIdIt->second;
+                    
+                    if (event.m_type == PointerEventType::k_remove)
+                    {
+                        m_playbackPointerIds.erase(pointerIdIt);
+                    }
+                }
+                
+                out_events.push_back(event);
+            }
+        }
+        //------------------------------------------------------------------------------
+        /// A move is only merged into an earlier move of the same pointer if every
+        /// event between them is also a move, so non-move events are never reordered.
+        /// The merged event takes the place of the earlier move.
+        //------------------------------------------------------------------------------
+        void PointerSystem::CoalesceMoveEvents(std::vector<PointerEvent>& inout_events)
+        {
+            m_moveHistory.clear();
+            for (const PointerEvent& event : inout_events)
+            {
+                if (event.m_type == PointerEventType::k_move)
+                {
+                    MoveSample sample;
+                    sample.m_position = event.m_position;
+                    sample.m_timestamp = event.m_timestamp;
+                    m_moveHistory.push_back(std::make_pair(event.m_pointerUniqueId, sample));
+                }
+            }
+            
+            if (m_moveCoalescingEnabled == false)
+            {
+                return;
+            }
+            
+            std::size_t runStart = 0;
+            std::size_t numEvents = 0;
+            for (const PointerEvent& event : inout_events)
+            {
+                if (event.m_type == PointerEventType::k_move)
+                {
+                    auto eventIt = std::find_if(inout_events.begin() + runStart, inout_events.begin() + numEvents, [&event](const PointerEvent& in_event)
+                    {
+                        return (in_event.m_pointerUniqueId == event.m_pointerUniqueId);
+                    });
+                    
+                    if (eventIt != inout_events.begin() + numEvents)
+                    {
+                        *eventIt = event;
+                        continue;
+                    }
+                }
+                
+                inout_events[numEvents++] = event;
+                
+                if (event.m_type != PointerEventType::k_move)
+                {
+                    runStart = numEvents;
+                }
+            }
+            
+            inout_events.resize(numEvents);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void PointerSystem::ProcessEvent(const PointerEvent& in_event)
+        {
+            switch (in_event.m_type)
+            {
+                case PointerEventType::k_add:
+                    CreatePointer(in_event.m_pointerUniqueId, in_event.m_timestamp, in_event.m_position);
+                    break;
+                case PointerEventType::k_down:
+                    PointerDown(in_event.m_pointerUniqueId, in_event.m_timestamp, in_event.m_inputType);
+                    break;
+                case PointerEventType::k_move:
+                    PointerMoved(in_event.m_pointerUniqueId, in_event.m_timestamp, in_event.m_position);
+                    break;
+                case PointerEventType::k_up:
+                    PointerUp(in_event.m_pointerUniqueId, in_event.m_timestamp, in_event.m_inputType);
+                    break;
+                case PointerEventType::k_scroll:
+                    PointerScrolled(in_event.m_pointerUniqueId, in_event.m_timestamp, in_event.m_position);
+                    break;
+                case PointerEventType::k_remove:
+                    RemovePointer(in_event.m_pointerUniqueId, in_event.m_timestamp);
+                    break;
+                default:
+                    CS_LOG_FATAL("Something has gone very wrong while processing buffered input");
+                    break;
+            }
+        }
+        //------------------------------------------------------------------------------
         //-------------------------------------------------------------------------------
         void PointerSystem::CreatePointer(Pointer::Id in_uniqueId, f64 in_timestamp, const Core::Vector2& in_initialPosition)
         {
@@ -32,11 +32,14 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Event/Event.h>
 #include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Container/spsc_ring_buffer.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Input/Pointer/Pointer.h>
+#include <ChilliSource/Input/Pointer/PointerEvent.h>
+#include <ChilliSource/Input/Pointer/PointerRecording.h>
 
+#include <atomic>
 #include <mutex>
-#include <queue>
 #include <set>
 #include <unordered_map>
 
@@ -48,6 +51,14 @@ namespace ChilliSource
         /// A system that provides a generic API for working with pointer devices.
         /// Pointers include touches on a touch screen and the mouse on a PC.
         ///
+        /// Events received from the OS are passed to the main thread through a
+        /// lock-free ring buffer and processed once per frame. By default, consecutive
+        /// move events for the same pointer within a frame are coalesced into a single
+        /// event; the full list of positions is still available from GetMoveHistory().
+        ///
+        /// The raw events can be recorded and later played back in place of live
+        /// input, allowing input heavy frames to be reproduced deterministically.
+        ///
         /// @author Ian Copland
         //------------------------------------------------------------------------------
         class PointerSystem : public Core::AppSystem
@@ -55,6 +66,16 @@ namespace ChilliSource
         public:
             CS_DECLARE_NAMEDTYPE(PointerSystem);
             //------------------------------------------------------------------------------
+            /// A single position a pointer moved through.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            struct MoveSample
+            {
+                Core::Vector2 m_position;
+                f64 m_timestamp;
+            };
+            //------------------------------------------------------------------------------
             /// A delegate that is used to receive pointer added events.
             ///
             /// On platforms which use a mouse this occurs once: when the mouse is first
@@ -245,6 +266,80 @@ namespace ChilliSource
             //------------------------------------------------------------------------------
             std::vector<Pointer> GetPointers() const;
             //------------------------------------------------------------------------------
+            /// Sets whether or not consecutive move events for the same pointer within a
+            /// single frame are coalesced into one move event to the final position. Move
+            /// events are only coalesced if no other type of event was received between
+            /// them, so the order of moves relative to other events is maintained. This is
+            /// enabled by default.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param in_enabled - Whether or not move coalescing is enabled.
+            //------------------------------------------------------------------------------
+            void SetMoveCoalescingEnabled(bool in_enabled);
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not move coalescing is enabled.
+            //------------------------------------------------------------------------------
+            bool IsMoveCoalescingEnabled() const;
+            //------------------------------------------------------------------------------
+            /// Returns every position the given pointer moved through during the most
+            /// recently processed frame, in order, including those which were coalesced.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param in_uniqueId - The unique Id of the pointer.
+            ///
+            /// @return The move history of the pointer.
+            //------------------------------------------------------------------------------
+            std::vector<MoveSample> GetMoveHistory(Pointer::Id in_uniqueId) const;
+            //------------------------------------------------------------------------------
+            /// Starts recording the raw pointer events received each frame, prior to move
+            /// coalescing. This cannot be called while recording or playing back.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            void StartRecording();
+            //------------------------------------------------------------------------------
+            /// Stops recording pointer events.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The recording.
+            //------------------------------------------------------------------------------
+            PointerRecording StopRecording();
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not pointer events are being recorded.
+            //------------------------------------------------------------------------------
+            bool IsRecording() const;
+            //------------------------------------------------------------------------------
+            /// Starts playing back the given recording, one recorded frame per processed
+            /// frame. The pointers in the recording are created as new pointers, and are
+            /// released and removed when playback ends. Live input received during playback
+            /// is held back and processed once playback ends. This cannot be called while
+            /// recording or playing back.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param in_recording - The recording to play back.
+            //------------------------------------------------------------------------------
+            void StartPlayback(const PointerRecording& in_recording);
+            //------------------------------------------------------------------------------
+            /// Stops any playback, releasing and removing any pointers created by it.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            void StopPlayback();
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not a recording is being played back.
+            //------------------------------------------------------------------------------
+            bool IsPlayingBack() const;
+            //------------------------------------------------------------------------------
             /// Hide the pointer cursor if one exists
             ///
             /// @author S Downie
@@ -257,7 +352,8 @@ namespace ChilliSource
             //------------------------------------------------------------------------------
             virtual void ShowCursor() = 0;
             //------------------------------------------------------------------------------
-            /// Process all input events that have been received from the OS.
+            /// Process all input events that have been received from the OS, or the next
+            /// frame of the recording being played back.
             ///
             /// @author Ian Copland
             //------------------------------------------------------------------------------
@@ -344,7 +440,8 @@ namespace ChilliSource
             //------------------------------------------------------------------------------
             void AddPointerRemoveEvent(Pointer::Id in_pointerUniqueId);
             //------------------------------------------------------------------------------
-            /// Removes all existing pointers. This must be called from the main thread.
+            /// Removes all existing pointers and discards any queued events, stopping any
+            /// playback. This must be called from the main thread.
             ///
             /// @author Ian Copland
             //------------------------------------------------------------------------------
@@ -363,32 +460,54 @@ namespace ChilliSource
             //------------------------------------------------------------------------------
             static PointerSystemUPtr Create();
             //------------------------------------------------------------------------------
-            /// An enum describing the different types of pointer event.
+            /// Queues the given event for processing on the main thread. The producer
+            /// mutex must be locked when this is called.
+            ///
+            /// Events are normally pushed onto the ring buffer. If it is full they are
+            /// added to the overflow list instead, which continues to be used until the
+            /// main thread has emptied it, maintaining the order of events.
             ///
             /// @author Ian Copland
+            ///
+            /// @param in_event - The event.
             //------------------------------------------------------------------------------
-            enum class PointerEventType
-            {
-                k_add,
-                k_down,
-                k_move,
-                k_up,
-                k_scroll,
-                k_remove
-            };
+            void AddEvent(const PointerEvent& in_event);
             //------------------------------------------------------------------------------
-            /// A container for information on a single pointer event.
+            /// Moves all queued events into the given list. This must be called from the
+            /// main thread.
             ///
             /// @author Ian Copland
+            ///
+            /// @param out_events - [Out] The list the events are appended to.
             //------------------------------------------------------------------------------
-            struct PointerEvent
-            {
-                PointerEventType m_type;
-                Pointer::Id m_pointerUniqueId;
-                Core::Vector2 m_position;
-                Pointer::InputType m_InputType;
-                f64 m_timestamp;
-            };
+            void TakeQueuedEvents(std::vector<PointerEvent>& out_events);
+            //------------------------------------------------------------------------------
+            /// Appends the events in the next frame of the playback recording to the given
+            /// list, mapping the recorded pointer Ids to those of the pointers created for
+            /// playback.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param out_events - [Out] The list the events are appended to.
+            //------------------------------------------------------------------------------
+            void TakePlaybackEvents(std::vector<PointerEvent>& out_events);
+            //------------------------------------------------------------------------------
+            /// Records the move history for the given events, and then coalesces
+            /// consecutive move events for the same pointer if enabled.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param inout_events - [In/Out] The events.
+            //------------------------------------------------------------------------------
+            void CoalesceMoveEvents(std::vector<PointerEvent>& inout_events);
+            //------------------------------------------------------------------------------
+            /// Updates the pointers and notifies listeners for the given event.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param in_event - The event.
+            //------------------------------------------------------------------------------
+            void ProcessEvent(const PointerEvent& in_event);
             //------------------------------------------------------------------------------
             /// Creates and adds a new pointer to the list.
             ///
@@ -513,11 +632,27 @@ namespace ChilliSource
             Core::Event<PointerDownDelegateInternal> m_pointerDownEventInternal;
             Core::Event<PointerScrollDelegateInternal> m_pointerScrolledEventInternal;
             
+            //the producer mutex serialises the threads adding events, as the ring buffer only
+            //supports a single producer. It is only taken by the main thread on overflow.
             std::mutex m_mutex;
             std::vector<Pointer> m_pointers;
-            std::queue<PointerEvent> m_eventQueue;
+            Core::spsc_ring_buffer<PointerEvent> m_eventRing;
+            std::vector<PointerEvent> m_overflowEvents;
+            std::atomic<bool> m_hasOverflowEvents;
             Pointer::Id m_nextUniqueId;
             
+            std::vector<PointerEvent> m_frameEvents;
+            std::vector<std::pair<Pointer::Id, MoveSample>> m_moveHistory;
+            bool m_moveCoalescingEnabled = true;
+            
+            bool m_isRecording = false;
+            PointerRecording m_recording;
+            bool m_isPlayingBack = false;
+            PointerRecording m_playback;
+            u32 m_playbackFrame = 0;
+            std::unordered_map<Pointer::Id, Pointer::Id> m_playbackPointerIds;
+            std::vector<PointerEvent> m_deferredEvents;
+            
             std::unordered_map<Pointer::Id, std::set<Pointer::InputType>> m_filteredPointerInput;
         };
     }
@@ -33,9 +33,11 @@
 #include <ChilliSource/Core/Math/MathUtils.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Core/String/UTF8StringUtils.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 #include <ChilliSource/Rendering/Font/Font.h>
 #include <ChilliSource/Rendering/Material/Material.h>
 #include <ChilliSource/Rendering/Material/MaterialFactory.h>
+#include <ChilliSource/Rendering/Texture/DynamicTextureAtlas.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/UI/Base/Canvas.h>
 
@@ -50,6 +52,24 @@ namespace ChilliSource
             const f32 k_maxAutoScaleIterations = 10.0f;//Max number of recursions to find the correct scale
             const f32 k_autoScaleTolerance = 0.01f;//Min difference in max/min scaling to warrant further recursion for AutoScaled text
             
+            const u32 k_maxCachedTexts = 1024;//Number of cached texts above which unused texts will be removed
+            const u32 k_textCacheLifetimeFrames = 60;//Number of frames a cached text must go unused before it can be removed
+            const u32 k_textCachePurgeIntervalFrames = 60;//Number of frames between removing texts built with destroyed or rebuilt fonts
+            
+            //------------------------------------------------------
+            /// Combines the given hash with the hash of the given
+            /// value.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param [In/Out] The hash.
+            /// @param The value.
+            //------------------------------------------------------
+            template <typename TValueType> void HashCombine(std::size_t& inout_hash, const TValueType& in_value)
+            {
+                inout_hash ^= std::hash<TValueType>()(in_value) + 0x9e3779b9 + (inout_hash << 6) + (inout_hash >> 2);
+            }
+            
             //------------------------------------------------------
             /// Converts a 2D transformation matrix to a 3D
             /// Transformation matrix. This will only work for
@@ -415,6 +435,125 @@ namespace ChilliSource
                 out_sprite.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vPos.z = -k_nearClipDistance;
                 out_sprite.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vPos.w = 1.0f;
             }
+            //-----------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param UVs relative to a sub-region of a texture.
+            /// @param The UVs of the sub-region.
+            ///
+            /// @return The UVs relative to the whole texture.
+            //-----------------------------------------------------
+            UVs RemapUVs(const UVs& in_UVs, const UVs& in_regionUVs)
+            {
+                return UVs(in_regionUVs.m_u + in_UVs.m_u * in_regionUVs.m_s, in_regionUVs.m_v + in_UVs.m_v * in_regionUVs.m_t, in_UVs.m_s * in_regionUVs.m_s, in_UVs.m_t * in_regionUVs.m_t);
+            }
+            //-----------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The sprite.
+            ///
+            /// @return Whether or not the edges of the sprite are
+            /// aligned with the screen axes, in which case it can
+            /// be clipped on the CPU.
+            //-----------------------------------------------------
+            bool IsAxisAligned(const SpriteBatch::SpriteData& in_sprite)
+            {
+                const auto& topLeft = in_sprite.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vPos;
+                const auto& bottomLeft = in_sprite.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vPos;
+                const auto& topRight = in_sprite.sVerts[(u32)SpriteBatch::Verts::k_topRight].vPos;
+                const auto& bottomRight = in_sprite.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vPos;
+                
+                return (topLeft.x == bottomLeft.x && topRight.x == bottomRight.x && topLeft.y == topRight.y && bottomLeft.y == bottomRight.y);
+            }
+            //-----------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The sprite.
+            /// @param The bottom left of the clip bounds.
+            /// @param The top right of the clip bounds.
+            ///
+            /// @return Whether or not the bounding box of the sprite
+            /// lies entirely outside the clip bounds.
+            //-----------------------------------------------------
+            bool IsOutsideClipBounds(const SpriteBatch::SpriteData& in_sprite, const Core::Vector2& in_clipBottomLeft, const Core::Vector2& in_clipTopRight)
+            {
+                f32 minX = in_sprite.sVerts[0].vPos.x;
+                f32 maxX = minX;
+                f32 minY = in_sprite.sVerts[0].vPos.y;
+                f32 maxY = minY;
+                
+                for (u32 i = 1; i < (u32)SpriteBatch::Verts::k_total; ++i)
+                {
+                    minX = std::min(minX, in_sprite.sVerts[i].vPos.x);
+                    maxX = std::max(maxX, in_sprite.sVerts[i].vPos.x);
+                    minY = std::min(minY, in_sprite.sVerts[i].vPos.y);
+                    maxY = std::max(maxY, in_sprite.sVerts[i].vPos.y);
+                }
+                
+                return (maxX <= in_clipBottomLeft.x || minX >= in_clipTopRight.x || maxY <= in_clipBottomLeft.y || minY >= in_clipTopRight.y);
+            }
+            //-----------------------------------------------------
+            /// Clips an axis-aligned sprite to the given clip
+            /// bounds, adjusting the UVs in proportion to the
+            /// positions. The sprite must overlap the clip bounds.
+            /// Mirrored sprites, where left is greater than right
+            /// or bottom greater than top, are supported.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The bottom left of the clip bounds.
+            /// @param The top right of the clip bounds.
+            /// @param [In/Out] The sprite.
+            //-----------------------------------------------------
+            void ClipAxisAlignedSprite(const Core::Vector2& in_clipBottomLeft, const Core::Vector2& in_clipTopRight, SpriteBatch::SpriteData& inout_sprite)
+            {
+                auto& topLeft = inout_sprite.sVerts[(u32)SpriteBatch::Verts::k_topLeft];
+                auto& bottomLeft = inout_sprite.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft];
+                auto& topRight = inout_sprite.sVerts[(u32)SpriteBatch::Verts::k_topRight];
+                auto& bottomRight = inout_sprite.sVerts[(u32)SpriteBatch::Verts::k_bottomRight];
+                
+                const f32 left = topLeft.vPos.x;
+                const f32 right = topRight.vPos.x;
+                if (std::min(left, right) < in_clipBottomLeft.x || std::max(left, right) > in_clipTopRight.x)
+                {
+                    const f32 clippedLeft = Core::MathUtils::Clamp(left, in_clipBottomLeft.x, in_clipTopRight.x);
+                    const f32 clippedRight = Core::MathUtils::Clamp(right, in_clipBottomLeft.x, in_clipTopRight.x);
+                    const f32 leftU = topLeft.vTex.x;
+                    const f32 deltaU = topRight.vTex.x - leftU;
+                    const f32 clippedLeftU = leftU + deltaU * ((clippedLeft - left) / (right - left));
+                    const f32 clippedRightU = leftU + deltaU * ((clippedRight - left) / (right - left));
+                    
+                    topLeft.vPos.x = clippedLeft;
+                    bottomLeft.vPos.x = clippedLeft;
+                    topRight.vPos.x = clippedRight;
+                    bottomRight.vPos.x = clippedRight;
+                    topLeft.vTex.x = clippedLeftU;
+                    bottomLeft.vTex.x = clippedLeftU;
+                    topRight.vTex.x = clippedRightU;
+                    bottomRight.vTex.x = clippedRightU;
+                }
+                
+                const f32 top = topLeft.vPos.y;
+                const f32 bottom = bottomLeft.vPos.y;
+                if (std::min(top, bottom) < in_clipBottomLeft.y || std::max(top, bottom) > in_clipTopRight.y)
+                {
+                    const f32 clippedTop = Core::MathUtils::Clamp(top, in_clipBottomLeft.y, in_clipTopRight.y);
+                    const f32 clippedBottom = Core::MathUtils::Clamp(bottom, in_clipBottomLeft.y, in_clipTopRight.y);
+                    const f32 topV = topLeft.vTex.y;
+                    const f32 deltaV = bottomLeft.vTex.y - topV;
+                    const f32 clippedTopV = topV + deltaV * ((clippedTop - top) / (bottom - top));
+                    const f32 clippedBottomV = topV + deltaV * ((clippedBottom - top) / (bottom - top));
+                    
+                    topLeft.vPos.y = clippedTop;
+                    topRight.vPos.y = clippedTop;
+                    bottomLeft.vPos.y = clippedBottom;
+                    bottomRight.vPos.y = clippedBottom;
+                    topLeft.vTex.y = clippedTopV;
+                    topRight.vTex.y = clippedTopV;
+                    bottomLeft.vTex.y = clippedBottomV;
+                    bottomRight.vTex.y = clippedBottomV;
+                }
+            }
             //----------------------------------------------------------------------------
             /// Adds an ellipsis to the end of the line of text without increasing the
             /// width of the line of text beyond the given length. If required, characters
@@ -719,30 +858,34 @@ namespace ChilliSource
             CS_ASSERT(m_screen != nullptr, "Canvas renderer cannot find screen system");
 
             m_overlayBatcher = DynamicSpriteBatchUPtr(new DynamicSpriteBatch(renderSystem));
+            
+            m_dynamicAtlas = Core::Application::Get()->GetSystem<DynamicTextureAtlas>();
         }
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
-        MaterialCSPtr CanvasRenderer::GetGUIMaterialForTexture(const TextureCSPtr& in_texture)
+        MaterialCSPtr CanvasRenderer::GetGUIMaterialForTexture(const TextureCSPtr& in_texture, bool in_isDistanceField)
         {
-            auto itExistingEntry = m_materialGUICache.find(in_texture);
-            if(itExistingEntry != m_materialGUICache.end())
+            auto& materialCache = (in_isDistanceField == true) ? m_materialGUIDistanceFieldCache : m_materialGUICache;
+            
+            auto itExistingEntry = materialCache.find(in_texture);
+            if(itExistingEntry != materialCache.end())
             {
                 return itExistingEntry->second;
             }
             else
             {
-                std::string materialId("_GUI:" + Core::ToString(in_texture->GetId()));
+                std::string materialId(((in_isDistanceField == true) ? "_GUIDistanceField:" : "_GUI:") + Core::ToString(in_texture->GetId()));
                 MaterialCSPtr materialExisting = m_resourcePool->GetResource<Material>(materialId);
 
                 if(materialExisting != nullptr)
                 {
-                    m_materialGUICache.insert(std::make_pair(in_texture, materialExisting));
+                    materialCache.insert(std::make_pair(in_texture, materialExisting));
                     return materialExisting;
                 }
 
-                MaterialSPtr materialNew = m_materialFactory->CreateGUI(materialId);
+                MaterialSPtr materialNew = (in_isDistanceField == true) ? m_materialFactory->CreateGUIDistanceField(materialId) : m_materialFactory->CreateGUI(materialId);
                 materialNew->AddTexture(in_texture);
-                m_materialGUICache.insert(std::make_pair(in_texture, materialNew));
+                materialCache.insert(std::make_pair(in_texture, materialNew));
 
                 return materialNew;
             }
@@ -754,15 +897,23 @@ namespace ChilliSource
 		//----------------------------------------------------------
 		void CanvasRenderer::Render(UI::Canvas* in_canvas)
 		{
+            CS_PROFILE_SCOPE("CanvasRenderer::Render");
+            
 			CS_ASSERT(in_canvas != nullptr, "Canvas cannot render null UI canvas");
 
             in_canvas->Draw(this);
 
 			m_overlayBatcher->DisableScissoring();
 			m_overlayBatcher->ForceRender();
+            m_appliedScissorDepth = 0;
+            m_isAppliedScissorStale = false;
 
             m_materialGUICache.clear();
+            m_materialGUIDistanceFieldCache.clear();
 			m_canvasSprite.pMaterial = nullptr;
+
+            TrimTextCache();
+            ++m_frameIndex;
 		}
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
@@ -794,8 +945,6 @@ namespace ChilliSource
                 m_scissorPositions.push_back(vNewBottomLeft);
                 m_scissorSizes.push_back(vNewSize);
             }
-
-            m_overlayBatcher->EnableScissoring(m_scissorPositions.back(), m_scissorSizes.back());
         }
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
@@ -806,31 +955,67 @@ namespace ChilliSource
                 m_scissorPositions.erase(m_scissorPositions.end()-1);
                 m_scissorSizes.erase(m_scissorSizes.end()-1);
 
-                if(!m_scissorPositions.empty())
+                //The scissor region applied to the batcher no longer contains the current clip bounds, so must be
+                //updated before anything else is drawn.
+                if(m_appliedScissorDepth > m_scissorPositions.size())
                 {
-                    m_overlayBatcher->EnableScissoring(m_scissorPositions.back(), m_scissorSizes.back());
+                    m_isAppliedScissorStale = true;
                 }
             }
-
-            if(m_scissorPositions.empty())
-            {
-                m_overlayBatcher->DisableScissoring();
-            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void CanvasRenderer::SetClipMode(ClipMode in_clipMode)
+        {
+            m_clipMode = in_clipMode;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        CanvasRenderer::ClipMode CanvasRenderer::GetClipMode() const
+        {
+            return m_clipMode;
         }
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
         void CanvasRenderer::DrawBox(const Core::Matrix3& in_transform, const Core::Vector2& in_size, const Core::Vector2& in_offset, const TextureCSPtr& in_texture, const Rendering::UVs& in_UVs,
                                      const Core::Colour& in_colour, AlignmentAnchor in_anchor)
         {
-            m_canvasSprite.pMaterial = GetGUIMaterialForTexture(in_texture);
+            UVs remappedUVs = in_UVs;
+            SetCanvasSpriteTexture(in_texture, remappedUVs);
 
-			UpdateSpriteData(Convert2DTransformTo3D(in_transform), in_size, in_offset, in_UVs, in_colour, in_anchor, m_canvasSprite);
+			UpdateSpriteData(Convert2DTransformTo3D(in_transform), in_size, in_offset, remappedUVs, in_colour, in_anchor, m_canvasSprite);
 
-			m_overlayBatcher->Render(m_canvasSprite);
+			RenderCanvasSprite();
         }
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
         CanvasRenderer::BuiltText CanvasRenderer::BuildText(const std::string& in_text, const FontCSPtr& in_font, const Core::Vector2& in_bounds, const TextProperties& in_properties, f32& out_textScale) const
+        {
+            TextCacheKey key{in_font.get(), in_font->GetBuildId(), in_text, in_bounds, in_properties};
+            
+            auto it = m_textCache.find(key);
+            if (it == m_textCache.end())
+            {
+                TextCacheEntry entry;
+                entry.m_font = in_font;
+                entry.m_builtText = BuildTextUncached(in_text, in_font, in_bounds, in_properties, entry.m_textScale);
+                it = m_textCache.emplace(std::move(key), std::move(entry)).first;
+            }
+            
+            it->second.m_lastUsedFrame = m_frameIndex;
+            out_textScale = it->second.m_textScale;
+            
+            return it->second.m_builtText;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void CanvasRenderer::ClearTextCache()
+        {
+            m_textCache.clear();
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        CanvasRenderer::BuiltText CanvasRenderer::BuildTextUncached(const std::string& in_text, const FontCSPtr& in_font, const Core::Vector2& in_bounds, const TextProperties& in_properties, f32& out_textScale) const
         {
             BuiltText result;
             result.m_width = 0.0f;
@@ -895,9 +1080,18 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
-		void CanvasRenderer::DrawText(const std::vector<DisplayCharacterInfo>& in_characters, const Core::Matrix3& in_transform, const Core::Colour& in_colour, const TextureCSPtr& in_texture)
+		void CanvasRenderer::DrawText(const std::vector<DisplayCharacterInfo>& in_characters, const Core::Matrix3& in_transform, const Core::Colour& in_colour, const TextureCSPtr& in_texture, bool in_isDistanceField)
 		{
-            m_canvasSprite.pMaterial = GetGUIMaterialForTexture(in_texture);
+            UVs regionUVs;
+            if (in_isDistanceField == true)
+            {
+                //distance field atlases are never in the dynamic atlas.
+                m_canvasSprite.pMaterial = GetGUIMaterialForTexture(in_texture, true);
+            }
+            else
+            {
+                SetCanvasSpriteTexture(in_texture, regionUVs);
+            }
 
             Core::Matrix4 matTransform = Convert2DTransformTo3D(in_transform);
             Core::Matrix4 matTransformedLocal;
@@ -905,16 +1099,145 @@ namespace ChilliSource
 			for (const auto& character : in_characters)
             {
                 matTransformedLocal = Core::Matrix4::CreateTranslation(Core::Vector3(character.m_position, 0.0f)) * matTransform;
-                UpdateSpriteData(matTransformedLocal, character.m_packedImageSize, Core::Vector2::k_zero, character.m_UVs, in_colour, AlignmentAnchor::k_topLeft, m_canvasSprite);
-                m_overlayBatcher->Render(m_canvasSprite);
+                UpdateSpriteData(matTransformedLocal, character.m_packedImageSize, Core::Vector2::k_zero, RemapUVs(character.m_UVs, regionUVs), in_colour, AlignmentAnchor::k_topLeft, m_canvasSprite);
+                RenderCanvasSprite();
 			}
 		}
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
+        void CanvasRenderer::SetCanvasSpriteTexture(const TextureCSPtr& in_texture, UVs& inout_UVs)
+        {
+            const DynamicTextureAtlas::Region* region = (m_dynamicAtlas != nullptr) ? m_dynamicAtlas->GetRegion(in_texture) : nullptr;
+            if (region != nullptr)
+            {
+                m_canvasSprite.pMaterial = GetGUIMaterialForTexture(region->m_pageTexture);
+                inout_UVs = RemapUVs(inout_UVs, region->m_UVs);
+            }
+            else
+            {
+                m_canvasSprite.pMaterial = GetGUIMaterialForTexture(in_texture);
+            }
+        }
+        //----------------------------------------------------------------------------
+        /// The clip bounds stack is nested, so while the applied scissor region is
+        /// not stale it contains the current clip bounds. A sprite clipped on the CPU
+        /// is therefore unaffected by it and the scissor state need not change,
+        /// which avoids breaking the batch.
+        //----------------------------------------------------------------------------
+        void CanvasRenderer::RenderCanvasSprite()
+        {
+            const u32 clipDepth = u32(m_scissorPositions.size());
+            bool needsScissor = false;
+            
+            if (clipDepth > 0)
+            {
+                const Core::Vector2& clipBottomLeft = m_scissorPositions.back();
+                const Core::Vector2 clipTopRight = clipBottomLeft + m_scissorSizes.back();
+                
+                if (IsOutsideClipBounds(m_canvasSprite, clipBottomLeft, clipTopRight) == true)
+                {
+                    return;
+                }
+                
+                if (m_clipMode == ClipMode::k_cpu && IsAxisAligned(m_canvasSprite) == true)
+                {
+                    ClipAxisAlignedSprite(clipBottomLeft, clipTopRight, m_canvasSprite);
+                }
+                else
+                {
+                    needsScissor = true;
+                }
+            }
+            
+            if (needsScissor == true)
+            {
+                if (m_appliedScissorDepth != clipDepth || m_isAppliedScissorStale == true)
+                {
+                    m_overlayBatcher->EnableScissoring(m_scissorPositions.back(), m_scissorSizes.back());
+                    m_appliedScissorDepth = clipDepth;
+                    m_isAppliedScissorStale = false;
+                }
+            }
+            else if (m_appliedScissorDepth > 0 && m_isAppliedScissorStale == true)
+            {
+                m_overlayBatcher->DisableScissoring();
+                m_appliedScissorDepth = 0;
+                m_isAppliedScissorStale = false;
+            }
+            
+            m_overlayBatcher->Render(m_canvasSprite);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void CanvasRenderer::TrimTextCache()
+        {
+            const bool isOverLimit = (m_textCache.size() > k_maxCachedTexts);
+            if (isOverLimit == false && m_frameIndex % k_textCachePurgeIntervalFrames != 0)
+            {
+                return;
+            }
+            
+            for (auto it = m_textCache.begin(); it != m_textCache.end();)
+            {
+                FontCSPtr font = it->second.m_font.lock();
+                const bool isFontOutOfDate = (font == nullptr || font->GetBuildId() != it->first.m_fontBuildId);
+                const bool isUnused = (m_frameIndex - it->second.m_lastUsedFrame >= k_textCacheLifetimeFrames);
+                
+                if (isFontOutOfDate == true || (isOverLimit == true && isUnused == true))
+                {
+                    it = m_textCache.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        bool CanvasRenderer::TextCacheKey::operator==(const TextCacheKey& in_other) const
+        {
+            return (m_font == in_other.m_font && m_fontBuildId == in_other.m_fontBuildId && m_bounds == in_other.m_bounds &&
+                    m_properties.m_textScale == in_other.m_properties.m_textScale &&
+                    m_properties.m_minTextScale == in_other.m_properties.m_minTextScale &&
+                    m_properties.m_absCharSpacingOffset == in_other.m_properties.m_absCharSpacingOffset &&
+                    m_properties.m_absLineSpacingOffset == in_other.m_properties.m_absLineSpacingOffset &&
+                    m_properties.m_lineSpacingScale == in_other.m_properties.m_lineSpacingScale &&
+                    m_properties.m_maxNumLines == in_other.m_properties.m_maxNumLines &&
+                    m_properties.m_shouldAutoScale == in_other.m_properties.m_shouldAutoScale &&
+                    m_properties.m_horizontalJustification == in_other.m_properties.m_horizontalJustification &&
+                    m_properties.m_verticalJustification == in_other.m_properties.m_verticalJustification &&
+                    m_text == in_other.m_text);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        std::size_t CanvasRenderer::TextCacheKeyHash::operator()(const TextCacheKey& in_key) const
+        {
+            std::size_t hash = std::hash<std::string>()(in_key.m_text);
+            HashCombine(hash, in_key.m_font);
+            HashCombine(hash, in_key.m_fontBuildId);
+            HashCombine(hash, in_key.m_bounds.x);
+            HashCombine(hash, in_key.m_bounds.y);
+            HashCombine(hash, in_key.m_properties.m_textScale);
+            HashCombine(hash, in_key.m_properties.m_minTextScale);
+            HashCombine(hash, in_key.m_properties.m_absCharSpacingOffset);
+            HashCombine(hash, in_key.m_properties.m_absLineSpacingOffset);
+            HashCombine(hash, in_key.m_properties.m_lineSpacingScale);
+            HashCombine(hash, in_key.m_properties.m_maxNumLines);
+            HashCombine(hash, in_key.m_properties.m_shouldAutoScale);
+            HashCombine(hash, u32(in_key.m_properties.m_horizontalJustification));
+            HashCombine(hash, u32(in_key.m_properties.m_verticalJustification));
+            
+            return hash;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
         void CanvasRenderer::OnDestroy()
         {
             m_overlayBatcher = nullptr;
             m_materialGUICache.clear();
+            m_materialGUIDistanceFieldCache.clear();
+            m_textCache.clear();
             m_canvasSprite.pMaterial = nullptr;
         }
 	}
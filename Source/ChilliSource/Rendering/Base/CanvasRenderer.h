@@ -54,6 +54,22 @@ namespace ChilliSource
 		public:
             CS_DECLARE_NAMEDTYPE(CanvasRenderer);
             //----------------------------------------------------------------------------
+            /// Describes how quads are clipped against the current clip bounds.
+            ///
+            /// * Scissor - All clipping uses the render system scissor test. Each
+            /// change in clip bounds breaks the sprite batch.
+            /// * CPU - Axis-aligned quads have their positions and UVs clipped on the
+            /// CPU, so they are batched regardless of clip bounds. Rotated quads
+            /// still fall back to the scissor test.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            enum class ClipMode
+            {
+                k_scissor,
+                k_cpu
+            };
+            //----------------------------------------------------------------------------
             /// A container for text properties for altering the look of built text.
             ///
             /// @author Ian Copland
@@ -136,6 +152,20 @@ namespace ChilliSource
             //----------------------------------------------------------------------------
             void PopClipBounds();
             //----------------------------------------------------------------------------
+            /// Sets how quads are clipped against the clip bounds. Defaults to CPU.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The clip mode.
+            //----------------------------------------------------------------------------
+            void SetClipMode(ClipMode in_clipMode);
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return How quads are clipped against the clip bounds.
+            //----------------------------------------------------------------------------
+            ClipMode GetClipMode() const;
+            //----------------------------------------------------------------------------
             /// Build a sprite box and render it to screen
             ///
             /// @param Transform
@@ -154,6 +184,10 @@ namespace ChilliSource
             /// build to fit into the given bounds and will wrap and then clip in
             /// order to fit.
             ///
+            /// Built text is cached, keyed on the text, font, bounds and properties,
+            /// so building the same text again, such as for another label showing
+            /// the same value, doesn't repeat the layout.
+            ///
             /// @author S Downie
             ///
             /// @param in_text - Text to convert to display characters (UTF-8)
@@ -172,13 +206,64 @@ namespace ChilliSource
             /// @param Transform to screen space
             /// @param Colour
             /// @param Texture
+            /// @param Whether or not the texture is a signed distance field font
+            /// atlas, in which case the distance field shader is used.
             //----------------------------------------------------------------------------
-			void DrawText(const std::vector<DisplayCharacterInfo>& in_characters, const Core::Matrix3& in_transform, const Core::Colour& in_colour, const TextureCSPtr& in_texture);
+			void DrawText(const std::vector<DisplayCharacterInfo>& in_characters, const Core::Matrix3& in_transform, const Core::Colour& in_colour, const TextureCSPtr& in_texture, bool in_isDistanceField = false);
+            //----------------------------------------------------------------------------
+            /// Clears the cache of built text, freeing its memory. Cached text built
+            /// with a font that has since been rebuilt or destroyed is discarded
+            /// automatically, so this doesn't need to be called when fonts change.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            void ClearTextCache();
 
 		private:
 
             friend class Core::Application;
             //----------------------------------------------------------------------------
+            /// The inputs used to build text, used as the key into the text cache.
+            /// The font is identified by its address and build Id rather than held,
+            /// so that the cache doesn't keep fonts alive, and text built with a
+            /// font which has since been rebuilt is never matched.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            struct TextCacheKey
+            {
+                const Font* m_font;
+                u32 m_fontBuildId;
+                std::string m_text;
+                Core::Vector2 m_bounds;
+                TextProperties m_properties;
+                
+                bool operator==(const TextCacheKey& in_other) const;
+            };
+            //----------------------------------------------------------------------------
+            /// Hash function for the text cache key.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            struct TextCacheKeyHash
+            {
+                std::size_t operator()(const TextCacheKey& in_key) const;
+            };
+            //----------------------------------------------------------------------------
+            /// A cached piece of built text along with the last frame it was used.
+            /// A weak reference to the font is kept so entries can be discarded once
+            /// the font is destroyed.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            struct TextCacheEntry
+            {
+                FontCWPtr m_font;
+                BuiltText m_builtText;
+                f32 m_textScale = 1.0f;
+                u32 m_lastUsedFrame = 0;
+            };
+            //----------------------------------------------------------------------------
             /// Creates a new instance of the system.
             ///
             /// @author S Downie
@@ -208,11 +293,53 @@ namespace ChilliSource
             /// @author S Downie
             ///
             /// @param Texture
+            /// @param Whether or not the texture is a signed distance field.
             ///
             /// @return Cached or new GUI material that has the given
             /// texture
             //----------------------------------------------------------------------------
-            MaterialCSPtr GetGUIMaterialForTexture(const TextureCSPtr& in_texture);
+            MaterialCSPtr GetGUIMaterialForTexture(const TextureCSPtr& in_texture, bool in_isDistanceField = false);
+            //----------------------------------------------------------------------------
+            /// Sets the material of the canvas sprite for the given texture. If the
+            /// texture is in the dynamic texture atlas, the atlas page is used instead
+            /// and the UVs are remapped to the texture's region of the page.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The texture.
+            /// @param [In/Out] The UVs.
+            //----------------------------------------------------------------------------
+            void SetCanvasSpriteTexture(const TextureCSPtr& in_texture, UVs& inout_UVs);
+            //----------------------------------------------------------------------------
+            /// Clips the canvas sprite against the current clip bounds and passes it
+            /// to the batcher. Sprites entirely outside the clip bounds are dropped.
+            /// Scissoring is only enabled on the batcher when a sprite cannot be
+            /// clipped on the CPU.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            void RenderCanvasSprite();
+            //----------------------------------------------------------------------------
+            /// Builds the given text without using the text cache. See BuildText().
+            ///
+            /// @author S Downie
+            ///
+            /// @param in_text - Text to convert to display characters (UTF-8)
+            /// @param in_font - Font to use
+            /// @param in_bounds - Max bounds
+            /// @param in_textProperties - The text properties used to build.
+            /// @param [Out] out_textScale - Final scale that should be used
+            ///
+            /// @return Built text struct containing all the character infos
+            //----------------------------------------------------------------------------
+            BuiltText BuildTextUncached(const std::string& in_text, const FontCSPtr& in_font, const Core::Vector2& in_bounds, const TextProperties& in_textProperties, f32& out_textScale) const;
+            //----------------------------------------------------------------------------
+            /// Removes text which hasn't been used recently from the text cache if
+            /// the cache has grown beyond its maximum size.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            void TrimTextCache();
 
 		private:
             
@@ -222,12 +349,20 @@ namespace ChilliSource
 
 			std::vector<Core::Vector2> m_scissorPositions;
             std::vector<Core::Vector2> m_scissorSizes;
+            ClipMode m_clipMode = ClipMode::k_cpu;
+            u32 m_appliedScissorDepth = 0;
+            bool m_isAppliedScissorStale = false;
 
             std::unordered_map<TextureCSPtr, MaterialCSPtr> m_materialGUICache;
+            std::unordered_map<TextureCSPtr, MaterialCSPtr> m_materialGUIDistanceFieldCache;
+
+            mutable std::unordered_map<TextCacheKey, TextCacheEntry, TextCacheKeyHash> m_textCache;
+            u32 m_frameIndex = 0;
 
             Core::ResourcePool* m_resourcePool;
             Core::Screen* m_screen;
             MaterialFactory* m_materialFactory;
+            DynamicTextureAtlas* m_dynamicAtlas = nullptr;
 		};
 	}
 }
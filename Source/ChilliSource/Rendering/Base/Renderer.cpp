@@ -33,6 +33,7 @@
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
 #include <ChilliSource/Core/Scene/Scene.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 #include <ChilliSource/Rendering/Base/BlendMode.h>
 #include <ChilliSource/Rendering/Base/CullingPredicates.h>
 #include <ChilliSource/Rendering/Base/RenderComponent.h>
@@ -168,6 +169,8 @@ namespace ChilliSource
 		//----------------------------------------------------------
 		void Renderer::RenderSceneToTarget(Core::Scene* inpScene, UI::Canvas* in_canvas, RenderTarget* inpRenderTarget)
         {
+            CS_PROFILE_SCOPE("Renderer::RenderSceneToTarget");
+            
             //TODO: Remove old UI render code
 			//Traverse the scene graph and get all renderable objects
             std::vector<RenderComponent*> aPreFilteredRenderCache;
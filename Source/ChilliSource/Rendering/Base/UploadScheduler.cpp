@@ -0,0 +1,332 @@
+//
+//  UploadScheduler.cpp
+//  Chilli Source
+//  Created by Ian Copland on 05/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Base/UploadScheduler.h>
+
+#include <ChilliSource/Core/Image/ImageCompression.h>
+#include <ChilliSource/Core/Image/ImageFormatConverter.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        CS_DEFINE_NAMEDTYPE(UploadScheduler);
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        UploadSchedulerUPtr UploadScheduler::Create()
+        {
+            return UploadSchedulerUPtr(new UploadScheduler());
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        bool UploadScheduler::IsA(Core::InterfaceIDType in_interfaceId) const
+        {
+            return (UploadScheduler::InterfaceID == in_interfaceId);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void UploadScheduler::SetFrameByteBudget(u32 in_numBytes)
+        {
+            m_frameByteBudget = in_numBytes;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        u32 UploadScheduler::GetFrameByteBudget() const
+        {
+            return m_frameByteBudget;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void UploadScheduler::SetFrameTimeBudget(f32 in_timeMS)
+        {
+            m_frameTimeBudgetMS = in_timeMS;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        f32 UploadScheduler::GetFrameTimeBudget() const
+        {
+            return m_frameTimeBudgetMS;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void UploadScheduler::SetMaxChunkSize(u32 in_numBytes)
+        {
+            m_maxChunkSize = in_numBytes;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        u32 UploadScheduler::GetMaxChunkSize() const
+        {
+            return m_maxChunkSize;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void UploadScheduler::ScheduleUpload(u32 in_numBytes, const UploadTask& in_task)
+        {
+            CS_ASSERT(in_task != nullptr, "Cannot schedule a null upload task.");
+
+            UploadJob job;
+            job.m_chunks.push_back(UploadChunk{in_numBytes, in_task});
+            AddJob(std::move(job));
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void UploadScheduler::ScheduleTextureUpload(const TextureSPtr& in_texture, const Texture::Descriptor& in_desc, Texture::TextureDataUPtr in_data, bool in_mipMap, bool in_restoreTextureDataEnabled, const UploadTask& in_completionTask)
+        {
+            CS_ASSERT(in_texture != nullptr, "Cannot schedule upload of a null texture.");
+
+            //std::function requires copyable captures, so the data is shared between the chunks.
+            auto data = std::make_shared<Texture::TextureDataUPtr>(std::move(in_data));
+
+            UploadJob job;
+
+            //when a mip chain is supplied only the base level is split into rows. The smaller levels are
+            //uploaded whole, smallest first, so that a usable low resolution version exists early.
+            //the data contains the whole chain whenever one is described, even if it isn't going to be used.
+            const bool hasMipChain = (in_mipMap == true && in_desc.m_numMipLevels > 1);
+            const u32 bytesPerPixel = (in_desc.m_compression == Core::ImageCompression::k_none) ? Core::ImageFormatConverter::GetBytesPerPixel(in_desc.m_format) : 0;
+            const u32 baseDataSize = (in_desc.m_numMipLevels > 1) ? in_desc.m_width * in_desc.m_height * bytesPerPixel : in_desc.m_dataSize;
+
+            bool canSplit = (in_desc.m_compression == Core::ImageCompression::k_none && (in_desc.m_height > 1 || hasMipChain == true) && *data != nullptr);
+            if (canSplit == false || m_maxChunkSize == 0 || in_desc.m_dataSize <= m_maxChunkSize)
+            {
+                job.m_chunks.push_back(UploadChunk{in_desc.m_dataSize, [=]()
+                {
+                    in_texture->Build(in_desc, std::move(*data), in_mipMap, in_restoreTextureDataEnabled);
+
+                    if (in_completionTask != nullptr)
+                    {
+                        in_completionTask();
+                    }
+                }});
+            }
+            else
+            {
+                job.m_chunks.push_back(UploadChunk{0, [=]()
+                {
+                    in_texture->BuildEmpty(in_desc, in_mipMap, in_restoreTextureDataEnabled);
+                }});
+
+                if (hasMipChain == true)
+                {
+                    std::vector<u32> levelOffsets(in_desc.m_numMipLevels);
+                    std::vector<u32> levelSizes(in_desc.m_numMipLevels);
+                    u32 offset = 0;
+                    u32 width = in_desc.m_width;
+                    u32 height = in_desc.m_height;
+                    for (u32 level = 0; level < in_desc.m_numMipLevels; ++level)
+                    {
+                        levelOffsets[level] = offset;
+                        levelSizes[level] = width * height * bytesPerPixel;
+                        offset += levelSizes[level];
+                        width = std::max(width / 2, 1u);
+                        height = std::max(height / 2, 1u);
+                    }
+                    CS_ASSERT(offset == in_desc.m_dataSize, "Texture data size does not match the mip chain described.");
+
+                    for (u32 level = in_desc.m_numMipLevels - 1; level > 0; --level)
+                    {
+                        const u32 levelOffset = levelOffsets[level];
+                        job.m_chunks.push_back(UploadChunk{levelSizes[level], [=]()
+                        {
+                            in_texture->UploadMipLevel(level, data->get() + levelOffset);
+                        }});
+                    }
+                }
+
+                const u32 rowSize = baseDataSize / in_desc.m_height;
+                const u32 rowsPerChunk = std::max(m_maxChunkSize / rowSize, 1u);
+
+                for (u32 firstRow = 0; firstRow < in_desc.m_height; firstRow += rowsPerChunk)
+                {
+                    const u32 numRows = std::min(rowsPerChunk, in_desc.m_height - firstRow);
+
+                    job.m_chunks.push_back(UploadChunk{numRows * rowSize, [=]()
+                    {
+                        in_texture->UploadRows(firstRow, numRows, data->get() + firstRow * rowSize);
+                    }});
+                }
+
+                job.m_chunks.push_back(UploadChunk{0, [=]()
+                {
+                    in_texture->CompleteUpload(std::move(*data));
+
+                    if (in_completionTask != nullptr)
+                    {
+                        in_completionTask();
+                    }
+                }});
+            }
+
+            AddJob(std::move(job));
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void UploadScheduler::Flush()
+        {
+            ProcessUploads(true);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        UploadScheduler::Stats UploadScheduler::GetStats() const
+        {
+            std::unique_lock<std::mutex> lock(m_pendingMutex);
+
+            //the published stats hold the number of active jobs, to which the jobs queued since are added.
+            Stats output = m_publishedStats;
+            output.m_numUploadsPending += u32(m_pendingJobs.size());
+
+            return output;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void UploadScheduler::ResetStats()
+        {
+            m_stats = Stats();
+            m_totalLatencyMS = 0.0;
+
+            PublishStats();
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void UploadScheduler::AddJob(UploadJob in_job)
+        {
+            in_job.m_latencyTimer.Start();
+
+            std::unique_lock<std::mutex> lock(m_pendingMutex);
+            m_pendingJobs.push_back(std::move(in_job));
+        }
+        //----------------------------------------------------------------------------
+        /// Jobs are moved into the active queue so that the lock is not held while
+        /// uploading. Only the main thread accesses the active queue.
+        //----------------------------------------------------------------------------
+        void UploadScheduler::ProcessUploads(bool in_ignoreBudget)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_pendingMutex);
+                while (m_pendingJobs.empty() == false)
+                {
+                    m_activeJobs.push_back(std::move(m_pendingJobs.front()));
+                    m_pendingJobs.pop_front();
+                }
+                m_publishedStats.m_numUploadsPending = u32(m_activeJobs.size());
+            }
+
+            Core::PerformanceTimer frameTimer;
+            frameTimer.Start();
+
+            u64 bytesUploaded = 0;
+            u32 numChunks = 0;
+
+            while (m_activeJobs.empty() == false)
+            {
+                UploadJob& job = m_activeJobs.front();
+
+                //always perform at least one chunk so the queue is guaranteed to drain.
+                if (in_ignoreBudget == false && numChunks > 0)
+                {
+                    if (m_frameByteBudget > 0 && bytesUploaded + job.m_chunks.front().m_numBytes > m_frameByteBudget)
+                    {
+                        break;
+                    }
+
+                    if (m_frameTimeBudgetMS > 0.0f)
+                    {
+                        frameTimer.Stop();
+                        if (frameTimer.GetTimeTakenMS() >= m_frameTimeBudgetMS)
+                        {
+                            break;
+                        }
+                    }
+                }
+
+                UploadChunk chunk = std::move(job.m_chunks.front());
+                job.m_chunks.pop_front();
+
+                //the job is removed before the task is run as the task may schedule further uploads.
+                const bool isFinalChunk = job.m_chunks.empty();
+                Core::PerformanceTimer latencyTimer = job.m_latencyTimer;
+                if (isFinalChunk == true)
+                {
+                    m_activeJobs.pop_front();
+                }
+
+                chunk.m_task();
+
+                bytesUploaded += chunk.m_numBytes;
+                ++numChunks;
+
+                if (isFinalChunk == true)
+                {
+                    latencyTimer.Stop();
+                    f64 latencyMS = latencyTimer.GetTimeTakenMS();
+
+                    m_stats.m_numUploadsCompleted++;
+                    m_stats.m_maxLatencyMS = std::max(m_stats.m_maxLatencyMS, latencyMS);
+                    m_totalLatencyMS += latencyMS;
+                    m_stats.m_averageLatencyMS = m_totalLatencyMS / f64(m_stats.m_numUploadsCompleted);
+                }
+            }
+
+            frameTimer.Stop();
+
+            m_stats.m_numChunksLastFrame = numChunks;
+            m_stats.m_bytesUploadedLastFrame = bytesUploaded;
+            m_stats.m_bytesUploadedTotal += bytesUploaded;
+            m_stats.m_uploadTimeLastFrameMS = frameTimer.GetTimeTakenMS();
+
+            PublishStats();
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void UploadScheduler::PublishStats()
+        {
+            std::unique_lock<std::mutex> lock(m_pendingMutex);
+            m_publishedStats = m_stats;
+            m_publishedStats.m_numUploadsPending = u32(m_activeJobs.size());
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void UploadScheduler::OnUpdate(f32 in_deltaTime)
+        {
+            ProcessUploads(false);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void UploadScheduler::OnDestroy()
+        {
+            std::unique_lock<std::mutex> lock(m_pendingMutex);
+            m_pendingJobs.clear();
+            m_activeJobs.clear();
+            m_publishedStats.m_numUploadsPending = 0;
+        }
+	}
+}
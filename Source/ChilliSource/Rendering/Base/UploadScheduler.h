@@ -0,0 +1,284 @@
+//
+//  UploadScheduler.h
+//  Chilli Source
+//  Created by Ian Copland on 05/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_BASE_UPLOADSCHEDULER_H_
+#define _CHILLISOURCE_RENDERING_BASE_UPLOADSCHEDULER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/System/AppSystem.h>
+#include <ChilliSource/Core/Time/PerformanceTimer.h>
+#include <ChilliSource/Rendering/Texture/Texture.h>
+
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        //----------------------------------------------------------------------------
+        /// A system for spreading the upload of resource data to the GPU over a
+        /// number of frames. Uploads are queued from any thread and are performed on
+        /// the main thread during the update, within a per-frame byte and time
+        /// budget. Large uncompressed textures are split into bands of rows so that
+        /// a single texture cannot stall a frame.
+        ///
+        /// At least one upload chunk is always performed each frame, regardless of
+        /// budget, so that the queue is guaranteed to drain.
+        ///
+        /// @author Ian Copland
+        //----------------------------------------------------------------------------
+		class UploadScheduler final : public Core::AppSystem
+		{
+		public:
+            CS_DECLARE_NAMEDTYPE(UploadScheduler);
+
+            using UploadTask = std::function<void()>;
+            //----------------------------------------------------------------------------
+            /// A container for statistics on the uploads performed by the scheduler.
+            /// Latency is the time between an upload being queued and its final chunk
+            /// being performed.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            struct Stats
+            {
+                u32 m_numUploadsPending = 0;
+                u32 m_numUploadsCompleted = 0;
+                u32 m_numChunksLastFrame = 0;
+                u64 m_bytesUploadedLastFrame = 0;
+                u64 m_bytesUploadedTotal = 0;
+                f64 m_uploadTimeLastFrameMS = 0.0;
+                f64 m_averageLatencyMS = 0.0;
+                f64 m_maxLatencyMS = 0.0;
+            };
+            //----------------------------------------------------------------------------
+            /// Allows querying of whether or not this system implements the interface
+            /// described by the given interface Id.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The interface Id.
+            ///
+            /// @return Whether or not the interface is implemented.
+            //----------------------------------------------------------------------------
+            bool IsA(Core::InterfaceIDType in_interfaceId) const override;
+            //----------------------------------------------------------------------------
+            /// Sets the maximum number of bytes that will be uploaded in a single frame.
+            /// A value of zero means there is no byte limit.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The byte budget.
+            //----------------------------------------------------------------------------
+            void SetFrameByteBudget(u32 in_numBytes);
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The maximum number of bytes that will be uploaded in a single
+            /// frame. Zero means there is no byte limit.
+            //----------------------------------------------------------------------------
+            u32 GetFrameByteBudget() const;
+            //----------------------------------------------------------------------------
+            /// Sets the maximum time in milliseconds that will be spent uploading in a
+            /// single frame. A value of zero means there is no time limit.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The time budget in milliseconds.
+            //----------------------------------------------------------------------------
+            void SetFrameTimeBudget(f32 in_timeMS);
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The maximum time in milliseconds that will be spent uploading in
+            /// a single frame. Zero means there is no time limit.
+            //----------------------------------------------------------------------------
+            f32 GetFrameTimeBudget() const;
+            //----------------------------------------------------------------------------
+            /// Sets the size in bytes above which texture uploads will be split into a
+            /// number of smaller chunks. A value of zero disables splitting.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The maximum chunk size in bytes.
+            //----------------------------------------------------------------------------
+            void SetMaxChunkSize(u32 in_numBytes);
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The size in bytes above which texture uploads are split.
+            //----------------------------------------------------------------------------
+            u32 GetMaxChunkSize() const;
+            //----------------------------------------------------------------------------
+            /// Queues a generic upload task, such as building a mesh, which cannot be
+            /// split into smaller chunks. This is thread safe. The task will be run on
+            /// the main thread.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The estimated number of bytes the task will upload.
+            /// @param The upload task.
+            //----------------------------------------------------------------------------
+            void ScheduleUpload(u32 in_numBytes, const UploadTask& in_task);
+            //----------------------------------------------------------------------------
+            /// Queues the building of the given texture from the given image data.
+            /// Uncompressed textures larger than the max chunk size will be uploaded
+            /// over a number of chunks. If the descriptor contains a mip chain, the
+            /// smaller levels are uploaded first, followed by the base level in bands
+            /// of rows. This is thread safe. The completion task will
+            /// be called on the main thread once the texture has been fully built.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The texture to build.
+            /// @param The texture descriptor.
+            /// @param The image data. Ownership is taken by the scheduler.
+            /// @param Whether or not mip maps should be generated.
+            /// @param Whether or not the texture data should be restored after a context
+            /// loss.
+            /// @param The completion task. May be null.
+            //----------------------------------------------------------------------------
+            void ScheduleTextureUpload(const TextureSPtr& in_texture, const Texture::Descriptor& in_desc, Texture::TextureDataUPtr in_data, bool in_mipMap, bool in_restoreTextureDataEnabled, const UploadTask& in_completionTask);
+            //----------------------------------------------------------------------------
+            /// Immediately performs all queued uploads, ignoring the frame budget. This
+            /// must be called on the main thread.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            void Flush();
+            //----------------------------------------------------------------------------
+            /// This is thread safe. The statistics are those published at the end of
+            /// the last processed frame, plus any uploads queued since.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The current upload statistics.
+            //----------------------------------------------------------------------------
+            Stats GetStats() const;
+            //----------------------------------------------------------------------------
+            /// Resets the accumulated upload statistics. This must be called on the
+            /// main thread.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            void ResetStats();
+
+		private:
+            friend class Core::Application;
+            //----------------------------------------------------------------------------
+            /// A single piece of an upload, which will be performed in one go.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            struct UploadChunk
+            {
+                u32 m_numBytes;
+                UploadTask m_task;
+            };
+            //----------------------------------------------------------------------------
+            /// A queued upload, made up of one or more chunks.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            struct UploadJob
+            {
+                std::deque<UploadChunk> m_chunks;
+                Core::PerformanceTimer m_latencyTimer;
+            };
+            //----------------------------------------------------------------------------
+            /// Creates a new instance of the system.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The new instance.
+            //----------------------------------------------------------------------------
+            static UploadSchedulerUPtr Create();
+            //----------------------------------------------------------------------------
+            /// Private constructor to enforce the use of the factory method.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            UploadScheduler() = default;
+            //----------------------------------------------------------------------------
+            /// Adds a new job to the pending queue. This is thread safe.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The job.
+            //----------------------------------------------------------------------------
+            void AddJob(UploadJob in_job);
+            //----------------------------------------------------------------------------
+            /// Performs queued upload chunks until the budget has been exceeded or
+            /// the queue is empty.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Whether or not the budget should be ignored.
+            //----------------------------------------------------------------------------
+            void ProcessUploads(bool in_ignoreBudget);
+            //----------------------------------------------------------------------------
+            /// Publishes a copy of the statistics, along with the number of active
+            /// jobs, for GetStats() to read from any thread. This must be called on the
+            /// main thread.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            void PublishStats();
+            //----------------------------------------------------------------------------
+            /// Called once per frame. Performs the uploads for this frame.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The delta time.
+            //----------------------------------------------------------------------------
+            void OnUpdate(f32 in_deltaTime) override;
+            //----------------------------------------------------------------------------
+            /// Discards all outstanding uploads.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            void OnDestroy() override;
+
+            u32 m_frameByteBudget = 2 * 1024 * 1024;
+            f32 m_frameTimeBudgetMS = 4.0f;
+            u32 m_maxChunkSize = 256 * 1024;
+
+            mutable std::mutex m_pendingMutex;
+            std::deque<UploadJob> m_pendingJobs;
+            std::deque<UploadJob> m_activeJobs;
+
+            Stats m_stats;
+            Stats m_publishedStats;
+            f64 m_totalLatencyMS = 0.0;
+		};
+	}
+}
+
+#endif
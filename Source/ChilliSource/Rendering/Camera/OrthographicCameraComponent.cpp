@@ -58,6 +58,18 @@ namespace ChilliSource
 		{
 			return (in_interfaceId == CameraComponent::InterfaceID || in_interfaceId == OrthographicCameraComponent::InterfaceID);
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool OrthographicCameraComponent::RequiresUpdate() const
+		{
+			return false;
+		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool OrthographicCameraComponent::RequiresFixedUpdate() const
+		{
+			return false;
+		}
         //------------------------------------------------------
 		//------------------------------------------------------
 		void OrthographicCameraComponent::SetViewportSize(const Core::Vector2& in_size)
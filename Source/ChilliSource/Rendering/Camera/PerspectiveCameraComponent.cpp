@@ -57,6 +57,18 @@ namespace ChilliSource
 		{
 			return (in_interfaceId == CameraComponent::InterfaceID || in_interfaceId == PerspectiveCameraComponent::InterfaceID);
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool PerspectiveCameraComponent::RequiresUpdate() const
+		{
+			return false;
+		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool PerspectiveCameraComponent::RequiresFixedUpdate() const
+		{
+			return false;
+		}
         //------------------------------------------------------
 		//------------------------------------------------------
 		void PerspectiveCameraComponent::SetFieldOfView(f32 in_fov)
@@ -65,6 +65,16 @@ namespace ChilliSource
 			/// @return Whether the class matches the comparison type
 			//----------------------------------------------------------
 			bool IsA(Core::InterfaceIDType in_interfaceId) const override;
+			//----------------------------------------------------------
+			/// @return Whether or not OnUpdate() should be called. This
+			/// component doesn't require an update.
+			//----------------------------------------------------------
+			bool RequiresUpdate() const override;
+			//----------------------------------------------------------
+			/// @return Whether or not OnFixedUpdate() should be called.
+			/// This component doesn't require a fixed update.
+			//----------------------------------------------------------
+			bool RequiresFixedUpdate() const override;
 			//------------------------------------------------------
 			/// @author S Downie
 			///
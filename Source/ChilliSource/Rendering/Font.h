@@ -31,7 +31,10 @@
 #define _CHILLISOURCE_RENDERING_FONT_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Rendering/Font/DistanceFieldGenerator.h>
+#include <ChilliSource/Rendering/Font/DistanceFieldGlyphAtlas.h>
 #include <ChilliSource/Rendering/Font/Font.h>
 #include <ChilliSource/Rendering/Font/FontProvider.h>
+#include <ChilliSource/Rendering/Font/FontResourceOptions.h>
 
 #endif
\ No newline at end of file
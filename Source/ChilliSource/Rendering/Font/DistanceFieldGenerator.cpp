@@ -0,0 +1,253 @@
+//
+//  DistanceFieldGenerator.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Font/DistanceFieldGenerator.h>
+
+#include <ChilliSource/Core/Math/MathUtils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        namespace DistanceFieldGenerator
+        {
+            namespace
+            {
+                const s32 k_farDistance = 9999;
+                const u8 k_coverageThreshold = 128;
+                const u8 k_fullCoverage = 255;
+                
+                //---------------------------------------------------
+                /// The offset from a texel to the nearest texel of
+                /// interest.
+                ///
+                /// @author Ian Copland
+                //---------------------------------------------------
+                struct Offset
+                {
+                    s32 m_x;
+                    s32 m_y;
+                    
+                    s32 GetDistanceSquared() const
+                    {
+                        return m_x * m_x + m_y * m_y;
+                    }
+                };
+                //---------------------------------------------------
+                /// A grid of offsets, padded by a single texel on
+                /// each side so neighbours can be read without
+                /// bounds checks.
+                ///
+                /// @author Ian Copland
+                //---------------------------------------------------
+                class OffsetGrid final
+                {
+                public:
+                    OffsetGrid(u32 in_width, u32 in_height)
+                        : m_width(s32(in_width) + 2), m_height(s32(in_height) + 2), m_offsets(m_width * m_height, Offset{k_farDistance, k_farDistance})
+                    {
+                    }
+                    
+                    Offset& Get(s32 in_x, s32 in_y)
+                    {
+                        return m_offsets[(in_y + 1) * m_width + (in_x + 1)];
+                    }
+                    
+                    s32 GetWidth() const
+                    {
+                        return m_width - 2;
+                    }
+                    
+                    s32 GetHeight() const
+                    {
+                        return m_height - 2;
+                    }
+                    
+                private:
+                    s32 m_width;
+                    s32 m_height;
+                    std::vector<Offset> m_offsets;
+                };
+                //---------------------------------------------------
+                /// Replaces the offset of the given texel with that
+                /// of its neighbour if the neighbour's nearest texel
+                /// is closer.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The grid.
+                /// @param [In/Out] The offset of the texel.
+                /// @param The x position of the texel.
+                /// @param The y position of the texel.
+                /// @param The x offset to the neighbour.
+                /// @param The y offset to the neighbour.
+                //---------------------------------------------------
+                void Compare(OffsetGrid& in_grid, Offset& inout_offset, s32 in_x, s32 in_y, s32 in_neighbourX, s32 in_neighbourY)
+                {
+                    Offset other = in_grid.Get(in_x + in_neighbourX, in_y + in_neighbourY);
+                    other.m_x += in_neighbourX;
+                    other.m_y += in_neighbourY;
+                    
+                    if (other.GetDistanceSquared() < inout_offset.GetDistanceSquared())
+                    {
+                        inout_offset = other;
+                    }
+                }
+                //---------------------------------------------------
+                /// Performs the 8SSEDT on the given grid, leaving
+                /// each texel holding the offset to its nearest texel
+                /// of interest.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param [In/Out] The grid.
+                //---------------------------------------------------
+                void Propagate(OffsetGrid& inout_grid)
+                {
+                    const s32 width = inout_grid.GetWidth();
+                    const s32 height = inout_grid.GetHeight();
+                    
+                    for (s32 y = 0; y < height; ++y)
+                    {
+                        for (s32 x = 0; x < width; ++x)
+                        {
+                            Offset& offset = inout_grid.Get(x, y);
+                            Compare(inout_grid, offset, x, y, -1, 0);
+                            Compare(inout_grid, offset, x, y, 0, -1);
+                            Compare(inout_grid, offset, x, y, -1, -1);
+                            Compare(inout_grid, offset, x, y, 1, -1);
+                        }
+                        
+                        for (s32 x = width - 1; x >= 0; --x)
+                        {
+                            Compare(inout_grid, inout_grid.Get(x, y), x, y, 1, 0);
+                        }
+                    }
+                    
+                    for (s32 y = height - 1; y >= 0; --y)
+                    {
+                        for (s32 x = width - 1; x >= 0; --x)
+                        {
+                            Offset& offset = inout_grid.Get(x, y);
+                            Compare(inout_grid, offset, x, y, 1, 0);
+                            Compare(inout_grid, offset, x, y, 0, 1);
+                            Compare(inout_grid, offset, x, y, -1, 1);
+                            Compare(inout_grid, offset, x, y, 1, 1);
+                        }
+                        
+                        for (s32 x = 0; x < width; ++x)
+                        {
+                            Compare(inout_grid, inout_grid.Get(x, y), x, y, -1, 0);
+                        }
+                    }
+                }
+            }
+            
+            //---------------------------------------------------
+            //---------------------------------------------------
+            void Generate(const u8* in_coverage, u32 in_coverageStride, u32 in_width, u32 in_height, u32 in_spread, u8* out_field, u32 in_fieldStride)
+            {
+                CS_ASSERT(in_spread > 0, "The distance field spread must be greater than zero.");
+                CS_ASSERT(in_fieldStride >= in_width + 2 * in_spread, "The distance field stride is too small.");
+                
+                const s32 fieldWidth = s32(in_width + 2 * in_spread);
+                const s32 fieldHeight = s32(in_height + 2 * in_spread);
+                
+                //the coverage is padded out to the size of the field so that neighbours can be read without bounds checks.
+                std::vector<u8> coverage(fieldWidth * fieldHeight, 0);
+                for (u32 y = 0; y < in_height; ++y)
+                {
+                    std::copy(in_coverage + y * in_coverageStride, in_coverage + y * in_coverageStride + in_width, coverage.begin() + (y + in_spread) * fieldWidth + in_spread);
+                }
+                
+                //The transform finds the nearest edge texel: one which is partially covered, or a fully
+                //covered texel next to an empty one. The edge is assumed to pass (coverage - 0.5) texels
+                //from the centre of an edge texel, which places the edge with sub-texel accuracy rather
+                //than snapping it to the texel boundaries.
+                OffsetGrid grid(in_width + 2 * in_spread, in_height + 2 * in_spread);
+                for (s32 y = 0; y < fieldHeight; ++y)
+                {
+                    for (s32 x = 0; x < fieldWidth; ++x)
+                    {
+                        const u8 value = coverage[y * fieldWidth + x];
+                        
+                        bool isEdge = (value > 0 && value < k_fullCoverage);
+                        if (isEdge == false)
+                        {
+                            const u8 opposite = (value == 0) ? k_fullCoverage : 0;
+                            isEdge = ((x > 0 && coverage[y * fieldWidth + x - 1] == opposite) || (x + 1 < fieldWidth && coverage[y * fieldWidth + x + 1] == opposite) ||
+                                      (y > 0 && coverage[(y - 1) * fieldWidth + x] == opposite) || (y + 1 < fieldHeight && coverage[(y + 1) * fieldWidth + x] == opposite));
+                        }
+                        
+                        if (isEdge == true)
+                        {
+                            grid.Get(x, y) = Offset{0, 0};
+                        }
+                    }
+                }
+                
+                Propagate(grid);
+                
+                const f32 range = 2.0f * f32(in_spread);
+                for (s32 y = 0; y < fieldHeight; ++y)
+                {
+                    u8* fieldRow = out_field + y * in_fieldStride;
+                    for (s32 x = 0; x < fieldWidth; ++x)
+                    {
+                        const Offset& offset = grid.Get(x, y);
+                        const s32 edgeX = x + offset.m_x;
+                        const s32 edgeY = y + offset.m_y;
+                        const bool isInside = (coverage[y * fieldWidth + x] >= k_coverageThreshold);
+                        
+                        //if there are no edge texels the offset never reaches a texel in the field.
+                        f32 distance = f32(k_farDistance);
+                        if (edgeX >= 0 && edgeX < fieldWidth && edgeY >= 0 && edgeY < fieldHeight)
+                        {
+                            const u8 edgeCoverage = coverage[edgeY * fieldWidth + edgeX];
+                            const f32 edgeDistance = f32(edgeCoverage) / f32(k_fullCoverage) - 0.5f;
+                            
+                            distance = (isInside == true ? 1.0f : -1.0f) * std::sqrt(f32(offset.GetDistanceSquared())) + edgeDistance;
+                        }
+                        else if (isInside == false)
+                        {
+                            distance = -distance;
+                        }
+                        
+                        f32 value = Core::MathUtils::Clamp(0.5f + distance / range, 0.0f, 1.0f);
+                        fieldRow[x] = u8(value * 255.0f + 0.5f);
+                    }
+                }
+            }
+        }
+    }
+}
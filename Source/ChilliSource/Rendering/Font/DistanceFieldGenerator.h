@@ -0,0 +1,81 @@
+//
+//  DistanceFieldGenerator.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_FONT_DISTANCEFIELDGENERATOR_H_
+#define _CHILLISOURCE_RENDERING_FONT_DISTANCEFIELDGENERATOR_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        //---------------------------------------------------------
+        /// Methods for generating signed distance fields from 8-bit
+        /// coverage images, such as font glyphs. The distance field
+        /// is stored in 8-bits with the edge of the shape at 0.5,
+        /// values above this being inside the shape. Distances are
+        /// clamped to the given spread, in texels, either side of
+        /// the edge.
+        ///
+        /// Distances are calculated using the 8-point sequential
+        /// signed Euclidean distance transform, which is linear in
+        /// the number of texels. The coverage of the nearest edge
+        /// texel is used to place the edge to a fraction of a texel.
+        ///
+        /// @author Ian Copland
+        //---------------------------------------------------------
+        namespace DistanceFieldGenerator
+        {
+            //---------------------------------------------------
+            /// Generates a distance field from the given coverage
+            /// image. The edge is taken to be where the coverage is
+            /// half. The output is larger than
+            /// the input by the spread on each side so that the
+            /// field can fall off fully around the shape.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The coverage data.
+            /// @param The number of bytes between rows of coverage
+            /// data.
+            /// @param The width of the coverage image.
+            /// @param The height of the coverage image.
+            /// @param The spread in texels.
+            /// @param [Out] The output distance field data. This must
+            /// have space for (height + 2 * spread) rows.
+            /// @param The number of bytes between rows of the output.
+            /// This must be at least (width + 2 * spread).
+            //---------------------------------------------------
+            void Generate(const u8* in_coverage, u32 in_coverageStride, u32 in_width, u32 in_height, u32 in_spread, u8* out_field, u32 in_fieldStride);
+        }
+    }
+}
+
+#endif
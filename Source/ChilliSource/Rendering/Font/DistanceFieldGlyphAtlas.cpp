@@ -0,0 +1,172 @@
+//
+//  DistanceFieldGlyphAtlas.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Font/DistanceFieldGlyphAtlas.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Image/ImageCompression.h>
+#include <ChilliSource/Core/Image/ImageFormat.h>
+#include <ChilliSource/Core/Resource/ResourcePool.h>
+#include <ChilliSource/Core/String/ToString.h>
+#include <ChilliSource/Rendering/Font/DistanceFieldGenerator.h>
+#include <ChilliSource/Rendering/Texture/Texture.h>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        namespace
+        {
+            //Rows of single channel texture data are uploaded with the default 4 byte alignment,
+            //so glyph widths in the atlas are rounded up to a multiple of this.
+            const u32 k_rowAlignment = 4;
+            
+            u32 g_nextAtlasId = 0;
+        }
+        
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        DistanceFieldGlyphAtlas::DistanceFieldGlyphAtlas(std::vector<u8> in_coverage, u32 in_coverageWidth, u32 in_coverageHeight, u32 in_spread, u32 in_atlasSize)
+            : m_coverage(std::move(in_coverage)), m_coverageWidth(in_coverageWidth), m_coverageHeight(in_coverageHeight), m_spread(in_spread), m_packer(in_atlasSize, in_atlasSize)
+        {
+            CS_ASSERT(m_coverage.size() == m_coverageWidth * m_coverageHeight, "The coverage data size doesn't match the dimensions.");
+            CS_ASSERT(in_atlasSize % k_rowAlignment == 0, "The distance field atlas size must be a multiple of 4.");
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool DistanceFieldGlyphAtlas::TryAddGlyph(const SourceRegion& in_region, UVs& out_UVs)
+        {
+            CS_ASSERT(in_region.m_x + in_region.m_width <= m_coverageWidth && in_region.m_y + in_region.m_height <= m_coverageHeight, "Glyph region is outside the coverage image.");
+            
+            const u32 fieldWidth = in_region.m_width + 2 * m_spread;
+            const u32 fieldHeight = in_region.m_height + 2 * m_spread;
+            const u32 alignedWidth = ((fieldWidth + k_rowAlignment - 1) / k_rowAlignment) * k_rowAlignment;
+            
+            Core::Integer2 position;
+            if (m_packer.Pack(alignedWidth, fieldHeight, position) == false)
+            {
+                CS_LOG_ERROR("Distance field glyph atlas is full.");
+                return false;
+            }
+            
+            PlacedGlyph placedGlyph;
+            placedGlyph.m_sourceRegion = in_region;
+            placedGlyph.m_x = u32(position.x);
+            placedGlyph.m_y = u32(position.y);
+            placedGlyph.m_alignedWidth = alignedWidth;
+            placedGlyph.m_height = fieldHeight;
+            m_placedGlyphs.push_back(placedGlyph);
+            
+            CreateTexture();
+            UploadGlyph(placedGlyph);
+            
+            const f32 atlasWidth = f32(m_packer.GetWidth());
+            const f32 atlasHeight = f32(m_packer.GetHeight());
+            out_UVs = UVs(f32(position.x) / atlasWidth, f32(position.y) / atlasHeight, f32(fieldWidth) / atlasWidth, f32(fieldHeight) / atlasHeight);
+            
+            return true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 DistanceFieldGlyphAtlas::GetSpread() const
+        {
+            return m_spread;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        const TextureCSPtr& DistanceFieldGlyphAtlas::GetTexture()
+        {
+            CreateTexture();
+            return m_constTexture;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void DistanceFieldGlyphAtlas::Restore()
+        {
+            if (m_texture == nullptr)
+            {
+                return;
+            }
+            
+            ClearTexture();
+            for (const auto& placedGlyph : m_placedGlyphs)
+            {
+                UploadGlyph(placedGlyph);
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void DistanceFieldGlyphAtlas::CreateTexture()
+        {
+            if (m_texture != nullptr)
+            {
+                return;
+            }
+            
+            Texture::Descriptor desc;
+            desc.m_width = m_packer.GetWidth();
+            desc.m_height = m_packer.GetHeight();
+            desc.m_format = Core::ImageFormat::k_Lum8;
+            desc.m_compression = Core::ImageCompression::k_none;
+            desc.m_dataSize = desc.m_width * desc.m_height;
+            
+            m_texture = Core::Application::Get()->GetResourcePool()->CreateResource<Texture>("_DistanceFieldGlyphAtlas" + Core::ToString(g_nextAtlasId++));
+            m_texture->BuildEmpty(desc, false, false);
+            ClearTexture();
+            m_texture->CompleteUpload(nullptr);
+            
+            m_texture->SetFilterMode(Texture::FilterMode::k_bilinear);
+            m_texture->SetWrapMode(Texture::WrapMode::k_clamp, Texture::WrapMode::k_clamp);
+            m_texture->SetLoadState(Core::Resource::LoadState::k_loaded);
+            
+            m_constTexture = m_texture;
+        }
+        //--------------------------------------------------------------
+        /// The texture is cleared to zero, which is the furthest distance
+        /// outside of a glyph, so that filtering at the edge of a glyph
+        /// doesn't pick up garbage.
+        //--------------------------------------------------------------
+        void DistanceFieldGlyphAtlas::ClearTexture()
+        {
+            std::vector<u8> clearData(m_packer.GetWidth() * m_packer.GetHeight(), 0);
+            m_texture->UploadRows(0, m_packer.GetHeight(), clearData.data());
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void DistanceFieldGlyphAtlas::UploadGlyph(const PlacedGlyph& in_glyph)
+        {
+            const SourceRegion& region = in_glyph.m_sourceRegion;
+            
+            m_fieldBuffer.assign(in_glyph.m_alignedWidth * in_glyph.m_height, 0);
+            DistanceFieldGenerator::Generate(m_coverage.data() + region.m_y * m_coverageWidth + region.m_x, m_coverageWidth, region.m_width, region.m_height, m_spread, m_fieldBuffer.data(), in_glyph.m_alignedWidth);
+            
+            m_texture->UploadRegion(in_glyph.m_x, in_glyph.m_y, in_glyph.m_alignedWidth, in_glyph.m_height, m_fieldBuffer.data());
+        }
+    }
+}
@@ -0,0 +1,175 @@
+//
+//  DistanceFieldGlyphAtlas.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_FONT_DISTANCEFIELDGLYPHATLAS_H_
+#define _CHILLISOURCE_RENDERING_FONT_DISTANCEFIELDGLYPHATLAS_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Rendering/Texture/SkylinePacker.h>
+#include <ChilliSource/Rendering/Texture/UVs.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        //--------------------------------------------------------------
+        /// A texture atlas of signed distance field glyphs, which are
+        /// generated from a font's coverage image the first time they
+        /// are needed. As only glyphs which are actually displayed are
+        /// generated, the atlas can be much smaller than the font's
+        /// bitmap, and a single atlas serves text of all sizes.
+        ///
+        /// The atlas texture is single channel and is created when
+        /// first requested. The coverage image and the position of
+        /// each glyph are kept so that the contents can be generated
+        /// again after a context loss. This must only be used on the
+        /// main thread.
+        ///
+        /// @author Ian Copland
+        //--------------------------------------------------------------
+        class DistanceFieldGlyphAtlas final
+        {
+        public:
+            //----------------------------------------------------------
+            /// The region of a glyph in the coverage image.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            struct SourceRegion
+            {
+                u32 m_x = 0;
+                u32 m_y = 0;
+                u32 m_width = 0;
+                u32 m_height = 0;
+            };
+            //----------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The coverage image that glyphs are generated
+            /// from. This is one byte per texel.
+            /// @param The width of the coverage image.
+            /// @param The height of the coverage image.
+            /// @param The distance field spread in texels.
+            /// @param The width and height of the atlas.
+            //----------------------------------------------------------
+            DistanceFieldGlyphAtlas(std::vector<u8> in_coverage, u32 in_coverageWidth, u32 in_coverageHeight, u32 in_spread, u32 in_atlasSize);
+            //----------------------------------------------------------
+            /// Generates the distance field for the given glyph and
+            /// adds it to the atlas. The glyph in the atlas is larger
+            /// than the source region by the spread on each side.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The region of the glyph in the coverage image.
+            /// @param [Out] The UVs of the glyph in the atlas.
+            ///
+            /// @return Whether or not there was space for the glyph.
+            //----------------------------------------------------------
+            bool TryAddGlyph(const SourceRegion& in_region, UVs& out_UVs);
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The distance field spread in texels.
+            //----------------------------------------------------------
+            u32 GetSpread() const;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The atlas texture. This is created if it
+            /// doesn't already exist.
+            //----------------------------------------------------------
+            const TextureCSPtr& GetTexture();
+            //----------------------------------------------------------
+            /// Generates the contents of the atlas texture again from
+            /// the coverage image. This should be called after the
+            /// texture has been restored following a context loss, as
+            /// its contents are not backed up. Glyphs keep their
+            /// positions, so existing UVs remain valid.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void Restore();
+            
+        private:
+            //----------------------------------------------------------
+            /// The position of a glyph in the atlas and the region of
+            /// the coverage image it was generated from.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            struct PlacedGlyph
+            {
+                SourceRegion m_sourceRegion;
+                u32 m_x = 0;
+                u32 m_y = 0;
+                u32 m_alignedWidth = 0;
+                u32 m_height = 0;
+            };
+            //----------------------------------------------------------
+            /// Creates the atlas texture if it doesn't already exist.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void CreateTexture();
+            //----------------------------------------------------------
+            /// Clears the atlas texture to zero.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void ClearTexture();
+            //----------------------------------------------------------
+            /// Generates the distance field for the given glyph and
+            /// uploads it to its position in the atlas texture.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The placed glyph.
+            //----------------------------------------------------------
+            void UploadGlyph(const PlacedGlyph& in_glyph);
+            
+            std::vector<u8> m_coverage;
+            u32 m_coverageWidth;
+            u32 m_coverageHeight;
+            u32 m_spread;
+            
+            SkylinePacker m_packer;
+            std::vector<PlacedGlyph> m_placedGlyphs;
+            std::vector<u8> m_fieldBuffer;
+            
+            TextureSPtr m_texture;
+            TextureCSPtr m_constTexture;
+        };
+    }
+}
+
+#endif
@@ -31,6 +31,7 @@
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
 #include <algorithm>
+#include <atomic>
 
 namespace ChilliSource
 {
@@ -39,6 +40,9 @@ namespace ChilliSource
         namespace
         {
             const u32 k_spacesPerTab = 5;
+            
+            //fonts can be built on background threads.
+            std::atomic<u32> g_nextBuildId(1);
         }
         
         CS_DEFINE_NAMEDTYPE(Font);
@@ -61,9 +65,20 @@ namespace ChilliSource
 		{
             CS_ASSERT(in_desc.m_supportedCharacters.size() > 0, "Font: Cannot build characters with empty character set");
             
-            m_characterInfos.clear();
+            m_glyphs.clear();
+            m_hasDirectGlyph.fill(false);
             m_characters = in_desc.m_supportedCharacters;
             m_texture = in_desc.m_texture;
+            m_distanceFieldAtlas.reset();
+            m_buildId = g_nextBuildId++;
+            
+            const bool isDistanceField = (in_desc.m_distanceFieldCoverage.empty() == false);
+            const f32 distanceFieldSpread = f32(in_desc.m_distanceFieldSpread);
+            if (isDistanceField == true)
+            {
+                m_distanceFieldAtlas = DistanceFieldGlyphAtlasUPtr(new DistanceFieldGlyphAtlas(in_desc.m_distanceFieldCoverage, in_desc.m_textureAtlasWidth, in_desc.m_textureAtlasHeight,
+                                                                                               in_desc.m_distanceFieldSpread, in_desc.m_distanceFieldAtlasSize));
+            }
 			
             const f32 textureAtlasWidth = (f32)in_desc.m_textureAtlasWidth;
             const f32 textureAtlasHeight = (f32)in_desc.m_textureAtlasHeight;
@@ -75,7 +90,8 @@ namespace ChilliSource
             {
                 auto character = Core::UTF8StringUtils::Next(it);
                 
-				CharacterInfo info;
+				Glyph glyph;
+				CharacterInfo& info = glyph.m_info;
 				
 				const Frame& frame = in_desc.m_frames[frameIdx];
                 
@@ -95,7 +111,21 @@ namespace ChilliSource
                 
                 m_lineHeight = std::max((f32)frame.m_height, m_lineHeight);
                 
-				m_characterInfos.insert(std::make_pair(character, info));
+                //distance field glyphs are padded by the spread and are added to the atlas on first use.
+                if (isDistanceField == true && frame.m_width > 0 && frame.m_height > 0)
+                {
+                    info.m_UVs = UVs();
+                    info.m_size += Core::Vector2(2.0f * distanceFieldSpread, 2.0f * distanceFieldSpread);
+                    info.m_offset -= Core::Vector2(distanceFieldSpread, distanceFieldSpread);
+                    
+                    glyph.m_sourceRegion.m_x = u32(frame.m_texCoordU);
+                    glyph.m_sourceRegion.m_y = u32(frame.m_texCoordV);
+                    glyph.m_sourceRegion.m_width = u32(frame.m_width);
+                    glyph.m_sourceRegion.m_height = u32(frame.m_height);
+                    glyph.m_isPending = true;
+                }
+                
+				AddGlyph(character, glyph);
                 
                 ++frameIdx;
 			}
@@ -112,26 +142,31 @@ namespace ChilliSource
 			
 			//Just assign the width of a whitespaces based on the similar space character in the
 			//font. This means it will scale relative to the font
-            CharacterInfo spaceCharacter;
-            spaceCharacter.m_advance = in_desc.m_spaceAdvance;
+            Glyph spaceCharacter;
+            spaceCharacter.m_info.m_advance = in_desc.m_spaceAdvance;
             
             //Space
-            m_characterInfos.insert(std::make_pair(k_spaceCharacter, spaceCharacter));
+            AddGlyph(k_spaceCharacter, spaceCharacter);
             
             //Non-breaking space
-            m_characterInfos.insert(std::make_pair(k_nbspCharacter, spaceCharacter));
+            AddGlyph(k_nbspCharacter, spaceCharacter);
             
             //Tab
-            spaceCharacter.m_size.x *= k_spacesPerTab;
-            m_characterInfos.insert(std::make_pair(k_tabCharacter, spaceCharacter));
+            spaceCharacter.m_info.m_size.x *= k_spacesPerTab;
+            AddGlyph(k_tabCharacter, spaceCharacter);
             
             //Return
-            m_characterInfos.insert(std::make_pair(k_returnCharacter, CharacterInfo()));
+            AddGlyph(k_returnCharacter, Glyph());
         }
 		//-------------------------------------------
 		//-------------------------------------------
 		const TextureCSPtr& Font::GetTexture() const
 		{
+            if (m_distanceFieldAtlas != nullptr)
+            {
+                return m_distanceFieldAtlas->GetTexture();
+            }
+            
 			return m_texture;
 		}
         //---------------------------------------------------------------------
@@ -168,15 +203,77 @@ namespace ChilliSource
 		//-------------------------------------------
 		bool Font::TryGetCharacterInfo(Core::UTF8Char in_char, CharacterInfo& out_info) const
 		{
-			auto itCharEntry = m_characterInfos.find(in_char);
-			
-			if (itCharEntry != m_characterInfos.end())
+            Glyph* glyph = TryGetGlyph(in_char);
+            if (glyph == nullptr)
             {
-				out_info = itCharEntry->second;
-				return true;
-			}
-			
-			return false;
+                return false;
+            }
+            
+            if (glyph->m_isPending == true)
+            {
+                glyph->m_isPending = false;
+                
+                //if the atlas is full the glyph is left blank, but still takes up space in the text.
+                if (m_distanceFieldAtlas->TryAddGlyph(glyph->m_sourceRegion, glyph->m_info.m_UVs) == false)
+                {
+                    glyph->m_info.m_size = Core::Vector2::k_zero;
+                }
+            }
+            
+            out_info = glyph->m_info;
+            return true;
 		}
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        bool Font::IsDistanceField() const
+        {
+            return (m_distanceFieldAtlas != nullptr);
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        u32 Font::GetBuildId() const
+        {
+            return m_buildId;
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        void Font::RestoreDistanceFieldAtlas()
+        {
+            if (m_distanceFieldAtlas != nullptr)
+            {
+                m_distanceFieldAtlas->Restore();
+            }
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        void Font::AddGlyph(Core::UTF8Char in_char, const Glyph& in_glyph)
+        {
+            if (in_char < k_numDirectCharacters)
+            {
+                if (m_hasDirectGlyph[in_char] == false)
+                {
+                    m_directGlyphs[in_char] = in_glyph;
+                    m_hasDirectGlyph[in_char] = true;
+                }
+            }
+            else
+            {
+                m_glyphs.insert(std::make_pair(in_char, in_glyph));
+            }
+        }
+        //---------------------------------------------------------------------
+        /// Characters in the Latin-1 range are looked up in a directly indexed
+        /// table, others fall back to a hash map.
+        //---------------------------------------------------------------------
+        Font::Glyph* Font::TryGetGlyph(Core::UTF8Char in_char) const
+        {
+            if (in_char < k_numDirectCharacters)
+            {
+                return (m_hasDirectGlyph[in_char] == true) ? &m_directGlyphs[in_char] : nullptr;
+            }
+            
+            auto it = m_glyphs.find(in_char);
+            return (it != m_glyphs.end()) ? &it->second : nullptr;
+        }
 	}
 }
@@ -33,8 +33,10 @@
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 #include <ChilliSource/Core/Resource/Resource.h>
 #include <ChilliSource/Core/String/UTF8StringUtils.h>
+#include <ChilliSource/Rendering/Font/DistanceFieldGlyphAtlas.h>
 #include <ChilliSource/Rendering/Texture/UVs.h>
 
+#include <array>
 #include <unordered_map>
 
 namespace ChilliSource
@@ -53,6 +55,12 @@ namespace ChilliSource
         /// The font resource describing the size, spacing and kerning of
         /// font characters.
         ///
+        /// A font can either be rendered directly from its bitmap, or as
+        /// signed distance fields generated from the bitmap. Distance field
+        /// glyphs are added to the font's glyph atlas the first time they
+        /// are used, so distance field fonts must only be used on the main
+        /// thread.
+        ///
         /// @author S Downie
         //---------------------------------------------------------------------
 		class Font final : public Core::Resource
@@ -113,6 +121,12 @@ namespace ChilliSource
                 u32 m_descent = 0;
                 u32 m_spaceAdvance = 0;
                 u32 m_verticalPadding = 0;
+                
+                //If the coverage isn't empty the font is built as a distance field font
+                //and the texture is unused. The coverage is the alpha of the font bitmap.
+                std::vector<u8> m_distanceFieldCoverage;
+                u32 m_distanceFieldSpread = 0;
+                u32 m_distanceFieldAtlasSize = 0;
             };
 			
 			CS_DECLARE_NAMEDTYPE(Font);
@@ -133,6 +147,9 @@ namespace ChilliSource
 			//---------------------------------------------------------------------
 			void Build(const Descriptor& in_desc);
 			//---------------------------------------------------------------------
+            /// For distance field fonts this is the glyph atlas texture, which
+            /// is created on first use.
+            ///
 			/// @author S Downie
 			///
 			/// @return Font texture 
@@ -141,6 +158,21 @@ namespace ChilliSource
             //---------------------------------------------------------------------
             /// @author Ian Copland
             ///
+            /// @return Whether or not this font is rendered using signed
+            /// distance fields.
+            //---------------------------------------------------------------------
+            bool IsDistanceField() const;
+            //---------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return An Id which is unique to the current build of the font.
+            /// This changes every time the font is built, so it can be used to
+            /// tell whether data derived from the font is out of date.
+            //---------------------------------------------------------------------
+            u32 GetBuildId() const;
+            //---------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
             /// @return The point size of the font the bitmap font was created from.
             //---------------------------------------------------------------------
             u32 GetPointSize() const;
@@ -170,6 +202,9 @@ namespace ChilliSource
             //---------------------------------------------------------------------
             bool SupportsKerning() const;
             //---------------------------------------------------------------------
+            /// Characters in the Latin-1 range are looked up in a directly
+            /// indexed table, others fall back to a hash map.
+            ///
 			/// @author S McGaw
 			///
 			/// @param UTF-8 Character
@@ -182,6 +217,7 @@ namespace ChilliSource
         private:
             
             friend class Core::ResourcePool;
+            friend class FontProvider;
             //---------------------------------------------------------------------
             /// Factory method to create empty font resource. Used only by the
             /// resource pool.
@@ -195,14 +231,61 @@ namespace ChilliSource
             /// @author S Downie
             //---------------------------------------------------------------------
             Font() = default;
+            //---------------------------------------------------------------------
+            /// The stored data for a single character. Distance field glyphs
+            /// are pending until they are first used and added to the atlas,
+            /// before which the UVs are not valid.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------------------------
+            struct Glyph
+            {
+                CharacterInfo m_info;
+                DistanceFieldGlyphAtlas::SourceRegion m_sourceRegion;
+                bool m_isPending = false;
+            };
+            //---------------------------------------------------------------------
+            /// Adds the given glyph to the lookup tables, unless the character
+            /// already exists.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The character.
+            /// @param The glyph.
+            //---------------------------------------------------------------------
+            void AddGlyph(Core::UTF8Char in_char, const Glyph& in_glyph);
+            //---------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The character.
+            ///
+            /// @return The glyph for the given character, or null if the font
+            /// doesn't contain it.
+            //---------------------------------------------------------------------
+            Glyph* TryGetGlyph(Core::UTF8Char in_char) const;
+            //---------------------------------------------------------------------
+            /// Generates the contents of the distance field glyph atlas again,
+            /// if this is a distance field font. Called by the font provider
+            /// once the atlas texture has been restored after a context loss.
+            ///
+            /// @author Ian Copland
+            //---------------------------------------------------------------------
+            void RestoreDistanceFieldAtlas();
             
         private:
             
-			std::unordered_map<Core::UTF8Char, CharacterInfo> m_characterInfos;
+            static const u32 k_numDirectCharacters = 256;
+            
+            //Glyphs are mutable as distance field glyphs are added to the atlas on first use.
+            mutable std::array<Glyph, k_numDirectCharacters> m_directGlyphs;
+            std::array<bool, k_numDirectCharacters> m_hasDirectGlyph = {};
+			mutable std::unordered_map<Core::UTF8Char, Glyph> m_glyphs;
 			CharacterSet m_characters;
             
             TextureCSPtr m_texture;
+            DistanceFieldGlyphAtlasUPtr m_distanceFieldAtlas;
             
+            u32 m_buildId = 0;
             u32 m_pointSize = 0;
             f32 m_lineHeight = 0.0f;
             f32 m_descent = 0.0f;
@@ -32,10 +32,14 @@
 #include <ChilliSource/Core/Base/Utils.h>
 #include <ChilliSource/Core/File/CSBinaryChunk.h>
 #include <ChilliSource/Core/File/CSBinaryInputStream.h>
+#include <ChilliSource/Core/Image/Image.h>
+#include <ChilliSource/Core/Image/ImageCompression.h>
+#include <ChilliSource/Core/Image/ImageFormat.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Core/String/UTF8StringUtils.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Font/Font.h>
+#include <ChilliSource/Rendering/Font/FontResourceOptions.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 
 namespace ChilliSource
@@ -209,6 +213,8 @@ namespace ChilliSource
 		
         CS_DEFINE_NAMEDTYPE(FontProvider);
         
+        const Core::IResourceOptionsBaseCSPtr FontProvider::s_defaultOptions(std::make_shared<FontResourceOptions>());
+        
         //-------------------------------------------------------
         //-------------------------------------------------------
         FontProviderUPtr FontProvider::Create()
@@ -233,23 +239,67 @@ namespace ChilliSource
 		{
 			return in_extension == k_fontFileExtension;
 		}
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void FontProvider::PostCreate()
+        {
+            auto resourceProviders = Core::Application::Get()->GetSystems<Core::ResourceProvider>();
+            
+            for(u32 i=0; i<resourceProviders.size(); ++i)
+            {
+                if(resourceProviders[i]->GetResourceType() == Core::Image::InterfaceID)
+                {
+                    m_imageProviders.push_back(resourceProviders[i]);
+                }
+            }
+        }
+        //----------------------------------------------------------------------------
+        /// The render system restores textures before the other systems are
+        /// resumed, so the atlas textures exist again by this point, but with
+        /// undefined contents.
+        //----------------------------------------------------------------------------
+        void FontProvider::OnResume()
+        {
+#ifdef CS_TARGETPLATFORM_ANDROID
+            auto fonts = Core::Application::Get()->GetResourcePool()->GetAllResources<Font>();
+            for (const auto& font : fonts)
+            {
+                const_cast<Font*>(font.get())->RestoreDistanceFieldAtlas();
+            }
+#endif
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        Core::IResourceOptionsBaseCSPtr FontProvider::GetDefaultOptions() const
+        {
+            return s_defaultOptions;
+        }
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
 		void FontProvider::CreateResourceFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceSPtr& out_resource)
 		{
-            LoadFont(in_location, in_filePath, nullptr, out_resource);
+            LoadFont(in_location, in_filePath, in_options, nullptr, out_resource);
 		}
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
 		void FontProvider::CreateResourceFromFileAsync(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
         {
-			auto task = std::bind(&FontProvider::LoadFont, this, in_location, in_filePath, in_delegate, out_resource);
+			auto task = std::bind(&FontProvider::LoadFont, this, in_location, in_filePath, in_options, in_delegate, out_resource);
             Core::Application::Get()->GetTaskScheduler()->ScheduleTask(task);
         }
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
-		void FontProvider::LoadFont(Core::StorageLocation in_location, const std::string& in_filePath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
+		void FontProvider::LoadFont(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
         {
+            CS_ASSERT(in_options != nullptr, "Options for font load cannot be null");
+            
+            const FontResourceOptions* options = (const FontResourceOptions*)in_options.get();
+            if (options->IsDistanceFieldEnabled() == true)
+            {
+                LoadDistanceFieldFont(in_location, in_filePath, options, in_delegate, out_resource);
+                return;
+            }
+            
 			std::string fileName, fileExtension;
             Core::StringUtils::SplitBaseFilename(in_filePath, fileName, fileExtension);
             
@@ -309,5 +359,111 @@ namespace ChilliSource
                 });
             }
         }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void FontProvider::LoadDistanceFieldFont(Core::StorageLocation in_location, const std::string& in_filePath, const FontResourceOptions* in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
+        {
+            std::string fileName, fileExtension;
+            Core::StringUtils::SplitBaseFilename(in_filePath, fileName, fileExtension);
+            
+            const std::string textureFilePath(fileName + "." + k_textureFileExtension);
+            
+            Font::Descriptor desc;
+            desc.m_distanceFieldSpread = in_options->GetDistanceFieldSpread();
+            desc.m_distanceFieldAtlasSize = in_options->GetDistanceFieldAtlasSize();
+            
+            if (LoadCSFont(in_location, in_filePath, desc) == true && LoadCoverage(in_location, textureFilePath, desc) == true)
+            {
+                Font* font = (Font*)(out_resource.get());
+                font->Build(desc);
+                out_resource->SetLoadState(Core::Resource::LoadState::k_loaded);
+            }
+            else
+            {
+                out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
+            }
+            
+            if (in_delegate != nullptr)
+            {
+                Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        bool FontProvider::LoadCoverage(Core::StorageLocation in_location, const std::string& in_filePath, Font::Descriptor& out_desc) const
+        {
+            std::string fileName, fileExtension;
+            Core::StringUtils::SplitBaseFilename(in_filePath, fileName, fileExtension);
+            
+            Core::ResourceProvider* imageProvider = nullptr;
+            for(u32 i=0; i<m_imageProviders.size(); ++i)
+            {
+                if(m_imageProviders[i]->CanCreateResourceWithFileExtension(fileExtension))
+                {
+                    imageProvider = m_imageProviders[i];
+                    break;
+                }
+            }
+            
+            if (imageProvider == nullptr)
+            {
+                CS_LOG_ERROR("Cannot find provider for " + in_filePath);
+                return false;
+            }
+            
+            Core::ResourceSPtr imageResource(Core::Image::Create());
+            imageProvider->CreateResourceFromFile(in_location, in_filePath, nullptr, imageResource);
+            Core::Image* image = (Core::Image*)imageResource.get();
+            
+            if (image->GetLoadState() == Core::Resource::LoadState::k_failed)
+            {
+                CS_LOG_ERROR("Failed to load font image " + in_filePath);
+                return false;
+            }
+            
+            if (image->GetWidth() != out_desc.m_textureAtlasWidth || image->GetHeight() != out_desc.m_textureAtlasHeight)
+            {
+                CS_LOG_ERROR("Font image size doesn't match the font: " + in_filePath);
+                return false;
+            }
+            
+            //glyph coverage is taken from the alpha channel, or luminance if there is no alpha.
+            u32 bytesPerPixel = 0;
+            u32 coverageOffset = 0;
+            switch (image->GetFormat())
+            {
+                case Core::ImageFormat::k_RGBA8888:
+                    bytesPerPixel = 4;
+                    coverageOffset = 3;
+                    break;
+                case Core::ImageFormat::k_LumA88:
+                    bytesPerPixel = 2;
+                    coverageOffset = 1;
+                    break;
+                case Core::ImageFormat::k_Lum8:
+                    bytesPerPixel = 1;
+                    coverageOffset = 0;
+                    break;
+                default:
+                    break;
+            }
+            
+            if (bytesPerPixel == 0 || image->GetCompression() != Core::ImageCompression::k_none)
+            {
+                CS_LOG_ERROR("Distance field fonts require an uncompressed RGBA8888, LumA88 or Lum8 image: " + in_filePath);
+                return false;
+            }
+            
+            const u32 numPixels = image->GetWidth() * image->GetHeight();
+            const u8* imageData = image->GetData();
+            
+            out_desc.m_distanceFieldCoverage.resize(numPixels);
+            for (u32 i = 0; i < numPixels; ++i)
+            {
+                out_desc.m_distanceFieldCoverage[i] = imageData[i * bytesPerPixel + coverageOffset];
+            }
+            
+            return true;
+        }
 	}
 }
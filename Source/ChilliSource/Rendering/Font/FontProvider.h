@@ -31,6 +31,9 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Resource/ResourceProvider.h>
+#include <ChilliSource/Rendering/Font/Font.h>
+
+#include <vector>
 
 namespace ChilliSource
 {
@@ -39,7 +42,11 @@ namespace ChilliSource
         //-------------------------------------------------------
         /// Factory class from loading font resources
         /// from file. The font resource is actually a compound
-        /// resource of supported characters and kerning info
+        /// resource of supported characters and kerning info.
+        ///
+        /// If loaded with distance field options, the font bitmap is
+        /// loaded as an image rather than a texture and glyphs are
+        /// converted to distance fields as they are used.
         ///
         /// @author S Downie
         //-------------------------------------------------------
@@ -79,6 +86,27 @@ namespace ChilliSource
 			/// @return Whether the object can create a resource with the given extension
 			//----------------------------------------------------------------------------
 			bool CanCreateResourceWithFileExtension(const std::string& in_extension) const override;
+            //----------------------------------------------------------------------------
+            /// Called when the system is initialised. Retrieves the image providers
+            /// used to load distance field font bitmaps.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            void PostCreate();
+            //----------------------------------------------------------------------------
+            /// Called when the application resumes. Distance field glyph atlases are
+            /// generated at runtime, so on platforms that can lose the render context
+            /// their contents are generated again here.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            void OnResume() override;
+            //----------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Default options for font loading
+            //----------------------------------------------------
+            Core::IResourceOptionsBaseCSPtr GetDefaultOptions() const override;
 			
 		private:
             //-------------------------------------------------------
@@ -121,10 +149,41 @@ namespace ChilliSource
 			///
             /// @param The storage location to load from
 			/// @param Filename
+            /// @param Options to customise the creation
             /// @param Completion delegate
 			/// @param [Out] Font resource
 			//----------------------------------------------------------------------------
-			void LoadFont(Core::StorageLocation in_location, const std::string& in_filePath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource);
+			void LoadFont(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource);
+            //----------------------------------------------------------------------------
+            /// Loads a distance field font. This is performed entirely on the calling
+            /// thread, as the glyph atlas texture isn't created until it is first used.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The storage location to load from
+            /// @param Filename
+            /// @param The font options.
+            /// @param Completion delegate
+            /// @param [Out] Font resource
+            //----------------------------------------------------------------------------
+            void LoadDistanceFieldFont(Core::StorageLocation in_location, const std::string& in_filePath, const FontResourceOptions* in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource);
+            //----------------------------------------------------------------------------
+            /// Loads the font bitmap image and extracts its coverage, for use in
+            /// generating distance fields.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The storage location to load from
+            /// @param The image file path.
+            /// @param [Out] The font description the coverage is written to.
+            ///
+            /// @return Whether or not the load was successful.
+            //----------------------------------------------------------------------------
+            bool LoadCoverage(Core::StorageLocation in_location, const std::string& in_filePath, Font::Descriptor& out_desc) const;
+            
+            static const Core::IResourceOptionsBaseCSPtr s_defaultOptions;
+            
+            std::vector<Core::ResourceProvider*> m_imageProviders;
 		};
 	}
 }
@@ -0,0 +1,76 @@
+//
+//  FontResourceOptions.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Font/FontResourceOptions.h>
+
+#include <ChilliSource/Core/Cryptographic/HashCRC32.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        FontResourceOptions::FontResourceOptions(bool in_distanceFieldEnabled, u32 in_distanceFieldSpread, u32 in_distanceFieldAtlasSize)
+        {
+            CS_ASSERT(in_distanceFieldSpread > 0, "The distance field spread must be greater than zero.");
+            CS_ASSERT(in_distanceFieldAtlasSize > 0, "The distance field atlas size must be greater than zero.");
+            
+            m_options.m_distanceFieldEnabled = in_distanceFieldEnabled;
+            m_options.m_distanceFieldSpread = in_distanceFieldSpread;
+            m_options.m_distanceFieldAtlasSize = in_distanceFieldAtlasSize;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        u32 FontResourceOptions::GenerateHash() const
+        {
+            //the options are copied to an array first so that struct padding isn't hashed.
+            const u32 values[] = { u32(m_options.m_distanceFieldEnabled), m_options.m_distanceFieldSpread, m_options.m_distanceFieldAtlasSize };
+            return Core::HashCRC32::GenerateHashCode((const s8*)values, sizeof(values));
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        bool FontResourceOptions::IsDistanceFieldEnabled() const
+        {
+            return m_options.m_distanceFieldEnabled;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        u32 FontResourceOptions::GetDistanceFieldSpread() const
+        {
+            return m_options.m_distanceFieldSpread;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        u32 FontResourceOptions::GetDistanceFieldAtlasSize() const
+        {
+            return m_options.m_distanceFieldAtlasSize;
+        }
+	}
+}
@@ -0,0 +1,121 @@
+//
+//  FontResourceOptions.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_FONT_FONTRESOURCEOPTIONS_H_
+#define _CHILLISOURCE_RENDERING_FONT_FONTRESOURCEOPTIONS_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Resource/IResourceOptions.h>
+#include <ChilliSource/Rendering/Font/Font.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        //-------------------------------------------------------
+        /// Custom options for loading a font.
+        ///
+        /// @author Ian Copland
+        //-------------------------------------------------------
+		class FontResourceOptions final : public Core::IResourceOptions<Rendering::Font>
+		{
+		public:
+            //-------------------------------------------------------
+            /// Constructor. Creates options for a bitmap font.
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------
+            FontResourceOptions() = default;
+            //-------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Whether or not the font should be rendered
+            /// using signed distance fields rather than directly
+            /// from the font bitmap. Distance field fonts stay sharp
+            /// when scaled, so a single font can be used at all
+            /// sizes.
+            /// @param The distance field spread in texels. Larger
+            /// values allow larger scales and effects such as
+            /// outlines, but take more space in the atlas.
+            /// @param The width and height of the distance field
+            /// glyph atlas.
+            //-------------------------------------------------------
+            FontResourceOptions(bool in_distanceFieldEnabled, u32 in_distanceFieldSpread = 4, u32 in_distanceFieldAtlasSize = 512);
+            //-------------------------------------------------------
+            /// Generate a unique hash based on the
+            /// currently set options
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return Hash of the options contents
+            //-------------------------------------------------------
+            u32 GenerateHash() const override;
+            //-------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not the font should be rendered
+            /// using signed distance fields.
+            //-------------------------------------------------------
+            bool IsDistanceFieldEnabled() const;
+            //-------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The distance field spread in texels.
+            //-------------------------------------------------------
+            u32 GetDistanceFieldSpread() const;
+            //-------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The width and height of the distance field
+            /// glyph atlas.
+            //-------------------------------------------------------
+            u32 GetDistanceFieldAtlasSize() const;
+        private:
+            
+            //-------------------------------------------------------
+            /// The options for loading fonts. These are held in a
+            /// struct to more easily allow hashing of the data
+            ///
+            /// @author Ian Copland
+            //-------------------------------------------------------
+            struct Options
+            {
+                u32 m_distanceFieldSpread = 4;
+                u32 m_distanceFieldAtlasSize = 512;
+                bool m_distanceFieldEnabled = false;
+            };
+            
+            Options m_options;
+		};
+	}
+}
+
+#endif
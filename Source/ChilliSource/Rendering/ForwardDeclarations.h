@@ -56,6 +56,7 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(MaterialSortPredicate);
         CS_FORWARDDECLARE_CLASS(RenderSystem);
         CS_FORWARDDECLARE_CLASS(RenderTarget);
+        CS_FORWARDDECLARE_CLASS(UploadScheduler);
         CS_FORWARDDECLARE_CLASS(VertexDeclaration);
         enum class AlignmentAnchor;
         enum class ShaderPass;
@@ -74,8 +75,10 @@ namespace ChilliSource
         //------------------------------------------------------------
         /// Font
         //------------------------------------------------------------
+        CS_FORWARDDECLARE_CLASS(DistanceFieldGlyphAtlas);
         CS_FORWARDDECLARE_CLASS(Font);
         CS_FORWARDDECLARE_CLASS(FontProvider);
+        CS_FORWARDDECLARE_CLASS(FontResourceOptions);
         //------------------------------------------------------------
         /// Lighting
         //------------------------------------------------------------
@@ -166,6 +169,8 @@ namespace ChilliSource
         /// Texture
         //------------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(Cubemap);
+        CS_FORWARDDECLARE_CLASS(DynamicTextureAtlas);
+        CS_FORWARDDECLARE_CLASS(SkylinePacker);
         CS_FORWARDDECLARE_CLASS(Texture);
         CS_FORWARDDECLARE_CLASS(TextureAtlas);
         CS_FORWARDDECLARE_CLASS(TextureAtlasProvider);
@@ -28,6 +28,8 @@
 
 #include <ChilliSource/Rendering/Lighting/AmbientLightComponent.h>
 
+#include <typeinfo>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -41,6 +43,20 @@ namespace ChilliSource
 		{
 			return inInterfaceID == LightComponent::InterfaceID || inInterfaceID == AmbientLightComponent::InterfaceID;
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool AmbientLightComponent::RequiresUpdate() const
+		{
+			//subclasses may override the update, so only this exact type opts out.
+			return typeid(*this) != typeid(AmbientLightComponent);
+		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool AmbientLightComponent::RequiresFixedUpdate() const
+		{
+			//subclasses may override the update, so only this exact type opts out.
+			return typeid(*this) != typeid(AmbientLightComponent);
+		}
         //----------------------------------------------------------
         /// Get Light Matrix
         //----------------------------------------------------------
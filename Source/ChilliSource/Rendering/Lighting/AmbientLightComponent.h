@@ -49,6 +49,17 @@ namespace ChilliSource
 			/// @return Whether the class matches the comparison type
 			//----------------------------------------------------------
 			bool IsA(Core::InterfaceIDType inInterfaceID) const override;
+			//----------------------------------------------------------
+			/// @return Whether or not OnUpdate() should be called. This
+			/// component doesn't require an update, but subclasses do.
+			//----------------------------------------------------------
+			bool RequiresUpdate() const override;
+			//----------------------------------------------------------
+			/// @return Whether or not OnFixedUpdate() should be called.
+			/// This component doesn't require a fixed update, but
+			/// subclasses do.
+			//----------------------------------------------------------
+			bool RequiresFixedUpdate() const override;
             //----------------------------------------------------------
             /// Get Light Matrix
             ///
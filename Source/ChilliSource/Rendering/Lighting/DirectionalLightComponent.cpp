@@ -37,6 +37,8 @@
 #include <ChilliSource/Rendering/Base/RenderCapabilities.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 
+#include <typeinfo>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -68,6 +70,20 @@ namespace ChilliSource
 		{
 			return inInterfaceID == LightComponent::InterfaceID || inInterfaceID == DirectionalLightComponent::InterfaceID;
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool DirectionalLightComponent::RequiresUpdate() const
+		{
+			//subclasses may override the update, so only this exact type opts out.
+			return typeid(*this) != typeid(DirectionalLightComponent);
+		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool DirectionalLightComponent::RequiresFixedUpdate() const
+		{
+			//subclasses may override the update, so only this exact type opts out.
+			return typeid(*this) != typeid(DirectionalLightComponent);
+		}
         //----------------------------------------------------------
         /// Set Shadow Volume
         //----------------------------------------------------------
@@ -32,6 +32,7 @@
 #include <ChilliSource/Core/Entity/Entity.h>
 
 #include <limits>
+#include <typeinfo>
 
 namespace ChilliSource
 {
@@ -55,6 +56,20 @@ namespace ChilliSource
 		{
 			return inInterfaceID == LightComponent::InterfaceID || inInterfaceID == PointLightComponent::InterfaceID;
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool PointLightComponent::RequiresUpdate() const
+		{
+			//subclasses may override the update, so only this exact type opts out.
+			return typeid(*this) != typeid(PointLightComponent);
+		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool PointLightComponent::RequiresFixedUpdate() const
+		{
+			//subclasses may override the update, so only this exact type opts out.
+			return typeid(*this) != typeid(PointLightComponent);
+		}
         //----------------------------------------------------------
         /// Set Radius
         //----------------------------------------------------------
@@ -84,6 +84,20 @@ namespace ChilliSource
         }
         //---------------------------------------------------
         //---------------------------------------------------
+        MaterialSPtr MaterialFactory::CreateGUIDistanceField(const std::string& in_uniqueId) const
+        {
+            MaterialSPtr material(CreateCustom(in_uniqueId));
+            
+            Core::ResourcePool* resourcePool = Core::Application::Get()->GetResourcePool();
+            material->SetShader(ShaderPass::k_ambient, resourcePool->LoadResource<Shader>(Core::StorageLocation::k_chilliSource, "Shaders/GUIDistanceField.csshader"));
+            material->SetTransparencyEnabled(true);
+            material->SetCullFace(CullFace::k_back);
+            material->SetFaceCullingEnabled(true);
+            material->SetDepthTestEnabled(false);
+			return material;
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
         MaterialSPtr MaterialFactory::CreateSprite(const std::string& in_uniqueId, const TextureCSPtr& in_texture) const
         {
             MaterialSPtr material(CreateCustom(in_uniqueId));
@@ -91,6 +91,18 @@ namespace ChilliSource
             //---------------------------------------------------
             MaterialSPtr CreateGUI(const std::string& in_uniqueId) const;
             //---------------------------------------------------
+            /// Create a material to render UI text using a
+            /// signed distance field font.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Unique Id to identify in resource pool
+            /// "_" prefix is reserved for engine resources
+            ///
+            /// @return New material
+            //---------------------------------------------------
+            MaterialSPtr CreateGUIDistanceField(const std::string& in_uniqueId) const;
+            //---------------------------------------------------
             /// Create a material for rendering sprites. Sprites
             /// have no lighting and vertex colours
             ///
@@ -44,6 +44,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <typeinfo>
 
 namespace ChilliSource
 {
@@ -70,6 +71,13 @@ namespace ChilliSource
                     (inInterfaceID == RenderComponent::InterfaceID) ||
                     (inInterfaceID == VolumeComponent::InterfaceID);
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool AnimatedMeshComponent::RequiresFixedUpdate() const
+		{
+			//subclasses may override the update, so only this exact type opts out.
+			return typeid(*this) != typeid(AnimatedMeshComponent);
+		}
 		//----------------------------------------------------
 		/// Get Axis Aligned Bounding Box
 		//----------------------------------------------------
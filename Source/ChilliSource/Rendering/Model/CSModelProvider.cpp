@@ -30,6 +30,7 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Rendering/Base/UploadScheduler.h>
 #include <ChilliSource/Rendering/Model/Mesh.h>
 #include <ChilliSource/Rendering/Model/MeshDescriptor.h>
 
@@ -504,8 +505,15 @@ namespace ChilliSource
 				return;
 			}
 			
-			//start a main thread task for loading the data into a mesh
-			Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(&CSModelProvider::BuildMesh, this, in_delegate, descriptor, out_resource));
+			//queue the upload of the data into a mesh. This will be performed on the main thread.
+            u32 numBytes = 0;
+            for (const auto& subMeshDesc : descriptor.mMeshes)
+            {
+                numBytes += subMeshDesc.mudwNumVertices * descriptor.mVertexDeclaration.GetTotalSize() + subMeshDesc.mudwNumIndices * descriptor.mudwIndexSize;
+            }
+            
+            UploadScheduler* uploadScheduler = Core::Application::Get()->GetSystem<UploadScheduler>();
+			uploadScheduler->ScheduleUpload(numBytes, std::bind(&CSModelProvider::BuildMesh, this, in_delegate, descriptor, out_resource));
 		}
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
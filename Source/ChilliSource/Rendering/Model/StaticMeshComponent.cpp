@@ -41,6 +41,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <typeinfo>
 
 namespace ChilliSource
 {
@@ -62,6 +63,20 @@ namespace ChilliSource
                     (inInterfaceID == RenderComponent::InterfaceID) ||
                     (inInterfaceID == VolumeComponent::InterfaceID);
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool StaticMeshComponent::RequiresUpdate() const
+		{
+			//subclasses may override the update, so only this exact type opts out.
+			return typeid(*this) != typeid(StaticMeshComponent);
+		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool StaticMeshComponent::RequiresFixedUpdate() const
+		{
+			//subclasses may override the update, so only this exact type opts out.
+			return typeid(*this) != typeid(StaticMeshComponent);
+		}
 		//----------------------------------------------------
 		/// Get Axis Aligned Bounding Box
 		//----------------------------------------------------
@@ -216,6 +216,12 @@ namespace ChilliSource
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
+		bool ParticleEffectComponent::RequiresFixedUpdate() const
+		{
+			return false;
+		}
+		//-------------------------------------------------------
+		//-------------------------------------------------------
 		ParticleEffectCSPtr ParticleEffectComponent::GetParticleEffect() const
 		{
 			CS_ASSERT(Core::Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Can only get the Particle Effect on the main thread.");
@@ -99,6 +99,11 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			bool IsA(Core::InterfaceIDType in_interfaceId) const override;
 			//----------------------------------------------------------------
+			/// @return Whether or not OnFixedUpdate() should be called.
+			/// This component doesn't require a fixed update.
+			//----------------------------------------------------------------
+			bool RequiresFixedUpdate() const override;
+			//----------------------------------------------------------------
 			/// Returns the current particle effect. 
 			///
 			/// This is not thread-safe and should only be called on the main
@@ -168,6 +168,18 @@ namespace ChilliSource
                     (in_interfaceId == RenderComponent::InterfaceID) ||
                     (in_interfaceId == VolumeComponent::InterfaceID);
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool SpriteComponent::RequiresUpdate() const
+		{
+			return false;
+		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool SpriteComponent::RequiresFixedUpdate() const
+		{
+			return false;
+		}
 		//----------------------------------------------------
 		//----------------------------------------------------
 		const Core::AABB& SpriteComponent::GetAABB()
@@ -34,6 +34,8 @@
 #include <ChilliSource/Rendering/Texture/Cubemap.h>
 #include <ChilliSource/Rendering/Texture/CubemapProvider.h>
 #include <ChilliSource/Rendering/Texture/CubemapResourceOptions.h>
+#include <ChilliSource/Rendering/Texture/DynamicTextureAtlas.h>
+#include <ChilliSource/Rendering/Texture/SkylinePacker.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlasProvider.h>
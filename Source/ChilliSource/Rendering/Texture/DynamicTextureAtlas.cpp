@@ -0,0 +1,334 @@
+//
+//  DynamicTextureAtlas.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Texture/DynamicTextureAtlas.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Image/ImageCompression.h>
+#include <ChilliSource/Core/Image/ImageFormat.h>
+#include <ChilliSource/Core/Resource/ResourcePool.h>
+#include <ChilliSource/Core/String/ToString.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        namespace
+        {
+            const u32 k_pageSize = 1024;
+            const u32 k_padding = 1;
+            const u32 k_bytesPerPixel = 4;
+            
+            //----------------------------------------------------------------------------
+            /// Copies the given image into a buffer with a border of the given size on
+            /// each side. The border is filled by extending the edge pixels of the image.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The image width.
+            /// @param The image height.
+            /// @param The RGBA8888 image data.
+            /// @param The border size.
+            /// @param [Out] The padded image data.
+            //----------------------------------------------------------------------------
+            void CopyWithExtrudedBorder(u32 in_width, u32 in_height, const u8* in_data, u32 in_border, std::vector<u8>& out_data)
+            {
+                const u32 paddedWidth = in_width + 2 * in_border;
+                const u32 paddedHeight = in_height + 2 * in_border;
+                out_data.resize(paddedWidth * paddedHeight * k_bytesPerPixel);
+                
+                for (u32 y = 0; y < paddedHeight; ++y)
+                {
+                    const u32 sourceY = std::min(u32(std::max(s32(y) - s32(in_border), 0)), in_height - 1);
+                    const u8* sourceRow = in_data + sourceY * in_width * k_bytesPerPixel;
+                    u8* destRow = out_data.data() + y * paddedWidth * k_bytesPerPixel;
+                    
+                    for (u32 x = 0; x < in_border; ++x)
+                    {
+                        memcpy(destRow + x * k_bytesPerPixel, sourceRow, k_bytesPerPixel);
+                        memcpy(destRow + (in_border + in_width + x) * k_bytesPerPixel, sourceRow + (in_width - 1) * k_bytesPerPixel, k_bytesPerPixel);
+                    }
+                    
+                    memcpy(destRow + in_border * k_bytesPerPixel, sourceRow, in_width * k_bytesPerPixel);
+                }
+            }
+        }
+        
+        CS_DEFINE_NAMEDTYPE(DynamicTextureAtlas);
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        DynamicTextureAtlasUPtr DynamicTextureAtlas::Create()
+        {
+            return DynamicTextureAtlasUPtr(new DynamicTextureAtlas());
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        DynamicTextureAtlas::DynamicTextureAtlas()
+            : m_isEnabled(false), m_maxEntrySize(256)
+        {
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        bool DynamicTextureAtlas::IsA(Core::InterfaceIDType in_interfaceId) const
+        {
+            return (DynamicTextureAtlas::InterfaceID == in_interfaceId);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void DynamicTextureAtlas::SetEnabled(bool in_enabled)
+        {
+            m_isEnabled = in_enabled;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        bool DynamicTextureAtlas::IsEnabled() const
+        {
+            return m_isEnabled;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void DynamicTextureAtlas::SetMaxEntrySize(u32 in_size)
+        {
+            CS_ASSERT(in_size + 2 * k_padding <= k_pageSize, "The max entry size must fit within an atlas page.");
+            
+            m_maxEntrySize = in_size;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        u32 DynamicTextureAtlas::GetMaxEntrySize() const
+        {
+            return m_maxEntrySize;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void DynamicTextureAtlas::SetMaxNumPages(u32 in_numPages)
+        {
+            m_maxNumPages = in_numPages;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        u32 DynamicTextureAtlas::GetMaxNumPages() const
+        {
+            return m_maxNumPages;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        bool DynamicTextureAtlas::CanAdd(const Texture::Descriptor& in_desc, bool in_mipMapped, Texture::FilterMode in_filterMode, Texture::WrapMode in_wrapModeS, Texture::WrapMode in_wrapModeT) const
+        {
+            const u32 maxEntrySize = m_maxEntrySize;
+            
+            return (m_isEnabled == true && in_mipMapped == false && in_desc.m_numMipLevels <= 1 &&
+                    in_desc.m_format == Core::ImageFormat::k_RGBA8888 && in_desc.m_compression == Core::ImageCompression::k_none &&
+                    in_filterMode == Texture::FilterMode::k_bilinear && in_wrapModeS == Texture::WrapMode::k_clamp && in_wrapModeT == Texture::WrapMode::k_clamp &&
+                    in_desc.m_width > 0 && in_desc.m_height > 0 && in_desc.m_width <= maxEntrySize && in_desc.m_height <= maxEntrySize);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        bool DynamicTextureAtlas::Add(const TextureCSPtr& in_texture, const Texture::Descriptor& in_desc, const u8* in_data)
+        {
+            CS_ASSERT(Core::Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Textures can only be added to the atlas on the main thread.");
+            CS_ASSERT(in_texture != nullptr && in_data != nullptr, "Cannot add a null texture to the atlas.");
+            CS_ASSERT(in_desc.m_format == Core::ImageFormat::k_RGBA8888 && in_desc.m_compression == Core::ImageCompression::k_none, "Only uncompressed RGBA8888 textures can be atlased.");
+            
+            Remove(in_texture.get());
+            
+            const u32 paddedWidth = in_desc.m_width + 2 * k_padding;
+            const u32 paddedHeight = in_desc.m_height + 2 * k_padding;
+            
+            u32 pageIndex = 0;
+            Core::Integer2 position;
+            if (Allocate(paddedWidth, paddedHeight, pageIndex, position) == false)
+            {
+                m_numRejected++;
+                return false;
+            }
+            
+            std::vector<u8> paddedData;
+            CopyWithExtrudedBorder(in_desc.m_width, in_desc.m_height, in_data, k_padding, paddedData);
+            
+            Page& page = m_pages[pageIndex];
+            page.m_texture->UploadRegion(u32(position.x), u32(position.y), paddedWidth, paddedHeight, paddedData.data());
+            page.m_numEntries++;
+            
+            Entry entry;
+            entry.m_texture = in_texture;
+            entry.m_pageIndex = pageIndex;
+            entry.m_region.m_pageTexture = page.m_texture;
+            entry.m_region.m_UVs = UVs(f32(u32(position.x) + k_padding) / f32(k_pageSize), f32(u32(position.y) + k_padding) / f32(k_pageSize),
+                                       f32(in_desc.m_width) / f32(k_pageSize), f32(in_desc.m_height) / f32(k_pageSize));
+            m_entries[in_texture.get()] = entry;
+            
+            return true;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void DynamicTextureAtlas::Remove(const Texture* in_texture)
+        {
+            auto it = m_entries.find(in_texture);
+            if (it != m_entries.end())
+            {
+                ReleaseEntry(it->second);
+                m_entries.erase(it);
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        const DynamicTextureAtlas::Region* DynamicTextureAtlas::GetRegion(const TextureCSPtr& in_texture) const
+        {
+            if (m_entries.empty() == true)
+            {
+                return nullptr;
+            }
+            
+            auto it = m_entries.find(in_texture.get());
+            if (it == m_entries.end() || it->second.m_texture.expired() == true)
+            {
+                return nullptr;
+            }
+            
+            return &it->second.m_region;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        DynamicTextureAtlas::Stats DynamicTextureAtlas::GetStats() const
+        {
+            Stats stats;
+            stats.m_numPages = u32(m_pages.size());
+            stats.m_numEntries = u32(m_entries.size());
+            stats.m_numRejected = m_numRejected;
+            
+            for (const auto& page : m_pages)
+            {
+                stats.m_averageOccupancy += page.m_packer.GetOccupancy();
+            }
+            
+            if (m_pages.empty() == false)
+            {
+                stats.m_averageOccupancy /= f32(m_pages.size());
+            }
+            
+            return stats;
+        }
+        //----------------------------------------------------------------------------
+        /// Space is only reclaimed from expired entries once the existing pages are
+        /// full, as destroyed textures are only detected by scanning all entries.
+        //----------------------------------------------------------------------------
+        bool DynamicTextureAtlas::Allocate(u32 in_width, u32 in_height, u32& out_pageIndex, Core::Integer2& out_position)
+        {
+            for (u32 attempt = 0; attempt < 2; ++attempt)
+            {
+                for (u32 i = 0; i < m_pages.size(); ++i)
+                {
+                    if (m_pages[i].m_packer.Pack(in_width, in_height, out_position) == true)
+                    {
+                        out_pageIndex = i;
+                        return true;
+                    }
+                }
+                
+                if (attempt == 0)
+                {
+                    RemoveExpiredEntries();
+                }
+            }
+            
+            if (m_pages.size() >= m_maxNumPages)
+            {
+                return false;
+            }
+            
+            Page page = { nullptr, SkylinePacker(k_pageSize, k_pageSize), 0 };
+            if (page.m_packer.Pack(in_width, in_height, out_position) == false)
+            {
+                return false;
+            }
+            
+            Texture::Descriptor desc;
+            desc.m_width = k_pageSize;
+            desc.m_height = k_pageSize;
+            desc.m_format = Core::ImageFormat::k_RGBA8888;
+            desc.m_compression = Core::ImageCompression::k_none;
+            desc.m_dataSize = k_pageSize * k_pageSize * k_bytesPerPixel;
+            
+            page.m_texture = Core::Application::Get()->GetResourcePool()->CreateResource<Texture>("_DynamicTextureAtlasPage" + Core::ToString(m_nextPageId++));
+            page.m_texture->BuildEmpty(desc, false, false);
+            page.m_texture->CompleteUpload(nullptr);
+            page.m_texture->SetFilterMode(Texture::FilterMode::k_bilinear);
+            page.m_texture->SetWrapMode(Texture::WrapMode::k_clamp, Texture::WrapMode::k_clamp);
+            page.m_texture->SetLoadState(Core::Resource::LoadState::k_loaded);
+            
+            out_pageIndex = u32(m_pages.size());
+            m_pages.push_back(std::move(page));
+            
+            return true;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void DynamicTextureAtlas::RemoveExpiredEntries()
+        {
+            for (auto it = m_entries.begin(); it != m_entries.end();)
+            {
+                if (it->second.m_texture.expired() == true)
+                {
+                    ReleaseEntry(it->second);
+                    it = m_entries.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void DynamicTextureAtlas::ReleaseEntry(const Entry& in_entry)
+        {
+            Page& page = m_pages[in_entry.m_pageIndex];
+            
+            CS_ASSERT(page.m_numEntries > 0, "Atlas page entry count is out of sync.");
+            page.m_numEntries--;
+            
+            if (page.m_numEntries == 0)
+            {
+                page.m_packer.Reset();
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void DynamicTextureAtlas::OnDestroy()
+        {
+            m_entries.clear();
+            m_pages.clear();
+        }
+    }
+}
@@ -0,0 +1,301 @@
+//
+//  DynamicTextureAtlas.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_TEXTURE_DYNAMICTEXTUREATLAS_H_
+#define _CHILLISOURCE_RENDERING_TEXTURE_DYNAMICTEXTUREATLAS_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/System/AppSystem.h>
+#include <ChilliSource/Rendering/Texture/SkylinePacker.h>
+#include <ChilliSource/Rendering/Texture/Texture.h>
+#include <ChilliSource/Rendering/Texture/UVs.h>
+
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        //----------------------------------------------------------------------------
+        /// A system which packs small textures into shared pages at runtime. Each
+        /// texture in its own file normally gets its own material, which breaks the
+        /// sprite batch every time a different image is drawn. The texture provider
+        /// adds suitable textures to the atlas as they are loaded. The canvas
+        /// renderer then draws them from their atlas page with remapped UVs, so UI
+        /// built from separate images batches as though it used an offline atlas.
+        ///
+        /// A texture is only added if it is uncompressed RGBA8888, has no mip maps,
+        /// uses clamped wrapping and bilinear filtering, and is no larger than the
+        /// max entry size. The original texture is still built, so atlased textures
+        /// remain usable anywhere else. Each image is surrounded by a one texel
+        /// border copied from its edge pixels to prevent bleeding when filtering.
+        ///
+        /// The atlas is disabled by default. Each page is a 1024x1024 RGBA texture,
+        /// so with the default page limit it can use up to 16MB of texture memory
+        /// on top of the original textures. Pages are only created once needed.
+        /// Atlas pages are not restored after a context loss, so the atlas should
+        /// not be enabled on Android.
+        ///
+        /// This system must only be used on the main thread.
+        ///
+        /// @author Ian Copland
+        //----------------------------------------------------------------------------
+        class DynamicTextureAtlas final : public Core::AppSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(DynamicTextureAtlas);
+            //----------------------------------------------------------------------------
+            /// The location of an atlased texture.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            struct Region
+            {
+                TextureCSPtr m_pageTexture;
+                UVs m_UVs;
+            };
+            //----------------------------------------------------------------------------
+            /// A container for statistics on the contents of the atlas.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            struct Stats
+            {
+                u32 m_numPages = 0;
+                u32 m_numEntries = 0;
+                u32 m_numRejected = 0;
+                f32 m_averageOccupancy = 0.0f;
+            };
+            //----------------------------------------------------------------------------
+            /// Allows querying of whether or not this system implements the interface
+            /// described by the given interface Id.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The interface Id.
+            ///
+            /// @return Whether or not the interface is implemented.
+            //----------------------------------------------------------------------------
+            bool IsA(Core::InterfaceIDType in_interfaceId) const override;
+            //----------------------------------------------------------------------------
+            /// Sets whether or not new textures can be added to the atlas. Textures
+            /// which have already been added are unaffected. Defaults to false.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Whether or not the atlas is enabled.
+            //----------------------------------------------------------------------------
+            void SetEnabled(bool in_enabled);
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return Whether or not new textures can be added to the atlas.
+            //----------------------------------------------------------------------------
+            bool IsEnabled() const;
+            //----------------------------------------------------------------------------
+            /// Sets the largest width or height of a texture which can be added to the
+            /// atlas. Defaults to 256.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The max entry size in texels.
+            //----------------------------------------------------------------------------
+            void SetMaxEntrySize(u32 in_size);
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The largest width or height of a texture which can be added to
+            /// the atlas.
+            //----------------------------------------------------------------------------
+            u32 GetMaxEntrySize() const;
+            //----------------------------------------------------------------------------
+            /// Sets the maximum number of pages the atlas can create. Once all pages
+            /// are full, further textures are drawn from their own texture. Defaults
+            /// to 4.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The maximum number of pages.
+            //----------------------------------------------------------------------------
+            void SetMaxNumPages(u32 in_numPages);
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The maximum number of pages the atlas can create.
+            //----------------------------------------------------------------------------
+            u32 GetMaxNumPages() const;
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The texture descriptor.
+            /// @param Whether or not the texture will have mip maps.
+            /// @param The texture filter mode.
+            /// @param The horizontal texture wrap mode.
+            /// @param The vertical texture wrap mode.
+            ///
+            /// @return Whether or not a texture with the given description can be added
+            /// to the atlas. This is thread safe, so can be called from the texture
+            /// loading thread.
+            //----------------------------------------------------------------------------
+            bool CanAdd(const Texture::Descriptor& in_desc, bool in_mipMapped, Texture::FilterMode in_filterMode, Texture::WrapMode in_wrapModeS, Texture::WrapMode in_wrapModeT) const;
+            //----------------------------------------------------------------------------
+            /// Copies the given texture data into the atlas. The descriptor must
+            /// describe a texture that CanAdd() accepts. If the texture is already in
+            /// the atlas it is replaced. This must be called on the main thread.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The texture the data belongs to.
+            /// @param The texture descriptor.
+            /// @param The texture data.
+            ///
+            /// @return Whether or not there was room for the texture.
+            //----------------------------------------------------------------------------
+            bool Add(const TextureCSPtr& in_texture, const Texture::Descriptor& in_desc, const u8* in_data);
+            //----------------------------------------------------------------------------
+            /// Removes the given texture from the atlas. The space it used is only
+            /// reclaimed once its page is empty. Textures which are destroyed are
+            /// removed automatically when space is needed.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The texture.
+            //----------------------------------------------------------------------------
+            void Remove(const Texture* in_texture);
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The texture.
+            ///
+            /// @return The region of the atlas containing the given texture, or null if
+            /// the texture is not atlased. The pointer is invalidated by any change to
+            /// the atlas.
+            //----------------------------------------------------------------------------
+            const Region* GetRegion(const TextureCSPtr& in_texture) const;
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The current atlas statistics.
+            //----------------------------------------------------------------------------
+            Stats GetStats() const;
+            
+        private:
+            friend class Core::Application;
+            //----------------------------------------------------------------------------
+            /// A single atlas texture.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            struct Page
+            {
+                TextureSPtr m_texture;
+                SkylinePacker m_packer;
+                u32 m_numEntries;
+            };
+            //----------------------------------------------------------------------------
+            /// An atlased texture. The texture is stored as a weak pointer so that
+            /// an entry left over from a destroyed texture can be identified even if a
+            /// new texture has been allocated at the same address.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            struct Entry
+            {
+                TextureCWPtr m_texture;
+                u32 m_pageIndex;
+                Region m_region;
+            };
+            //----------------------------------------------------------------------------
+            /// Creates a new instance of the system.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The new instance.
+            //----------------------------------------------------------------------------
+            static DynamicTextureAtlasUPtr Create();
+            //----------------------------------------------------------------------------
+            /// Private constructor to enforce the use of the factory method.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            DynamicTextureAtlas();
+            //----------------------------------------------------------------------------
+            /// Finds space for a region of the given size, creating a new page if
+            /// required and permitted.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The width of the region.
+            /// @param The height of the region.
+            /// @param [Out] The index of the page.
+            /// @param [Out] The position of the region in the page.
+            ///
+            /// @return Whether or not space was found.
+            //----------------------------------------------------------------------------
+            bool Allocate(u32 in_width, u32 in_height, u32& out_pageIndex, Core::Integer2& out_position);
+            //----------------------------------------------------------------------------
+            /// Removes the entries for all textures which have been destroyed.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            void RemoveExpiredEntries();
+            //----------------------------------------------------------------------------
+            /// Releases an entry's space in its page, resetting the page once it is
+            /// empty.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The entry.
+            //----------------------------------------------------------------------------
+            void ReleaseEntry(const Entry& in_entry);
+            //----------------------------------------------------------------------------
+            /// Discards all entries and pages. The page textures are left to be
+            /// released by the resource pool, as GUI materials may still refer to
+            /// them.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            void OnDestroy() override;
+            
+            //These are read by CanAdd() on the texture loading thread, so are atomic.
+            std::atomic<bool> m_isEnabled;
+            std::atomic<u32> m_maxEntrySize;
+            u32 m_maxNumPages = 4;
+            u32 m_numRejected = 0;
+            u32 m_nextPageId = 0;
+            
+            std::vector<Page> m_pages;
+            std::unordered_map<const Texture*, Entry> m_entries;
+        };
+    }
+}
+
+#endif
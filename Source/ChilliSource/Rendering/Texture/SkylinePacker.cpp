@@ -0,0 +1,189 @@
+//
+//  SkylinePacker.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Texture/SkylinePacker.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        SkylinePacker::SkylinePacker(u32 in_width, u32 in_height)
+            : m_width(in_width), m_height(in_height)
+        {
+            Reset();
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool SkylinePacker::Pack(u32 in_width, u32 in_height, Core::Integer2& out_position)
+        {
+            if (in_width == 0 || in_height == 0)
+            {
+                return false;
+            }
+            
+            u32 bestIndex = std::numeric_limits<u32>::max();
+            u32 bestBottom = std::numeric_limits<u32>::max();
+            u32 bestWidth = std::numeric_limits<u32>::max();
+            u32 bestY = 0;
+            
+            for (u32 i = 0; i < m_skyline.size(); ++i)
+            {
+                u32 y = 0;
+                if (Fit(i, in_width, in_height, y) == true)
+                {
+                    const u32 bottom = y + in_height;
+                    if (bottom < bestBottom || (bottom == bestBottom && m_skyline[i].m_width < bestWidth))
+                    {
+                        bestIndex = i;
+                        bestBottom = bottom;
+                        bestWidth = m_skyline[i].m_width;
+                        bestY = y;
+                    }
+                }
+            }
+            
+            if (bestIndex == std::numeric_limits<u32>::max())
+            {
+                return false;
+            }
+            
+            Segment segment;
+            segment.m_x = m_skyline[bestIndex].m_x;
+            segment.m_y = bestY + in_height;
+            segment.m_width = in_width;
+            AddSegment(bestIndex, segment);
+            
+            m_usedArea += u64(in_width) * u64(in_height);
+            
+            out_position = Core::Integer2(s32(segment.m_x), s32(bestY));
+            return true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void SkylinePacker::Reset()
+        {
+            m_usedArea = 0;
+            m_skyline.clear();
+            
+            Segment segment;
+            segment.m_x = 0;
+            segment.m_y = 0;
+            segment.m_width = m_width;
+            m_skyline.push_back(segment);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 SkylinePacker::GetWidth() const
+        {
+            return m_width;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 SkylinePacker::GetHeight() const
+        {
+            return m_height;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        f32 SkylinePacker::GetOccupancy() const
+        {
+            return f32(f64(m_usedArea) / (f64(m_width) * f64(m_height)));
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool SkylinePacker::Fit(u32 in_segmentIndex, u32 in_width, u32 in_height, u32& out_y) const
+        {
+            const u32 x = m_skyline[in_segmentIndex].m_x;
+            if (x + in_width > m_width)
+            {
+                return false;
+            }
+            
+            u32 y = 0;
+            u32 remainingWidth = in_width;
+            for (u32 i = in_segmentIndex; remainingWidth > 0; ++i)
+            {
+                y = std::max(y, m_skyline[i].m_y);
+                if (y + in_height > m_height)
+                {
+                    return false;
+                }
+                
+                remainingWidth -= std::min(remainingWidth, m_skyline[i].m_width);
+            }
+            
+            out_y = y;
+            return true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void SkylinePacker::AddSegment(u32 in_segmentIndex, const Segment& in_segment)
+        {
+            m_skyline.insert(m_skyline.begin() + in_segmentIndex, in_segment);
+            
+            const u32 right = in_segment.m_x + in_segment.m_width;
+            for (u32 i = in_segmentIndex + 1; i < m_skyline.size();)
+            {
+                Segment& segment = m_skyline[i];
+                if (segment.m_x >= right)
+                {
+                    break;
+                }
+                
+                const u32 overlap = right - segment.m_x;
+                if (overlap < segment.m_width)
+                {
+                    segment.m_x += overlap;
+                    segment.m_width -= overlap;
+                    break;
+                }
+                
+                m_skyline.erase(m_skyline.begin() + i);
+            }
+            
+            for (u32 i = 0; i + 1 < m_skyline.size();)
+            {
+                if (m_skyline[i].m_y == m_skyline[i + 1].m_y)
+                {
+                    m_skyline[i].m_width += m_skyline[i + 1].m_width;
+                    m_skyline.erase(m_skyline.begin() + i + 1);
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+        }
+    }
+}
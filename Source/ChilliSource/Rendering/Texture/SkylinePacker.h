@@ -0,0 +1,154 @@
+//
+//  SkylinePacker.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_TEXTURE_SKYLINEPACKER_H_
+#define _CHILLISOURCE_RENDERING_TEXTURE_SKYLINEPACKER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        //--------------------------------------------------------------
+        /// Packs rectangles into a fixed size area using the skyline
+        /// bottom-left heuristic. The packer tracks the top edge of the
+        /// packed rectangles as a series of horizontal segments. Each
+        /// new rectangle is placed on the segment where its far edge
+        /// would be lowest. This is fast, and works well for the
+        /// similarly sized images typical of UI, but space below the
+        /// skyline that is left behind cannot be reused until the
+        /// packer is reset.
+        ///
+        /// Positions are measured from the top left of the area.
+        ///
+        /// @author Ian Copland
+        //--------------------------------------------------------------
+        class SkylinePacker final
+        {
+        public:
+            //----------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The width of the area to pack into.
+            /// @param The height of the area to pack into.
+            //----------------------------------------------------------
+            SkylinePacker(u32 in_width, u32 in_height);
+            //----------------------------------------------------------
+            /// Attempts to find space for a rectangle of the given size.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The width of the rectangle.
+            /// @param The height of the rectangle.
+            /// @param [Out] The position of the top left of the
+            /// rectangle if it was packed.
+            ///
+            /// @return Whether or not the rectangle was packed.
+            //----------------------------------------------------------
+            bool Pack(u32 in_width, u32 in_height, Core::Integer2& out_position);
+            //----------------------------------------------------------
+            /// Removes all packed rectangles.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            void Reset();
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The width of the area to pack into.
+            //----------------------------------------------------------
+            u32 GetWidth() const;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The height of the area to pack into.
+            //----------------------------------------------------------
+            u32 GetHeight() const;
+            //----------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The fraction of the area covered by packed
+            /// rectangles.
+            //----------------------------------------------------------
+            f32 GetOccupancy() const;
+            
+        private:
+            //----------------------------------------------------------
+            /// A single horizontal segment of the skyline.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------
+            struct Segment
+            {
+                u32 m_x;
+                u32 m_y;
+                u32 m_width;
+            };
+            //----------------------------------------------------------
+            /// Calculates the lowest y position at which a rectangle of
+            /// the given size can be placed with its left edge at the
+            /// start of the given segment.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The index of the segment.
+            /// @param The width of the rectangle.
+            /// @param The height of the rectangle.
+            /// @param [Out] The y position.
+            ///
+            /// @return Whether or not the rectangle fits.
+            //----------------------------------------------------------
+            bool Fit(u32 in_segmentIndex, u32 in_width, u32 in_height, u32& out_y) const;
+            //----------------------------------------------------------
+            /// Adds a new segment for a packed rectangle, removing or
+            /// shortening the segments it covers and merging adjacent
+            /// segments of the same height.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The index at which to insert the segment.
+            /// @param The new segment.
+            //----------------------------------------------------------
+            void AddSegment(u32 in_segmentIndex, const Segment& in_segment);
+            
+            u32 m_width;
+            u32 m_height;
+            u64 m_usedArea = 0;
+            std::vector<Segment> m_skyline;
+        };
+    }
+}
+
+#endif
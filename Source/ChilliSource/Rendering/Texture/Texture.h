@@ -52,7 +52,11 @@ namespace ChilliSource
             using TextureDataUPtr = std::unique_ptr<u8[]>;
             
             //--------------------------------------------------------------
-            /// Holds the description for building a texture from image data
+            /// Holds the description for building a texture from image data.
+            /// The number of mip levels includes the base level. If greater
+            /// than one the data must contain a complete, uncompressed mip
+            /// chain stored consecutively, largest first, and the data size
+            /// is that of the whole chain.
             ///
             /// @author S Downie
             //--------------------------------------------------------------
@@ -63,6 +67,7 @@ namespace ChilliSource
                 Core::ImageFormat m_format;
                 Core::ImageCompression m_compression;
                 u32 m_dataSize;
+                u32 m_numMipLevels = 1;
             };
 			//--------------------------------------------------------------
             /// The filter mode for determining how to sample texels based
@@ -112,6 +117,75 @@ namespace ChilliSource
             /// and RGB565 textures.
             //--------------------------------------------------------------
             virtual void Build(const Descriptor& in_desc, TextureDataUPtr in_data, bool in_mipMap, bool in_restoreTextureDataEnabled) = 0;
+            //--------------------------------------------------------------
+            /// Allocates storage for the texture described by the given
+            /// descriptor without supplying any image data. The data should
+            /// then be supplied in bands of rows using UploadRows(), after
+            /// which CompleteUpload() must be called. This allows the upload
+            /// of large textures to be spread over a number of frames. Only
+            /// uncompressed textures can be built this way.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param Texture descriptor
+            /// @param Whether the texture should have mip maps generated
+            /// once the upload is complete.
+            /// @param Whether or not to restore the texture data after a
+            /// context loss. This has the same restrictions as Build().
+            //--------------------------------------------------------------
+            virtual void BuildEmpty(const Descriptor& in_desc, bool in_mipMap, bool in_restoreTextureDataEnabled) = 0;
+            //--------------------------------------------------------------
+            /// Uploads a band of rows to a texture that was created using
+            /// BuildEmpty(). The data must be in the format given in the
+            /// descriptor and tightly packed.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The index of the first row.
+            /// @param The number of rows.
+            /// @param The row data.
+            //--------------------------------------------------------------
+            virtual void UploadRows(u32 in_firstRow, u32 in_numRows, const u8* in_data) = 0;
+            //--------------------------------------------------------------
+            /// Uploads a single mip level below the base level to a texture
+            /// that was created using BuildEmpty() with a descriptor
+            /// containing a mip chain. The data must be in the format given
+            /// in the descriptor and tightly packed.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The mip level.
+            /// @param The level data.
+            //--------------------------------------------------------------
+            virtual void UploadMipLevel(u32 in_level, const u8* in_data) = 0;
+            //--------------------------------------------------------------
+            /// Uploads a rectangular region of the base level to a texture
+            /// that was created using BuildEmpty(). The data must be in the
+            /// format given in the descriptor and tightly packed. This
+            /// allows a number of small images to be packed into a single
+            /// texture at runtime.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The x position of the left of the region.
+            /// @param The y position of the top of the region.
+            /// @param The width of the region.
+            /// @param The height of the region.
+            /// @param The region data.
+            //--------------------------------------------------------------
+            virtual void UploadRegion(u32 in_x, u32 in_y, u32 in_width, u32 in_height, const u8* in_data) = 0;
+            //--------------------------------------------------------------
+            /// Completes a texture built using BuildEmpty() and UploadRows(),
+            /// generating mip maps if they were requested and not supplied.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The complete texture data that was uploaded, which
+            /// may be kept to restore the texture after a context loss.
+            /// This may be null, in which case the data is read back from
+            /// the texture if it needs to be restored.
+            //--------------------------------------------------------------
+            virtual void CompleteUpload(TextureDataUPtr in_data) = 0;
 			//--------------------------------------------------------------
             /// Binds this texture to the given texture unit allowing it to
             /// be accessed by the shaders and operations to be performed on it
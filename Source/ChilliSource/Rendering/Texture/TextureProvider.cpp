@@ -31,6 +31,9 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Image/Image.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
+#include <ChilliSource/Rendering/Base/UploadScheduler.h>
+#include <ChilliSource/Rendering/Texture/DynamicTextureAtlas.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureResourceOptions.h>
 
@@ -58,6 +61,11 @@ namespace ChilliSource
         //----------------------------------------------------------------------------
         void TextureProvider::PostCreate()
         {
+            m_uploadScheduler = Core::Application::Get()->GetSystem<UploadScheduler>();
+            CS_ASSERT(m_uploadScheduler != nullptr, "Texture provider is missing required system: Upload Scheduler.");
+            
+            m_dynamicAtlas = Core::Application::Get()->GetSystem<DynamicTextureAtlas>();
+            
             auto resourceProviders = Core::Application::Get()->GetSystems<Core::ResourceProvider>();
             
             for(u32 i=0; i<resourceProviders.size(); ++i)
@@ -111,6 +119,7 @@ namespace ChilliSource
         //----------------------------------------------------------------------------
 		void TextureProvider::LoadTexture(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
         {
+            CS_PROFILE_SCOPE("TextureProvider::LoadTexture");
             CS_ASSERT(in_options != nullptr, "Options for texture load cannot be null");
             
             std::string fileName;
@@ -153,43 +162,79 @@ namespace ChilliSource
                 return;
             }
             
+            const TextureResourceOptions* options = (const TextureResourceOptions*)in_options.get();
+            
+            Texture::Descriptor desc;
+            desc.m_width = image->GetWidth();
+            desc.m_height = image->GetHeight();
+            desc.m_format = image->GetFormat();
+            desc.m_compression = image->GetCompression();
+            desc.m_dataSize = image->GetDataSize();
+            desc.m_numMipLevels = image->GetNumMipLevels();
+            
+            //Small UI textures are also copied into the dynamic atlas so they can be batched together.
+            std::shared_ptr<const std::vector<u8>> atlasData;
+            if(m_dynamicAtlas != nullptr && m_dynamicAtlas->CanAdd(desc, options->IsMipMapsEnabled(), options->GetFilterMode(), options->GetWrapModeS(), options->GetWrapModeT()) == true)
+            {
+                atlasData = std::make_shared<const std::vector<u8>>(image->GetData(), image->GetData() + image->GetDataSize());
+            }
+            
             if(in_delegate == nullptr)
             {
                 Texture* texture = (Texture*)out_resource.get();
-                const TextureResourceOptions* options = (const TextureResourceOptions*)in_options.get();
-                
-                Texture::Descriptor desc;
-                desc.m_width = image->GetWidth();
-                desc.m_height = image->GetHeight();
-                desc.m_format = image->GetFormat();
-                desc.m_compression = image->GetCompression();
-                desc.m_dataSize = image->GetDataSize();
 
                 texture->Build(desc, Texture::TextureDataUPtr(image->MoveData()), options->IsMipMapsEnabled(), options->IsRestoreTextureDataEnabled());
                 texture->SetWrapMode(options->GetWrapModeS(), options->GetWrapModeT());
                 texture->SetFilterMode(options->GetFilterMode());
                 out_resource->SetLoadState(Core::Resource::LoadState::k_loaded);
+                
+                if(atlasData != nullptr)
+                {
+                    AddToDynamicAtlas(std::static_pointer_cast<const Texture>(out_resource), desc, atlasData);
+                }
             }
             else
             {
-                auto task([image, in_options, in_delegate, out_resource]()
+                //The upload is spread over a number of frames by the upload scheduler so that loading
+                //many textures at once doesn't stall the main thread.
+                auto completionTask([this, in_options, in_delegate, out_resource, desc, atlasData]()
                 {
                     Texture* texture = (Texture*)out_resource.get();
                     const TextureResourceOptions* options = (const TextureResourceOptions*)in_options.get();
                     
-                    Texture::Descriptor desc;
-                    desc.m_width = image->GetWidth();
-                    desc.m_height = image->GetHeight();
-                    desc.m_format = image->GetFormat();
-                    desc.m_compression = image->GetCompression();
-                    desc.m_dataSize = image->GetDataSize();
-                    
-                    texture->Build(desc, Texture::TextureDataUPtr(image->MoveData()), options->IsMipMapsEnabled(), options->IsRestoreTextureDataEnabled());
                     texture->SetWrapMode(options->GetWrapModeS(), options->GetWrapModeT());
                     texture->SetFilterMode(options->GetFilterMode());
+                    
+                    if(atlasData != nullptr)
+                    {
+                        AddToDynamicAtlas(std::static_pointer_cast<const Texture>(out_resource), desc, atlasData);
+                    }
+                    
                     out_resource->SetLoadState(Core::Resource::LoadState::k_loaded);
                     in_delegate(out_resource);
                 });
+                m_uploadScheduler->ScheduleTextureUpload(std::static_pointer_cast<Texture>(out_resource), desc, Texture::TextureDataUPtr(image->MoveData()), options->IsMipMapsEnabled(), options->IsRestoreTextureDataEnabled(), completionTask);
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void TextureProvider::AddToDynamicAtlas(const TextureCSPtr& in_texture, const Texture::Descriptor& in_desc, const std::shared_ptr<const std::vector<u8>>& in_data)
+        {
+            auto task([this, in_texture, in_desc, in_data]()
+            {
+                //The atlas may have been disabled since CanAdd() was checked on the loading thread.
+                if(m_dynamicAtlas->IsEnabled() == true)
+                {
+                    m_dynamicAtlas->Add(in_texture, in_desc, in_data->data());
+                }
+            });
+            
+            if(Core::Application::Get()->GetTaskScheduler()->IsMainThread() == true)
+            {
+                task();
+            }
+            else
+            {
                 Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(task);
             }
         }
@@ -31,6 +31,9 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Resource/ResourceProvider.h>
+#include <ChilliSource/Rendering/Texture/Texture.h>
+
+#include <vector>
 
 namespace ChilliSource
 {
@@ -51,7 +54,7 @@ namespace ChilliSource
             
             //----------------------------------------------------------------------------
             /// Called when the system is initialised. Retrieves the image providers
-            /// to delegate image loading to
+            /// to delegate image loading to and the upload scheduler.
             ///
             /// @author S Downie
             //----------------------------------------------------------------------------
@@ -139,10 +142,24 @@ namespace ChilliSource
 			/// @param [Out] Resource object
 			//----------------------------------------------------------------------------
 			void LoadTexture(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource);
+            //----------------------------------------------------------------------------
+            /// Adds a copy of the given texture data to the dynamic texture atlas. If
+            /// this is not called on the main thread, the data is added on the main
+            /// thread later.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The texture.
+            /// @param The texture descriptor.
+            /// @param The copy of the texture data.
+            //----------------------------------------------------------------------------
+            void AddToDynamicAtlas(const TextureCSPtr& in_texture, const Texture::Descriptor& in_desc, const std::shared_ptr<const std::vector<u8>>& in_data);
             
         private:
             
             std::vector<Core::ResourceProvider*> m_imageProviders;
+            UploadScheduler* m_uploadScheduler = nullptr;
+            DynamicTextureAtlas* m_dynamicAtlas = nullptr;
             static const Core::IResourceOptionsBaseCSPtr s_defaultOptions;
 		};
 	}
@@ -32,9 +32,11 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/UI/Base/Canvas.h>
+#include <ChilliSource/UI/Base/CompiledWidgetFile.h>
 #include <ChilliSource/UI/Base/Component.h>
 #include <ChilliSource/UI/Base/ComponentDesc.h>
 #include <ChilliSource/UI/Base/ComponentFactory.h>
+#include <ChilliSource/UI/Base/PropertyKeys.h>
 #include <ChilliSource/UI/Base/PropertyLink.h>
 #include <ChilliSource/UI/Base/SizePolicy.h>
 #include <ChilliSource/UI/Base/Widget.h>
@@ -43,5 +45,6 @@
 #include <ChilliSource/UI/Base/WidgetTemplate.h>
 #include <ChilliSource/UI/Base/WidgetTemplateProvider.h>
 #include <ChilliSource/UI/Base/WidgetFactory.h>
+#include <ChilliSource/UI/Base/WidgetPool.h>
 
 #endif
\ No newline at end of file
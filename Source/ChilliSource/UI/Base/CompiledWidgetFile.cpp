@@ -0,0 +1,459 @@
+//
+//  CompiledWidgetFile.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/UI/Base/CompiledWidgetFile.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/CSBinaryChunk.h>
+#include <ChilliSource/Core/File/CSBinaryInputStream.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace UI
+    {
+        namespace
+        {
+            const u32 k_fileFormatId = 2;
+            const u32 k_fileFormatVersion = 1;
+            
+            const u32 k_noKey = 0xffffffff;
+            const u32 k_countSize = sizeof(u32);
+            const u32 k_valueEntrySize = 3 * sizeof(u32);
+            const u32 k_listEntrySize = 2 * sizeof(u32);
+            
+            //----------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The chunk data.
+            ///
+            /// @return The number of elements stored at the start of the chunk.
+            //----------------------------------------------------------------------
+            u32 ReadCount(const u8* in_data)
+            {
+                return *reinterpret_cast<const u32*>(in_data);
+            }
+        }
+        
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        bool CompiledWidgetFile::IsCompiledWidgetFile(Core::StorageLocation in_storageLocation, const std::string& in_filePath)
+        {
+            auto fileSystem = Core::Application::Get()->GetFileSystem();
+            
+            auto fileStream = fileSystem->CreateFileStream(in_storageLocation, in_filePath, Core::FileMode::k_readBinary);
+            if (fileStream == nullptr || fileStream->IsBad() == true || fileStream->IsOpen() == false)
+            {
+                return false;
+            }
+            
+            const u32 k_fileIdSize = 4;
+            s8 fileId[k_fileIdSize] = {};
+            fileStream->Read(fileId, k_fileIdSize);
+            
+            return (fileStream->IsBad() == false && fileId[0] == 'C' && fileId[1] == 'S' && fileId[2] == 'C' && fileId[3] == 'S');
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        CompiledWidgetFileUPtr CompiledWidgetFile::Load(Core::StorageLocation in_storageLocation, const std::string& in_filePath)
+        {
+            Core::CSBinaryInputStream stream(in_storageLocation, in_filePath);
+            if (stream.IsValid() == false || stream.GetFileFormatId() != k_fileFormatId || stream.GetFileFormatVersion() != k_fileFormatVersion)
+            {
+                CS_LOG_ERROR("Could not open compiled widget file: " + in_filePath);
+                return nullptr;
+            }
+            
+            Core::CSBinaryChunkUPtr stringChunk = stream.ReadChunk("STRS");
+            Core::CSBinaryChunkUPtr valueChunk = stream.ReadChunk("VALS");
+            Core::CSBinaryChunkUPtr listChunk = stream.ReadChunk("LIST");
+            if (stringChunk == nullptr || valueChunk == nullptr || listChunk == nullptr)
+            {
+                CS_LOG_ERROR("Missing chunk in compiled widget file: " + in_filePath);
+                return nullptr;
+            }
+            
+            //validate the string table. As all offsets must be within the string data and the data must
+            //end in a null terminator, every string is guaranteed to be terminated.
+            const u8* stringData = stringChunk->GetData();
+            if (stringChunk->GetSize() < k_countSize || (stringChunk->GetSize() - k_countSize) / sizeof(u32) < ReadCount(stringData))
+            {
+                CS_LOG_ERROR("Invalid string table in compiled widget file: " + in_filePath);
+                return nullptr;
+            }
+            
+            const u32 numStrings = ReadCount(stringData);
+            const u32* stringOffsets = reinterpret_cast<const u32*>(stringData + k_countSize);
+            const u32 stringsOffset = k_countSize + numStrings * sizeof(u32);
+            const u32 stringsSize = stringChunk->GetSize() - stringsOffset;
+            if ((numStrings > 0 && (stringsSize == 0 || stringData[stringChunk->GetSize() - 1] != '\0')) ||
+                std::any_of(stringOffsets, stringOffsets + numStrings, [=](u32 in_offset) { return in_offset >= stringsSize; }) == true)
+            {
+                CS_LOG_ERROR("Invalid string table in compiled widget file: " + in_filePath);
+                return nullptr;
+            }
+            
+            //validate the value table. The entries of an array or object must always come after it in the
+            //table, ensuring there are no cycles.
+            const u8* valueData = valueChunk->GetData();
+            if (valueChunk->GetSize() < k_countSize || ReadCount(valueData) == 0 || (valueChunk->GetSize() - k_countSize) / k_valueEntrySize != ReadCount(valueData) ||
+                (valueChunk->GetSize() - k_countSize) % k_valueEntrySize != 0)
+            {
+                CS_LOG_ERROR("Invalid value table in compiled widget file: " + in_filePath);
+                return nullptr;
+            }
+            
+            const u8* listData = listChunk->GetData();
+            if (listChunk->GetSize() < k_countSize || (listChunk->GetSize() - k_countSize) / k_listEntrySize != ReadCount(listData) || (listChunk->GetSize() - k_countSize) % k_listEntrySize != 0)
+            {
+                CS_LOG_ERROR("Invalid list table in compiled widget file: " + in_filePath);
+                return nullptr;
+            }
+            
+            const u32 numValues = ReadCount(valueData);
+            const u32 numListEntries = ReadCount(listData);
+            const ValueEntry* values = reinterpret_cast<const ValueEntry*>(valueData + k_countSize);
+            const ListEntry* listEntries = reinterpret_cast<const ListEntry*>(listData + k_countSize);
+            const char* strings = reinterpret_cast<const char*>(stringData + stringsOffset);
+            
+            for (u32 valueIndex = 0; valueIndex < numValues; ++valueIndex)
+            {
+                const ValueEntry& value = values[valueIndex];
+                
+                bool isValid = true;
+                switch (value.m_type)
+                {
+                    case ValueType::k_null:
+                    case ValueType::k_bool:
+                    case ValueType::k_int:
+                    case ValueType::k_uint:
+                    case ValueType::k_real:
+                        break;
+                    case ValueType::k_string:
+                        isValid = (value.m_data0 < numStrings);
+                        break;
+                    case ValueType::k_array:
+                    case ValueType::k_object:
+                    {
+                        if (value.m_data1 > numListEntries || value.m_data0 > numListEntries - value.m_data1)
+                        {
+                            isValid = false;
+                            break;
+                        }
+                        
+                        for (u32 entryIndex = value.m_data0; entryIndex < value.m_data0 + value.m_data1 && isValid == true; ++entryIndex)
+                        {
+                            const ListEntry& entry = listEntries[entryIndex];
+                            isValid = (entry.m_valueIndex > valueIndex && entry.m_valueIndex < numValues);
+                            
+                            if (value.m_type == ValueType::k_array)
+                            {
+                                isValid = isValid && (entry.m_keyIndex == k_noKey);
+                            }
+                            else
+                            {
+                                isValid = isValid && (entry.m_keyIndex < numStrings);
+                                if (isValid == true && entryIndex > value.m_data0)
+                                {
+                                    const char* previousKey = strings + stringOffsets[listEntries[entryIndex - 1].m_keyIndex];
+                                    isValid = (std::strcmp(previousKey, strings + stringOffsets[entry.m_keyIndex]) < 0);
+                                }
+                            }
+                        }
+                        break;
+                    }
+                    default:
+                        isValid = false;
+                        break;
+                }
+                
+                if (isValid == false)
+                {
+                    CS_LOG_ERROR("Invalid value in compiled widget file: " + in_filePath);
+                    return nullptr;
+                }
+            }
+            
+            return CompiledWidgetFileUPtr(new CompiledWidgetFile(stringChunk->ClaimData(), valueChunk->ClaimData(), listChunk->ClaimData()));
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        CompiledWidgetFile::CompiledWidgetFile(std::unique_ptr<u8[]> in_stringData, std::unique_ptr<u8[]> in_valueData, std::unique_ptr<u8[]> in_listData)
+            : m_stringData(std::move(in_stringData)), m_valueData(std::move(in_valueData)), m_listData(std::move(in_listData))
+        {
+            const u32 numStrings = ReadCount(m_stringData.get());
+            m_stringOffsets = reinterpret_cast<const u32*>(m_stringData.get() + k_countSize);
+            m_strings = reinterpret_cast<const char*>(m_stringData.get() + k_countSize + numStrings * sizeof(u32));
+            m_values = reinterpret_cast<const ValueEntry*>(m_valueData.get() + k_countSize);
+            m_listEntries = reinterpret_cast<const ListEntry*>(m_listData.get() + k_countSize);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        CompiledWidgetFile::Value CompiledWidgetFile::GetRoot() const
+        {
+            return Value(this, 0);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        const char* CompiledWidgetFile::GetString(u32 in_index) const
+        {
+            return m_strings + m_stringOffsets[in_index];
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        CompiledWidgetFile::Value::Value(const CompiledWidgetFile* in_file, u32 in_valueIndex)
+            : m_file(in_file), m_valueIndex(in_valueIndex)
+        {
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        bool CompiledWidgetFile::Value::isNull() const
+        {
+            return (m_file == nullptr || m_file->m_values[m_valueIndex].m_type == ValueType::k_null);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        bool CompiledWidgetFile::Value::isString() const
+        {
+            return (m_file != nullptr && m_file->m_values[m_valueIndex].m_type == ValueType::k_string);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        bool CompiledWidgetFile::Value::isArray() const
+        {
+            return (m_file != nullptr && m_file->m_values[m_valueIndex].m_type == ValueType::k_array);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        bool CompiledWidgetFile::Value::isObject() const
+        {
+            return (m_file != nullptr && m_file->m_values[m_valueIndex].m_type == ValueType::k_object);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        bool CompiledWidgetFile::Value::isMember(const char* in_name) const
+        {
+            return ((*this)[in_name].m_file != nullptr);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        std::string CompiledWidgetFile::Value::asString() const
+        {
+            if (m_file == nullptr)
+            {
+                return "";
+            }
+            
+            const ValueEntry& value = m_file->m_values[m_valueIndex];
+            switch (value.m_type)
+            {
+                case ValueType::k_null:
+                    return "";
+                case ValueType::k_bool:
+                    return (value.m_data0 != 0) ? "true" : "false";
+                case ValueType::k_string:
+                    return m_file->GetString(value.m_data0);
+                default:
+                    CS_LOG_FATAL("Compiled widget value cannot be converted to a string.");
+                    return "";
+            }
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        u32 CompiledWidgetFile::Value::size() const
+        {
+            if (isArray() == true || isObject() == true)
+            {
+                return m_file->m_values[m_valueIndex].m_data1;
+            }
+            
+            return 0;
+        }
+        //----------------------------------------------------------------------
+        /// Object entries are sorted by key, so members are found using a binary
+        /// search.
+        //----------------------------------------------------------------------
+        CompiledWidgetFile::Value CompiledWidgetFile::Value::operator[](const char* in_name) const
+        {
+            if (isObject() == false)
+            {
+                return Value();
+            }
+            
+            const ValueEntry& value = m_file->m_values[m_valueIndex];
+            const ListEntry* first = m_file->m_listEntries + value.m_data0;
+            const ListEntry* last = first + value.m_data1;
+            
+            const CompiledWidgetFile* file = m_file;
+            auto it = std::lower_bound(first, last, in_name, [=](const ListEntry& in_entry, const char* in_key)
+            {
+                return (std::strcmp(file->GetString(in_entry.m_keyIndex), in_key) < 0);
+            });
+            
+            if (it != last && std::strcmp(m_file->GetString(it->m_keyIndex), in_name) == 0)
+            {
+                return Value(m_file, it->m_valueIndex);
+            }
+            
+            return Value();
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        CompiledWidgetFile::Value CompiledWidgetFile::Value::operator[](const std::string& in_name) const
+        {
+            return (*this)[in_name.c_str()];
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        CompiledWidgetFile::Value CompiledWidgetFile::Value::operator[](u32 in_index) const
+        {
+            if (isArray() == false || in_index >= size())
+            {
+                return Value();
+            }
+            
+            return Value(m_file, m_file->m_listEntries[m_file->m_values[m_valueIndex].m_data0 + in_index].m_valueIndex);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        CompiledWidgetFile::Value::ConstIterator CompiledWidgetFile::Value::begin() const
+        {
+            if (isArray() == true || isObject() == true)
+            {
+                return ConstIterator(m_file, m_file->m_values[m_valueIndex].m_data0);
+            }
+            
+            return ConstIterator(m_file, 0);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        CompiledWidgetFile::Value::ConstIterator CompiledWidgetFile::Value::end() const
+        {
+            if (isArray() == true || isObject() == true)
+            {
+                const ValueEntry& value = m_file->m_values[m_valueIndex];
+                return ConstIterator(m_file, value.m_data0 + value.m_data1);
+            }
+            
+            return ConstIterator(m_file, 0);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        Json::Value CompiledWidgetFile::Value::ToJson() const
+        {
+            if (m_file == nullptr)
+            {
+                return Json::Value(Json::nullValue);
+            }
+            
+            const ValueEntry& value = m_file->m_values[m_valueIndex];
+            switch (value.m_type)
+            {
+                case ValueType::k_bool:
+                    return Json::Value(value.m_data0 != 0);
+                case ValueType::k_int:
+                    return Json::Value(s32(value.m_data0));
+                case ValueType::k_uint:
+                    return Json::Value(value.m_data0);
+                case ValueType::k_real:
+                {
+                    u64 bits = u64(value.m_data0) | (u64(value.m_data1) << 32);
+                    f64 real;
+                    std::memcpy(&real, &bits, sizeof(real));
+                    return Json::Value(real);
+                }
+                case ValueType::k_string:
+                    return Json::Value(m_file->GetString(value.m_data0));
+                case ValueType::k_array:
+                {
+                    Json::Value output(Json::arrayValue);
+                    for (auto it = begin(); it != end(); ++it)
+                    {
+                        output.append((*it).ToJson());
+                    }
+                    return output;
+                }
+                case ValueType::k_object:
+                {
+                    Json::Value output(Json::objectValue);
+                    for (auto it = begin(); it != end(); ++it)
+                    {
+                        output[it.memberName()] = (*it).ToJson();
+                    }
+                    return output;
+                }
+                default:
+                    return Json::Value(Json::nullValue);
+            }
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        CompiledWidgetFile::Value::ConstIterator::ConstIterator(const CompiledWidgetFile* in_file, u32 in_entryIndex)
+            : m_file(in_file), m_entryIndex(in_entryIndex)
+        {
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        CompiledWidgetFile::Value CompiledWidgetFile::Value::ConstIterator::operator*() const
+        {
+            return Value(m_file, m_file->m_listEntries[m_entryIndex].m_valueIndex);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        CompiledWidgetFile::Value::ConstIterator& CompiledWidgetFile::Value::ConstIterator::operator++()
+        {
+            ++m_entryIndex;
+            return *this;
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        bool CompiledWidgetFile::Value::ConstIterator::operator==(const ConstIterator& in_other) const
+        {
+            return (m_file == in_other.m_file && m_entryIndex == in_other.m_entryIndex);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        bool CompiledWidgetFile::Value::ConstIterator::operator!=(const ConstIterator& in_other) const
+        {
+            return (operator==(in_other) == false);
+        }
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        const char* CompiledWidgetFile::Value::ConstIterator::memberName() const
+        {
+            u32 keyIndex = m_file->m_listEntries[m_entryIndex].m_keyIndex;
+            return (keyIndex != k_noKey) ? m_file->GetString(keyIndex) : "";
+        }
+    }
+}
@@ -0,0 +1,373 @@
+//
+//  CompiledWidgetFile.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_UI_BASE_COMPILEDWIDGETFILE_H_
+#define _CHILLISOURCE_UI_BASE_COMPILEDWIDGETFILE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/StorageLocation.h>
+
+#include <json/forwards.h>
+
+namespace ChilliSource
+{
+    namespace UI
+    {
+        //--------------------------------------------------------------------------
+        /// A widget template (csui) or widget def (csuidef) file which has been
+        /// precompiled from json into a flat binary form using the CSUICompiler
+        /// tool. Compiled files keep the same file extension as the source json,
+        /// so the widget providers detect the format from the file header.
+        ///
+        /// The file is a Chilli Source chunked binary file containing three
+        /// chunks, all values in which are little endian u32s:
+        ///
+        /// * STRS - The string table: the number of strings, followed by the
+        ///   offset of each string from the start of the string data, followed
+        ///   by the null terminated string data.
+        /// * VALS - The value table: the number of values, followed by a type,
+        ///   and two data fields for each value. The root value is always the
+        ///   first value. Strings store a string index, booleans and integers
+        ///   store the value in the first field, reals store the low and high
+        ///   words of a f64, and arrays and objects store the index of their
+        ///   first entry in the list table and the number of entries.
+        /// * LIST - The list table: the number of entries followed by a key
+        ///   string index and value index for each entry. Array entries have no
+        ///   key. Object entries are sorted by key.
+        ///
+        /// As the data is offset based it can be navigated in place without any
+        /// parsing. Values are exposed through the Value class, which mirrors
+        /// the subset of the Json::Value interface used by the widget parsers so
+        /// that they can be shared between the two formats.
+        ///
+        /// @author Ian Copland
+        //--------------------------------------------------------------------------
+        class CompiledWidgetFile final
+        {
+        public:
+            CS_DECLARE_NOCOPY(CompiledWidgetFile);
+            //----------------------------------------------------------------------
+            /// A read only view of a single value in a compiled widget file. This
+            /// is a lightweight handle which can be freely copied, but is only
+            /// valid for the life of the file it came from. A default constructed
+            /// value is null.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------
+            class Value final
+            {
+            public:
+                //------------------------------------------------------------------
+                /// An iterator over the entries in an object or array value.
+                ///
+                /// @author Ian Copland
+                //------------------------------------------------------------------
+                class ConstIterator final
+                {
+                public:
+                    //--------------------------------------------------------------
+                    /// @author Ian Copland
+                    ///
+                    /// @return The value of the current entry.
+                    //--------------------------------------------------------------
+                    Value operator*() const;
+                    //--------------------------------------------------------------
+                    /// Moves to the next entry.
+                    ///
+                    /// @author Ian Copland
+                    ///
+                    /// @return A reference to this.
+                    //--------------------------------------------------------------
+                    ConstIterator& operator++();
+                    //--------------------------------------------------------------
+                    /// @author Ian Copland
+                    ///
+                    /// @param The other iterator.
+                    ///
+                    /// @return Whether or not the iterators point at the same entry.
+                    //--------------------------------------------------------------
+                    bool operator==(const ConstIterator& in_other) const;
+                    //--------------------------------------------------------------
+                    /// @author Ian Copland
+                    ///
+                    /// @param The other iterator.
+                    ///
+                    /// @return Whether or not the iterators point at different
+                    /// entries.
+                    //--------------------------------------------------------------
+                    bool operator!=(const ConstIterator& in_other) const;
+                    //--------------------------------------------------------------
+                    /// @author Ian Copland
+                    ///
+                    /// @return The key of the current entry if iterating over an
+                    /// object, otherwise an empty string.
+                    //--------------------------------------------------------------
+                    const char* memberName() const;
+                    
+                private:
+                    friend class Value;
+                    //--------------------------------------------------------------
+                    /// Constructor.
+                    ///
+                    /// @author Ian Copland
+                    ///
+                    /// @param The file.
+                    /// @param The index of the entry in the list table.
+                    //--------------------------------------------------------------
+                    ConstIterator(const CompiledWidgetFile* in_file, u32 in_entryIndex);
+                    
+                    const CompiledWidgetFile* m_file;
+                    u32 m_entryIndex;
+                };
+                //------------------------------------------------------------------
+                /// Constructor. Creates a null value.
+                ///
+                /// @author Ian Copland
+                //------------------------------------------------------------------
+                Value() = default;
+                //------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @return Whether or not the value is null. Looking up a member
+                /// which doesn't exist returns a null value.
+                //------------------------------------------------------------------
+                bool isNull() const;
+                //------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @return Whether or not the value is a string.
+                //------------------------------------------------------------------
+                bool isString() const;
+                //------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @return Whether or not the value is an array.
+                //------------------------------------------------------------------
+                bool isArray() const;
+                //------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @return Whether or not the value is an object.
+                //------------------------------------------------------------------
+                bool isObject() const;
+                //------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The member name.
+                ///
+                /// @return Whether or not this is an object containing a member
+                /// with the given name.
+                //------------------------------------------------------------------
+                bool isMember(const char* in_name) const;
+                //------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @return The value as a string. Null values return an empty
+                /// string and booleans return "true" or "false". Any other type
+                /// of value is considered an error.
+                //------------------------------------------------------------------
+                std::string asString() const;
+                //------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @return The number of entries in an array or object value, or
+                /// zero for any other type.
+                //------------------------------------------------------------------
+                u32 size() const;
+                //------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The member name.
+                ///
+                /// @return The member with the given name, or a null value if
+                /// this is not an object or the member doesn't exist.
+                //------------------------------------------------------------------
+                Value operator[](const char* in_name) const;
+                //------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The member name.
+                ///
+                /// @return The member with the given name, or a null value if
+                /// this is not an object or the member doesn't exist.
+                //------------------------------------------------------------------
+                Value operator[](const std::string& in_name) const;
+                //------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The index of an array element.
+                ///
+                /// @return The element at the given index, or a null value if
+                /// this is not an array or the index is out of bounds.
+                //------------------------------------------------------------------
+                Value operator[](u32 in_index) const;
+                //------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @return An iterator pointing at the first entry in an array or
+                /// object.
+                //------------------------------------------------------------------
+                ConstIterator begin() const;
+                //------------------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @return An iterator pointing past the last entry in an array or
+                /// object.
+                //------------------------------------------------------------------
+                ConstIterator end() const;
+                //------------------------------------------------------------------
+                /// Builds a json value with the same contents as this value. This is
+                /// used for those parts of a widget, such as drawable and layout
+                /// defs, which can only be created from json. No text parsing is
+                /// performed.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @return The json value.
+                //------------------------------------------------------------------
+                Json::Value ToJson() const;
+                
+            private:
+                friend class CompiledWidgetFile;
+                //------------------------------------------------------------------
+                /// Constructor.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The file.
+                /// @param The index of the value in the value table.
+                //------------------------------------------------------------------
+                Value(const CompiledWidgetFile* in_file, u32 in_valueIndex);
+                
+                const CompiledWidgetFile* m_file = nullptr;
+                u32 m_valueIndex = 0;
+            };
+            //----------------------------------------------------------------------
+            /// Checks the header of the given file to determine whether or not it
+            /// is a compiled widget file rather than json.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The storage location.
+            /// @param The file path.
+            ///
+            /// @return Whether or not the file is a compiled widget file.
+            //----------------------------------------------------------------------
+            static bool IsCompiledWidgetFile(Core::StorageLocation in_storageLocation, const std::string& in_filePath);
+            //----------------------------------------------------------------------
+            /// Loads a compiled widget file. The contents of the file are validated
+            /// so that values can later be accessed without bounds checks.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The storage location.
+            /// @param The file path.
+            ///
+            /// @return The loaded file, or null if it couldn't be loaded.
+            //----------------------------------------------------------------------
+            static CompiledWidgetFileUPtr Load(Core::StorageLocation in_storageLocation, const std::string& in_filePath);
+            //----------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The root value of the file.
+            //----------------------------------------------------------------------
+            Value GetRoot() const;
+            
+        private:
+            //----------------------------------------------------------------------
+            /// The types of value which can be stored in the value table. These
+            /// must match those written by the compiler.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------
+            enum class ValueType : u32
+            {
+                k_null,
+                k_bool,
+                k_int,
+                k_uint,
+                k_real,
+                k_string,
+                k_array,
+                k_object
+            };
+            //----------------------------------------------------------------------
+            /// A single entry in the value table.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------
+            struct ValueEntry
+            {
+                ValueType m_type;
+                u32 m_data0;
+                u32 m_data1;
+            };
+            //----------------------------------------------------------------------
+            /// A single entry in the list table.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------
+            struct ListEntry
+            {
+                u32 m_keyIndex;
+                u32 m_valueIndex;
+            };
+            //----------------------------------------------------------------------
+            /// Constructor. Takes ownership of the chunk data, which must already
+            /// have been validated.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The STRS chunk data.
+            /// @param The VALS chunk data.
+            /// @param The LIST chunk data.
+            //----------------------------------------------------------------------
+            CompiledWidgetFile(std::unique_ptr<u8[]> in_stringData, std::unique_ptr<u8[]> in_valueData, std::unique_ptr<u8[]> in_listData);
+            //----------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The string index.
+            ///
+            /// @return The string with the given index.
+            //----------------------------------------------------------------------
+            const char* GetString(u32 in_index) const;
+            
+            std::unique_ptr<u8[]> m_stringData;
+            std::unique_ptr<u8[]> m_valueData;
+            std::unique_ptr<u8[]> m_listData;
+            
+            const u32* m_stringOffsets = nullptr;
+            const char* m_strings = nullptr;
+            const ValueEntry* m_values = nullptr;
+            const ListEntry* m_listEntries = nullptr;
+        };
+    }
+}
+
+#endif
@@ -56,17 +56,14 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
-        bool Component::HasProperty(const std::string& in_propertyName) const
+        bool Component::HasProperty(const Core::PropertyKey& in_propertyName) const
         {
-            std::string lowerPropertyName = in_propertyName;
-            Core::StringUtils::ToLowerCase(lowerPropertyName);
-            
-            auto it = m_properties.find(lowerPropertyName);
+            auto it = m_properties.find(in_propertyName);
             return (it != m_properties.end());
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
-        void Component::SetProperty(const std::string& in_propertyName, const char* in_propertyValue)
+        void Component::SetProperty(const Core::PropertyKey& in_propertyName, const char* in_propertyValue)
         {
             SetProperty(in_propertyName, std::string(in_propertyValue));
         }
@@ -90,7 +87,7 @@ namespace ChilliSource
             
             m_propertyRegistrationComplete = true;
             
-            for (const auto& key : in_properties.GetKeys())
+            for (const auto& key : in_properties.GetInternedKeys())
             {
                 if (in_properties.HasValue(key) == true)
                 {
@@ -109,20 +106,32 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
-        void Component::SetProperty(const std::string& in_propertyName, const Core::IProperty* in_property)
+        void Component::SetProperty(const Core::PropertyKey& in_propertyName, const Core::IProperty* in_property)
         {
             CS_ASSERT(m_propertyRegistrationComplete == true, "Cannot set a property on a UI::Component prior to property registration completion.");
             
-            std::string lowerPropertyName = in_propertyName;
-            Core::StringUtils::ToLowerCase(lowerPropertyName);
-            
-            auto it = m_properties.find(lowerPropertyName);
+            auto it = m_properties.find(in_propertyName);
             if(it == m_properties.end())
             {
-                CS_LOG_FATAL("Cannot find property with name '" + in_propertyName + "' in UI::Component.");
+                CS_LOG_FATAL("Cannot find property with name '" + in_propertyName.GetName() + "' in UI::Component.");
             }
             
             it->second->Set(in_property);
         }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Component::CopyPropertyValues(const Component* in_prototype)
+        {
+            CS_ASSERT(in_prototype != nullptr, "Cannot copy property values from a null component.");
+            CS_ASSERT(m_properties.size() == in_prototype->m_properties.size(), "Cannot copy property values from a component of a different type.");
+            
+            for (auto& property : m_properties)
+            {
+                auto it = in_prototype->m_properties.find(property.first);
+                CS_ASSERT(it != in_prototype->m_properties.end(), "Cannot copy property values from a component of a different type.");
+                
+                property.second->Set(it->second.get());
+            }
+        }
     }
 }
\ No newline at end of file
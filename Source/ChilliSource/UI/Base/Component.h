@@ -32,6 +32,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/QueryableInterface.h>
 #include <ChilliSource/Core/Container/Property/Property.h>
+#include <ChilliSource/Core/Container/Property/PropertyKey.h>
 #include <ChilliSource/Core/Container/Property/PropertyType.h>
 
 #include <type_traits>
@@ -83,12 +84,14 @@ namespace ChilliSource
             ///
             /// @return Whether or not the property exists.
             //----------------------------------------------------------------
-            bool HasProperty(const std::string& in_propertyName) const;
+            bool HasProperty(const Core::PropertyKey& in_propertyName) const;
             //----------------------------------------------------------------
             /// Allows querying for the value of properties in the component
             /// using a string name. If there is no property with the given
             /// name or it is not of the requested type the app is considered
-            /// to be in an irrecoverable state and will terminate.
+            /// to be in an irrecoverable state and will terminate. Properties
+            /// which are accessed regularly should be accessed using a
+            /// retained PropertyKey to avoid interning the name each time.
             ///
             /// @author Ian Copland
             ///
@@ -96,19 +99,21 @@ namespace ChilliSource
             ///
             /// @return The value of the requested property.
             //----------------------------------------------------------------
-            template <typename TPropertyType> TPropertyType GetProperty(const std::string& in_propertyName) const;
+            template <typename TPropertyType> TPropertyType GetProperty(const Core::PropertyKey& in_propertyName) const;
             //----------------------------------------------------------------
             /// Allows setting of properties in the component using a string
             /// name. If there is no property with the given name or it is not
             /// of the requested type the app is considered to be in an
-            /// irrecoverable state and will terminate.
+            /// irrecoverable state and will terminate. Properties which are
+            /// set regularly should be accessed using a retained PropertyKey
+            /// to avoid interning the name each time.
             ///
             /// @author Ian Copland
             ///
             /// @param The name of the property. This is case insensitive.
             /// @param The value of the property.
             //----------------------------------------------------------------
-            template <typename TPropertyType> void SetProperty(const std::string& in_propertyName, TPropertyType&& in_propertyValue);
+            template <typename TPropertyType> void SetProperty(const Core::PropertyKey& in_propertyName, TPropertyType&& in_propertyValue);
             //----------------------------------------------------------------
             /// Allows setting of properties in the component using a string
             /// name. If there is no property with the given name or it is not
@@ -123,7 +128,7 @@ namespace ChilliSource
             /// @param The name of the property. This is case insensitive.
             /// @param The value of the property.
             //----------------------------------------------------------------
-            void SetProperty(const std::string& in_propertyName, const char* in_propertyValue);
+            void SetProperty(const Core::PropertyKey& in_propertyName, const char* in_propertyValue);
             //----------------------------------------------------------------
             /// Destructor
             ///
@@ -158,7 +163,7 @@ namespace ChilliSource
             /// @param The getter delegate for the property.
             /// @param The setter delegate for the property.
             //----------------------------------------------------------------
-            template <typename TPropertyType> void RegisterProperty(const Core::PropertyType<TPropertyType>* in_propertyType, const std::string& in_name, std::function<TPropertyType()>&& in_getter, std::function<void(TPropertyType)>&& in_setter);
+            template <typename TPropertyType> void RegisterProperty(const Core::PropertyType<TPropertyType>* in_propertyType, const Core::PropertyKey& in_name, std::function<TPropertyType()>&& in_getter, std::function<void(TPropertyType)>&& in_setter);
             //----------------------------------------------------------------
             /// Finalises any registered properties and applies the default
             /// values for them as supplied by the given property map.
@@ -283,61 +288,62 @@ namespace ChilliSource
             /// @param The property name.
             /// @param The property used to set the value.
             //----------------------------------------------------------------
-            void SetProperty(const std::string& in_propertyName, const Core::IProperty* in_property);
+            void SetProperty(const Core::PropertyKey& in_propertyName, const Core::IProperty* in_property);
+            //----------------------------------------------------------------
+            /// Sets the value of every registered property to that of the
+            /// same property in the given component, which must be of the
+            /// same type as this.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The component to copy property values from.
+            //----------------------------------------------------------------
+            void CopyPropertyValues(const Component* in_prototype);
 
             bool m_propertyRegistrationComplete = false;
-            std::unordered_map<std::string, Core::IPropertyUPtr> m_properties;
+            std::unordered_map<Core::PropertyKey, Core::IPropertyUPtr, Core::PropertyKey::Hash> m_properties;
             Widget* m_widget = nullptr;
             std::string m_name;
         };
         //----------------------------------------------------------------
         //----------------------------------------------------------------
-        template <typename TPropertyType> TPropertyType Component::GetProperty(const std::string& in_propertyName) const
+        template <typename TPropertyType> TPropertyType Component::GetProperty(const Core::PropertyKey& in_propertyName) const
         {
             CS_ASSERT(m_propertyRegistrationComplete == true, "Cannot get a property on a UI::Component prior to property registration completion.");
             
-            std::string lowerPropertyName = in_propertyName;
-            Core::StringUtils::ToLowerCase(lowerPropertyName);
-            
-            auto it = m_properties.find(lowerPropertyName);
+            auto it = m_properties.find(in_propertyName);
             if(it == m_properties.end())
             {
-                CS_LOG_FATAL("Cannot find property with name '" + in_propertyName + "' in UI::Component.");
+                CS_LOG_FATAL("Cannot find property with name '" + in_propertyName.GetName() + "' in UI::Component.");
             }
             
-            auto accessor = CS_SMARTCAST(const Core::Property<typename std::decay<TPropertyType>::type>*, it->second.get(), "Incorrect type for property with name: " + in_propertyName);
+            auto accessor = CS_SMARTCAST(const Core::Property<typename std::decay<TPropertyType>::type>*, it->second.get(), "Incorrect type for property with name: " + in_propertyName.GetName());
             return accessor->Get();
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
-        template <typename TPropertyType> void Component::SetProperty(const std::string& in_propertyName, TPropertyType&& in_propertyValue)
+        template <typename TPropertyType> void Component::SetProperty(const Core::PropertyKey& in_propertyName, TPropertyType&& in_propertyValue)
         {
             CS_ASSERT(m_propertyRegistrationComplete == true, "Cannot set a property on a UI::Component prior to property registration completion.");
             
-            std::string lowerPropertyName = in_propertyName;
-            Core::StringUtils::ToLowerCase(lowerPropertyName);
-            
-            auto it = m_properties.find(lowerPropertyName);
+            auto it = m_properties.find(in_propertyName);
             if(it == m_properties.end())
             {
-                CS_LOG_FATAL("Cannot find property with name '" + in_propertyName + "' in UI::Component.");
+                CS_LOG_FATAL("Cannot find property with name '" + in_propertyName.GetName() + "' in UI::Component.");
             }
             
-            auto accessor = CS_SMARTCAST(Core::Property<typename std::decay<TPropertyType>::type>*, it->second.get(), "Incorrect type for property with name: " + in_propertyName);
+            auto accessor = CS_SMARTCAST(Core::Property<typename std::decay<TPropertyType>::type>*, it->second.get(), "Incorrect type for property with name: " + in_propertyName.GetName());
             accessor->Set(std::forward<TPropertyType>(in_propertyValue));
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
-        template <typename TPropertyType> void Component::RegisterProperty(const Core::PropertyType<TPropertyType>* in_propertyType, const std::string& in_name, std::function<TPropertyType()>&& in_getter, std::function<void(TPropertyType)>&& in_setter)
+        template <typename TPropertyType> void Component::RegisterProperty(const Core::PropertyType<TPropertyType>* in_propertyType, const Core::PropertyKey& in_name, std::function<TPropertyType()>&& in_getter, std::function<void(TPropertyType)>&& in_setter)
         {
             CS_ASSERT(m_propertyRegistrationComplete == false, "UI::Component properties cannot be registered after property registration completion.");
             
-            std::string lowerPropertyName = in_name;
-            Core::StringUtils::ToLowerCase(lowerPropertyName);
-            
-            CS_ASSERT(m_properties.find(lowerPropertyName) == m_properties.end(), "Cannot register duplicate property name '" + in_name + "' in a UI::Component.");
+            CS_ASSERT(m_properties.find(in_name) == m_properties.end(), "Cannot register duplicate property name '" + in_name.GetName() + "' in a UI::Component.");
             
-            m_properties.emplace(lowerPropertyName, in_propertyType->CreateProperty(std::forward<std::function<TPropertyType()>>(in_getter), std::forward<std::function<void(TPropertyType)>>(in_setter)));
+            m_properties.emplace(in_name, in_propertyType->CreateProperty(std::forward<std::function<TPropertyType()>>(in_getter), std::forward<std::function<void(TPropertyType)>>(in_setter)));
         }
     }
 }
@@ -32,6 +32,7 @@
 #include <ChilliSource/UI/Button/ToggleHighlightComponent.h>
 #include <ChilliSource/UI/Drawable/DrawableComponent.h>
 #include <ChilliSource/UI/Layout/LayoutComponent.h>
+#include <ChilliSource/UI/List/VirtualListComponent.h>
 #include <ChilliSource/UI/ProgressBar/ProgressBarComponent.h>
 #include <ChilliSource/UI/Slider/SliderComponent.h>
 #include <ChilliSource/UI/Text/TextComponent.h>
@@ -82,6 +83,7 @@ namespace ChilliSource
             Register<TextComponent>("Text");
             Register<ProgressBarComponent>("ProgressBar");
             Register<SliderComponent>("Slider");
+            Register<VirtualListComponent>("VirtualList");
         }
         //-----------------------------------------------------------------
         //-----------------------------------------------------------------
@@ -0,0 +1,152 @@
+//
+//  PropertyKeys.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/UI/Base/PropertyKeys.h>
+
+namespace ChilliSource
+{
+    namespace UI
+    {
+        namespace PropertyKeys
+        {
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& Name()
+            {
+                static const Core::PropertyKey s_key("name");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& RelPosition()
+            {
+                static const Core::PropertyKey s_key("relposition");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& AbsPosition()
+            {
+                static const Core::PropertyKey s_key("absposition");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& RelSize()
+            {
+                static const Core::PropertyKey s_key("relsize");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& AbsSize()
+            {
+                static const Core::PropertyKey s_key("abssize");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& PreferredSize()
+            {
+                static const Core::PropertyKey s_key("preferredsize");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& Scale()
+            {
+                static const Core::PropertyKey s_key("scale");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& Colour()
+            {
+                static const Core::PropertyKey s_key("colour");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& Rotation()
+            {
+                static const Core::PropertyKey s_key("rotation");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& OriginAnchor()
+            {
+                static const Core::PropertyKey s_key("originanchor");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& ParentalAnchor()
+            {
+                static const Core::PropertyKey s_key("parentalanchor");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& Visible()
+            {
+                static const Core::PropertyKey s_key("visible");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& ClipChildren()
+            {
+                static const Core::PropertyKey s_key("clipchildren");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& InputEnabled()
+            {
+                static const Core::PropertyKey s_key("inputenabled");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& InputConsumeEnabled()
+            {
+                static const Core::PropertyKey s_key("inputconsumeenabled");
+                return s_key;
+            }
+            //------------------------------------------------------------------------
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& SizePolicy()
+            {
+                static const Core::PropertyKey s_key("sizepolicy");
+                return s_key;
+            }
+        }
+    }
+}
@@ -0,0 +1,151 @@
+//
+//  PropertyKeys.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_UI_BASE_PROPERTYKEYS_H_
+#define _CHILLISOURCE_UI_BASE_PROPERTYKEYS_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/Property/PropertyKey.h>
+
+namespace ChilliSource
+{
+    namespace UI
+    {
+        //------------------------------------------------------------------------
+        /// Pre-interned keys for the properties which are built into every
+        /// widget. These allow the built-in properties to be accessed through
+        /// Widget::SetProperty() and Widget::GetProperty() without interning the
+        /// property name on each call. Keys are created on first use so they can
+        /// safely be used during static initialisation.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------
+        namespace PropertyKeys
+        {
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the name property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& Name();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the relative position property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& RelPosition();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the absolute position property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& AbsPosition();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the relative size property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& RelSize();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the absolute size property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& AbsSize();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the preferred size property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& PreferredSize();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the scale property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& Scale();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the colour property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& Colour();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the rotation property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& Rotation();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the origin anchor property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& OriginAnchor();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the parental anchor property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& ParentalAnchor();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the visible property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& Visible();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the clip children property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& ClipChildren();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the input enabled property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& InputEnabled();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the input consume enabled property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& InputConsumeEnabled();
+            //------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The key for the size policy property.
+            //------------------------------------------------------------------------
+            const Core::PropertyKey& SizePolicy();
+        }
+    }
+}
+
+#endif
@@ -48,41 +48,24 @@ namespace ChilliSource
     {
         namespace
         {
-            const char k_properyNameName[] = "name";
-            const char k_properyNameRelPosition[] = "relposition";
-            const char k_properyNameAbsPosition[] = "absposition";
-            const char k_properyNameRelSize[] = "relsize";
-            const char k_properyNameAbsSize[] = "abssize";
-            const char k_properyNamePreferredSize[] = "preferredsize";
-            const char k_properyNameScale[] = "scale";
-            const char k_properyNameColour[] = "colour";
-            const char k_properyNameRotation[] = "rotation";
-            const char k_properyNameOriginAnchor[] = "originanchor";
-            const char k_properyNameParentalAnchor[] = "parentalanchor";
-            const char k_properyNameVisible[] = "visible";
-            const char k_properyNameClipChildren[] = "clipchildren";
-            const char k_properyNameInputEnabled[] = "inputenabled";
-            const char k_properyNameInputConsumeEnabled[] = "inputconsumeenabled";
-            const char k_properyNameSizePolicy[] = "sizepolicy";
-            
             const std::vector<Core::PropertyMap::PropertyDesc> k_propertyDescs =
             {
-                {Core::PropertyTypes::String(), k_properyNameName},
-                {Core::PropertyTypes::Vector2(), k_properyNameRelPosition},
-                {Core::PropertyTypes::Vector2(), k_properyNameAbsPosition},
-                {Core::PropertyTypes::Vector2(), k_properyNameRelSize},
-                {Core::PropertyTypes::Vector2(), k_properyNameAbsSize},
-                {Core::PropertyTypes::Vector2(), k_properyNamePreferredSize},
-                {Core::PropertyTypes::Vector2(), k_properyNameScale},
-                {Core::PropertyTypes::Colour(), k_properyNameColour},
-                {Core::PropertyTypes::Float(), k_properyNameRotation},
-                {PropertyTypes::AlignmentAnchor(), k_properyNameOriginAnchor},
-                {PropertyTypes::AlignmentAnchor(), k_properyNameParentalAnchor},
-                {Core::PropertyTypes::Bool(), k_properyNameVisible},
-                {Core::PropertyTypes::Bool(), k_properyNameClipChildren},
-                {Core::PropertyTypes::Bool(), k_properyNameInputEnabled},
-                {Core::PropertyTypes::Bool(), k_properyNameInputConsumeEnabled},
-                {PropertyTypes::SizePolicy(), k_properyNameSizePolicy},
+                {Core::PropertyTypes::String(), PropertyKeys::Name().GetName()},
+                {Core::PropertyTypes::Vector2(), PropertyKeys::RelPosition().GetName()},
+                {Core::PropertyTypes::Vector2(), PropertyKeys::AbsPosition().GetName()},
+                {Core::PropertyTypes::Vector2(), PropertyKeys::RelSize().GetName()},
+                {Core::PropertyTypes::Vector2(), PropertyKeys::AbsSize().GetName()},
+                {Core::PropertyTypes::Vector2(), PropertyKeys::PreferredSize().GetName()},
+                {Core::PropertyTypes::Vector2(), PropertyKeys::Scale().GetName()},
+                {Core::PropertyTypes::Colour(), PropertyKeys::Colour().GetName()},
+                {Core::PropertyTypes::Float(), PropertyKeys::Rotation().GetName()},
+                {PropertyTypes::AlignmentAnchor(), PropertyKeys::OriginAnchor().GetName()},
+                {PropertyTypes::AlignmentAnchor(), PropertyKeys::ParentalAnchor().GetName()},
+                {Core::PropertyTypes::Bool(), PropertyKeys::Visible().GetName()},
+                {Core::PropertyTypes::Bool(), PropertyKeys::ClipChildren().GetName()},
+                {Core::PropertyTypes::Bool(), PropertyKeys::InputEnabled().GetName()},
+                {Core::PropertyTypes::Bool(), PropertyKeys::InputConsumeEnabled().GetName()},
+                {PropertyTypes::SizePolicy(), PropertyKeys::SizePolicy().GetName()},
             };
             
             //----------------------------------------------------------------------------------------
@@ -252,22 +235,22 @@ namespace ChilliSource
         //----------------------------------------------------------------------------------------
         void Widget::InitBaseProperties()
         {
-            m_baseProperties.emplace(k_properyNameName, Core::PropertyTypes::String()->CreateProperty(Core::MakeDelegate(this, &Widget::GetName), Core::MakeDelegate(this, &Widget::SetName)));
-            m_baseProperties.emplace(k_properyNameRelPosition, Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalRelativePosition), Core::MakeDelegate(this, &Widget::SetRelativePosition)));
-            m_baseProperties.emplace(k_properyNameAbsPosition, Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalAbsolutePosition), Core::MakeDelegate(this, &Widget::SetAbsolutePosition)));
-            m_baseProperties.emplace(k_properyNameRelSize, Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalRelativeSize), Core::MakeDelegate(this, &Widget::SetRelativeSize)));
-            m_baseProperties.emplace(k_properyNameAbsSize, Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalAbsoluteSize), Core::MakeDelegate(this, &Widget::SetAbsoluteSize)));
-            m_baseProperties.emplace(k_properyNamePreferredSize, Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetPreferredSize), Core::MakeDelegate(this, &Widget::SetDefaultPreferredSize)));
-            m_baseProperties.emplace(k_properyNameScale, Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalScale), Core::MakeDelegate(this, &Widget::ScaleTo)));
-            m_baseProperties.emplace(k_properyNameColour, Core::PropertyTypes::Colour()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalColour), Core::MakeDelegate(this, &Widget::SetColour)));
-            m_baseProperties.emplace(k_properyNameRotation, Core::PropertyTypes::Float()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalRotation), Core::MakeDelegate(this, &Widget::RotateTo)));
-            m_baseProperties.emplace(k_properyNameOriginAnchor, PropertyTypes::AlignmentAnchor()->CreateProperty(Core::MakeDelegate(this, &Widget::GetOriginAnchor), Core::MakeDelegate(this, &Widget::SetOriginAnchor)));
-            m_baseProperties.emplace(k_properyNameParentalAnchor, PropertyTypes::AlignmentAnchor()->CreateProperty(Core::MakeDelegate(this, &Widget::GetParentalAnchor), Core::MakeDelegate(this, &Widget::SetParentalAnchor)));
-            m_baseProperties.emplace(k_properyNameVisible, Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsVisible), Core::MakeDelegate(this, &Widget::SetVisible)));
-            m_baseProperties.emplace(k_properyNameClipChildren, Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsClippingEnabled), Core::MakeDelegate(this, &Widget::SetClippingEnabled)));
-            m_baseProperties.emplace(k_properyNameInputEnabled, Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsInputEnabled), Core::MakeDelegate(this, &Widget::SetInputEnabled)));
-            m_baseProperties.emplace(k_properyNameInputConsumeEnabled, Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsInputConsumeEnabled), Core::MakeDelegate(this, &Widget::SetInputConsumeEnabled)));
-            m_baseProperties.emplace(k_properyNameSizePolicy, PropertyTypes::SizePolicy()->CreateProperty(Core::MakeDelegate(this, &Widget::GetSizePolicy), Core::MakeDelegate(this, &Widget::SetSizePolicy)));
+            m_baseProperties.emplace(PropertyKeys::Name(), Core::PropertyTypes::String()->CreateProperty(Core::MakeDelegate(this, &Widget::GetName), Core::MakeDelegate(this, &Widget::SetName)));
+            m_baseProperties.emplace(PropertyKeys::RelPosition(), Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalRelativePosition), Core::MakeDelegate(this, &Widget::SetRelativePosition)));
+            m_baseProperties.emplace(PropertyKeys::AbsPosition(), Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalAbsolutePosition), Core::MakeDelegate(this, &Widget::SetAbsolutePosition)));
+            m_baseProperties.emplace(PropertyKeys::RelSize(), Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalRelativeSize), Core::MakeDelegate(this, &Widget::SetRelativeSize)));
+            m_baseProperties.emplace(PropertyKeys::AbsSize(), Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalAbsoluteSize), Core::MakeDelegate(this, &Widget::SetAbsoluteSize)));
+            m_baseProperties.emplace(PropertyKeys::PreferredSize(), Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetPreferredSize), Core::MakeDelegate(this, &Widget::SetDefaultPreferredSize)));
+            m_baseProperties.emplace(PropertyKeys::Scale(), Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalScale), Core::MakeDelegate(this, &Widget::ScaleTo)));
+            m_baseProperties.emplace(PropertyKeys::Colour(), Core::PropertyTypes::Colour()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalColour), Core::MakeDelegate(this, &Widget::SetColour)));
+            m_baseProperties.emplace(PropertyKeys::Rotation(), Core::PropertyTypes::Float()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalRotation), Core::MakeDelegate(this, &Widget::RotateTo)));
+            m_baseProperties.emplace(PropertyKeys::OriginAnchor(), PropertyTypes::AlignmentAnchor()->CreateProperty(Core::MakeDelegate(this, &Widget::GetOriginAnchor), Core::MakeDelegate(this, &Widget::SetOriginAnchor)));
+            m_baseProperties.emplace(PropertyKeys::ParentalAnchor(), PropertyTypes::AlignmentAnchor()->CreateProperty(Core::MakeDelegate(this, &Widget::GetParentalAnchor), Core::MakeDelegate(this, &Widget::SetParentalAnchor)));
+            m_baseProperties.emplace(PropertyKeys::Visible(), Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsVisible), Core::MakeDelegate(this, &Widget::SetVisible)));
+            m_baseProperties.emplace(PropertyKeys::ClipChildren(), Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsClippingEnabled), Core::MakeDelegate(this, &Widget::SetClippingEnabled)));
+            m_baseProperties.emplace(PropertyKeys::InputEnabled(), Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsInputEnabled), Core::MakeDelegate(this, &Widget::SetInputEnabled)));
+            m_baseProperties.emplace(PropertyKeys::InputConsumeEnabled(), Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsInputConsumeEnabled), Core::MakeDelegate(this, &Widget::SetInputConsumeEnabled)));
+            m_baseProperties.emplace(PropertyKeys::SizePolicy(), PropertyTypes::SizePolicy()->CreateProperty(Core::MakeDelegate(this, &Widget::GetSizePolicy), Core::MakeDelegate(this, &Widget::SetSizePolicy)));
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -319,42 +302,38 @@ namespace ChilliSource
             //Hook up any links to our components
             for(const auto& link : in_componentPropertyLinks)
             {
-                CS_ASSERT(m_baseProperties.find(link.GetLinkName()) == m_baseProperties.end(), "Cannot add duplicate property: " + link.GetLinkName());
-                CS_ASSERT(m_componentPropertyLinks.find(link.GetLinkName()) == m_componentPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
-                CS_ASSERT(m_childPropertyLinks.find(link.GetLinkName()) == m_childPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
+                Core::PropertyKey linkKey(link.GetLinkName());
+                CS_ASSERT(m_baseProperties.find(linkKey) == m_baseProperties.end(), "Cannot add duplicate property: " + link.GetLinkName());
+                CS_ASSERT(m_componentPropertyLinks.find(linkKey) == m_componentPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
+                CS_ASSERT(m_childPropertyLinks.find(linkKey) == m_childPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
                 
                 Component* component = GetComponentWithName(link.GetLinkedOwner());
                 CS_ASSERT(component != nullptr, "Cannot create property link for property '" + link.GetLinkName() + "' because target component '" + link.GetLinkedOwner() + "' doesn't exist.");
                 CS_ASSERT(component->HasProperty(link.GetLinkName()) == true, "Cannot create property link for property '" + link.GetLinkName() + "' because target component '" +
                           link.GetLinkedOwner() + "' doesn't contain a property called '" + link.GetLinkedProperty() + "'.");
                 
-                std::string lowerLinkName = link.GetLinkName();
-                Core::StringUtils::ToLowerCase(lowerLinkName);
-                
-                m_componentPropertyLinks.emplace(lowerLinkName, std::make_pair(component, link.GetLinkedProperty()));
+                m_componentPropertyLinks.emplace(linkKey, std::make_pair(component, Core::PropertyKey(link.GetLinkedProperty())));
             }
             
             //Hook up any links to our childrens properties
             for(const auto& link : in_childPropertyLinks)
             {
-                CS_ASSERT(m_baseProperties.find(link.GetLinkName()) == m_baseProperties.end(), "Cannot add duplicate property: " + link.GetLinkName());
-                CS_ASSERT(m_componentPropertyLinks.find(link.GetLinkName()) == m_componentPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
-                CS_ASSERT(m_childPropertyLinks.find(link.GetLinkName()) == m_childPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
+                Core::PropertyKey linkKey(link.GetLinkName());
+                CS_ASSERT(m_baseProperties.find(linkKey) == m_baseProperties.end(), "Cannot add duplicate property: " + link.GetLinkName());
+                CS_ASSERT(m_componentPropertyLinks.find(linkKey) == m_componentPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
+                CS_ASSERT(m_childPropertyLinks.find(linkKey) == m_childPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
                 
                 Widget* childWidget = GetInternalWidgetRecursive(link.GetLinkedOwner());
                 CS_ASSERT(childWidget != nullptr, "Cannot create property link for property '" + link.GetLinkName() + "' because target widget '" + link.GetLinkedOwner() + "' doesn't exist.");
                 
-                std::string lowerLinkName = link.GetLinkName();
-                Core::StringUtils::ToLowerCase(lowerLinkName);
-                
-                m_childPropertyLinks.emplace(lowerLinkName, std::make_pair(childWidget, link.GetLinkedProperty()));
+                m_childPropertyLinks.emplace(linkKey, std::make_pair(childWidget, Core::PropertyKey(link.GetLinkedProperty())));
             }
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
         void Widget::InitPropertyValues(const Core::PropertyMap& in_propertyMap)
         {
-            for (const auto& key : in_propertyMap.GetKeys())
+            for (const auto& key : in_propertyMap.GetInternedKeys())
             {
                 if (in_propertyMap.HasValue(key) == true)
                 {
@@ -364,6 +343,85 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
+        bool Widget::HasSameStructure(const Widget* in_widget) const
+        {
+            if (m_components.size() != in_widget->m_components.size() || m_internalChildren.size() != in_widget->m_internalChildren.size() || m_children.size() != in_widget->m_children.size())
+            {
+                return false;
+            }
+            
+            for (u32 i = 0; i < m_components.size(); ++i)
+            {
+                if (m_components[i]->GetName() != in_widget->m_components[i]->GetName())
+                {
+                    return false;
+                }
+            }
+            
+            for (u32 i = 0; i < m_internalChildren.size(); ++i)
+            {
+                if (m_internalChildren[i]->HasSameStructure(in_widget->m_internalChildren[i].get()) == false)
+                {
+                    return false;
+                }
+            }
+            
+            for (u32 i = 0; i < m_children.size(); ++i)
+            {
+                if (m_children[i]->HasSameStructure(in_widget->m_children[i].get()) == false)
+                {
+                    return false;
+                }
+            }
+            
+            return true;
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        void Widget::ResetToPrototype(const Widget* in_prototype)
+        {
+            CS_ASSERT(m_canvas == nullptr, "Cannot reset a widget which is attached to a canvas.");
+            CS_ASSERT(HasSameStructure(in_prototype) == true, "Cannot reset a widget to a prototype with a different structure.");
+            
+            m_name = in_prototype->m_name;
+            m_localPosition = in_prototype->m_localPosition;
+            m_localSize = in_prototype->m_localSize;
+            m_preferredSize = in_prototype->m_preferredSize;
+            m_localScale = in_prototype->m_localScale;
+            m_localColour = in_prototype->m_localColour;
+            m_localRotation = in_prototype->m_localRotation;
+            m_sizePolicy = in_prototype->m_sizePolicy;
+            m_sizePolicyDelegate = in_prototype->m_sizePolicyDelegate;
+            m_parentalAnchor = in_prototype->m_parentalAnchor;
+            m_originAnchor = in_prototype->m_originAnchor;
+            m_originPosition = in_prototype->m_originPosition;
+            m_isVisible = in_prototype->m_isVisible;
+            m_isSubviewClippingEnabled = in_prototype->m_isSubviewClippingEnabled;
+            m_isInputEnabled = in_prototype->m_isInputEnabled;
+            m_isInputConsumeEnabled = in_prototype->m_isInputConsumeEnabled;
+            
+            m_pressedInput.clear();
+            m_containedPointers.clear();
+            
+            InvalidateTransformCache();
+            
+            for (u32 i = 0; i < m_components.size(); ++i)
+            {
+                m_components[i]->CopyPropertyValues(in_prototype->m_components[i].get());
+            }
+            
+            for (u32 i = 0; i < m_internalChildren.size(); ++i)
+            {
+                m_internalChildren[i]->ResetToPrototype(in_prototype->m_internalChildren[i].get());
+            }
+            
+            for (u32 i = 0; i < m_children.size(); ++i)
+            {
+                m_children[i]->ResetToPrototype(in_prototype->m_children[i].get());
+            }
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
         Component* Widget::GetComponentWithName(const std::string& in_name)
         {
             return Core::ConstMethodCast(this, &Widget::GetComponentWithName, in_name);
@@ -1034,7 +1092,7 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        void Widget::SetProperty(const std::string& in_name, const char* in_value)
+        void Widget::SetProperty(const Core::PropertyKey& in_name, const char* in_value)
         {
             SetProperty<std::string>(in_name, in_value);
         }
@@ -1310,33 +1368,30 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        void Widget::SetProperty(const std::string& in_propertyName, const Core::IProperty* in_property)
+        void Widget::SetProperty(const Core::PropertyKey& in_propertyName, const Core::IProperty* in_property)
         {
-            std::string lowerName = in_propertyName;
-            Core::StringUtils::ToLowerCase(lowerName);
-            
-            auto basePropIt = m_baseProperties.find(lowerName);
+            auto basePropIt = m_baseProperties.find(in_propertyName);
             if(basePropIt != m_baseProperties.end())
             {
                 basePropIt->second->Set(in_property);
                 return;
             }
             
-            auto componentPropIt = m_componentPropertyLinks.find(lowerName);
+            auto componentPropIt = m_componentPropertyLinks.find(in_propertyName);
             if(componentPropIt != m_componentPropertyLinks.end())
             {
                 componentPropIt->second.first->SetProperty(componentPropIt->second.second, in_property);
                 return;
             }
             
-            auto childPropIt = m_childPropertyLinks.find(lowerName);
+            auto childPropIt = m_childPropertyLinks.find(in_propertyName);
             if(childPropIt != m_childPropertyLinks.end())
             {
                 childPropIt->second.first->SetProperty(childPropIt->second.second, in_property);
                 return;
             }
             
-            CS_LOG_FATAL("Invalid property name for Widget: " + in_propertyName);
+            CS_LOG_FATAL("Invalid property name for Widget: " + in_propertyName.GetName());
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -42,6 +42,7 @@
 #include <ChilliSource/Input/Pointer/Pointer.h>
 #include <ChilliSource/Rendering/Base/AlignmentAnchors.h>
 #include <ChilliSource/UI/Base/Component.h>
+#include <ChilliSource/UI/Base/PropertyKeys.h>
 #include <ChilliSource/UI/Base/PropertyLink.h>
 #include <ChilliSource/UI/Base/SizePolicy.h>
 
@@ -808,14 +809,17 @@ namespace ChilliSource
             Core::Colour GetFinalColour() const;
             //----------------------------------------------------------------------------------------
             /// Set the value of the property with the given name. If no property exists
-            /// with the name then it will assert.
+            /// with the name then it will assert. Properties which are set regularly, for
+            /// example by an animation, should be accessed using a retained property key
+            /// to avoid interning the name on each call. Keys for the built in properties
+            /// are available in UI::PropertyKeys.
             ///
             /// @author S Downie
             ///
             /// @param Name. This is case insensitive.
             /// @param Value
             //----------------------------------------------------------------------------------------
-            template<typename TType> void SetProperty(const std::string& in_name, TType&& in_value);
+            template<typename TType> void SetProperty(const Core::PropertyKey& in_name, TType&& in_value);
             //----------------------------------------------------------------------------------------
             /// Specialisation to store property value for const char* as a std::string
             ///
@@ -824,10 +828,11 @@ namespace ChilliSource
             /// @param Property name. This is case insensitive.
             /// @param Property value
             //----------------------------------------------------------------------------------------
-            void SetProperty(const std::string& in_name, const char* in_value);
+            void SetProperty(const Core::PropertyKey& in_name, const char* in_value);
             //----------------------------------------------------------------------------------------
             /// Get the value of the property with the given name. If no property exists
-            /// with the name then it will assert.
+            /// with the name then it will assert. Properties which are read regularly
+            /// should be accessed using a retained property key.
             ///
             /// @author S Downie
             ///
@@ -835,7 +840,7 @@ namespace ChilliSource
             ///
             /// @return Value
             //----------------------------------------------------------------------------------------
-            template<typename TType> TType GetProperty(const std::string& in_name) const;
+            template<typename TType> TType GetProperty(const Core::PropertyKey& in_name) const;
             //----------------------------------------------------------------------------------------
             /// Performs a calculation to check if the given position is within the OOBB
             /// of the widget
@@ -875,6 +880,7 @@ namespace ChilliSource
         private:
             friend class Canvas;
             friend class WidgetFactory;
+            friend class WidgetPool;
             //----------------------------------------------------------------------------------------
             /// Constructor that builds the widget from the given definition. The default properties
             /// of a widget are described in the class documentation.
@@ -937,6 +943,27 @@ namespace ChilliSource
             //----------------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
+            /// @param The widget to compare against.
+            ///
+            /// @return Whether or not this widget tree has the same structure as the given tree,
+            /// i.e. the same components, internal children and children at every level.
+            //----------------------------------------------------------------------------------------
+            bool HasSameStructure(const Widget* in_widget) const;
+            //----------------------------------------------------------------------------------------
+            /// Resets this widget tree to the state of the given prototype tree, which must have
+            /// the same structure. The base property storage of each widget is copied directly from
+            /// the prototype and the component properties are copied from the matching prototype
+            /// components. Any in-progress pointer input is discarded. This should only be called
+            /// on widgets which are not attached to a canvas.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The prototype widget tree.
+            //----------------------------------------------------------------------------------------
+            void ResetToPrototype(const Widget* in_prototype);
+            //----------------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
             /// @param The name of the component. There should only be one component with the name.
             ///
             /// @return The component with the given name. This will return nullptr is no component
@@ -1053,7 +1080,7 @@ namespace ChilliSource
             /// @param The property name.
             /// @param The property used to set the value.
             //----------------------------------------------------------------------------------------
-            void SetProperty(const std::string& in_propertyName, const Core::IProperty* in_property);
+            void SetProperty(const Core::PropertyKey& in_propertyName, const Core::IProperty* in_property);
             //------------------------------------------------------------------------------
             /// Checks the given pointer and updates the contained pointer set accordingly.
             /// If the pointer has changed state a pointer entered or exited event will be
@@ -1225,9 +1252,9 @@ namespace ChilliSource
             
         private:
             
-            std::unordered_map<std::string, CSCore::IPropertyUPtr> m_baseProperties;
-            std::unordered_map<std::string, std::pair<Component*, std::string>> m_componentPropertyLinks;
-            std::unordered_map<std::string, std::pair<Widget*, std::string>> m_childPropertyLinks;
+            std::unordered_map<Core::PropertyKey, CSCore::IPropertyUPtr, Core::PropertyKey::Hash> m_baseProperties;
+            std::unordered_map<Core::PropertyKey, std::pair<Component*, Core::PropertyKey>, Core::PropertyKey::Hash> m_componentPropertyLinks;
+            std::unordered_map<Core::PropertyKey, std::pair<Widget*, Core::PropertyKey>, Core::PropertyKey::Hash> m_childPropertyLinks;
             
             std::unordered_map<Input::Pointer::Id, std::set<Input::Pointer::InputType>> m_pressedInput;
             std::unordered_set<Input::Pointer::Id> m_containedPointers;
@@ -1306,62 +1333,56 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        template<typename TType> void Widget::SetProperty(const std::string& in_name, TType&& in_value)
+        template<typename TType> void Widget::SetProperty(const Core::PropertyKey& in_name, TType&& in_value)
         {
-            std::string lowerName = in_name;
-            Core::StringUtils::ToLowerCase(lowerName);
-            
-            auto basePropIt = m_baseProperties.find(lowerName);
+            auto basePropIt = m_baseProperties.find(in_name);
             if(basePropIt != m_baseProperties.end())
             {
-                auto property = CS_SMARTCAST(Core::Property<TType>*, basePropIt->second.get(), "Incorrect type for property with name: " + in_name);
+                auto property = CS_SMARTCAST(Core::Property<TType>*, basePropIt->second.get(), "Incorrect type for property with name: " + in_name.GetName());
                 property->Set(std::forward<TType>(in_value));
                 return;
             }
             
-            auto componentPropIt = m_componentPropertyLinks.find(lowerName);
+            auto componentPropIt = m_componentPropertyLinks.find(in_name);
             if(componentPropIt != m_componentPropertyLinks.end())
             {
                 componentPropIt->second.first->SetProperty<TType>(componentPropIt->second.second, std::forward<TType>(in_value));
                 return;
             }
             
-            auto childPropIt = m_childPropertyLinks.find(lowerName);
+            auto childPropIt = m_childPropertyLinks.find(in_name);
             if(childPropIt != m_childPropertyLinks.end())
             {
                 childPropIt->second.first->SetProperty<TType>(childPropIt->second.second, std::forward<TType>(in_value));
                 return;
             }
             
-            CS_LOG_FATAL("Invalid property name for Widget: " + in_name);
+            CS_LOG_FATAL("Invalid property name for Widget: " + in_name.GetName());
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        template<typename TType> TType Widget::GetProperty(const std::string& in_name) const
+        template<typename TType> TType Widget::GetProperty(const Core::PropertyKey& in_name) const
         {
-            std::string lowerName = in_name;
-            Core::StringUtils::ToLowerCase(lowerName);
-            
-            auto basePropIt = m_baseProperties.find(lowerName);
+            auto basePropIt = m_baseProperties.find(in_name);
             if(basePropIt != m_baseProperties.end())
             {
-                auto property = CS_SMARTCAST(Core::Property<TType>*, basePropIt->second.get(), "Incorrect type for property with name: " + in_name);
+                auto property = CS_SMARTCAST(Core::Property<TType>*, basePropIt->second.get(), "Incorrect type for property with name: " + in_name.GetName());
                 return property->Get();
             }
             
-            auto componentPropIt = m_componentPropertyLinks.find(lowerName);
+            auto componentPropIt = m_componentPropertyLinks.find(in_name);
             if(componentPropIt != m_componentPropertyLinks.end())
             {
                 return componentPropIt->second.first->GetProperty<TType>(componentPropIt->second.second);
             }
             
-            auto childPropIt = m_childPropertyLinks.find(lowerName);
+            auto childPropIt = m_childPropertyLinks.find(in_name);
             if(childPropIt != m_childPropertyLinks.end())
             {
                 return childPropIt->second.first->GetProperty<TType>(childPropIt->second.second);
             }
             
-            CS_LOG_FATAL("Invalid property name for Widget: " + in_name);
+            CS_LOG_FATAL("Invalid property name for Widget: " + in_name.GetName());
             return TType();
         }
     }
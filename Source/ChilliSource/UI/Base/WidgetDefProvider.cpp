@@ -34,6 +34,7 @@
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/UI/Base/CompiledWidgetFile.h>
 #include <ChilliSource/UI/Base/ComponentFactory.h>
 #include <ChilliSource/UI/Base/Widget.h>
 #include <ChilliSource/UI/Base/WidgetDef.h>
@@ -134,15 +135,15 @@ namespace ChilliSource
             ///
             /// @return The output component description.
             //-------------------------------------------------------
-            ComponentDesc ParseComponent(const Json::Value& in_componentJson, Core::StorageLocation in_definitionLocation, const std::string& in_definitionPath, ComponentFactory* in_componentFactory)
+            template <typename TValue> ComponentDesc ParseComponent(const TValue& in_componentJson, Core::StorageLocation in_definitionLocation, const std::string& in_definitionPath, ComponentFactory* in_componentFactory)
             {
                 CS_ASSERT(in_componentJson.isNull() == false, "Cannot parse null component json.");
                 CS_ASSERT(in_componentJson.isObject() == true, "Component json must be an object.");
                 CS_ASSERT(in_componentJson.isMember(k_componentTypeKey) == true, "Component json must contain a '" + std::string(k_componentTypeKey) + "' key.");
                 CS_ASSERT(in_componentJson.isMember(k_componentNameKey) == true, "Component json must contain a '" + std::string(k_componentNameKey) + "' key.");
                 
-                Json::Value typeJson = in_componentJson.get(k_componentTypeKey, Json::nullValue);
-                Json::Value nameJson = in_componentJson.get(k_componentNameKey, Json::nullValue);
+                const TValue& typeJson = in_componentJson[k_componentTypeKey];
+                const TValue& nameJson = in_componentJson[k_componentNameKey];
                 CS_ASSERT(typeJson.isString() == true, "The '" + std::string(k_componentTypeKey) + "' in component json must be a string.");
                 CS_ASSERT(nameJson.isString() == true, "The '" + std::string(k_componentNameKey) + "' in component json must be a string.");
                 
@@ -187,13 +188,13 @@ namespace ChilliSource
             ///
             /// @return The output component descriptions.
             //-------------------------------------------------------
-            std::vector<ComponentDesc> ParseComponents(const Json::Value& in_componentsJson, Core::StorageLocation in_definitionLocation, const std::string& in_definitionPath, ComponentFactory* in_componentFactory)
+            template <typename TValue> std::vector<ComponentDesc> ParseComponents(const TValue& in_componentsJson, Core::StorageLocation in_definitionLocation, const std::string& in_definitionPath, ComponentFactory* in_componentFactory)
             {
                 CS_ASSERT(in_componentsJson.isNull() == false, "Cannot parse null components json.");
                 CS_ASSERT(in_componentsJson.isArray() == true, "Components json must be an array.");
                 
                 std::vector<ComponentDesc> output;
-                for(auto& componentJson : in_componentsJson)
+                for(const auto& componentJson : in_componentsJson)
                 {
                     output.push_back(ParseComponent(componentJson, in_definitionLocation, in_definitionPath, in_componentFactory));
                 }
@@ -214,13 +215,13 @@ namespace ChilliSource
             ///
             /// @return The child widget descriptions.
             //-------------------------------------------------------
-            std::vector<WidgetDesc> ParseChildWidgets(const Json::Value& in_children, Core::StorageLocation in_definitionLocation, const std::string& in_definitionPath)
+            template <typename TValue> std::vector<WidgetDesc> ParseChildWidgets(const TValue& in_children, Core::StorageLocation in_definitionLocation, const std::string& in_definitionPath)
             {
                 std::vector<WidgetDesc> output;
                 
                 for(u32 i = 0; i < in_children.size(); ++i)
                 {
-                    const Json::Value& childJson = in_children[i];
+                    const TValue& childJson = in_children[i];
                     WidgetDesc childDesc = WidgetParserUtils::ParseWidget(childJson, in_definitionLocation, in_definitionPath);
                     output.push_back(childDesc);
                 }
@@ -291,7 +292,7 @@ namespace ChilliSource
             /// @param [Out] Default property values
             /// @param [Out] Custom property values
             //-------------------------------------------------------
-            void ParseDefaultValues(const Json::Value& in_defaults, Core::StorageLocation in_definitionLocation, const std::string& in_definitionPath, Core::PropertyMap& out_properties)
+            template <typename TValue> void ParseDefaultValues(const TValue& in_defaults, Core::StorageLocation in_definitionLocation, const std::string& in_definitionPath, Core::PropertyMap& out_properties)
             {
                 for(auto it = in_defaults.begin(); it != in_defaults.end(); ++it)
                 {
@@ -315,7 +316,7 @@ namespace ChilliSource
             ///
             /// @return The list of component property links.
             //-------------------------------------------------------
-            std::vector<PropertyLink> ParseLinkedComponentProperties(const Json::Value& in_properties, const std::vector<ComponentDesc>& in_componentDescs)
+            template <typename TValue> std::vector<PropertyLink> ParseLinkedComponentProperties(const TValue& in_properties, const std::vector<ComponentDesc>& in_componentDescs)
             {
                 const char k_componentLinkTypeAllKey[] = "all";
                 const char k_componentLinkTypeNoneKey[] = "none";
@@ -325,7 +326,7 @@ namespace ChilliSource
                 for (auto linkedComponentIt = in_properties.begin(); linkedComponentIt != in_properties.end(); ++linkedComponentIt)
                 {
                     std::string linkedComponentName = linkedComponentIt.memberName();
-                    Json::Value linkedComponentJson = (*linkedComponentIt);
+                    const TValue& linkedComponentJson = (*linkedComponentIt);
                     CS_ASSERT((linkedComponentJson.isString() == true || linkedComponentJson.isObject() == true), "A component link must be an object or a string (containing either 'all' or 'none').");
                     
                     if (linkedComponentJson.isString() == true)
@@ -356,7 +357,7 @@ namespace ChilliSource
                         for (auto linkedPropertyIt = linkedComponentJson.begin(); linkedPropertyIt != linkedComponentJson.end(); ++linkedPropertyIt)
                         {
                             std::string linkName = linkedPropertyIt.memberName();
-                            Json::Value linkedPropertyJson = (*linkedPropertyIt);
+                            const TValue& linkedPropertyJson = (*linkedPropertyIt);
                             CS_ASSERT(linkedPropertyJson.isString(), "A linked property name must be a string.");
                             
                             std::string linkedPropertyName = linkedPropertyJson.asString();
@@ -377,20 +378,20 @@ namespace ChilliSource
             ///
             /// @return The list of child links.
             //-------------------------------------------------------
-            std::vector<PropertyLink> ParseLinkedChildProperties(const Json::Value& in_properties)
+            template <typename TValue> std::vector<PropertyLink> ParseLinkedChildProperties(const TValue& in_properties)
             {
                 std::vector<PropertyLink> links;
                 
                 for (auto linkedWidgetIt = in_properties.begin(); linkedWidgetIt != in_properties.end(); ++linkedWidgetIt)
                 {
                     std::string linkedWidgetName = linkedWidgetIt.memberName();
-                    Json::Value linkedWidgetJson = (*linkedWidgetIt);
+                    const TValue& linkedWidgetJson = (*linkedWidgetIt);
                     CS_ASSERT(linkedWidgetJson.isObject() == true, "A child link must be an object.");
                     
                     for (auto linkedPropertyIt = linkedWidgetJson.begin(); linkedPropertyIt != linkedWidgetJson.end(); ++linkedPropertyIt)
                     {
                         std::string linkName = linkedPropertyIt.memberName();
-                        Json::Value linkedPropertyJson = (*linkedPropertyIt);
+                        const TValue& linkedPropertyJson = (*linkedPropertyIt);
                         CS_ASSERT(linkedPropertyJson.isString(), "A linked property name must be a string.");
                         
                         std::string linkedPropertyName = linkedPropertyJson.asString();
@@ -401,17 +402,17 @@ namespace ChilliSource
                 return links;
             }
             //-------------------------------------------------------
-            /// Performs the heavy lifting for loading a UI
-            /// widget description from file
+            /// Builds the given widget def from the root value of
+            /// either a json or compiled widget def file.
             ///
             /// @author S Downie
             ///
-            /// @param Storage location
-            /// @param File path
-            /// @param Async load delegate
-            /// @param [Out] Resource
+            /// @param The root value.
+            /// @param Definition location
+            /// @param Definition path (no file name)
+            /// @param [Out] The widget def.
             //-------------------------------------------------------
-            void LoadDesc(Core::StorageLocation in_storageLocation, const std::string& in_filepath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
+            template <typename TValue> void BuildWidgetDef(const TValue& in_root, Core::StorageLocation in_definitionLocation, const std::string& in_definitionPath, WidgetDef* out_widgetDef)
             {
                 const char k_widgetTypeKey[] = "Type";
                 const char k_widgetComponentsKey[] = "Components";
@@ -422,57 +423,38 @@ namespace ChilliSource
                 
                 ComponentFactory* componentFactory = Core::Application::Get()->GetSystem<ComponentFactory>();
                 
-                //read the json
-                Json::Value root;
-                if (Core::JsonUtils::ReadJson(in_storageLocation, in_filepath, root) == false)
-                {
-                    CS_LOG_ERROR("Cannot read widget def file: " + in_filepath);
-                    out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
-                    if(in_delegate != nullptr)
-                    {
-                        Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
-                    }
-                    return;
-                }
-                
                 //get the type
-                WidgetDef* widgetDef = (WidgetDef*)out_resource.get();
-                
-                CS_ASSERT(root.isMember(k_widgetTypeKey), "Widget def must have Type");
-                std::string typeName = root[k_widgetTypeKey].asString();
+                CS_ASSERT(in_root.isMember(k_widgetTypeKey), "Widget def must have Type");
+                std::string typeName = in_root[k_widgetTypeKey].asString();
                 
                 //parse components
-                std::string definitionFileName;
-                std::string pathToDefinition;
-                Core::StringUtils::SplitFilename(in_filepath, definitionFileName, pathToDefinition);
-            
-                const Json::Value& componentsJson = root[k_widgetComponentsKey];
+                const TValue& componentsJson = in_root[k_widgetComponentsKey];
                 std::vector<ComponentDesc> componentDescs;
                 if(componentsJson.isNull() == false)
                 {
-                    componentDescs = ParseComponents(componentsJson, in_storageLocation, pathToDefinition, componentFactory);
+                    componentDescs = ParseComponents(componentsJson, in_definitionLocation, in_definitionPath, componentFactory);
                 }
                 
                 //parse component property links
                 std::vector<PropertyLink> componentPropertyLinks;
-                const Json::Value& componentPropertiesJson = root[k_widgetComponentPropertiesKey];
+                const TValue& componentPropertiesJson = in_root[k_widgetComponentPropertiesKey];
                 if(componentPropertiesJson.isNull() == false)
                 {
                     componentPropertyLinks = ParseLinkedComponentProperties(componentPropertiesJson, componentDescs);
                 }
                 
                 //parse children
-                const Json::Value& childrenJson = root[k_widgetChildrenKey];
+                const TValue& childrenJson = in_root[k_widgetChildrenKey];
                 std::vector<WidgetDesc> childDescs;
                 if(childrenJson.isNull() == false)
                 {
                     CS_ASSERT(childrenJson.isArray() == true, "'" + std::string(k_widgetChildrenKey) + "' in a Widget Def must be an array.");
-                    childDescs = ParseChildWidgets(childrenJson, in_storageLocation, pathToDefinition);
+                    childDescs = ParseChildWidgets(childrenJson, in_definitionLocation, in_definitionPath);
                 }
                 
                 //parse child property links
                 std::vector<PropertyLink> childPropertyLinks;
-                const Json::Value& childProperties = root[k_widgetChildPropertiesKey];
+                const TValue& childProperties = in_root[k_widgetChildPropertiesKey];
                 if(childProperties.isNull() == false)
                 {
                     childPropertyLinks = ParseLinkedChildProperties(childProperties);
@@ -480,19 +462,68 @@ namespace ChilliSource
                 
                 //build the default values property map and read the default values from the json
                 Core::PropertyMap defaultProperties = BuildPropertyMap(componentDescs, componentPropertyLinks, childDescs, childPropertyLinks);
-                const Json::Value& defaults = root[k_widgetPropertyDefaultsKey];
+                const TValue& defaults = in_root[k_widgetPropertyDefaultsKey];
                 if(defaults.isNull() == false)
                 {
-                    ParseDefaultValues(defaults, in_storageLocation, pathToDefinition, defaultProperties);
+                    ParseDefaultValues(defaults, in_definitionLocation, in_definitionPath, defaultProperties);
                 }
 
                 //build the widget def.
-                widgetDef->Build(typeName, defaultProperties, componentDescs, componentPropertyLinks, childDescs, childPropertyLinks);
-                out_resource->SetLoadState(CSCore::Resource::LoadState::k_loaded);
+                out_widgetDef->Build(typeName, defaultProperties, componentDescs, componentPropertyLinks, childDescs, childPropertyLinks);
+            }
+            //-------------------------------------------------------
+            /// Performs the heavy lifting for loading a UI
+            /// widget description from file. The file may either be
+            /// a json widget def or a compiled widget file.
+            ///
+            /// @author S Downie
+            ///
+            /// @param Storage location
+            /// @param File path
+            /// @param Async load delegate
+            /// @param [Out] Resource
+            //-------------------------------------------------------
+            void LoadDesc(Core::StorageLocation in_storageLocation, const std::string& in_filepath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
+            {
+                WidgetDef* widgetDef = (WidgetDef*)out_resource.get();
+                
+                std::string definitionFileName;
+                std::string pathToDefinition;
+                Core::StringUtils::SplitFilename(in_filepath, definitionFileName, pathToDefinition);
+                
+                bool success = false;
+                if (CompiledWidgetFile::IsCompiledWidgetFile(in_storageLocation, in_filepath) == true)
+                {
+                    CompiledWidgetFileUPtr compiledFile = CompiledWidgetFile::Load(in_storageLocation, in_filepath);
+                    if (compiledFile != nullptr)
+                    {
+                        BuildWidgetDef(compiledFile->GetRoot(), in_storageLocation, pathToDefinition, widgetDef);
+                        success = true;
+                    }
+                }
+                else
+                {
+                    Json::Value root;
+                    if (Core::JsonUtils::ReadJson(in_storageLocation, in_filepath, root) == true)
+                    {
+                        BuildWidgetDef(root, in_storageLocation, pathToDefinition, widgetDef);
+                        success = true;
+                    }
+                }
+                
+                if (success == true)
+                {
+                    out_resource->SetLoadState(Core::Resource::LoadState::k_loaded);
+                }
+                else
+                {
+                    CS_LOG_ERROR("Cannot read widget def file: " + in_filepath);
+                    out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
+                }
                 
                 if(in_delegate != nullptr)
                 {
-                    CSCore::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
+                    Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
                 }
             }
         }
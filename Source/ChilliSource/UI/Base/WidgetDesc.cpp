@@ -34,8 +34,8 @@ namespace ChilliSource
     {
         //------------------------------------------------------------------
         //------------------------------------------------------------------
-        WidgetDesc::WidgetDesc(const std::string& in_type, const Core::PropertyMap& in_propertyMap, const std::vector<WidgetDesc>& in_childDescs)
-            : m_type(in_type), m_propertyMap(in_propertyMap), m_childDescs(in_childDescs)
+        WidgetDesc::WidgetDesc(const std::string& in_type, Core::PropertyMap in_propertyMap, std::vector<WidgetDesc> in_childDescs)
+            : m_type(in_type), m_propertyMap(std::move(in_propertyMap)), m_childDescs(std::move(in_childDescs))
         {
         }
         //------------------------------------------------------------------
@@ -58,7 +58,9 @@ namespace ChilliSource
             //------------------------------------------------------------------
             WidgetDesc() = default;
             //------------------------------------------------------------------
-            /// Constructor.
+            /// Constructor. The properties and child descriptions are taken by
+            /// value so that they can be moved in, avoiding a deep copy of the
+            /// whole tree for each level when a description is built bottom up.
             ///
             /// @author Ian Copland
             ///
@@ -66,7 +68,7 @@ namespace ChilliSource
             /// @param The map of properties the widget should be created with.
             /// @param The list of child widget descriptions.
             //------------------------------------------------------------------
-            WidgetDesc(const std::string& in_type, const Core::PropertyMap& in_properties, const std::vector<WidgetDesc>& in_childDescs);
+            WidgetDesc(const std::string& in_type, Core::PropertyMap in_properties, std::vector<WidgetDesc> in_childDescs);
             //------------------------------------------------------------------
             /// @author Ian Copland
             ///
@@ -39,6 +39,7 @@
 #include <ChilliSource/Rendering/Font/Font.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
+#include <ChilliSource/UI/Base/CompiledWidgetFile.h>
 #include <ChilliSource/UI/Base/PropertyTypes.h>
 #include <ChilliSource/UI/Base/Widget.h>
 #include <ChilliSource/UI/Base/WidgetDef.h>
@@ -56,180 +57,254 @@ namespace ChilliSource
 	{
         namespace WidgetParserUtils
         {
-            //-------------------------------------------------------
-            /// Loads a storage location and file path from the given
-            /// json. If a storage location is not specified this
-            /// will use the resource is considered to be relative
-            /// to the given path and location.
-            ///
-            /// @author Ian Copland
-            ///
-            /// @param The json object.
-            /// @param The relative storage location.
-            /// @param The relative directory path.
-            ///
-            /// @return a pair containing the storage location and
-            /// file path of the resource.
-            //-------------------------------------------------------
-            std::pair<Core::StorageLocation, std::string> ParseResource(const Json::Value& in_jsonValue, Core::StorageLocation in_relStorageLocation, const std::string& in_relDirectoryPath)
+            namespace
             {
-                const char k_resourceFilePathKey[] = "Path";
-                const char k_resourceLocationKey[] = "Location";
-                
-                CS_ASSERT(in_jsonValue.isObject(), "Resource json must be an object.");
-                CS_ASSERT(in_jsonValue.isMember(k_resourceFilePathKey) == true, "Resource json must contain a '" + std::string(k_resourceFilePathKey) + "' key.");
-                
-                const Json::Value& pathJson = in_jsonValue.get(k_resourceFilePathKey, Json::nullValue);
-                CS_ASSERT(pathJson.isString() == true, "'" + std::string(k_resourceFilePathKey) + "' must be a string.");
-                
-                std::string outputPath = pathJson.asString();
-                
-                Core::StorageLocation outputLocation;
-                if (in_jsonValue.isMember(k_resourceLocationKey) == true)
+                //-------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The json value.
+                ///
+                /// @return The given json value.
+                //-------------------------------------------------------
+                const Json::Value& ToJson(const Json::Value& in_jsonValue)
                 {
-                    const Json::Value& locationJson = in_jsonValue.get(k_resourceLocationKey, Json::nullValue);
-                    CS_ASSERT(locationJson.isString() == true, "'" + std::string(k_resourceLocationKey) + "' must be a string.");
-
-                    outputLocation = Core::ParseStorageLocation(locationJson.asString());
+                    return in_jsonValue;
                 }
-                else
+                //-------------------------------------------------------
+                /// @author Ian Copland
+                ///
+                /// @param The compiled value.
+                ///
+                /// @return A json value with the same contents.
+                //-------------------------------------------------------
+                Json::Value ToJson(const CompiledWidgetFile::Value& in_compiledValue)
                 {
-                    outputLocation = in_relStorageLocation;
-                    outputPath = Core::StringUtils::StandardiseDirectoryPath(in_relDirectoryPath) + outputPath;
+                    return in_compiledValue.ToJson();
                 }
+                //-------------------------------------------------------
+                /// Loads a storage location and file path from the given
+                /// json. If a storage location is not specified this
+                /// will use the resource is considered to be relative
+                /// to the given path and location.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The json object.
+                /// @param The relative storage location.
+                /// @param The relative directory path.
+                ///
+                /// @return a pair containing the storage location and
+                /// file path of the resource.
+                //-------------------------------------------------------
+                template <typename TValue> std::pair<Core::StorageLocation, std::string> ParseResourceImpl(const TValue& in_jsonValue, Core::StorageLocation in_relStorageLocation, const std::string& in_relDirectoryPath)
+                {
+                    const char k_resourceFilePathKey[] = "Path";
+                    const char k_resourceLocationKey[] = "Location";
                 
-                return std::make_pair(outputLocation, outputPath);
-            }
-            //-------------------------------------------------------
-            //-------------------------------------------------------
-            void SetProperty(const std::string& in_propertyName, const Json::Value& in_jsonValue, Core::StorageLocation in_relStorageLocation, const std::string& in_relDirectoryPath, Core::PropertyMap& out_propertyMap)
-            {
-                auto propertyType = out_propertyMap.GetType(in_propertyName);
+                    CS_ASSERT(in_jsonValue.isObject(), "Resource json must be an object.");
+                    CS_ASSERT(in_jsonValue.isMember(k_resourceFilePathKey) == true, "Resource json must contain a '" + std::string(k_resourceFilePathKey) + "' key.");
                 
-                if (propertyType == PropertyTypes::Texture())
-                {
-                    auto resourcePair = ParseResource(in_jsonValue, in_relStorageLocation, in_relDirectoryPath);
-                    auto texture = Core::Application::Get()->GetResourcePool()->LoadResource<Rendering::Texture>(resourcePair.first, resourcePair.second);
-                    out_propertyMap.SetProperty(in_propertyName, texture);
-                }
-                else if (propertyType == PropertyTypes::TextureAtlas())
-                {
-                    auto resourcePair = ParseResource(in_jsonValue, in_relStorageLocation, in_relDirectoryPath);
-                    auto textureAtlas = Core::Application::Get()->GetResourcePool()->LoadResource<Rendering::TextureAtlas>(resourcePair.first, resourcePair.second);
-                    out_propertyMap.SetProperty(in_propertyName, textureAtlas);
-                }
-                else if (propertyType == PropertyTypes::Font())
-                {
-                    auto resourcePair = ParseResource(in_jsonValue, in_relStorageLocation, in_relDirectoryPath);
-                    auto font = Core::Application::Get()->GetResourcePool()->LoadResource<Rendering::Font>(resourcePair.first, resourcePair.second);
-                    out_propertyMap.SetProperty(in_propertyName, font);
-                }
-                else if (propertyType == PropertyTypes::LocalisedText())
-                {
-                    auto resourcePair = ParseResource(in_jsonValue, in_relStorageLocation, in_relDirectoryPath);
-                    auto localisedText = Core::Application::Get()->GetResourcePool()->LoadResource<Core::LocalisedText>(resourcePair.first, resourcePair.second);
-                    out_propertyMap.SetProperty(in_propertyName, localisedText);
-                }
-                else if (propertyType == PropertyTypes::DrawableDef())
-                {
-                    CS_ASSERT(in_jsonValue.isObject(), "Value can only be specified as an object: " + in_propertyName);
-                    DrawableDefCSPtr drawableDef = DrawableDef::Create(in_jsonValue, in_relStorageLocation, in_relDirectoryPath);
-                    out_propertyMap.SetProperty(in_propertyName, drawableDef);
-                }
-                else if (propertyType == PropertyTypes::LayoutDef())
-                {
-                    CS_ASSERT(in_jsonValue.isObject(), "Value can only be specified as an object: " + in_propertyName);
-                    LayoutDefCSPtr layoutDef = LayoutDef::Create(in_jsonValue);
-                    out_propertyMap.SetProperty(in_propertyName, layoutDef);
-                }
-                else
-                {
-                    CS_ASSERT(in_jsonValue.isString(), "Value can only be specified as a string: " + in_propertyName);
-                    out_propertyMap.ParseProperty(in_propertyName, in_jsonValue.asString());
-                }
-            }
-            //-------------------------------------------------------
-            //-------------------------------------------------------
-            WidgetDesc ParseWidget(const Json::Value& in_widget, Core::StorageLocation in_templateLocation, const std::string& in_templatePath)
-            {
-                const char k_widgetTypeKey[] = "Type";
-                const char k_widgetChildrenKey[] = "Children";
-                const char k_templateTypeName[] = "Template";
-                const char k_templateFilePathKey[] = "TemplatePath";
-                const char k_templateLocationKey[] = "TemplateLocation";
+                    const TValue& pathJson = in_jsonValue[k_resourceFilePathKey];
+                    CS_ASSERT(pathJson.isString() == true, "'" + std::string(k_resourceFilePathKey) + "' must be a string.");
                 
-                CS_ASSERT(in_widget.isMember(k_widgetTypeKey) == true, "Widget must have '" + std::string(k_widgetTypeKey) + "' key.");
+                    std::string outputPath = pathJson.asString();
                 
-                std::string outputType = in_widget[k_widgetTypeKey].asString();
-                Core::PropertyMap outputProperties;
-                std::vector<WidgetDesc> outputChildren;
+                    Core::StorageLocation outputLocation;
+                    if (in_jsonValue.isMember(k_resourceLocationKey) == true)
+                    {
+                        const TValue& locationJson = in_jsonValue[k_resourceLocationKey];
+                        CS_ASSERT(locationJson.isString() == true, "'" + std::string(k_resourceLocationKey) + "' must be a string.");
+
+                        outputLocation = Core::ParseStorageLocation(locationJson.asString());
+                    }
+                    else
+                    {
+                        outputLocation = in_relStorageLocation;
+                        outputPath = Core::StringUtils::StandardiseDirectoryPath(in_relDirectoryPath) + outputPath;
+                    }
                 
-                if(outputType == k_templateTypeName)
+                    return std::make_pair(outputLocation, outputPath);
+                }
+                //-------------------------------------------------------
+                /// Sets a property in a property map from a json or
+                /// compiled value.
+                ///
+                /// @author Ian Copland
+                ///
+                /// @param The property name.
+                /// @param The value.
+                /// @param The relative storage location.
+                /// @param The relative directory path.
+                /// @param [Out] The output property map.
+                //-------------------------------------------------------
+                template <typename TValue> void SetPropertyImpl(const std::string& in_propertyName, const TValue& in_jsonValue, Core::StorageLocation in_relStorageLocation, const std::string& in_relDirectoryPath, Core::PropertyMap& out_propertyMap)
                 {
-                    //This type is a special case in which the property values are read from a separate template file
-                    CS_ASSERT(in_widget.isMember(k_templateFilePathKey), "Link to template file must have '" + std::string(k_templateFilePathKey) + "' key.");
-                    
-                    bool relativePath = in_widget.isMember(k_templateLocationKey) == false;
-                    Core::StorageLocation location = in_templateLocation;
-                    std::string path = in_widget[k_templateFilePathKey].asString();
-                    
-                    if(relativePath == false)
+                    auto propertyType = out_propertyMap.GetType(in_propertyName);
+                
+                    if (propertyType == PropertyTypes::Texture())
+                    {
+                        auto resourcePair = ParseResourceImpl(in_jsonValue, in_relStorageLocation, in_relDirectoryPath);
+                        auto texture = Core::Application::Get()->GetResourcePool()->LoadResource<Rendering::Texture>(resourcePair.first, resourcePair.second);
+                        out_propertyMap.SetProperty(in_propertyName, texture);
+                    }
+                    else if (propertyType == PropertyTypes::TextureAtlas())
+                    {
+                        auto resourcePair = ParseResourceImpl(in_jsonValue, in_relStorageLocation, in_relDirectoryPath);
+                        auto textureAtlas = Core::Application::Get()->GetResourcePool()->LoadResource<Rendering::TextureAtlas>(resourcePair.first, resourcePair.second);
+                        out_propertyMap.SetProperty(in_propertyName, textureAtlas);
+                    }
+                    else if (propertyType == PropertyTypes::Font())
+                    {
+                        auto resourcePair = ParseResourceImpl(in_jsonValue, in_relStorageLocation, in_relDirectoryPath);
+                        auto font = Core::Application::Get()->GetResourcePool()->LoadResource<Rendering::Font>(resourcePair.first, resourcePair.second);
+                        out_propertyMap.SetProperty(in_propertyName, font);
+                    }
+                    else if (propertyType == PropertyTypes::LocalisedText())
+                    {
+                        auto resourcePair = ParseResourceImpl(in_jsonValue, in_relStorageLocation, in_relDirectoryPath);
+                        auto localisedText = Core::Application::Get()->GetResourcePool()->LoadResource<Core::LocalisedText>(resourcePair.first, resourcePair.second);
+                        out_propertyMap.SetProperty(in_propertyName, localisedText);
+                    }
+                    else if (propertyType == PropertyTypes::DrawableDef())
                     {
-                        location = Core::ParseStorageLocation(in_widget[k_templateLocationKey].asString());
+                        CS_ASSERT(in_jsonValue.isObject(), "Value can only be specified as an object: " + in_propertyName);
+                        DrawableDefCSPtr drawableDef = DrawableDef::Create(ToJson(in_jsonValue), in_relStorageLocation, in_relDirectoryPath);
+                        out_propertyMap.SetProperty(in_propertyName, drawableDef);
+                    }
+                    else if (propertyType == PropertyTypes::LayoutDef())
+                    {
+                        CS_ASSERT(in_jsonValue.isObject(), "Value can only be specified as an object: " + in_propertyName);
+                        LayoutDefCSPtr layoutDef = LayoutDef::Create(ToJson(in_jsonValue));
+                        out_propertyMap.SetProperty(in_propertyName, layoutDef);
                     }
                     else
                     {
-                        path = Core::StringUtils::ResolveParentedDirectories(in_templatePath + path);
+                        CS_ASSERT(in_jsonValue.isString(), "Value can only be specified as a string: " + in_propertyName);
+                        out_propertyMap.ParseProperty(in_propertyName, in_jsonValue.asString());
                     }
-                    
-                    //Template widgets need to be created as a hierarchy so that we can set properties such as layout
-                    //on the widget without affecting the contents of the template and vice-versa.
-                    outputType = "Widget";
-                    outputProperties = Core::PropertyMap(Widget::GetPropertyDescs());
-
-                    //TODO: this will not work with async loading.
-                    WidgetTemplateCSPtr widgetTemplate = Core::Application::Get()->GetResourcePool()->LoadResource<WidgetTemplate>(location, path);
-                    outputChildren.push_back(widgetTemplate->GetWidgetDesc());
                 }
-                else
+                //-------------------------------------------------------
+                /// Parses a widget description from a json or compiled
+                /// value.
+                ///
+                /// @author S Downie
+                ///
+                /// @param The widget value.
+                /// @param Template location.
+                /// @param Template path (no file name)
+                ///
+                /// @return The output widget description.
+                //-------------------------------------------------------
+                template <typename TValue> WidgetDesc ParseWidgetImpl(const TValue& in_widget, Core::StorageLocation in_templateLocation, const std::string& in_templatePath)
                 {
-                    auto widgetFactory = Core::Application::Get()->GetWidgetFactory();
-                    WidgetDefCSPtr widgetDef = widgetFactory->GetDefinition(outputType);
-                    outputProperties = widgetDef->GetDefaultProperties();
-                }
+                    const char k_widgetTypeKey[] = "Type";
+                    const char k_widgetChildrenKey[] = "Children";
+                    const char k_templateTypeName[] = "Template";
+                    const char k_templateFilePathKey[] = "TemplatePath";
+                    const char k_templateLocationKey[] = "TemplateLocation";
                 
-                for(auto it = in_widget.begin(); it != in_widget.end(); ++it)
-                {
-                    std::string propertyName = it.memberName();
-                    
-                    //ignore template properties, children and type since they're already handled.
-                    if (propertyName != k_templateLocationKey && propertyName != k_templateFilePathKey && propertyName != k_widgetChildrenKey && propertyName != k_widgetTypeKey)
+                    CS_ASSERT(in_widget.isMember(k_widgetTypeKey) == true, "Widget must have '" + std::string(k_widgetTypeKey) + "' key.");
+                
+                    std::string outputType = in_widget[k_widgetTypeKey].asString();
+                    Core::PropertyMap outputProperties;
+                    std::vector<WidgetDesc> outputChildren;
+                
+                    if(outputType == k_templateTypeName)
                     {
-                        if (outputProperties.HasKey(propertyName) == true)
+                        //This type is a special case in which the property values are read from a separate template file
+                        CS_ASSERT(in_widget.isMember(k_templateFilePathKey), "Link to template file must have '" + std::string(k_templateFilePathKey) + "' key.");
+                    
+                        bool relativePath = in_widget.isMember(k_templateLocationKey) == false;
+                        Core::StorageLocation location = in_templateLocation;
+                        std::string path = in_widget[k_templateFilePathKey].asString();
+                    
+                        if(relativePath == false)
                         {
-                            SetProperty(propertyName, (*it), in_templateLocation, in_templatePath, outputProperties);
+                            location = Core::ParseStorageLocation(in_widget[k_templateLocationKey].asString());
                         }
                         else
                         {
-                            CS_LOG_FATAL("Property with name does not exist: " + std::string(propertyName));
+                            path = Core::StringUtils::ResolveParentedDirectories(in_templatePath + path);
                         }
+                    
+                        //Template widgets need to be created as a hierarchy so that we can set properties such as layout
+                        //on the widget without affecting the contents of the template and vice-versa.
+                        outputType = "Widget";
+                        outputProperties = Core::PropertyMap(Widget::GetPropertyDescs());
+
+                        //TODO: this will not work with async loading.
+                        WidgetTemplateCSPtr widgetTemplate = Core::Application::Get()->GetResourcePool()->LoadResource<WidgetTemplate>(location, path);
+                        outputChildren.push_back(widgetTemplate->GetWidgetDesc());
+                    }
+                    else
+                    {
+                        auto widgetFactory = Core::Application::Get()->GetWidgetFactory();
+                        WidgetDefCSPtr widgetDef = widgetFactory->GetDefinition(outputType);
+                        outputProperties = widgetDef->GetDefaultProperties();
                     }
-                }
                 
-                const Json::Value& childrenJson = in_widget.get(k_widgetChildrenKey, Json::nullValue);
-                if(childrenJson.isNull() == false)
-                {
-                    CS_ASSERT(childrenJson.isArray() == true, "The '" + std::string(k_widgetChildrenKey) + "' must be in an array.");
+                    for(auto it = in_widget.begin(); it != in_widget.end(); ++it)
+                    {
+                        std::string propertyName = it.memberName();
                     
-                    for(u32 i = 0; i < childrenJson.size(); ++i)
+                        //ignore template properties, children and type since they're already handled.
+                        if (propertyName != k_templateLocationKey && propertyName != k_templateFilePathKey && propertyName != k_widgetChildrenKey && propertyName != k_widgetTypeKey)
+                        {
+                            if (outputProperties.HasKey(propertyName) == true)
+                            {
+                                SetPropertyImpl<TValue>(propertyName, (*it), in_templateLocation, in_templatePath, outputProperties);
+                            }
+                            else
+                            {
+                                CS_LOG_FATAL("Property with name does not exist: " + std::string(propertyName));
+                            }
+                        }
+                    }
+                
+                    const TValue& childrenJson = in_widget[k_widgetChildrenKey];
+                    if(childrenJson.isNull() == false)
                     {
-                        const Json::Value& childJson = childrenJson[i];
-                        WidgetDesc childDesc = ParseWidget(childJson, in_templateLocation, in_templatePath);
-                        outputChildren.push_back(childDesc);
+                        CS_ASSERT(childrenJson.isArray() == true, "The '" + std::string(k_widgetChildrenKey) + "' must be in an array.");
+                    
+                        for(u32 i = 0; i < childrenJson.size(); ++i)
+                        {
+                            const TValue& childJson = childrenJson[i];
+                            outputChildren.push_back(ParseWidgetImpl(childJson, in_templateLocation, in_templatePath));
+                        }
                     }
-                }
                 
-                return WidgetDesc(outputType, outputProperties, outputChildren);
+                    return WidgetDesc(outputType, std::move(outputProperties), std::move(outputChildren));
+                }
+            }
+            //-------------------------------------------------------
+            //-------------------------------------------------------
+            std::pair<Core::StorageLocation, std::string> ParseResource(const Json::Value& in_jsonValue, Core::StorageLocation in_relStorageLocation, const std::string& in_relDirectoryPath)
+            {
+                return ParseResourceImpl(in_jsonValue, in_relStorageLocation, in_relDirectoryPath);
+            }
+            //-------------------------------------------------------
+            //-------------------------------------------------------
+            void SetProperty(const std::string& in_propertyName, const Json::Value& in_jsonValue, Core::StorageLocation in_relStorageLocation, const std::string& in_relDirectoryPath, Core::PropertyMap& out_propertyMap)
+            {
+                SetPropertyImpl(in_propertyName, in_jsonValue, in_relStorageLocation, in_relDirectoryPath, out_propertyMap);
+            }
+            //-------------------------------------------------------
+            //-------------------------------------------------------
+            void SetProperty(const std::string& in_propertyName, const CompiledWidgetFile::Value& in_compiledValue, Core::StorageLocation in_relStorageLocation, const std::string& in_relDirectoryPath, Core::PropertyMap& out_propertyMap)
+            {
+                SetPropertyImpl(in_propertyName, in_compiledValue, in_relStorageLocation, in_relDirectoryPath, out_propertyMap);
+            }
+            //-------------------------------------------------------
+            //-------------------------------------------------------
+            WidgetDesc ParseWidget(const Json::Value& in_widget, Core::StorageLocation in_templateLocation, const std::string& in_templatePath)
+            {
+                return ParseWidgetImpl(in_widget, in_templateLocation, in_templatePath);
+            }
+            //-------------------------------------------------------
+            //-------------------------------------------------------
+            WidgetDesc ParseWidget(const CompiledWidgetFile::Value& in_widget, Core::StorageLocation in_templateLocation, const std::string& in_templatePath)
+            {
+                return ParseWidgetImpl(in_widget, in_templateLocation, in_templatePath);
             }
         }
 	}
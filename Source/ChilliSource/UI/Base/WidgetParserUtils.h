@@ -32,6 +32,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Container/Property/PropertyMap.h>
 #include <ChilliSource/Core/File/StorageLocation.h>
+#include <ChilliSource/UI/Base/CompiledWidgetFile.h>
 
 #include <json/forwards.h>
 
@@ -70,6 +71,18 @@ namespace ChilliSource
             //-------------------------------------------------------
             void SetProperty(const std::string& in_propertyName, const Json::Value& in_jsonValue, Core::StorageLocation in_relStorageLocation, const std::string& in_relDirectoryPath, Core::PropertyMap& out_propertyMap);
             //-------------------------------------------------------
+            /// Sets a property in a property map from a value in a
+            /// compiled widget file. The value type must be a string
+            /// or an object or this will assert.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The property name.
+            /// @param The compiled value.
+            /// @param [Out] The output property map.
+            //-------------------------------------------------------
+            void SetProperty(const std::string& in_propertyName, const CompiledWidgetFile::Value& in_compiledValue, Core::StorageLocation in_relStorageLocation, const std::string& in_relDirectoryPath, Core::PropertyMap& out_propertyMap);
+            //-------------------------------------------------------
             /// From the given JSON value parse the values of the property
             /// types into the given container. Some of the properties
             /// require conversion from relative to absolute paths
@@ -84,6 +97,20 @@ namespace ChilliSource
             /// @return The output widget description.
             //-------------------------------------------------------
             WidgetDesc ParseWidget(const Json::Value& in_widget, Core::StorageLocation in_templateLocation, const std::string& in_templatePath);
+            //-------------------------------------------------------
+            /// Builds a widget description from a value in a compiled
+            /// widget file. This performs the same processing as the
+            /// json version without the cost of parsing json.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The compiled widget value.
+            /// @param Template location.
+            /// @param Template path (no file name)
+            ///
+            /// @return The output widget description.
+            //-------------------------------------------------------
+            WidgetDesc ParseWidget(const CompiledWidgetFile::Value& in_widget, Core::StorageLocation in_templateLocation, const std::string& in_templatePath);
         }
 	}
 }
@@ -0,0 +1,112 @@
+//
+//  WidgetPool.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/UI/Base/WidgetPool.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/UI/Base/Widget.h>
+#include <ChilliSource/UI/Base/WidgetFactory.h>
+#include <ChilliSource/UI/Base/WidgetTemplate.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    namespace UI
+    {
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        WidgetPool::WidgetPool(const WidgetTemplateCSPtr& in_template, u32 in_maxNumPooled)
+            : m_template(in_template), m_maxNumPooled(in_maxNumPooled)
+        {
+            CS_ASSERT(m_template != nullptr, "Cannot create a widget pool with a null template.");
+            
+            m_widgetFactory = Core::Application::Get()->GetSystem<WidgetFactory>();
+            CS_ASSERT(m_widgetFactory != nullptr, "WidgetPool is missing required system: WidgetFactory");
+            
+            m_prototype = m_widgetFactory->Create(m_template);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void WidgetPool::Reserve(u32 in_numWidgets)
+        {
+            u32 targetSize = std::min(in_numWidgets, m_maxNumPooled);
+            
+            m_pooledWidgets.reserve(targetSize);
+            while (m_pooledWidgets.size() < targetSize)
+            {
+                m_pooledWidgets.push_back(WidgetSPtr(m_widgetFactory->Create(m_template)));
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        WidgetSPtr WidgetPool::Acquire()
+        {
+            if (m_pooledWidgets.empty() == true)
+            {
+                return WidgetSPtr(m_widgetFactory->Create(m_template));
+            }
+            
+            WidgetSPtr widget = std::move(m_pooledWidgets.back());
+            m_pooledWidgets.pop_back();
+            return widget;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void WidgetPool::Release(const WidgetSPtr& in_widget)
+        {
+            CS_ASSERT(in_widget != nullptr, "Cannot release a null widget.");
+            
+            if (in_widget->GetParent() != nullptr)
+            {
+                in_widget->RemoveFromParent();
+            }
+            
+            if (m_pooledWidgets.size() >= m_maxNumPooled || in_widget->HasSameStructure(m_prototype.get()) == false)
+            {
+                return;
+            }
+            
+            in_widget->ResetToPrototype(m_prototype.get());
+            m_pooledWidgets.push_back(in_widget);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        u32 WidgetPool::GetNumPooled() const
+        {
+            return u32(m_pooledWidgets.size());
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void WidgetPool::Clear()
+        {
+            m_pooledWidgets.clear();
+        }
+    }
+}
@@ -0,0 +1,128 @@
+//
+//  WidgetPool.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_UI_BASE_WIDGETPOOL_H_
+#define _CHILLISOURCE_UI_BASE_WIDGETPOOL_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace UI
+    {
+        //----------------------------------------------------------------------------
+        /// A pool of widgets created from a single widget template. Released widgets
+        /// are detached from their parent, reset to the template defaults and kept
+        /// for reuse, avoiding the cost of building a new widget tree, with all of
+        /// its components and properties, each time one is needed. This is intended
+        /// for widgets which are frequently created and destroyed, such as the rows
+        /// of a scrolling list.
+        ///
+        /// Resetting is performed by copying the property storage of a prototype
+        /// widget tree, built from the template when the pool is created, over the
+        /// released tree. Any event connections opened on a pooled widget by the
+        /// application should be closed before it is released.
+        ///
+        /// Widget pools are not thread safe and should only be used on the main
+        /// thread.
+        ///
+        /// @author Ian Copland
+        //----------------------------------------------------------------------------
+        class WidgetPool final
+        {
+        public:
+            CS_DECLARE_NOCOPY(WidgetPool);
+            //----------------------------------------------------------------------------
+            /// Constructor.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The template which widgets in the pool are created from.
+            /// @param The maximum number of released widgets which will be kept for
+            /// reuse. Widgets released once the pool is full are destroyed.
+            //----------------------------------------------------------------------------
+            WidgetPool(const WidgetTemplateCSPtr& in_template, u32 in_maxNumPooled = 64);
+            //----------------------------------------------------------------------------
+            /// Creates widgets until the pool contains the given number, or the maximum
+            /// pool size is reached. This can be used to move the cost of creating
+            /// widgets to a convenient time, such as during a loading screen.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The number of widgets the pool should contain.
+            //----------------------------------------------------------------------------
+            void Reserve(u32 in_numWidgets);
+            //----------------------------------------------------------------------------
+            /// Gets a widget from the pool, creating a new one from the template if the
+            /// pool is empty. The widget will be in the state described by the template.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The widget.
+            //----------------------------------------------------------------------------
+            WidgetSPtr Acquire();
+            //----------------------------------------------------------------------------
+            /// Returns a widget to the pool. The widget is removed from its parent and
+            /// reset to the template defaults. The widget must have been acquired from
+            /// this pool, and no other references to it should be kept. If children have
+            /// been added to or removed from the widget, or the pool is full, the widget
+            /// is destroyed instead.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The widget to release.
+            //----------------------------------------------------------------------------
+            void Release(const WidgetSPtr& in_widget);
+            //----------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The number of widgets currently in the pool and available for
+            /// reuse.
+            //----------------------------------------------------------------------------
+            u32 GetNumPooled() const;
+            //----------------------------------------------------------------------------
+            /// Destroys all widgets currently in the pool.
+            ///
+            /// @author Ian Copland
+            //----------------------------------------------------------------------------
+            void Clear();
+
+        private:
+            WidgetTemplateCSPtr m_template;
+            WidgetFactory* m_widgetFactory = nullptr;
+            WidgetUPtr m_prototype;
+            std::vector<WidgetSPtr> m_pooledWidgets;
+            u32 m_maxNumPooled;
+        };
+    }
+}
+
+#endif
@@ -32,6 +32,7 @@
 #include <ChilliSource/Core/Container/Property/PropertyMap.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/UI/Base/CompiledWidgetFile.h>
 #include <ChilliSource/UI/Base/Widget.h>
 #include <ChilliSource/UI/Base/WidgetDesc.h>
 #include <ChilliSource/UI/Base/WidgetParserUtils.h>
@@ -49,7 +50,8 @@ namespace ChilliSource
             
             //-------------------------------------------------------
             /// Performs the heavy lifting for loading a UI
-            /// widget description from file
+            /// widget description from file. The file may either be
+            /// a json widget file or a compiled widget file.
             ///
             /// @author S Downie
             ///
@@ -60,8 +62,32 @@ namespace ChilliSource
             //-------------------------------------------------------
             void LoadDesc(Core::StorageLocation in_storageLocation, const std::string& in_filepath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
             {
-                Json::Value root;
-                if (Core::JsonUtils::ReadJson(in_storageLocation, in_filepath, root) == false)
+                std::string definitionFileName;
+                std::string pathToDefinition;
+                Core::StringUtils::SplitFilename(in_filepath, definitionFileName, pathToDefinition);
+                
+                WidgetDesc desc;
+                bool success = false;
+                if (CompiledWidgetFile::IsCompiledWidgetFile(in_storageLocation, in_filepath) == true)
+                {
+                    CompiledWidgetFileUPtr compiledFile = CompiledWidgetFile::Load(in_storageLocation, in_filepath);
+                    if (compiledFile != nullptr)
+                    {
+                        desc = WidgetParserUtils::ParseWidget(compiledFile->GetRoot(), in_storageLocation, pathToDefinition);
+                        success = true;
+                    }
+                }
+                else
+                {
+                    Json::Value root;
+                    if (Core::JsonUtils::ReadJson(in_storageLocation, in_filepath, root) == true)
+                    {
+                        desc = WidgetParserUtils::ParseWidget(root, in_storageLocation, pathToDefinition);
+                        success = true;
+                    }
+                }
+                
+                if (success == false)
                 {
                     CS_LOG_ERROR("Cannot read widget file: " + in_filepath);
                     out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
@@ -73,13 +99,6 @@ namespace ChilliSource
                 }
                 
                 WidgetTemplate* widgetTemplate = (WidgetTemplate*)out_resource.get();
-                
-                std::string definitionFileName;
-                std::string pathToDefinition;
-                Core::StringUtils::SplitFilename(in_filepath, definitionFileName, pathToDefinition);
-                
-                WidgetDesc desc = WidgetParserUtils::ParseWidget(root, in_storageLocation, pathToDefinition);
-                
                 widgetTemplate->Build(desc);
                 
                 out_resource->SetLoadState(CSCore::Resource::LoadState::k_loaded);
@@ -41,6 +41,7 @@ namespace ChilliSource
         /// Base
         //---------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(Canvas);
+        CS_FORWARDDECLARE_CLASS(CompiledWidgetFile);
         CS_FORWARDDECLARE_CLASS(Component);
         CS_FORWARDDECLARE_CLASS(ComponentDesc);
         CS_FORWARDDECLARE_CLASS(ComponentFactory);
@@ -50,6 +51,7 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(WidgetDesc);
         CS_FORWARDDECLARE_CLASS(WidgetDefProvider);
         CS_FORWARDDECLARE_CLASS(WidgetFactory);
+        CS_FORWARDDECLARE_CLASS(WidgetPool);
         CS_FORWARDDECLARE_CLASS(WidgetTemplate);
         CS_FORWARDDECLARE_CLASS(WidgetTemplateProvider);
         enum class SizePolicy;
@@ -83,6 +85,10 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(VListLayout);
         CS_FORWARDDECLARE_CLASS(VListLayoutDef);
         //---------------------------------------------------------
+        /// List
+        //---------------------------------------------------------
+        CS_FORWARDDECLARE_CLASS(VirtualListComponent);
+        //---------------------------------------------------------
         /// Progress Bar
         //---------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(ProgressBarComponent);
@@ -0,0 +1,472 @@
+//
+//  VirtualListComponent.cpp
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/UI/List/VirtualListComponent.h>
+
+#include <ChilliSource/Core/Delegate/MakeDelegate.h>
+#include <ChilliSource/Core/Container/Property/PropertyTypes.h>
+#include <ChilliSource/Core/Math/MathUtils.h>
+#include <ChilliSource/UI/Base/Widget.h>
+#include <ChilliSource/UI/Base/WidgetPool.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    namespace UI
+    {
+        namespace
+        {
+            const char k_estimatedRowSizeKey[] = "EstimatedRowSize";
+            const char k_overscanKey[] = "Overscan";
+            
+            const u32 k_maxMeasurePasses = 4;
+            
+            const std::vector<Core::PropertyMap::PropertyDesc> k_propertyDescs =
+            {
+                {Core::PropertyTypes::Float(), k_estimatedRowSizeKey},
+                {Core::PropertyTypes::Float(), k_overscanKey}
+            };
+        }
+        
+        CS_DEFINE_NAMEDTYPE(VirtualListComponent);
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        const std::vector<Core::PropertyMap::PropertyDesc>& VirtualListComponent::GetPropertyDescs()
+        {
+            return k_propertyDescs;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        VirtualListComponent::VirtualListComponent(const std::string& in_componentName, const Core::PropertyMap& in_properties)
+            : Component(in_componentName)
+        {
+            RegisterProperty<f32>(Core::PropertyTypes::Float(), k_estimatedRowSizeKey, Core::MakeDelegate(this, &VirtualListComponent::GetEstimatedRowSize), Core::MakeDelegate(this, &VirtualListComponent::SetEstimatedRowSize));
+            RegisterProperty<f32>(Core::PropertyTypes::Float(), k_overscanKey, Core::MakeDelegate(this, &VirtualListComponent::GetOverscan), Core::MakeDelegate(this, &VirtualListComponent::SetOverscan));
+            ApplyRegisteredProperties(in_properties);
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        bool VirtualListComponent::IsA(Core::InterfaceIDType in_interfaceId) const
+        {
+            return (Component::InterfaceID == in_interfaceId || VirtualListComponent::InterfaceID == in_interfaceId);
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        f32 VirtualListComponent::GetEstimatedRowSize() const
+        {
+            return m_estimatedRowSize;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        f32 VirtualListComponent::GetOverscan() const
+        {
+            return m_overscan;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::SetEstimatedRowSize(f32 in_size)
+        {
+            CS_ASSERT(in_size > 0.0f, "The estimated row size must be greater than zero.");
+            
+            m_estimatedRowSize = in_size;
+            m_rowOffsetsDirty = true;
+            m_rowsDirty = true;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::SetOverscan(f32 in_overscan)
+        {
+            CS_ASSERT(in_overscan >= 0.0f, "The overscan cannot be negative.");
+            
+            m_overscan = in_overscan;
+            m_rowsDirty = true;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::SetRowTemplate(const WidgetTemplateCSPtr& in_rowTemplate)
+        {
+            ReleaseAllRows();
+            
+            m_rowPool = (in_rowTemplate != nullptr) ? WidgetPoolUPtr(new WidgetPool(in_rowTemplate)) : nullptr;
+            m_rowsDirty = true;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::SetDataSource(const NumRowsDelegate& in_numRowsDelegate, const BindRowDelegate& in_bindRowDelegate, const RowSizeDelegate& in_rowSizeDelegate)
+        {
+            m_numRowsDelegate = in_numRowsDelegate;
+            m_bindRowDelegate = in_bindRowDelegate;
+            m_rowSizeDelegate = in_rowSizeDelegate;
+            
+            ReloadData();
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::ReloadData()
+        {
+            ReleaseAllRows();
+            
+            m_numRows = (m_numRowsDelegate != nullptr) ? m_numRowsDelegate() : 0;
+            m_rowSizes.assign(m_numRows, -1.0f);
+            m_totalMeasuredSize = 0.0f;
+            m_numMeasuredRows = 0;
+            m_rowOffsetsDirty = true;
+            m_rowsDirty = true;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::ReloadRow(u32 in_rowIndex)
+        {
+            CS_ASSERT(in_rowIndex < m_numRows, "Row index out of bounds.");
+            
+            if (m_rowSizes[in_rowIndex] >= 0.0f)
+            {
+                m_totalMeasuredSize -= m_rowSizes[in_rowIndex];
+                m_numMeasuredRows--;
+                m_rowSizes[in_rowIndex] = -1.0f;
+                m_rowOffsetsDirty = true;
+            }
+            
+            for (auto it = m_activeRows.begin(); it != m_activeRows.end(); ++it)
+            {
+                if (it->m_rowIndex == in_rowIndex)
+                {
+                    m_rowPool->Release(it->m_widget);
+                    m_activeRows.erase(it);
+                    break;
+                }
+            }
+            
+            m_rowsDirty = true;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        f32 VirtualListComponent::GetScrollPosition() const
+        {
+            return m_scrollPosition;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::SetScrollPosition(f32 in_position)
+        {
+            m_scrollPosition = in_position;
+            m_rowsDirty = true;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::ScrollToRow(u32 in_rowIndex)
+        {
+            CS_ASSERT(in_rowIndex < m_numRows, "Row index out of bounds.");
+            
+            UpdateRowOffsets();
+            SetScrollPosition(m_rowOffsets[in_rowIndex]);
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        f32 VirtualListComponent::GetContentSize()
+        {
+            UpdateRowOffsets();
+            return m_rowOffsets.back();
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        u32 VirtualListComponent::GetNumRows() const
+        {
+            return m_numRows;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        u32 VirtualListComponent::GetNumInstantiatedRows() const
+        {
+            return u32(m_activeRows.size());
+        }
+        //-------------------------------------------------------------------
+        /// Rows which haven't been measured are assumed to be the average
+        /// size of those which have, as this is typically a better estimate
+        /// than the fixed estimated size.
+        //-------------------------------------------------------------------
+        f32 VirtualListComponent::GetRowSize(u32 in_rowIndex) const
+        {
+            if (m_rowSizes[in_rowIndex] >= 0.0f)
+            {
+                return m_rowSizes[in_rowIndex];
+            }
+            
+            if (m_numMeasuredRows > 0)
+            {
+                return m_totalMeasuredSize / f32(m_numMeasuredRows);
+            }
+            
+            return m_estimatedRowSize;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::UpdateRowOffsets()
+        {
+            if (m_rowOffsetsDirty == true)
+            {
+                m_rowOffsetsDirty = false;
+                
+                m_rowOffsets.resize(m_numRows + 1);
+                m_rowOffsets[0] = 0.0f;
+                for (u32 i = 0; i < m_numRows; ++i)
+                {
+                    m_rowOffsets[i + 1] = m_rowOffsets[i] + GetRowSize(i);
+                }
+            }
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        u32 VirtualListComponent::GetRowAtOffset(f32 in_offset) const
+        {
+            CS_ASSERT(m_numRows > 0 && m_rowOffsetsDirty == false, "Cannot get row at offset without valid row offsets.");
+            
+            auto it = std::upper_bound(m_rowOffsets.begin() + 1, m_rowOffsets.end(), in_offset);
+            u32 rowIndex = u32(it - m_rowOffsets.begin()) - 1;
+            
+            return std::min(rowIndex, m_numRows - 1);
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        bool VirtualListComponent::MeasureRows(u32 in_firstRowIndex, u32 in_lastRowIndex, u32 in_anchorRowIndex)
+        {
+            if (m_rowSizeDelegate == nullptr)
+            {
+                return false;
+            }
+            
+            UpdateRowOffsets();
+            f32 anchorOffset = m_rowOffsets[in_anchorRowIndex];
+            
+            bool rowsMeasured = false;
+            for (u32 i = in_firstRowIndex; i <= in_lastRowIndex; ++i)
+            {
+                if (m_rowSizes[i] < 0.0f)
+                {
+                    f32 size = std::max(m_rowSizeDelegate(i), 0.0f);
+                    m_rowSizes[i] = size;
+                    m_totalMeasuredSize += size;
+                    m_numMeasuredRows++;
+                    rowsMeasured = true;
+                }
+            }
+            
+            if (rowsMeasured == true)
+            {
+                m_rowOffsetsDirty = true;
+                UpdateRowOffsets();
+                
+                //keep the anchor row in the same place on screen.
+                m_scrollPosition += m_rowOffsets[in_anchorRowIndex] - anchorOffset;
+            }
+            
+            return rowsMeasured;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::UpdateRows()
+        {
+            Widget* widget = GetWidget();
+            if (widget == nullptr || widget->IsOnCanvas() == false)
+            {
+                return;
+            }
+            
+            m_rowsDirty = false;
+            m_visibleSize = widget->GetFinalSize().y;
+            
+            if (m_rowPool == nullptr || m_bindRowDelegate == nullptr || m_numRows == 0)
+            {
+                ReleaseAllRows();
+                m_scrollPosition = 0.0f;
+                return;
+            }
+            
+            //find the range of rows required, measuring them as they come into view. Measuring
+            //changes row offsets, so this is repeated until the range is stable.
+            UpdateRowOffsets();
+            
+            u32 firstRowIndex = 0;
+            u32 lastRowIndex = 0;
+            for (u32 pass = 0; ; ++pass)
+            {
+                f32 maxScrollPosition = std::max(m_rowOffsets.back() - m_visibleSize, 0.0f);
+                m_scrollPosition = Core::MathUtils::Clamp(m_scrollPosition, 0.0f, maxScrollPosition);
+                
+                u32 anchorRowIndex = GetRowAtOffset(m_scrollPosition);
+                firstRowIndex = GetRowAtOffset(m_scrollPosition - m_overscan);
+                lastRowIndex = GetRowAtOffset(m_scrollPosition + m_visibleSize + m_overscan);
+                
+                if (pass == k_maxMeasurePasses)
+                {
+                    m_rowsDirty = true;
+                    break;
+                }
+                
+                if (MeasureRows(firstRowIndex, lastRowIndex, anchorRowIndex) == false)
+                {
+                    break;
+                }
+            }
+            
+            //recycle rows which are no longer in range. The active rows are kept sorted by index.
+            std::vector<ActiveRow> keptRows;
+            keptRows.reserve(m_activeRows.size());
+            for (auto& row : m_activeRows)
+            {
+                if (row.m_rowIndex < firstRowIndex || row.m_rowIndex > lastRowIndex)
+                {
+                    m_rowPool->Release(row.m_widget);
+                }
+                else
+                {
+                    keptRows.push_back(std::move(row));
+                }
+            }
+            
+            m_activeRows.clear();
+            m_activeRows.reserve(lastRowIndex - firstRowIndex + 1);
+            
+            auto keptIt = keptRows.begin();
+            for (u32 rowIndex = firstRowIndex; rowIndex <= lastRowIndex; ++rowIndex)
+            {
+                if (keptIt != keptRows.end() && keptIt->m_rowIndex == rowIndex)
+                {
+                    m_activeRows.push_back(std::move(*keptIt));
+                    ++keptIt;
+                }
+                else
+                {
+                    WidgetSPtr rowWidget = m_rowPool->Acquire();
+                    m_bindRowDelegate(rowWidget.get(), rowIndex);
+                    widget->AddWidget(rowWidget);
+                    m_activeRows.push_back(ActiveRow{rowIndex, rowWidget});
+                }
+            }
+            
+            //position the rows. Positive y is up, so rows are placed downwards from the top.
+            for (const auto& row : m_activeRows)
+            {
+                row.m_widget->SetParentalAnchor(Rendering::AlignmentAnchor::k_topCentre);
+                row.m_widget->SetOriginAnchor(Rendering::AlignmentAnchor::k_topCentre);
+                row.m_widget->SetRelativeSize(Core::Vector2(1.0f, 0.0f));
+                row.m_widget->SetAbsoluteSize(Core::Vector2(0.0f, GetRowSize(row.m_rowIndex)));
+                row.m_widget->SetRelativePosition(Core::Vector2::k_zero);
+                row.m_widget->SetAbsolutePosition(Core::Vector2(0.0f, m_scrollPosition - m_rowOffsets[row.m_rowIndex]));
+            }
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::ReleaseAllRows()
+        {
+            for (const auto& row : m_activeRows)
+            {
+                m_rowPool->Release(row.m_widget);
+            }
+            
+            m_activeRows.clear();
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::OnInit()
+        {
+            m_pressedInsideConnection = GetWidget()->GetPressedInsideEvent().OpenConnection(Core::MakeDelegate(this, &VirtualListComponent::OnPressedInside));
+            m_draggedInsideConnection = GetWidget()->GetDraggedInsideEvent().OpenConnection(Core::MakeDelegate(this, &VirtualListComponent::OnDragged));
+            m_draggedOutsideConnection = GetWidget()->GetDraggedOutsideEvent().OpenConnection(Core::MakeDelegate(this, &VirtualListComponent::OnDragged));
+            m_releasedInsideConnection = GetWidget()->GetReleasedInsideEvent().OpenConnection(Core::MakeDelegate(this, &VirtualListComponent::OnReleased));
+            m_releasedOutsideConnection = GetWidget()->GetReleasedOutsideEvent().OpenConnection(Core::MakeDelegate(this, &VirtualListComponent::OnReleased));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void VirtualListComponent::OnAddedToCanvas()
+        {
+            UpdateRows();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void VirtualListComponent::OnUpdate(f32 in_deltaTime)
+        {
+            if (m_rowsDirty == true || GetWidget()->GetFinalSize().y != m_visibleSize)
+            {
+                UpdateRows();
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void VirtualListComponent::OnPressedInside(Widget* in_widget, const Input::Pointer& in_pointer, Input::Pointer::InputType in_inputType)
+        {
+            if (m_isDragging == false && in_inputType == Input::Pointer::GetDefaultInputType())
+            {
+                m_isDragging = true;
+                m_dragPointerId = in_pointer.GetId();
+                m_dragPosition = GetWidget()->ToLocalSpace(in_pointer.GetPosition(), Rendering::AlignmentAnchor::k_middleCentre).y;
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void VirtualListComponent::OnDragged(Widget* in_widget, const Input::Pointer& in_pointer)
+        {
+            if (m_isDragging == true && m_dragPointerId == in_pointer.GetId())
+            {
+                f32 position = GetWidget()->ToLocalSpace(in_pointer.GetPosition(), Rendering::AlignmentAnchor::k_middleCentre).y;
+                SetScrollPosition(m_scrollPosition + position - m_dragPosition);
+                m_dragPosition = position;
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void VirtualListComponent::OnReleased(Widget* in_widget, const Input::Pointer& in_pointer, Input::Pointer::InputType in_inputType)
+        {
+            if (m_isDragging == true && m_dragPointerId == in_pointer.GetId())
+            {
+                m_isDragging = false;
+            }
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void VirtualListComponent::OnDestroy()
+        {
+            m_pressedInsideConnection.reset();
+            m_draggedInsideConnection.reset();
+            m_draggedOutsideConnection.reset();
+            m_releasedInsideConnection.reset();
+            m_releasedOutsideConnection.reset();
+            
+            m_activeRows.clear();
+            m_rowPool.reset();
+            m_isDragging = false;
+        }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        VirtualListComponent::~VirtualListComponent()
+        {
+        }
+    }
+}
@@ -0,0 +1,407 @@
+//
+//  VirtualListComponent.h
+//  Chilli Source
+//  Created by Ian Copland on 19/10/2015.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2015 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_UI_LIST_VIRTUALLISTCOMPONENT_H_
+#define _CHILLISOURCE_UI_LIST_VIRTUALLISTCOMPONENT_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/Property/PropertyMap.h>
+#include <ChilliSource/Core/Event/EventConnection.h>
+#include <ChilliSource/Input/Pointer/Pointer.h>
+#include <ChilliSource/UI/Base/Component.h>
+
+#include <functional>
+
+namespace ChilliSource
+{
+    namespace UI
+    {
+        //------------------------------------------------------------------------------
+        /// A logic component for a vertically scrolling list of rows which are
+        /// supplied by a data source. Unlike a list layout, only the rows which are
+        /// currently visible, plus an overscan margin above and below, exist as
+        /// widgets. As rows scroll out of view their widgets are returned to a pool and
+        /// reused for the rows scrolling into view, so the cost of the list does not
+        /// depend on the number of rows.
+        ///
+        /// Rows are created from a row widget template and are bound to the data for a
+        /// particular row index using the bind delegate. Rows can have variable sizes,
+        /// supplied by the optional row size delegate. The size of each row is requested
+        /// when it first comes into view and is cached; until then the row is assumed to
+        /// be the average size of the rows measured so far, or the estimated row size if
+        /// none have been. If the size of a row above the visible area changes, the
+        /// scroll position is adjusted so that the visible rows do not move.
+        ///
+        /// The list is scrolled by dragging inside the owning widget, or via
+        /// SetScrollPosition(). Row widgets are added as children of the owning widget,
+        /// which should not also have a layout component. Typically child clipping
+        /// should be enabled on the owning widget.
+        ///
+        /// "EstimatedRowSize": A float describing the absolute size of rows which have
+        /// not yet been measured. This defaults to 50.0.
+        ///
+        /// "Overscan": A float describing the absolute distance above and below the
+        /// visible area in which rows are also instantiated, so that rows are ready
+        /// before they scroll into view. This defaults to 100.0.
+        ///
+        /// @author Ian Copland
+        //------------------------------------------------------------------------------
+        class VirtualListComponent final : public Component
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(VirtualListComponent);
+            //------------------------------------------------------------------------------
+            /// A delegate which returns the number of rows in the data source.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @return The number of rows.
+            //------------------------------------------------------------------------------
+            using NumRowsDelegate = std::function<u32()>;
+            //------------------------------------------------------------------------------
+            /// A delegate which binds the data for a row to a row widget. This is called
+            /// each time a row widget is used to display a row. The widget will be in the
+            /// state described by the row template.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The row widget.
+            /// @param The row index.
+            //------------------------------------------------------------------------------
+            using BindRowDelegate = std::function<void(Widget* in_rowWidget, u32 in_rowIndex)>;
+            //------------------------------------------------------------------------------
+            /// A delegate which returns the absolute size of the given row.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The row index.
+            ///
+            /// @return The absolute size of the row.
+            //------------------------------------------------------------------------------
+            using RowSizeDelegate = std::function<f32(u32 in_rowIndex)>;
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The list of properties supported by a virtual list component.
+            //------------------------------------------------------------------------------
+            static const std::vector<Core::PropertyMap::PropertyDesc>& GetPropertyDescs();
+            //------------------------------------------------------------------------------
+            /// Allows querying of whether or not the component implements the interface
+            /// associated with the given interface Id. Typically this won't be called
+            /// directly, instead the templated version IsA<Interface>() should be used.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The interface Id.
+            ///
+            /// @return Whether the object implements the given interface.
+            //------------------------------------------------------------------------------
+            bool IsA(Core::InterfaceIDType in_interfaceId) const override;
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The absolute size of rows which have not yet been measured.
+            //------------------------------------------------------------------------------
+            f32 GetEstimatedRowSize() const;
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The absolute distance above and below the visible area in which rows
+            /// are also instantiated.
+            //------------------------------------------------------------------------------
+            f32 GetOverscan() const;
+            //------------------------------------------------------------------------------
+            /// Sets the absolute size of rows which have not yet been measured.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The estimated row size.
+            //------------------------------------------------------------------------------
+            void SetEstimatedRowSize(f32 in_size);
+            //------------------------------------------------------------------------------
+            /// Sets the absolute distance above and below the visible area in which rows
+            /// are also instantiated.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The overscan distance.
+            //------------------------------------------------------------------------------
+            void SetOverscan(f32 in_overscan);
+            //------------------------------------------------------------------------------
+            /// Sets the template which row widgets are created from. Any existing rows are
+            /// destroyed.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The row widget template.
+            //------------------------------------------------------------------------------
+            void SetRowTemplate(const WidgetTemplateCSPtr& in_rowTemplate);
+            //------------------------------------------------------------------------------
+            /// Sets the data source for the list. This reloads all data.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The delegate which returns the number of rows.
+            /// @param The delegate which binds row data to a row widget.
+            /// @param [Optional] The delegate which returns the size of a row. If this is
+            /// not supplied all rows will be the estimated row size.
+            //------------------------------------------------------------------------------
+            void SetDataSource(const NumRowsDelegate& in_numRowsDelegate, const BindRowDelegate& in_bindRowDelegate, const RowSizeDelegate& in_rowSizeDelegate = nullptr);
+            //------------------------------------------------------------------------------
+            /// Requeries the number of rows from the data source, discards all cached row
+            /// sizes and rebinds all visible rows. This should be called whenever rows are
+            /// added to or removed from the data source.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            void ReloadData();
+            //------------------------------------------------------------------------------
+            /// Discards the cached size of the given row and rebinds it if it is visible.
+            /// This should be called whenever the data for a single row changes.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The row index.
+            //------------------------------------------------------------------------------
+            void ReloadRow(u32 in_rowIndex);
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The absolute distance from the top of the list to the top of the
+            /// visible area.
+            //------------------------------------------------------------------------------
+            f32 GetScrollPosition() const;
+            //------------------------------------------------------------------------------
+            /// Sets the absolute distance from the top of the list to the top of the visible
+            /// area. This is clamped to the scrollable range when the rows are next updated.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The scroll position.
+            //------------------------------------------------------------------------------
+            void SetScrollPosition(f32 in_position);
+            //------------------------------------------------------------------------------
+            /// Scrolls so that the top of the given row is at the top of the visible area.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The row index.
+            //------------------------------------------------------------------------------
+            void ScrollToRow(u32 in_rowIndex);
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The total absolute size of all rows, using the estimated size for
+            /// those which have not been measured.
+            //------------------------------------------------------------------------------
+            f32 GetContentSize();
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The number of rows in the data source.
+            //------------------------------------------------------------------------------
+            u32 GetNumRows() const;
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @return The number of rows which currently exist as widgets.
+            //------------------------------------------------------------------------------
+            u32 GetNumInstantiatedRows() const;
+            //------------------------------------------------------------------------------
+            /// Destructor. Declared out of line as the row pool is only forward
+            /// declared here.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            ~VirtualListComponent();
+
+        private:
+            friend class ComponentFactory;
+            //------------------------------------------------------------------------------
+            /// A row which currently exists as a widget.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            struct ActiveRow
+            {
+                u32 m_rowIndex;
+                WidgetSPtr m_widget;
+            };
+            //------------------------------------------------------------------------------
+            /// Constructor that builds the component from key-value properties. The
+            /// properties used to create a virtual list component are described in the
+            /// class documentation.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The component name.
+            /// @param The property map.
+            //------------------------------------------------------------------------------
+            VirtualListComponent(const std::string& in_componentName, const Core::PropertyMap& in_properties);
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param The row index.
+            ///
+            /// @return The cached size of the given row, or the estimated size if the row
+            /// has not yet been measured.
+            //------------------------------------------------------------------------------
+            f32 GetRowSize(u32 in_rowIndex) const;
+            //------------------------------------------------------------------------------
+            /// Rebuilds the cached offset of each row if any row sizes have changed.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            void UpdateRowOffsets();
+            //------------------------------------------------------------------------------
+            /// @author Ian Copland
+            ///
+            /// @param An absolute offset from the top of the list.
+            ///
+            /// @return The index of the row at the given offset, clamped to the valid row
+            /// range. The row offsets must be up to date and there must be at least one row.
+            //------------------------------------------------------------------------------
+            u32 GetRowAtOffset(f32 in_offset) const;
+            //------------------------------------------------------------------------------
+            /// Measures any unmeasured rows in the given range using the row size delegate,
+            /// adjusting the scroll position so that the given anchor row does not move.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The first row index.
+            /// @param The last row index.
+            /// @param The anchor row index.
+            ///
+            /// @return Whether or not any rows were measured.
+            //------------------------------------------------------------------------------
+            bool MeasureRows(u32 in_firstRowIndex, u32 in_lastRowIndex, u32 in_anchorRowIndex);
+            //------------------------------------------------------------------------------
+            /// Creates, recycles and positions the row widgets so that exactly the visible
+            /// rows, plus the overscan margin, exist.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            void UpdateRows();
+            //------------------------------------------------------------------------------
+            /// Returns all row widgets to the pool.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            void ReleaseAllRows();
+            //------------------------------------------------------------------------------
+            /// Called when the component is first added to the owning widget.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            void OnInit() override;
+            //------------------------------------------------------------------------------
+            /// This is called when the owning widget is added to the canvas.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            void OnAddedToCanvas() override;
+            //------------------------------------------------------------------------------
+            /// Updates the rows if the scroll position, data or size of the owning widget
+            /// have changed.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The delta time.
+            //------------------------------------------------------------------------------
+            void OnUpdate(f32 in_deltaTime) override;
+            //------------------------------------------------------------------------------
+            /// Called when a pointer is pressed inside the bounds of the owning widget.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The owning widget.
+            /// @param The pointer that was pressed.
+            /// @param The type of input.
+            //------------------------------------------------------------------------------
+            void OnPressedInside(Widget* in_widget, const Input::Pointer& in_pointer, Input::Pointer::InputType in_inputType);
+            //------------------------------------------------------------------------------
+            /// Called when a pointer which was pressed inside the owning widget moves.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The owning widget.
+            /// @param The pointer that moved.
+            //------------------------------------------------------------------------------
+            void OnDragged(Widget* in_widget, const Input::Pointer& in_pointer);
+            //------------------------------------------------------------------------------
+            /// Called when a pointer which was pressed inside the owning widget is released.
+            ///
+            /// @author Ian Copland
+            ///
+            /// @param The owning widget.
+            /// @param The pointer that was released.
+            /// @param The type of input.
+            //------------------------------------------------------------------------------
+            void OnReleased(Widget* in_widget, const Input::Pointer& in_pointer, Input::Pointer::InputType in_inputType);
+            //------------------------------------------------------------------------------
+            /// Called when the owning widget is being destructed.
+            ///
+            /// @author Ian Copland
+            //------------------------------------------------------------------------------
+            void OnDestroy() override;
+            
+            f32 m_estimatedRowSize = 50.0f;
+            f32 m_overscan = 100.0f;
+            f32 m_scrollPosition = 0.0f;
+            
+            NumRowsDelegate m_numRowsDelegate;
+            BindRowDelegate m_bindRowDelegate;
+            RowSizeDelegate m_rowSizeDelegate;
+            WidgetPoolUPtr m_rowPool;
+            
+            u32 m_numRows = 0;
+            std::vector<f32> m_rowSizes;
+            std::vector<f32> m_rowOffsets;
+            f32 m_totalMeasuredSize = 0.0f;
+            u32 m_numMeasuredRows = 0;
+            bool m_rowOffsetsDirty = true;
+            bool m_rowsDirty = true;
+            f32 m_visibleSize = 0.0f;
+            
+            std::vector<ActiveRow> m_activeRows;
+            
+            bool m_isDragging = false;
+            Input::Pointer::Id m_dragPointerId = 0;
+            f32 m_dragPosition = 0.0f;
+            
+            Core::EventConnectionUPtr m_pressedInsideConnection;
+            Core::EventConnectionUPtr m_draggedInsideConnection;
+            Core::EventConnectionUPtr m_draggedOutsideConnection;
+            Core::EventConnectionUPtr m_releasedInsideConnection;
+            Core::EventConnectionUPtr m_releasedOutsideConnection;
+        };
+    }
+}
+
+#endif
@@ -232,7 +232,7 @@ namespace ChilliSource
             
             if (m_localisedText != nullptr && m_localisedText->Contains(m_localisedTextId) == true)
             {
-                m_text = m_localisedText->GetText(m_localisedTextId);
+                m_text = m_localisedText->GetTextCString(m_localisedTextId);
             }
             else
             {
@@ -250,7 +250,7 @@ namespace ChilliSource
             
             if (m_localisedText != nullptr && m_localisedText->Contains(m_localisedTextId) == true)
             {
-                m_text = m_localisedText->GetText(m_localisedTextId);
+                m_text = m_localisedText->GetTextCString(m_localisedTextId);
             }
             else
             {
@@ -273,6 +273,12 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         void TextComponent::SetText(const std::string& in_text)
         {
+            //avoid invalidating the built text when the text hasn't changed.
+            if (m_text == in_text && m_iconIndices.empty() == true)
+            {
+                return;
+            }
+            
             m_iconIndices.clear();
             m_text = in_text;
             
@@ -590,7 +596,7 @@ namespace ChilliSource
             }
             
             // Draw text
-            in_renderer->DrawText(m_cachedText.m_characters, in_transform, m_textColour * GetWidget()->GetFinalColour(), m_font->GetTexture());
+            in_renderer->DrawText(m_cachedText.m_characters, in_transform, m_textColour * GetWidget()->GetFinalColour(), m_font->GetTexture(), m_font->IsDistanceField());
             
             // Draw images
             for(const auto& iconData : m_cachedIcons)
@@ -0,0 +1,355 @@
+#!/usr/bin/python
+#
+#  compile_text_file.py
+#  Chilli Source
+#  Created by Ian Copland on 19/10/2015.
+#
+#  The MIT License (MIT)
+#
+#  Copyright (c) 2015 Tag Games Limited
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a copy
+#  of this software and associated documentation files (the "Software"), to deal
+#  in the Software without restriction, including without limitation the rights
+#  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#  copies of the Software, and to permit persons to whom the Software is
+#  furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included in
+#  all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+#  THE SOFTWARE.
+#
+
+
+
+import sys
+import json
+import re
+import struct
+
+from compile_widget_file import strip_comments
+
+#----------------------------------------------------------------------
+# Compiles one or more json localised text files (.cstext), each for
+# a different language, into a single compiled cstext file, which can
+# be used in place of the json file. Only the text for the device
+# language is loaded at runtime. The default language, which is the
+# first language given unless --default is used, is used for any keys
+# that are missing from other languages and when the device language
+# is not available.
+#
+# Optionally a C++ header can be written containing a constant for
+# the Id of each key, allowing text to be looked up without hashing
+# the key at runtime.
+#
+# Usage: python compile_text_file.py --input <language>=<json file> [--input <language>=<json file> ...]
+#        --output <compiled file> [--default <language>] [--header <header file> --namespace <namespace>]
+#
+# @author I Copland
+#----------------------------------------------------------------------
+
+FILE_FORMAT_ID = 3
+FILE_FORMAT_VERSION = 2
+ENDIANNESS_CHECK_FLAG = 9999
+JSON_FILE_VERSION = 1
+KEYS_PER_BUCKET = 4
+MAX_DISPLACEMENT = 1 << 24
+EMPTY_SLOT = 0xffffffff
+
+#----------------------------------------------------------------------
+# Calculates the Id of the given key. This must match
+# LocalisedText::CalculateKeyId().
+#
+# @author I Copland
+#
+# @param The key.
+#
+# @return The 64-bit FNV-1a hash of the key.
+#----------------------------------------------------------------------
+def calculate_key_id(key):
+    hash = 14695981039346656037
+    for byte in bytearray(key.encode("utf-8")):
+        hash ^= byte
+        hash = (hash * 1099511628211) & 0xffffffffffffffff
+    return hash
+
+#----------------------------------------------------------------------
+# The 64-bit murmur3 finaliser, used to spread the bits of a key Id.
+#
+# @author I Copland
+#
+# @param The value to mix.
+#
+# @return The mixed value.
+#----------------------------------------------------------------------
+def mix(value):
+    value ^= value >> 33
+    value = (value * 0xff51afd7ed558ccd) & 0xffffffffffffffff
+    value ^= value >> 33
+    value = (value * 0xc4ceb9fe1a85ec53) & 0xffffffffffffffff
+    value ^= value >> 33
+    return value
+
+#----------------------------------------------------------------------
+# @author I Copland
+#
+# @param The key Id.
+# @param The displacement of the key's bucket.
+# @param The number of keys.
+#
+# @return The slot the key Id is stored in.
+#----------------------------------------------------------------------
+def calculate_slot(key_id, displacement, num_keys):
+    return mix((key_id + displacement * 0x9e3779b97f4a7c15) & 0xffffffffffffffff) % num_keys
+
+#----------------------------------------------------------------------
+# Finds a displacement for each bucket such that every key maps to a
+# unique slot, using the hash and displace method. This must match
+# the hash built by LocalisedText.
+#
+# @author I Copland
+#
+# @param The sorted, unique key Ids.
+#
+# @return The displacement of each bucket and the index of the key Id
+# in each slot.
+#----------------------------------------------------------------------
+def build_perfect_hash(key_ids):
+    num_keys = len(key_ids)
+    num_buckets = max((num_keys + KEYS_PER_BUCKET - 1) // KEYS_PER_BUCKET, 1)
+
+    buckets = [[] for i in range(num_buckets)]
+    for key_index, key_id in enumerate(key_ids):
+        buckets[key_id % num_buckets].append(key_index)
+
+    displacements = [0] * num_buckets
+    slot_keys = [EMPTY_SLOT] * num_keys
+
+    for bucket_index in sorted(range(num_buckets), key=lambda index: -len(buckets[index])):
+        bucket = buckets[bucket_index]
+        if len(bucket) == 0:
+            break
+
+        for displacement in range(MAX_DISPLACEMENT):
+            slots = [calculate_slot(key_ids[key_index], displacement, num_keys) for key_index in bucket]
+            if len(set(slots)) == len(slots) and all(slot_keys[slot] == EMPTY_SLOT for slot in slots):
+                for slot, key_index in zip(slots, bucket):
+                    slot_keys[slot] = key_index
+                displacements[bucket_index] = displacement
+                break
+        else:
+            raise ValueError("Could not build the key hash.")
+
+    return displacements, slot_keys
+
+#----------------------------------------------------------------------
+# Builds the null terminated string data for the given strings.
+#
+# @author I Copland
+#
+# @param The list of strings.
+#
+# @return The offset of each string and the string data.
+#----------------------------------------------------------------------
+def build_string_data(strings):
+    offsets = []
+    data = b""
+    for string in strings:
+        encoded = string.encode("utf-8")
+        if b"\0" in encoded:
+            raise ValueError("Strings cannot contain null characters.")
+        offsets.append(len(data))
+        data += encoded + b"\0"
+    return offsets, data
+
+#----------------------------------------------------------------------
+# Writes a Chilli Source "Chunked" binary file containing the given
+# chunks.
+#
+# @author I Copland
+#
+# @param The output file path.
+# @param The list of (chunk id, chunk data) tuples.
+#----------------------------------------------------------------------
+def write_chunked_file(output_file_path, chunks):
+    header_size = 20
+    chunk_table_entry_size = 12
+
+    header = b"CSCS" + struct.pack("<IIII", ENDIANNESS_CHECK_FLAG, FILE_FORMAT_ID, FILE_FORMAT_VERSION, len(chunks))
+    chunk_table = b""
+    chunk_data = b""
+    offset = header_size + chunk_table_entry_size * len(chunks)
+    for chunk_id, data in chunks:
+        chunk_table += chunk_id.encode("ascii") + struct.pack("<II", offset + len(chunk_data), len(data))
+        chunk_data += data
+
+    with open(output_file_path, "wb") as output_file:
+        output_file.write(header + chunk_table + chunk_data)
+
+#----------------------------------------------------------------------
+# Reads the text from a json cstext file.
+#
+# @author I Copland
+#
+# @param The file path.
+#
+# @return The dictionary of keys to text.
+#----------------------------------------------------------------------
+def read_text_file(file_path):
+    with open(file_path, "rb") as input_file:
+        text = input_file.read().decode("utf-8-sig")
+
+    root = json.loads(strip_comments(text))
+    if root.get("Version") != JSON_FILE_VERSION or isinstance(root.get("Text"), dict) == False:
+        raise ValueError("Invalid cstext file: " + file_path)
+
+    return root["Text"]
+
+#----------------------------------------------------------------------
+# Writes a C++ header containing a constant for the Id of each key.
+#
+# @author I Copland
+#
+# @param The header file path.
+# @param The namespace the constants are declared in.
+# @param The sorted list of keys.
+#----------------------------------------------------------------------
+def write_key_id_header(header_file_path, namespace, keys):
+    guard = "_" + re.sub("[^A-Za-z0-9]", "_", header_file_path.replace("\\", "/").split("/")[-1]).upper() + "_"
+
+    names = {}
+    for key in keys:
+        name = "k_" + re.sub("[^A-Za-z0-9_]", "_", key)
+        if name in names:
+            raise ValueError("Keys '" + names[name] + "' and '" + key + "' have the same constant name.")
+        names[name] = key
+
+    lines = []
+    lines.append("//")
+    lines.append("// Generated by compile_text_file.py. Do not edit.")
+    lines.append("//")
+    lines.append("")
+    lines.append("#ifndef " + guard)
+    lines.append("#define " + guard)
+    lines.append("")
+    lines.append("#include <ChilliSource/Core/Localisation/LocalisedText.h>")
+    lines.append("")
+    lines.append("namespace " + namespace)
+    lines.append("{")
+    for name in sorted(names):
+        lines.append("    const ChilliSource::Core::LocalisedText::KeyId " + name + " = " + "0x%016x" % calculate_key_id(names[name]) + "ull;")
+    lines.append("}")
+    lines.append("")
+    lines.append("#endif")
+    lines.append("")
+
+    with open(header_file_path, "w") as header_file:
+        header_file.write("\n".join(lines))
+
+#----------------------------------------------------------------------
+# Compiles the given json cstext files.
+#
+# @author I Copland
+#
+# @param The list of (language, input file path) tuples.
+# @param The default language. If empty, the first language is used.
+# @param The output file path.
+# @param The header file path. May be empty.
+# @param The header namespace.
+#----------------------------------------------------------------------
+def compile_text_files(inputs, default_language, output_file_path, header_file_path, namespace):
+    languages = [language for language, file_path in inputs]
+    texts = [read_text_file(file_path) for language, file_path in inputs]
+
+    if len(default_language) == 0:
+        default_language = languages[0]
+    if default_language not in languages:
+        raise ValueError("The default language '" + default_language + "' is not one of the input languages.")
+    default_language_index = languages.index(default_language)
+
+    default_text = texts[default_language_index]
+    for language, text in zip(languages, texts):
+        if language == default_language:
+            continue
+        for key in default_text:
+            if key not in text:
+                print("Warning: '" + key + "' is missing from language '" + language + "', the default text will be used.")
+        for key in text:
+            if key not in default_text:
+                print("Warning: '" + key + "' in language '" + language + "' is not in the default language and will be ignored.")
+
+    keys = sorted(default_text.keys(), key=calculate_key_id)
+    key_ids = [calculate_key_id(key) for key in keys]
+    for i in range(1, len(key_ids)):
+        if key_ids[i] == key_ids[i - 1]:
+            raise ValueError("Keys '" + keys[i - 1] + "' and '" + keys[i] + "' have the same Id.")
+
+    displacements, slot_keys = build_perfect_hash(key_ids)
+    num_keys = len(keys)
+
+    key_offsets, key_data = build_string_data([keys[key_index] for key_index in slot_keys])
+    key_chunk = struct.pack("<II", num_keys, len(displacements))
+    key_chunk += struct.pack("<%dI" % len(displacements), *displacements)
+    for key_index in slot_keys:
+        key_chunk += struct.pack("<II", key_ids[key_index] & 0xffffffff, key_ids[key_index] >> 32)
+    key_chunk += struct.pack("<%dI" % num_keys, *key_offsets)
+    key_chunk += key_data
+
+    language_offsets, language_data = build_string_data(languages)
+    language_chunk = struct.pack("<II", len(languages), default_language_index) + struct.pack("<%dI" % len(languages), *language_offsets) + language_data
+
+    chunks = [("LANG", language_chunk), ("KEYS", key_chunk)]
+    for language_index, text in enumerate(texts):
+        text_offsets, text_data = build_string_data([text.get(keys[key_index], default_text[keys[key_index]]) for key_index in slot_keys])
+        text_chunk = struct.pack("<I", num_keys) + struct.pack("<%dI" % num_keys, *text_offsets) + text_data
+        chunks.append(("T%03d" % language_index, text_chunk))
+
+    write_chunked_file(output_file_path, chunks)
+
+    if len(header_file_path) > 0:
+        write_key_id_header(header_file_path, namespace, keys)
+
+#----------------------------------------------------------------------
+# The entry point into the script.
+#
+# @author I Copland
+#
+# @param The list of arguments.
+#----------------------------------------------------------------------
+def main(args):
+    inputs = []
+    default_language = ""
+    output_file_path = ""
+    header_file_path = ""
+    namespace = "LocalisedTextKeys"
+
+    argCount = len(args)
+    for i in range(0, argCount):
+        arg = args[i]
+
+        if (arg == "--input" or arg == "-i") and i+1 < argCount and "=" in args[i+1]:
+            language, file_path = args[i+1].split("=", 1)
+            inputs.append((language, file_path))
+        if (arg == "--default" or arg == "-d") and i+1 < argCount:
+            default_language = args[i+1]
+        if (arg == "--output" or arg == "-o") and i+1 < argCount:
+            output_file_path = args[i+1]
+        if (arg == "--header" or arg == "-h") and i+1 < argCount:
+            header_file_path = args[i+1]
+        if (arg == "--namespace" or arg == "-n") and i+1 < argCount:
+            namespace = args[i+1]
+
+    if len(inputs) > 0 and len(output_file_path) > 0:
+        compile_text_files(inputs, default_language, output_file_path, header_file_path, namespace)
+    else:
+        print("Incorrect arguments supplied.")
+
+if __name__ == "__main__":
+    main(sys.argv)
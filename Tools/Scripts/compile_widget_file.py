@@ -0,0 +1,278 @@
+#!/usr/bin/python
+#
+#  compile_widget_file.py
+#  Chilli Source
+#  Created by Ian Copland on 19/10/2015.
+#
+#  The MIT License (MIT)
+#
+#  Copyright (c) 2015 Tag Games Limited
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a copy
+#  of this software and associated documentation files (the "Software"), to deal
+#  in the Software without restriction, including without limitation the rights
+#  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#  copies of the Software, and to permit persons to whom the Software is
+#  furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included in
+#  all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+#  THE SOFTWARE.
+#
+
+
+import sys
+import json
+import struct
+
+#----------------------------------------------------------------------
+# Compiles a json widget file (.csui) or widget def file (.csuidef)
+# into the binary form read by CompiledWidgetFile. The compiled file
+# can be used in place of the json file, keeping the same extension.
+#
+# Usage: python compile_widget_file.py --input <json file> --output <compiled file>
+#
+# @author I Copland
+#----------------------------------------------------------------------
+
+FILE_FORMAT_ID = 2
+FILE_FORMAT_VERSION = 1
+ENDIANNESS_CHECK_FLAG = 9999
+NO_KEY = 0xffffffff
+
+TYPE_NULL = 0
+TYPE_BOOL = 1
+TYPE_INT = 2
+TYPE_UINT = 3
+TYPE_REAL = 4
+TYPE_STRING = 5
+TYPE_ARRAY = 6
+TYPE_OBJECT = 7
+
+#----------------------------------------------------------------------
+# Removes any single line or block comments from the given json
+# text, as these are accepted by the engine's json reader.
+#
+# @author I Copland
+#
+# @param The json text.
+#
+# @return The json text without comments.
+#----------------------------------------------------------------------
+def strip_comments(text):
+    output = []
+    i = 0
+    in_string = False
+    while i < len(text):
+        c = text[i]
+        if in_string == True:
+            output.append(c)
+            if c == "\\" and i + 1 < len(text):
+                output.append(text[i + 1])
+                i += 1
+            elif c == "\"":
+                in_string = False
+            i += 1
+        elif c == "\"":
+            in_string = True
+            output.append(c)
+            i += 1
+        elif text.startswith("//", i):
+            end = text.find("\n", i)
+            i = len(text) if end == -1 else end
+        elif text.startswith("/*", i):
+            end = text.find("*/", i + 2)
+            if end == -1:
+                raise ValueError("Unterminated block comment.")
+            i = end + 2
+        else:
+            output.append(c)
+            i += 1
+    return "".join(output)
+
+#----------------------------------------------------------------------
+# Builds the string, value and list tables for a json document. Values
+# are added before their children so a child value index is always
+# greater than that of its parent, and object members are sorted by
+# key so they can be binary searched.
+#
+# @author I Copland
+#----------------------------------------------------------------------
+class TableBuilder:
+
+    def __init__(self):
+        self.strings = []
+        self.string_indices = {}
+        self.values = []
+        self.list_entries = []
+
+    #------------------------------------------------------------------
+    # @author I Copland
+    #
+    # @param The string.
+    #
+    # @return The index of the string in the string table.
+    #------------------------------------------------------------------
+    def add_string(self, string):
+        data = string.encode("utf-8")
+        if b"\0" in data:
+            raise ValueError("Strings cannot contain null characters.")
+        if data not in self.string_indices:
+            self.string_indices[data] = len(self.strings)
+            self.strings.append(data)
+        return self.string_indices[data]
+
+    #------------------------------------------------------------------
+    # Adds the given json value, and all of its children, to the
+    # tables.
+    #
+    # @author I Copland
+    #
+    # @param The json value.
+    #
+    # @return The index of the value in the value table.
+    #------------------------------------------------------------------
+    def add_value(self, value):
+        value_index = len(self.values)
+        self.values.append(None)
+
+        if value is None:
+            self.values[value_index] = (TYPE_NULL, 0, 0)
+        elif isinstance(value, bool):
+            self.values[value_index] = (TYPE_BOOL, 1 if value == True else 0, 0)
+        elif isinstance(value, float):
+            low, high = struct.unpack("<II", struct.pack("<d", value))
+            self.values[value_index] = (TYPE_REAL, low, high)
+        elif isinstance(value, int) or (sys.version_info[0] < 3 and isinstance(value, long)):
+            if -0x80000000 <= value <= 0x7fffffff:
+                self.values[value_index] = (TYPE_INT, value & 0xffffffff, 0)
+            elif 0 <= value <= 0xffffffff:
+                self.values[value_index] = (TYPE_UINT, value, 0)
+            else:
+                low, high = struct.unpack("<II", struct.pack("<d", float(value)))
+                self.values[value_index] = (TYPE_REAL, low, high)
+        elif isinstance(value, list):
+            first_entry = len(self.list_entries)
+            self.list_entries.extend([None] * len(value))
+            self.values[value_index] = (TYPE_ARRAY, first_entry, len(value))
+            for i, child in enumerate(value):
+                self.list_entries[first_entry + i] = (NO_KEY, self.add_value(child))
+        elif isinstance(value, dict):
+            keys = sorted(value.keys(), key=lambda key: key.encode("utf-8"))
+            first_entry = len(self.list_entries)
+            self.list_entries.extend([None] * len(keys))
+            self.values[value_index] = (TYPE_OBJECT, first_entry, len(keys))
+            for i, key in enumerate(keys):
+                key_index = self.add_string(key)
+                self.list_entries[first_entry + i] = (key_index, self.add_value(value[key]))
+        else:
+            self.values[value_index] = (TYPE_STRING, self.add_string(value), 0)
+
+        return value_index
+
+    #------------------------------------------------------------------
+    # @author I Copland
+    #
+    # @return The string table chunk data.
+    #------------------------------------------------------------------
+    def build_string_chunk(self):
+        offsets = []
+        data = b""
+        for string in self.strings:
+            offsets.append(len(data))
+            data += string + b"\0"
+        return struct.pack("<I", len(self.strings)) + b"".join(struct.pack("<I", offset) for offset in offsets) + data
+
+    #------------------------------------------------------------------
+    # @author I Copland
+    #
+    # @return The value table chunk data.
+    #------------------------------------------------------------------
+    def build_value_chunk(self):
+        return struct.pack("<I", len(self.values)) + b"".join(struct.pack("<III", *value) for value in self.values)
+
+    #------------------------------------------------------------------
+    # @author I Copland
+    #
+    # @return The list table chunk data.
+    #------------------------------------------------------------------
+    def build_list_chunk(self):
+        return struct.pack("<I", len(self.list_entries)) + b"".join(struct.pack("<II", *entry) for entry in self.list_entries)
+
+#----------------------------------------------------------------------
+# Writes a Chilli Source "Chunked" binary file containing the given
+# chunks.
+#
+# @author I Copland
+#
+# @param The output file path.
+# @param The list of (chunk id, chunk data) tuples.
+#----------------------------------------------------------------------
+def write_chunked_file(output_file_path, chunks):
+    header_size = 20
+    chunk_table_entry_size = 12
+
+    header = b"CSCS" + struct.pack("<IIII", ENDIANNESS_CHECK_FLAG, FILE_FORMAT_ID, FILE_FORMAT_VERSION, len(chunks))
+    chunk_table = b""
+    chunk_data = b""
+    offset = header_size + chunk_table_entry_size * len(chunks)
+    for chunk_id, data in chunks:
+        chunk_table += chunk_id.encode("ascii") + struct.pack("<II", offset + len(chunk_data), len(data))
+        chunk_data += data
+
+    with open(output_file_path, "wb") as output_file:
+        output_file.write(header + chunk_table + chunk_data)
+
+#----------------------------------------------------------------------
+# Compiles the given json widget file.
+#
+# @author I Copland
+#
+# @param The input file path.
+# @param The output file path.
+#----------------------------------------------------------------------
+def compile_widget_file(input_file_path, output_file_path):
+    with open(input_file_path, "rb") as input_file:
+        text = input_file.read().decode("utf-8-sig")
+
+    root = json.loads(strip_comments(text))
+
+    builder = TableBuilder()
+    builder.add_value(root)
+
+    write_chunked_file(output_file_path, [("STRS", builder.build_string_chunk()), ("VALS", builder.build_value_chunk()), ("LIST", builder.build_list_chunk())])
+
+#----------------------------------------------------------------------
+# The entry point into the script.
+#
+# @author I Copland
+#
+# @param The list of arguments.
+#----------------------------------------------------------------------
+def main(args):
+    input_file_path = ""
+    output_file_path = ""
+
+    argCount = len(args)
+    for i in range(0, argCount):
+        arg = args[i]
+
+        if (arg == "--input" or arg == "-i") and i+1 < argCount:
+            input_file_path = args[i+1]
+        if (arg == "--output" or arg == "-o") and i+1 < argCount:
+            output_file_path = args[i+1]
+
+    if len(input_file_path) > 0 and len(output_file_path) > 0:
+        compile_widget_file(input_file_path, output_file_path)
+    else:
+        print("Incorrect arguments supplied.")
+
+if __name__ == "__main__":
+    main(sys.argv)